@@ -0,0 +1,797 @@
+/*
+ * Allocation bitmap functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( _MSC_VER )
+#include <intrin.h>
+#endif
+
+#include "libpff_allocation_bitmap.h"
+#include "libpff_libcerror.h"
+
+/* Creates an allocation bitmap
+ * The bitmap contains a bit for every unit of the size, where all units are initially allocated
+ * Make sure the value allocation_bitmap is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_allocation_bitmap_initialize(
+     libpff_allocation_bitmap_t **allocation_bitmap,
+     size64_t size,
+     size32_t unit_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libpff_allocation_bitmap_initialize";
+	size_t number_of_words   = 0;
+	size_t words_size        = 0;
+	uint64_t number_of_units = 0;
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( *allocation_bitmap != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid allocation bitmap value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( unit_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid unit size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_units = size / unit_size;
+
+	if( ( number_of_units / 64 ) >= ( (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_words = (size_t) ( ( number_of_units + 63 ) / 64 );
+	words_size      = sizeof( uint64_t ) * number_of_words;
+
+	*allocation_bitmap = memory_allocate_structure(
+	                      libpff_allocation_bitmap_t );
+
+	if( *allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create allocation bitmap.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *allocation_bitmap,
+	     0,
+	     sizeof( libpff_allocation_bitmap_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear allocation bitmap.",
+		 function );
+
+		memory_free(
+		 *allocation_bitmap );
+
+		*allocation_bitmap = NULL;
+
+		return( -1 );
+	}
+	if( number_of_words > 0 )
+	{
+		( *allocation_bitmap )->words = (uint64_t *) memory_allocate(
+		                                              words_size );
+
+		if( ( *allocation_bitmap )->words == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create words.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *allocation_bitmap )->words,
+		     0,
+		     words_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear words.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *allocation_bitmap )->unit_size        = unit_size;
+	( *allocation_bitmap )->number_of_units  = number_of_units;
+	( *allocation_bitmap )->number_of_words  = number_of_words;
+	( *allocation_bitmap )->number_of_ranges = 0;
+	( *allocation_bitmap )->last_range_index = -1;
+
+	return( 1 );
+
+on_error:
+	if( *allocation_bitmap != NULL )
+	{
+		if( ( *allocation_bitmap )->words != NULL )
+		{
+			memory_free(
+			 ( *allocation_bitmap )->words );
+		}
+		memory_free(
+		 *allocation_bitmap );
+
+		*allocation_bitmap = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an allocation bitmap
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_allocation_bitmap_free(
+     libpff_allocation_bitmap_t **allocation_bitmap,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_allocation_bitmap_free";
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( *allocation_bitmap != NULL )
+	{
+		if( ( *allocation_bitmap )->words != NULL )
+		{
+			memory_free(
+			 ( *allocation_bitmap )->words );
+		}
+		memory_free(
+		 *allocation_bitmap );
+
+		*allocation_bitmap = NULL;
+	}
+	return( 1 );
+}
+
+/* Determines the number of trailing zero bits of a value
+ * Returns the number of trailing zero bits or 64 if the value is 0
+ */
+uint8_t libpff_allocation_bitmap_get_number_of_trailing_zero_bits(
+         uint64_t value )
+{
+#if !defined( __GNUC__ ) && !defined( __clang__ )
+#if defined( _MSC_VER ) && defined( _M_X64 )
+	unsigned long bit_index = 0;
+#else
+	uint8_t number_of_bits  = 0;
+#endif
+#endif
+
+	if( value == 0 )
+	{
+		return( 64 );
+	}
+#if defined( __GNUC__ ) || defined( __clang__ )
+	return( (uint8_t) __builtin_ctzll( (unsigned long long) value ) );
+
+#elif defined( _MSC_VER ) && defined( _M_X64 )
+	_BitScanForward64(
+	 &bit_index,
+	 value );
+
+	return( (uint8_t) bit_index );
+#else
+	while( ( value & 0x00000000ffffffffULL ) == 0 )
+	{
+		number_of_bits += 32;
+		value         >>= 32;
+	}
+	while( ( value & 0x00000000000000ffULL ) == 0 )
+	{
+		number_of_bits += 8;
+		value         >>= 8;
+	}
+	while( ( value & 0x0000000000000001ULL ) == 0 )
+	{
+		number_of_bits += 1;
+		value         >>= 1;
+	}
+	return( number_of_bits );
+#endif
+}
+
+/* Determines the number of set bits of a value
+ * Returns the number of set bits
+ */
+uint8_t libpff_allocation_bitmap_get_number_of_set_bits(
+         uint64_t value )
+{
+#if defined( __GNUC__ ) || defined( __clang__ )
+	return( (uint8_t) __builtin_popcountll( (unsigned long long) value ) );
+#else
+	value = value - ( ( value >> 1 ) & 0x5555555555555555ULL );
+	value = ( value & 0x3333333333333333ULL ) + ( ( value >> 2 ) & 0x3333333333333333ULL );
+	value = ( value + ( value >> 4 ) ) & 0x0f0f0f0f0f0f0f0fULL;
+
+	return( (uint8_t) ( ( value * 0x0101010101010101ULL ) >> 56 ) );
+#endif
+}
+
+/* Reads the allocation bits of allocation table data
+ * The allocation table data contains a bit per unit, where the most significant bit
+ * of the first byte corresponds with the unit at the offset and a clear bit marks an unallocated unit
+ * Units beyond the end of the bitmap are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_allocation_bitmap_read_allocation_table_data(
+     libpff_allocation_bitmap_t *allocation_bitmap,
+     off64_t offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libpff_allocation_bitmap_read_allocation_table_data";
+	size_t data_offset        = 0;
+	uint64_t number_of_units  = 0;
+	uint64_t unit_index       = 0;
+	uint64_t value_64bit      = 0;
+	size_t word_index         = 0;
+	uint8_t bit_index         = 0;
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( ( offset % allocation_bitmap->unit_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > (size_t) SSIZE_MAX )
+	 || ( ( data_size % 8 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	unit_index = (uint64_t) offset / allocation_bitmap->unit_size;
+
+	while( data_offset < data_size )
+	{
+		if( unit_index >= allocation_bitmap->number_of_units )
+		{
+			break;
+		}
+		/* Convert 64 bits of allocation table data, that are stored most significant bit first
+		 * per byte, into a word where a set bit marks an unallocated unit
+		 */
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 value_64bit );
+
+		value_64bit = ( ( value_64bit >> 1 ) & 0x5555555555555555ULL ) | ( ( value_64bit & 0x5555555555555555ULL ) << 1 );
+		value_64bit = ( ( value_64bit >> 2 ) & 0x3333333333333333ULL ) | ( ( value_64bit & 0x3333333333333333ULL ) << 2 );
+		value_64bit = ( ( value_64bit >> 4 ) & 0x0f0f0f0f0f0f0f0fULL ) | ( ( value_64bit & 0x0f0f0f0f0f0f0f0fULL ) << 4 );
+		value_64bit = ~value_64bit;
+
+		number_of_units = allocation_bitmap->number_of_units - unit_index;
+
+		if( number_of_units < 64 )
+		{
+			value_64bit &= ( (uint64_t) 1 << number_of_units ) - 1;
+		}
+		word_index = (size_t) ( unit_index / 64 );
+		bit_index  = (uint8_t) ( unit_index % 64 );
+
+		allocation_bitmap->words[ word_index ] |= value_64bit << bit_index;
+
+		if( ( bit_index != 0 )
+		 && ( ( word_index + 1 ) < allocation_bitmap->number_of_words ) )
+		{
+			allocation_bitmap->words[ word_index + 1 ] |= value_64bit >> ( 64 - bit_index );
+		}
+		data_offset += 8;
+		unit_index  += 64;
+	}
+	allocation_bitmap->number_of_ranges = -1;
+	allocation_bitmap->last_range_index = -1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of (unallocated) ranges
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_allocation_bitmap_get_number_of_ranges(
+     libpff_allocation_bitmap_t *allocation_bitmap,
+     int *number_of_ranges,
+     libcerror_error_t **error )
+{
+	static char *function          = "libpff_allocation_bitmap_get_number_of_ranges";
+	uint64_t carry_bit             = 0;
+	uint64_t range_start_bits      = 0;
+	uint64_t safe_number_of_ranges = 0;
+	size_t word_index              = 0;
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_bitmap->number_of_ranges == -1 )
+	{
+		/* A range starts at every set bit that is not preceded by a set bit
+		 */
+		for( word_index = 0;
+		     word_index < allocation_bitmap->number_of_words;
+		     word_index++ )
+		{
+			range_start_bits = allocation_bitmap->words[ word_index ]
+			                 & ~( ( allocation_bitmap->words[ word_index ] << 1 ) | carry_bit );
+
+			safe_number_of_ranges += libpff_allocation_bitmap_get_number_of_set_bits(
+			                          range_start_bits );
+
+			carry_bit = allocation_bitmap->words[ word_index ] >> 63;
+		}
+		if( safe_number_of_ranges > (uint64_t) INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of ranges value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		allocation_bitmap->number_of_ranges = (int) safe_number_of_ranges;
+	}
+	*number_of_ranges = allocation_bitmap->number_of_ranges;
+
+	return( 1 );
+}
+
+/* Retrieves the next (unallocated) range at or after a specific offset
+ * If the offset is inside a range, the remainder of the range is returned
+ * Returns 1 if successful, 0 if no such range or -1 on error
+ */
+int libpff_allocation_bitmap_get_next_range(
+     libpff_allocation_bitmap_t *allocation_bitmap,
+     off64_t offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libpff_allocation_bitmap_get_next_range";
+	uint64_t range_end_unit  = 0;
+	uint64_t range_unit      = 0;
+	uint64_t value_64bit     = 0;
+	size_t word_index        = 0;
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range size.",
+		 function );
+
+		return( -1 );
+	}
+	range_unit = (uint64_t) offset / allocation_bitmap->unit_size;
+
+	if( range_unit >= allocation_bitmap->number_of_units )
+	{
+		return( 0 );
+	}
+	/* Find the first set bit at or after the unit
+	 */
+	word_index  = (size_t) ( range_unit / 64 );
+	value_64bit = allocation_bitmap->words[ word_index ] & ( ~( (uint64_t) 0 ) << ( range_unit % 64 ) );
+
+	while( value_64bit == 0 )
+	{
+		word_index++;
+
+		if( word_index >= allocation_bitmap->number_of_words )
+		{
+			return( 0 );
+		}
+		value_64bit = allocation_bitmap->words[ word_index ];
+	}
+	range_unit = ( (uint64_t) word_index * 64 )
+	           + libpff_allocation_bitmap_get_number_of_trailing_zero_bits(
+	              value_64bit );
+
+	/* Find the first clear bit after the start of the range
+	 */
+	value_64bit = ~( allocation_bitmap->words[ word_index ] ) & ( ~( (uint64_t) 0 ) << ( range_unit % 64 ) );
+
+	while( value_64bit == 0 )
+	{
+		word_index++;
+
+		if( word_index >= allocation_bitmap->number_of_words )
+		{
+			break;
+		}
+		value_64bit = ~( allocation_bitmap->words[ word_index ] );
+	}
+	if( word_index >= allocation_bitmap->number_of_words )
+	{
+		range_end_unit = allocation_bitmap->number_of_units;
+	}
+	else
+	{
+		range_end_unit = ( (uint64_t) word_index * 64 )
+		               + libpff_allocation_bitmap_get_number_of_trailing_zero_bits(
+		                  value_64bit );
+	}
+	if( range_end_unit > allocation_bitmap->number_of_units )
+	{
+		range_end_unit = allocation_bitmap->number_of_units;
+	}
+	*range_offset = (off64_t) ( range_unit * allocation_bitmap->unit_size );
+	*range_size   = (size64_t) ( ( range_end_unit - range_unit ) * allocation_bitmap->unit_size );
+
+	return( 1 );
+}
+
+/* Retrieves a specific (unallocated) range
+ * Retrieving the ranges in increasing order does not require the bitmap to be scanned from the start
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_allocation_bitmap_get_range_by_index(
+     libpff_allocation_bitmap_t *allocation_bitmap,
+     int range_index,
+     off64_t *range_offset,
+     size64_t *range_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libpff_allocation_bitmap_get_range_by_index";
+	off64_t safe_range_offset = 0;
+	size64_t safe_range_size  = 0;
+	int number_of_ranges      = 0;
+	int result                = 0;
+	int safe_range_index      = 0;
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_allocation_bitmap_get_number_of_ranges(
+	     allocation_bitmap,
+	     &number_of_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( range_index < 0 )
+	 || ( range_index >= number_of_ranges ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( allocation_bitmap->last_range_index >= 0 )
+	 && ( allocation_bitmap->last_range_index <= range_index ) )
+	{
+		safe_range_index  = allocation_bitmap->last_range_index;
+		safe_range_offset = (off64_t) ( allocation_bitmap->last_range_unit * allocation_bitmap->unit_size );
+	}
+	while( safe_range_index <= range_index )
+	{
+		result = libpff_allocation_bitmap_get_next_range(
+		          allocation_bitmap,
+		          safe_range_offset,
+		          &safe_range_offset,
+		          &safe_range_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve range: %d.",
+			 function,
+			 safe_range_index );
+
+			return( -1 );
+		}
+		if( safe_range_index == range_index )
+		{
+			break;
+		}
+		safe_range_offset += (off64_t) safe_range_size;
+		safe_range_index  += 1;
+	}
+	allocation_bitmap->last_range_index = range_index;
+	allocation_bitmap->last_range_unit  = (uint64_t) safe_range_offset / allocation_bitmap->unit_size;
+
+	*range_offset = safe_range_offset;
+	*range_size   = safe_range_size;
+
+	return( 1 );
+}
+
+/* Determines if a range overlaps with an unallocated unit
+ * Returns 1 if the range contains an unallocated unit, 0 if not or -1 on error
+ */
+int libpff_allocation_bitmap_range_is_unallocated(
+     libpff_allocation_bitmap_t *allocation_bitmap,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libpff_allocation_bitmap_range_is_unallocated";
+	uint64_t first_unit     = 0;
+	uint64_t last_unit      = 0;
+	uint64_t value_64bit    = 0;
+	size_t first_word_index = 0;
+	size_t last_word_index  = 0;
+	size_t word_index       = 0;
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) ( INT64_MAX - offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 0 );
+	}
+	first_unit = (uint64_t) offset / allocation_bitmap->unit_size;
+	last_unit  = ( (uint64_t) offset + size - 1 ) / allocation_bitmap->unit_size;
+
+	if( first_unit >= allocation_bitmap->number_of_units )
+	{
+		return( 0 );
+	}
+	if( last_unit >= allocation_bitmap->number_of_units )
+	{
+		last_unit = allocation_bitmap->number_of_units - 1;
+	}
+	first_word_index = (size_t) ( first_unit / 64 );
+	last_word_index  = (size_t) ( last_unit / 64 );
+
+	for( word_index = first_word_index;
+	     word_index <= last_word_index;
+	     word_index++ )
+	{
+		value_64bit = allocation_bitmap->words[ word_index ];
+
+		if( word_index == first_word_index )
+		{
+			value_64bit &= ~( (uint64_t) 0 ) << ( first_unit % 64 );
+		}
+		if( word_index == last_word_index )
+		{
+			value_64bit &= ~( (uint64_t) 0 ) >> ( 63 - ( last_unit % 64 ) );
+		}
+		if( value_64bit != 0 )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
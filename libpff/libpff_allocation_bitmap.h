@@ -0,0 +1,125 @@
+/*
+ * Allocation bitmap functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBPFF_ALLOCATION_BITMAP_H )
+#define _LIBPFF_ALLOCATION_BITMAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libpff_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libpff_allocation_bitmap libpff_allocation_bitmap_t;
+
+struct libpff_allocation_bitmap
+{
+	/* The unit size
+	 */
+	size32_t unit_size;
+
+	/* The number of units
+	 */
+	uint64_t number_of_units;
+
+	/* The words
+	 * A set bit marks an unallocated unit, where the least significant bit
+	 * of the first word corresponds with the first unit
+	 */
+	uint64_t *words;
+
+	/* The number of words
+	 */
+	size_t number_of_words;
+
+	/* The number of (unallocated) ranges
+	 * Contains -1 if not yet determined
+	 */
+	int number_of_ranges;
+
+	/* The index of the last retrieved range
+	 * Contains -1 if no range was retrieved
+	 */
+	int last_range_index;
+
+	/* The unit of the last retrieved range
+	 */
+	uint64_t last_range_unit;
+};
+
+int libpff_allocation_bitmap_initialize(
+     libpff_allocation_bitmap_t **allocation_bitmap,
+     size64_t size,
+     size32_t unit_size,
+     libcerror_error_t **error );
+
+int libpff_allocation_bitmap_free(
+     libpff_allocation_bitmap_t **allocation_bitmap,
+     libcerror_error_t **error );
+
+uint8_t libpff_allocation_bitmap_get_number_of_trailing_zero_bits(
+         uint64_t value );
+
+uint8_t libpff_allocation_bitmap_get_number_of_set_bits(
+         uint64_t value );
+
+int libpff_allocation_bitmap_read_allocation_table_data(
+     libpff_allocation_bitmap_t *allocation_bitmap,
+     off64_t offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libpff_allocation_bitmap_get_number_of_ranges(
+     libpff_allocation_bitmap_t *allocation_bitmap,
+     int *number_of_ranges,
+     libcerror_error_t **error );
+
+int libpff_allocation_bitmap_get_next_range(
+     libpff_allocation_bitmap_t *allocation_bitmap,
+     off64_t offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     libcerror_error_t **error );
+
+int libpff_allocation_bitmap_get_range_by_index(
+     libpff_allocation_bitmap_t *allocation_bitmap,
+     int range_index,
+     off64_t *range_offset,
+     size64_t *range_size,
+     libcerror_error_t **error );
+
+int libpff_allocation_bitmap_range_is_unallocated(
+     libpff_allocation_bitmap_t *allocation_bitmap,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBPFF_ALLOCATION_BITMAP_H ) */
+
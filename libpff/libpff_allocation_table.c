@@ -24,59 +24,45 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libpff_allocation_bitmap.h"
 #include "libpff_allocation_table.h"
 #include "libpff_checksum.h"
 #include "libpff_definitions.h"
 #include "libpff_libbfio.h"
-#include "libpff_libcdata.h"
 #include "libpff_libcerror.h"
 #include "libpff_libcnotify.h"
 
 #include "pff_allocation_table.h"
 
-/* Reads allocation table data
+/* Checks allocation table data
+ * Determines the offset and unit size of the allocation bits and validates the checksum
  * Returns 1 if successful or -1 on error
  */
-int libpff_allocation_table_read_data(
-     libcdata_range_list_t *unallocated_block_list,
+int libpff_allocation_table_check_data(
      const uint8_t *data,
      size_t data_size,
      uint8_t file_type,
+     off64_t *back_pointer_offset,
+     size32_t *allocation_block_size,
+     size_t *table_data_offset,
+     size_t *table_data_size,
      libcerror_error_t **error )
 {
-	uint8_t *table_data                = NULL;
-	static char *function              = "libpff_allocation_table_read_data";
-	size_t allocation_block_size       = 0;
+	const uint8_t *table_data          = NULL;
+	static char *function              = "libpff_allocation_table_check_data";
 	size_t allocation_table_data_size  = 0;
-	size_t unallocated_size            = 0;
-	off64_t back_pointer_offset        = 0;
-	off64_t unallocated_offset         = 0;
+	off64_t safe_back_pointer_offset   = 0;
 	uint32_t calculated_checksum       = 0;
 	uint32_t stored_checksum           = 0;
-	uint16_t table_data_index          = 0;
-	uint16_t table_data_size           = 0;
-	uint8_t allocation_table_entry     = 0;
+	uint16_t safe_table_data_size      = 0;
 	uint8_t allocation_table_type      = 0;
 	uint8_t allocation_table_type_copy = 0;
-	uint8_t bit_index                  = 0;
-	int result                         = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint64_t value_64bit               = 0;
 	uint16_t value_16bit               = 0;
 #endif
 
-	if( unallocated_block_list == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid unallocated block list.",
-		 function );
-
-		return( -1 );
-	}
 	if( data == NULL )
 	{
 		libcerror_error_set(
@@ -112,20 +98,64 @@ int libpff_allocation_table_read_data(
 
 		return( -1 );
 	}
+	if( back_pointer_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid back pointer offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table data size.",
+		 function );
+
+		return( -1 );
+	}
 	if( file_type == LIBPFF_FILE_TYPE_32BIT )
 	{
 		allocation_table_data_size = sizeof( pff_allocation_table_32bit_t );
-		table_data_size            = 496;
+		safe_table_data_size       = 496;
 	}
 	else if( file_type == LIBPFF_FILE_TYPE_64BIT )
 	{
 		allocation_table_data_size = sizeof( pff_allocation_table_64bit_t );
-		table_data_size            = 496;
+		safe_table_data_size       = 496;
 	}
 	else if( file_type == LIBPFF_FILE_TYPE_64BIT_4K_PAGE )
 	{
 		allocation_table_data_size = sizeof( pff_allocation_table_64bit_4k_page_t );
-		table_data_size            = 4072;
+		safe_table_data_size       = 4072;
 	}
 	if( data_size < allocation_table_data_size )
 	{
@@ -158,7 +188,7 @@ int libpff_allocation_table_read_data(
 
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (pff_allocation_table_32bit_t *) data )->back_pointer,
-		 back_pointer_offset );
+		 safe_back_pointer_offset );
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (pff_allocation_table_32bit_t *) data )->checksum,
 		 stored_checksum );
@@ -174,7 +204,7 @@ int libpff_allocation_table_read_data(
 		 stored_checksum );
 		byte_stream_copy_to_uint64_little_endian(
 		 ( (pff_allocation_table_64bit_t *) data )->back_pointer,
-		 back_pointer_offset );
+		 safe_back_pointer_offset );
 	}
 	else if( file_type == LIBPFF_FILE_TYPE_64BIT_4K_PAGE )
 	{
@@ -187,7 +217,7 @@ int libpff_allocation_table_read_data(
 		 stored_checksum );
 		byte_stream_copy_to_uint64_little_endian(
 		 ( (pff_allocation_table_64bit_4k_page_t *) data )->back_pointer,
-		 back_pointer_offset );
+		 safe_back_pointer_offset );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -214,7 +244,7 @@ int libpff_allocation_table_read_data(
 			libcnotify_printf(
 			 "%s: back pointer\t\t\t\t: %" PRIu64 "\n",
 			 function,
-			 back_pointer_offset );
+			 safe_back_pointer_offset );
 
 			libcnotify_printf(
 			 "%s: checksum\t\t\t\t: 0x%" PRIx32 "\n",
@@ -249,7 +279,7 @@ int libpff_allocation_table_read_data(
 			libcnotify_printf(
 			 "%s: back pointer\t\t\t\t: %" PRIu64 "\n",
 			 function,
-			 back_pointer_offset );
+			 safe_back_pointer_offset );
 
 			if( file_type == LIBPFF_FILE_TYPE_64BIT_4K_PAGE )
 			{
@@ -270,7 +300,7 @@ int libpff_allocation_table_read_data(
 	if( libpff_checksum_calculate_weak_crc32(
 	     &calculated_checksum,
 	     table_data,
-	     (size_t) table_data_size,
+	     (size_t) safe_table_data_size,
 	     0,
 	     error ) != 1 )
 	{
@@ -339,105 +369,26 @@ int libpff_allocation_table_read_data(
 
 			goto on_error;
 		}
-		allocation_block_size = 512;
-		back_pointer_offset  -= 0x200;
+		*allocation_block_size    = 512;
+		safe_back_pointer_offset -= 0x200;
 	}
 	else if( allocation_table_type == LIBPFF_ALLOCATION_TABLE_TYPE_DATA )
 	{
-		allocation_block_size = 64;
-	}
-	for( table_data_index = 0;
-	     table_data_index < table_data_size;
-	     table_data_index++ )
-	{
-		allocation_table_entry = table_data[ table_data_index ];
-
-		for( bit_index = 0;
-		     bit_index < 8;
-		     bit_index++ )
-		{
-			if( ( allocation_table_entry & 0x80 ) == 0 )
-			{
-				if( unallocated_size == 0 )
-				{
-					unallocated_offset = back_pointer_offset;
-				}
-				unallocated_size += allocation_block_size;
-			}
-			else if( unallocated_size > 0 )
-			{
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: unallocated block: 0x%08" PRIx64 " - 0x%08" PRIx64 " (%" PRIu64 ")\n",
-					 function,
-					 unallocated_offset,
-					 unallocated_offset + unallocated_size,
-					 unallocated_size );
-				}
-#endif
-				result = libcdata_range_list_insert_range(
-				          unallocated_block_list,
-				          unallocated_offset,
-				          unallocated_size,
-				          NULL,
-				          NULL,
-				          NULL,
-				          error );
-
-				if( result == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append unallocated block to list.",
-					 function );
-
-					goto on_error;
-				}
-				unallocated_size = 0;
-			}
-			allocation_table_entry <<= 1;
-
-			back_pointer_offset += allocation_block_size;
-		}
-	}
-	if( unallocated_size > 0 )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		/* In 4k page files every bit of a data allocation table represents 512 bytes
+		 */
+		if( file_type == LIBPFF_FILE_TYPE_64BIT_4K_PAGE )
 		{
-			libcnotify_printf(
-			 "%s: unallocated block: 0x%08" PRIx64 " - 0x%08" PRIx64 " (%" PRIu64 ")\n",
-			 function,
-			 unallocated_offset,
-			 unallocated_offset + unallocated_size,
-			 unallocated_size );
+			*allocation_block_size = 512;
 		}
-#endif
-		result = libcdata_range_list_insert_range(
-		          unallocated_block_list,
-		          unallocated_offset,
-		          unallocated_size,
-		          NULL,
-		          NULL,
-		          NULL,
-		          error );
-
-		if( result == -1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append unallocated block to list.",
-			 function );
-
-			goto on_error;
+			*allocation_block_size = 64;
 		}
 	}
+	*back_pointer_offset = safe_back_pointer_offset;
+	*table_data_offset   = (size_t) ( table_data - data );
+	*table_data_size     = (size_t) safe_table_data_size;
+
 	return( 1 );
 
 on_error:
@@ -445,11 +396,133 @@ on_error:
 	return( -1 );
 }
 
+/* Reads allocation table data
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_allocation_table_read_data(
+     libpff_allocation_bitmap_t *allocation_bitmap,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t file_type,
+     libcerror_error_t **error )
+{
+	static char *function          = "libpff_allocation_table_read_data";
+	size_t table_data_offset       = 0;
+	size_t table_data_size         = 0;
+	off64_t back_pointer_offset    = 0;
+	size32_t allocation_block_size = 0;
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_allocation_table_check_data(
+	     data,
+	     data_size,
+	     file_type,
+	     &back_pointer_offset,
+	     &allocation_block_size,
+	     &table_data_offset,
+	     &table_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to check allocation table data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_allocation_table_set_allocation_bitmap(
+	     allocation_bitmap,
+	     back_pointer_offset,
+	     allocation_block_size,
+	     &( data[ table_data_offset ] ),
+	     table_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the allocation bitmap from the allocation bits of checked allocation table data
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_allocation_table_set_allocation_bitmap(
+     libpff_allocation_bitmap_t *allocation_bitmap,
+     off64_t back_pointer_offset,
+     size32_t allocation_block_size,
+     const uint8_t *table_data,
+     size_t table_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_allocation_table_set_allocation_bitmap";
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_bitmap->unit_size != allocation_block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: mismatch in allocation bitmap unit size ( %" PRIu32 " != %" PRIu32 " ).",
+		 function,
+		 allocation_bitmap->unit_size,
+		 allocation_block_size );
+
+		return( -1 );
+	}
+	if( libpff_allocation_bitmap_read_allocation_table_data(
+	     allocation_bitmap,
+	     back_pointer_offset,
+	     table_data,
+	     table_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to read allocation table data into allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Reads an allocation table
  * Returns 1 if successful or -1 on error
  */
 int libpff_allocation_table_read_file_io_handle(
-     libcdata_range_list_t *unallocated_block_list,
+     libpff_allocation_bitmap_t *allocation_bitmap,
      libbfio_handle_t *file_io_handle,
      off64_t allocation_table_offset,
      uint8_t file_type,
@@ -460,13 +533,13 @@ int libpff_allocation_table_read_file_io_handle(
 	size_t allocation_table_data_size = 0;
 	ssize_t read_count                = 0;
 
-	if( unallocated_block_list == NULL )
+	if( allocation_bitmap == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid unallocated block list.",
+		 "%s: invalid allocation bitmap.",
 		 function );
 
 		return( -1 );
@@ -552,7 +625,7 @@ int libpff_allocation_table_read_file_io_handle(
 		goto on_error;
 	}
 	if( libpff_allocation_table_read_data(
-	     unallocated_block_list,
+	     allocation_bitmap,
 	     allocation_table_data,
 	     allocation_table_data_size,
 	     file_type,
@@ -583,3 +656,217 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the allocation tables that are stored at a fixed distance of each other
+ * The allocation tables are read and checked one at a time, since the file IO handle
+ * cannot be shared between threads and the allocation tables are too far apart to read
+ * several of them with a single read
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_allocation_table_read_tables_file_io_handle(
+     libpff_allocation_bitmap_t *allocation_bitmap,
+     libbfio_handle_t *file_io_handle,
+     off64_t allocation_table_offset,
+     size64_t allocation_block_size,
+     size64_t file_size,
+     uint8_t file_type,
+     libcerror_error_t **error )
+{
+	uint8_t *allocation_table_data    = NULL;
+	static char *function             = "libpff_allocation_table_read_tables_file_io_handle";
+	size_t allocation_table_data_size = 0;
+	size_t table_data_offset          = 0;
+	size_t table_data_size            = 0;
+	ssize_t read_count                = 0;
+	size32_t table_block_size         = 0;
+	off64_t back_pointer_offset       = 0;
+
+	if( allocation_bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_table_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid allocation table offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( allocation_block_size == 0 )
+	 || ( allocation_block_size > (size64_t) INT64_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid file size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_type != LIBPFF_FILE_TYPE_32BIT )
+	 && ( file_type != LIBPFF_FILE_TYPE_64BIT )
+	 && ( file_type != LIBPFF_FILE_TYPE_64BIT_4K_PAGE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type == LIBPFF_FILE_TYPE_32BIT )
+	{
+		allocation_table_data_size = sizeof( pff_allocation_table_32bit_t );
+	}
+	else if( file_type == LIBPFF_FILE_TYPE_64BIT )
+	{
+		allocation_table_data_size = sizeof( pff_allocation_table_64bit_t );
+	}
+	else if( file_type == LIBPFF_FILE_TYPE_64BIT_4K_PAGE )
+	{
+		allocation_table_data_size = sizeof( pff_allocation_table_64bit_4k_page_t );
+	}
+	if( allocation_table_offset >= (off64_t) file_size )
+	{
+		return( 1 );
+	}
+	allocation_table_data = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * allocation_table_data_size );
+
+	if( allocation_table_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create allocation table data.",
+		 function );
+
+		goto on_error;
+	}
+	while( allocation_table_offset < (off64_t) file_size )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading allocation table at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 allocation_table_offset,
+			 allocation_table_offset );
+		}
+#endif
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              allocation_table_data,
+		              allocation_table_data_size,
+		              allocation_table_offset,
+		              error );
+
+		if( read_count != (ssize_t) allocation_table_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read allocation table data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 allocation_table_offset,
+			 allocation_table_offset );
+
+			goto on_error;
+		}
+		if( libpff_allocation_table_check_data(
+		     allocation_table_data,
+		     allocation_table_data_size,
+		     file_type,
+		     &back_pointer_offset,
+		     &table_block_size,
+		     &table_data_offset,
+		     &table_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read allocation table at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 allocation_table_offset,
+			 allocation_table_offset );
+
+			goto on_error;
+		}
+		if( libpff_allocation_table_set_allocation_bitmap(
+		     allocation_bitmap,
+		     back_pointer_offset,
+		     table_block_size,
+		     &( allocation_table_data[ table_data_offset ] ),
+		     table_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set allocation bitmap of allocation table at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 allocation_table_offset,
+			 allocation_table_offset );
+
+			goto on_error;
+		}
+		if( allocation_block_size >= ( file_size - (size64_t) allocation_table_offset ) )
+		{
+			break;
+		}
+		allocation_table_offset += (off64_t) allocation_block_size;
+	}
+	memory_free(
+	 allocation_table_data );
+
+	return( 1 );
+
+on_error:
+	if( allocation_table_data != NULL )
+	{
+		memory_free(
+		 allocation_table_data );
+	}
+	return( -1 );
+}
@@ -25,25 +25,52 @@
 #include <common.h>
 #include <types.h>
 
+#include "libpff_allocation_bitmap.h"
 #include "libpff_libbfio.h"
-#include "libpff_libcdata.h"
 #include "libpff_libcerror.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+int libpff_allocation_table_check_data(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t file_type,
+     off64_t *back_pointer_offset,
+     size32_t *allocation_block_size,
+     size_t *table_data_offset,
+     size_t *table_data_size,
+     libcerror_error_t **error );
+
 int libpff_allocation_table_read_data(
-     libcdata_range_list_t *unallocated_block_list,
+     libpff_allocation_bitmap_t *allocation_bitmap,
      const uint8_t *data,
      size_t data_size,
      uint8_t file_type,
      libcerror_error_t **error );
 
+int libpff_allocation_table_set_allocation_bitmap(
+     libpff_allocation_bitmap_t *allocation_bitmap,
+     off64_t back_pointer_offset,
+     size32_t allocation_block_size,
+     const uint8_t *table_data,
+     size_t table_data_size,
+     libcerror_error_t **error );
+
 int libpff_allocation_table_read_file_io_handle(
-     libcdata_range_list_t *unallocated_block_list,
+     libpff_allocation_bitmap_t *allocation_bitmap,
+     libbfio_handle_t *file_io_handle,
+     off64_t allocation_table_offset,
+     uint8_t file_type,
+     libcerror_error_t **error );
+
+int libpff_allocation_table_read_tables_file_io_handle(
+     libpff_allocation_bitmap_t *allocation_bitmap,
      libbfio_handle_t *file_io_handle,
      off64_t allocation_table_offset,
+     size64_t allocation_block_size,
+     size64_t file_size,
      uint8_t file_type,
      libcerror_error_t **error );
 
@@ -26,6 +26,7 @@
 
 #include "libpff_attached_file_io_handle.h"
 #include "libpff_attachment.h"
+#include "libpff_data_block.h"
 #include "libpff_debug.h"
 #include "libpff_definitions.h"
 #include "libpff_item.h"
@@ -659,6 +660,560 @@ off64_t libpff_attachment_data_seek_offset(
 	return( offset );
 }
 
+/* Writes the attachment data using a write callback function
+ * The data is passed to the callback directly from the data block buffers
+ * or the record entry value data, without copying it into an intermediate buffer
+ * The callback should return the number of bytes written or -1 on error,
+ * an error set by the callback is included in the error of this function
+ * The attachment data offset used by libpff_attachment_data_read_buffer is not changed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libpff_attachment_data_write_to_callback(
+     libpff_item_t *attachment,
+     ssize_t (*write_callback)(
+              intptr_t *callback_data,
+              const uint8_t *buffer,
+              size_t buffer_size,
+              libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libpff_data_block_t *data_block       = NULL;
+	libpff_internal_item_t *internal_item = NULL;
+	libpff_record_entry_t *record_entry   = NULL;
+	uint8_t *value_data                   = NULL;
+	static char *function                 = "libpff_attachment_data_write_to_callback";
+	size_t value_data_size                = 0;
+	ssize_t write_count                   = 0;
+	uint32_t value_type                   = 0;
+	int element_index                     = 0;
+	int number_of_elements                = 0;
+	int result                            = 0;
+
+	if( attachment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attachment.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) attachment;
+
+	if( write_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write callback.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_item_values_get_record_entry_by_type(
+	          internal_item->item_values,
+	          internal_item->name_to_id_map_list,
+	          internal_item->io_handle,
+	          internal_item->file_io_handle,
+	          internal_item->offsets_index,
+	          0,
+	          LIBPFF_ENTRY_TYPE_ATTACHMENT_DATA_OBJECT,
+	          0,
+	          &record_entry,
+	          LIBPFF_ENTRY_VALUE_FLAG_MATCH_ANY_VALUE_TYPE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libpff_record_entry_get_value_type(
+	     record_entry,
+	     &value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		return( -1 );
+	}
+	/* The OLE attachment method could refer to an OLE embedded object
+	 */
+	if( value_type == LIBPFF_VALUE_TYPE_OBJECT )
+	{
+		if( internal_item->embedded_object_data_stream == NULL )
+		{
+			if( libpff_internal_item_get_embedded_object_data(
+			     internal_item,
+			     record_entry,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve embedded object data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libfdata_list_get_number_of_elements(
+		     internal_item->embedded_object_data_list,
+		     &number_of_elements,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of embedded object data list elements.",
+			 function );
+
+			return( -1 );
+		}
+		/* The data blocks are read through the cache of the embedded object data stream
+		 * hence data arrays benefit from read-ahead and the block buffers are reused
+		 */
+		for( element_index = 0;
+		     element_index < number_of_elements;
+		     element_index++ )
+		{
+			if( libfdata_list_get_element_value_by_index(
+			     internal_item->embedded_object_data_list,
+			     (intptr_t *) internal_item->file_io_handle,
+			     (libfdata_cache_t *) internal_item->embedded_object_data_cache,
+			     element_index,
+			     (intptr_t **) &data_block,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data block: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			if( data_block == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing data block: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			if( data_block->uncompressed_data_size == 0 )
+			{
+				continue;
+			}
+			write_count = write_callback(
+			               callback_data,
+			               data_block->data,
+			               (size_t) data_block->uncompressed_data_size,
+			               error );
+
+			if( write_count != (ssize_t) data_block->uncompressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write data block: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+		}
+	}
+	else
+	{
+		if( libpff_record_entry_get_value_data(
+		     record_entry,
+		     &value_data,
+		     &value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value data.",
+			 function );
+
+			return( -1 );
+		}
+		/* The value data is written with a single call since it is already in memory
+		 */
+		if( ( value_data != NULL )
+		 && ( value_data_size > 0 ) )
+		{
+			write_count = write_callback(
+			               callback_data,
+			               value_data,
+			               value_data_size,
+			               error );
+
+			if( write_count != (ssize_t) value_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write value data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of attachment data extents
+ * The data extents are the ranges of the file that contain the attachment data as-is,
+ * they are only available if the file is not encrypted, the data is not compressed,
+ * validated without a mismatch and decryption was not forced
+ * The data blocks of embedded object data are read on the first call to validate them
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libpff_attachment_get_number_of_data_extents(
+     libpff_item_t *attachment,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	libpff_internal_item_t *internal_item = NULL;
+	libpff_record_entry_t *record_entry   = NULL;
+	static char *function                 = "libpff_attachment_get_number_of_data_extents";
+	uint32_t value_type                   = 0;
+	int result                            = 0;
+
+	if( attachment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attachment.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) attachment;
+
+	result = libpff_item_values_get_record_entry_by_type(
+	          internal_item->item_values,
+	          internal_item->name_to_id_map_list,
+	          internal_item->io_handle,
+	          internal_item->file_io_handle,
+	          internal_item->offsets_index,
+	          0,
+	          LIBPFF_ENTRY_TYPE_ATTACHMENT_DATA_OBJECT,
+	          0,
+	          &record_entry,
+	          LIBPFF_ENTRY_VALUE_FLAG_MATCH_ANY_VALUE_TYPE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libpff_record_entry_get_value_type(
+		     record_entry,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+		/* The OLE attachment method could refer to an OLE embedded object
+		 */
+		if( value_type == LIBPFF_VALUE_TYPE_OBJECT )
+		{
+			if( internal_item->embedded_object_data_stream == NULL )
+			{
+				if( libpff_internal_item_get_embedded_object_data(
+				     internal_item,
+				     record_entry,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve embedded object data.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( number_of_extents == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+				 "%s: invalid number of extents.",
+				 function );
+
+				return( -1 );
+			}
+			result = libpff_internal_item_get_embedded_object_data_extents(
+			          internal_item,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve embedded object data extents.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				*number_of_extents = internal_item->number_of_embedded_object_data_extents;
+			}
+		}
+		else
+		{
+			result = libpff_record_entry_get_number_of_data_extents(
+			          record_entry,
+			          number_of_extents,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of value data extents.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( result );
+}
+
+/* Retrieves a specific attachment data extent
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libpff_attachment_get_data_extent_by_index(
+     libpff_item_t *attachment,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libcerror_error_t **error )
+{
+	libpff_internal_item_t *internal_item = NULL;
+	libpff_record_entry_t *record_entry   = NULL;
+	static char *function                 = "libpff_attachment_get_data_extent_by_index";
+	uint32_t value_type                   = 0;
+	int result                            = 0;
+
+	if( attachment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attachment.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) attachment;
+
+	result = libpff_item_values_get_record_entry_by_type(
+	          internal_item->item_values,
+	          internal_item->name_to_id_map_list,
+	          internal_item->io_handle,
+	          internal_item->file_io_handle,
+	          internal_item->offsets_index,
+	          0,
+	          LIBPFF_ENTRY_TYPE_ATTACHMENT_DATA_OBJECT,
+	          0,
+	          &record_entry,
+	          LIBPFF_ENTRY_VALUE_FLAG_MATCH_ANY_VALUE_TYPE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libpff_record_entry_get_value_type(
+		     record_entry,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+		/* The OLE attachment method could refer to an OLE embedded object
+		 */
+		if( value_type == LIBPFF_VALUE_TYPE_OBJECT )
+		{
+			if( internal_item->embedded_object_data_stream == NULL )
+			{
+				if( libpff_internal_item_get_embedded_object_data(
+				     internal_item,
+				     record_entry,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve embedded object data.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( extent_offset == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+				 "%s: invalid extent offset.",
+				 function );
+
+				return( -1 );
+			}
+			if( extent_size == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+				 "%s: invalid extent size.",
+				 function );
+
+				return( -1 );
+			}
+			result = libpff_internal_item_get_embedded_object_data_extents(
+			          internal_item,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve embedded object data extents.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				if( ( extent_index < 0 )
+				 || ( extent_index >= internal_item->number_of_embedded_object_data_extents ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid extent index value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				*extent_offset = internal_item->embedded_object_data_extents[ extent_index ].file_offset;
+				*extent_size   = internal_item->embedded_object_data_extents[ extent_index ].size;
+			}
+		}
+		else
+		{
+			result = libpff_record_entry_get_data_extent_by_index(
+			          record_entry,
+			          extent_index,
+			          extent_offset,
+			          extent_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value data extent: %d.",
+				 function,
+				 extent_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( result );
+}
+
 /* Retrieves the attachment data file IO handle
  * Returns 1 if successful, 0 if not available or -1 on error
  */
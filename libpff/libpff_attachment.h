@@ -61,6 +61,31 @@ off64_t libpff_attachment_data_seek_offset(
          int whence,
          libcerror_error_t **error );
 
+LIBPFF_EXTERN \
+int libpff_attachment_data_write_to_callback(
+     libpff_item_t *attachment,
+     ssize_t (*write_callback)(
+              intptr_t *callback_data,
+              const uint8_t *buffer,
+              size_t buffer_size,
+              libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_attachment_get_number_of_data_extents(
+     libpff_item_t *attachment,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_attachment_get_data_extent_by_index(
+     libpff_item_t *attachment,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libcerror_error_t **error );
+
 LIBPFF_EXTERN \
 int libpff_attachment_get_data_file_io_handle(
      libpff_item_t *attachment,
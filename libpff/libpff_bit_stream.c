@@ -20,14 +20,13 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
 #include "libpff_bit_stream.h"
 #include "libpff_libcerror.h"
 
-/* TODO use memory alignment in bit stream */
-
 /* Creates a bit stream
  * Make sure the value bit_stream is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -185,6 +184,149 @@ int libpff_bit_stream_free(
 	return( 1 );
 }
 
+/* Sets the byte stream of a bit stream
+ * This resets the bit buffer so that the bit stream can be reused
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_bit_stream_set_byte_stream(
+     libpff_bit_stream_t *bit_stream,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t byte_stream_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_bit_stream_set_byte_stream";
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_offset > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream offset value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream->byte_stream        = byte_stream;
+	bit_stream->byte_stream_size   = byte_stream_size;
+	bit_stream->byte_stream_offset = byte_stream_offset;
+	bit_stream->bit_buffer         = 0;
+	bit_stream->bit_buffer_size    = 0;
+
+	return( 1 );
+}
+
+/* Reads bytes from the byte stream into the bit buffer
+ * Bits already in the bit buffer are kept. If at least 8 bytes remain in a byte back to front
+ * byte stream the bit buffer is filled with a single unaligned 64-bit read, in which case
+ * more than the number of bits are read
+ * Returns 1 if the number of bits are available, 0 if not or -1 on error
+ */
+int libpff_bit_stream_read(
+     libpff_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_bit_stream_read";
+	uint64_t value_64bit  = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > (uint8_t) 56 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of bits value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream->bit_buffer_size >= number_of_bits )
+	{
+		return( 1 );
+	}
+	if( ( bit_stream->storage_type == LIBPFF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	 && ( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) >= 8 ) )
+	{
+		/* The bits of the partially read byte at the top of the bit buffer are read again
+		 * at the same position by the next read, hence they are not cleared
+		 */
+		byte_stream_copy_to_uint64_little_endian(
+		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+		 value_64bit );
+
+		bit_stream->bit_buffer         |= value_64bit << bit_stream->bit_buffer_size;
+		bit_stream->byte_stream_offset += ( 63 - bit_stream->bit_buffer_size ) >> 3;
+		bit_stream->bit_buffer_size    |= 56;
+
+		return( 1 );
+	}
+	while( bit_stream->bit_buffer_size < number_of_bits )
+	{
+		if( bit_stream->byte_stream_offset >= bit_stream->byte_stream_size )
+		{
+			return( 0 );
+		}
+		if( bit_stream->storage_type == LIBPFF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+		{
+			bit_stream->bit_buffer |= (uint64_t) bit_stream->byte_stream[ bit_stream->byte_stream_offset ] << bit_stream->bit_buffer_size;
+		}
+		else if( bit_stream->storage_type == LIBPFF_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
+		{
+			bit_stream->bit_buffer <<= 8;
+			bit_stream->bit_buffer  |= bit_stream->byte_stream[ bit_stream->byte_stream_offset ];
+		}
+		bit_stream->bit_buffer_size    += 8;
+		bit_stream->byte_stream_offset += 1;
+	}
+	return( 1 );
+}
+
 /* Retrieves a value from the bit stream
  * Returns 1 on success or -1 on error
  */
@@ -194,11 +336,8 @@ int libpff_bit_stream_get_value(
      uint32_t *value_32bit,
      libcerror_error_t **error )
 {
-	static char *function            = "libpff_bit_stream_get_value";
-	uint32_t read_value_32bit        = 0;
-	uint32_t safe_value_32bit        = 0;
-	uint8_t read_number_of_bits      = 0;
-	uint8_t remaining_number_of_bits = 0;
+	static char *function = "libpff_bit_stream_get_value";
+	uint64_t value_mask   = 0;
 
 	if( bit_stream == NULL )
 	{
@@ -233,81 +372,49 @@ int libpff_bit_stream_get_value(
 
 		return( -1 );
 	}
-	remaining_number_of_bits = number_of_bits;
-
-	while( remaining_number_of_bits > 0 )
+	/* The bit buffer is filled byte by byte so that only the bytes needed are read
+	 */
+	while( bit_stream->bit_buffer_size < number_of_bits )
 	{
-		while( ( remaining_number_of_bits > bit_stream->bit_buffer_size )
-		    && ( bit_stream->bit_buffer_size <= 24 ) )
-		{
-			if( bit_stream->byte_stream_offset >= bit_stream->byte_stream_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid byte stream offset value out of bounds.",
-				 function );
-
-				return( -1 );
-			}
-			if( bit_stream->storage_type == LIBPFF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
-			{
-				bit_stream->bit_buffer |= (uint32_t) bit_stream->byte_stream[ bit_stream->byte_stream_offset ] << bit_stream->bit_buffer_size;
-			}
-			else if( bit_stream->storage_type == LIBPFF_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
-			{
-				bit_stream->bit_buffer <<= 8;
-				bit_stream->bit_buffer  |= bit_stream->byte_stream[ bit_stream->byte_stream_offset ];
-			}
-			bit_stream->bit_buffer_size    += 8;
-			bit_stream->byte_stream_offset += 1;
-		}
-		if( remaining_number_of_bits < bit_stream->bit_buffer_size )
-		{
-			read_number_of_bits = remaining_number_of_bits;
-		}
-		else
-		{
-			read_number_of_bits = bit_stream->bit_buffer_size;
-		}
-		read_value_32bit = bit_stream->bit_buffer;
-
-		if( remaining_number_of_bits < number_of_bits )
+		if( bit_stream->byte_stream_offset >= bit_stream->byte_stream_size )
 		{
-			safe_value_32bit <<= remaining_number_of_bits;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid byte stream offset value out of bounds.",
+			 function );
+
+			return( -1 );
 		}
 		if( bit_stream->storage_type == LIBPFF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
 		{
-			if( read_number_of_bits < 32 )
-			{
-				/* On VS 2008 32-bit "~( 0xfffffffUL << 32 )" does not behave as expected
-				 */
-				read_value_32bit &= ~( 0xffffffffUL << read_number_of_bits );
-
-				bit_stream->bit_buffer >>= read_number_of_bits;
-			}
-			bit_stream->bit_buffer_size -= read_number_of_bits;
+			bit_stream->bit_buffer |= (uint64_t) bit_stream->byte_stream[ bit_stream->byte_stream_offset ] << bit_stream->bit_buffer_size;
 		}
 		else if( bit_stream->storage_type == LIBPFF_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
 		{
-			bit_stream->bit_buffer_size -= read_number_of_bits;
-			read_value_32bit           >>= bit_stream->bit_buffer_size;
-
-			if( bit_stream->bit_buffer_size > 0 )
-			{
-				bit_stream->bit_buffer &= 0xffffffffUL >> ( 32 - bit_stream->bit_buffer_size );
-			}
-		}
-		if( bit_stream->bit_buffer_size == 0 )
-		{
-			bit_stream->bit_buffer = 0;
+			bit_stream->bit_buffer <<= 8;
+			bit_stream->bit_buffer  |= bit_stream->byte_stream[ bit_stream->byte_stream_offset ];
 		}
-		safe_value_32bit         |= read_value_32bit;
-		remaining_number_of_bits -= read_number_of_bits;
+		bit_stream->bit_buffer_size    += 8;
+		bit_stream->byte_stream_offset += 1;
 	}
-	*value_32bit = safe_value_32bit;
+	value_mask = ( (uint64_t) 1 << number_of_bits ) - 1;
 
+	if( bit_stream->storage_type == LIBPFF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT )
+	{
+		*value_32bit = (uint32_t) ( bit_stream->bit_buffer & value_mask );
+
+		bit_stream->bit_buffer     >>= number_of_bits;
+		bit_stream->bit_buffer_size -= number_of_bits;
+	}
+	else if( bit_stream->storage_type == LIBPFF_BIT_STREAM_STORAGE_TYPE_BYTE_FRONT_TO_BACK )
+	{
+		bit_stream->bit_buffer_size -= number_of_bits;
+
+		*value_32bit = (uint32_t) ( ( bit_stream->bit_buffer >> bit_stream->bit_buffer_size ) & value_mask );
+
+		bit_stream->bit_buffer &= ( (uint64_t) 1 << bit_stream->bit_buffer_size ) - 1;
+	}
 	return( 1 );
 }
-
@@ -62,13 +62,31 @@ struct libpff_bit_stream
 
 	/* The bit buffer
 	 */
-	uint32_t bit_buffer;
+	uint64_t bit_buffer;
 
 	/* The number of bits remaining in the bit buffer
 	 */
 	uint8_t bit_buffer_size;
 };
 
+/* Retrieves the next number of bits from the bit buffer without consuming them
+ * Only supported for the byte back to front storage type
+ * The bit buffer must contain the number of bits, use libpff_bit_stream_read to fill it
+ */
+#define libpff_bit_stream_peek_bits( bit_stream, number_of_bits ) \
+	(uint32_t) ( ( bit_stream )->bit_buffer & ( ( (uint64_t) 1 << ( number_of_bits ) ) - 1 ) )
+
+/* Consumes the number of bits from the bit buffer
+ * Only supported for the byte back to front storage type
+ */
+#define libpff_bit_stream_skip_bits( bit_stream, number_of_bits ) \
+	do \
+	{ \
+		( bit_stream )->bit_buffer      >>= ( number_of_bits ); \
+		( bit_stream )->bit_buffer_size  -= ( number_of_bits ); \
+	} \
+	while( 0 )
+
 int libpff_bit_stream_initialize(
      libpff_bit_stream_t **bit_stream,
      const uint8_t *byte_stream,
@@ -81,6 +99,18 @@ int libpff_bit_stream_free(
      libpff_bit_stream_t **bit_stream,
      libcerror_error_t **error );
 
+int libpff_bit_stream_set_byte_stream(
+     libpff_bit_stream_t *bit_stream,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t byte_stream_offset,
+     libcerror_error_t **error );
+
+int libpff_bit_stream_read(
+     libpff_bit_stream_t *bit_stream,
+     uint8_t number_of_bits,
+     libcerror_error_t **error );
+
 int libpff_bit_stream_get_value(
      libpff_bit_stream_t *bit_stream,
      uint8_t number_of_bits,
@@ -0,0 +1,294 @@
+/*
+ * Bloom filter functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libpff_bloom_filter.h"
+#include "libpff_libcerror.h"
+
+/* Creates a Bloom filter
+ * The number of bits is determined by the expected number of values
+ * Make sure the value bloom_filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_bloom_filter_initialize(
+     libpff_bloom_filter_t **bloom_filter,
+     uint64_t number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function   = "libpff_bloom_filter_initialize";
+	size_t bits_size        = 0;
+	uint64_t number_of_bits = 64;
+
+	if( bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bloom_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Bloom filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > ( (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / LIBPFF_BLOOM_FILTER_NUMBER_OF_BITS_PER_VALUE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of bits is rounded up to a power of 2 so that a bit index
+	 * can be determined with a mask
+	 */
+	while( number_of_bits < ( number_of_values * LIBPFF_BLOOM_FILTER_NUMBER_OF_BITS_PER_VALUE ) )
+	{
+		number_of_bits <<= 1;
+	}
+	bits_size = (size_t) ( number_of_bits / 8 );
+
+	if( bits_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid bits size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*bloom_filter = memory_allocate_structure(
+	                 libpff_bloom_filter_t );
+
+	if( *bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Bloom filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *bloom_filter,
+	     0,
+	     sizeof( libpff_bloom_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Bloom filter.",
+		 function );
+
+		memory_free(
+		 *bloom_filter );
+
+		*bloom_filter = NULL;
+
+		return( -1 );
+	}
+	( *bloom_filter )->bits = (uint64_t *) memory_allocate(
+	                                        bits_size );
+
+	if( ( *bloom_filter )->bits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bits.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *bloom_filter )->bits,
+	     0,
+	     bits_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bits.",
+		 function );
+
+		goto on_error;
+	}
+	( *bloom_filter )->number_of_bits = number_of_bits;
+
+	return( 1 );
+
+on_error:
+	if( *bloom_filter != NULL )
+	{
+		if( ( *bloom_filter )->bits != NULL )
+		{
+			memory_free(
+			 ( *bloom_filter )->bits );
+		}
+		memory_free(
+		 *bloom_filter );
+
+		*bloom_filter = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a Bloom filter
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_bloom_filter_free(
+     libpff_bloom_filter_t **bloom_filter,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_bloom_filter_free";
+
+	if( bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bloom_filter != NULL )
+	{
+		if( ( *bloom_filter )->bits != NULL )
+		{
+			memory_free(
+			 ( *bloom_filter )->bits );
+		}
+		memory_free(
+		 *bloom_filter );
+
+		*bloom_filter = NULL;
+	}
+	return( 1 );
+}
+
+/* Inserts a hash in the Bloom filter
+ * The bit positions are derived from the lower and upper 32-bit of the hash using double hashing
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_bloom_filter_insert_hash(
+     libpff_bloom_filter_t *bloom_filter,
+     uint64_t hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_bloom_filter_insert_hash";
+	uint64_t bit_index    = 0;
+	uint64_t bit_mask     = 0;
+	uint64_t hash_step    = 0;
+	int hash_iterator     = 0;
+
+	if( bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	bit_mask  = bloom_filter->number_of_bits - 1;
+	bit_index = hash & 0xffffffffUL;
+	hash_step = ( hash >> 32 ) | 1;
+
+	for( hash_iterator = 0;
+	     hash_iterator < LIBPFF_BLOOM_FILTER_NUMBER_OF_HASHES;
+	     hash_iterator++ )
+	{
+		bloom_filter->bits[ ( bit_index & bit_mask ) >> 6 ] |= (uint64_t) 1 << ( bit_index & 63 );
+
+		bit_index += hash_step;
+	}
+	return( 1 );
+}
+
+/* Determines if the Bloom filter contains a hash
+ * Returns 1 if the Bloom filter possibly contains the hash, 0 if it does not or -1 on error
+ */
+int libpff_bloom_filter_contains_hash(
+     libpff_bloom_filter_t *bloom_filter,
+     uint64_t hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_bloom_filter_contains_hash";
+	uint64_t bit_index    = 0;
+	uint64_t bit_mask     = 0;
+	uint64_t hash_step    = 0;
+	int hash_iterator     = 0;
+
+	if( bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	bit_mask  = bloom_filter->number_of_bits - 1;
+	bit_index = hash & 0xffffffffUL;
+	hash_step = ( hash >> 32 ) | 1;
+
+	for( hash_iterator = 0;
+	     hash_iterator < LIBPFF_BLOOM_FILTER_NUMBER_OF_HASHES;
+	     hash_iterator++ )
+	{
+		if( ( bloom_filter->bits[ ( bit_index & bit_mask ) >> 6 ] & ( (uint64_t) 1 << ( bit_index & 63 ) ) ) == 0 )
+		{
+			return( 0 );
+		}
+		bit_index += hash_step;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,78 @@
+/*
+ * Bloom filter functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBPFF_BLOOM_FILTER_H )
+#define _LIBPFF_BLOOM_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libpff_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of bits per value and the number of bit positions per value
+ * result in a false positive rate of approximately 1%
+ */
+#define LIBPFF_BLOOM_FILTER_NUMBER_OF_BITS_PER_VALUE	10
+#define LIBPFF_BLOOM_FILTER_NUMBER_OF_HASHES		7
+
+typedef struct libpff_bloom_filter libpff_bloom_filter_t;
+
+struct libpff_bloom_filter
+{
+	/* The bits
+	 */
+	uint64_t *bits;
+
+	/* The number of bits
+	 * This value is always a power of 2
+	 */
+	uint64_t number_of_bits;
+};
+
+int libpff_bloom_filter_initialize(
+     libpff_bloom_filter_t **bloom_filter,
+     uint64_t number_of_values,
+     libcerror_error_t **error );
+
+int libpff_bloom_filter_free(
+     libpff_bloom_filter_t **bloom_filter,
+     libcerror_error_t **error );
+
+int libpff_bloom_filter_insert_hash(
+     libpff_bloom_filter_t *bloom_filter,
+     uint64_t hash,
+     libcerror_error_t **error );
+
+int libpff_bloom_filter_contains_hash(
+     libpff_bloom_filter_t *bloom_filter,
+     uint64_t hash,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBPFF_BLOOM_FILTER_H ) */
+
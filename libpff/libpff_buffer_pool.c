@@ -0,0 +1,433 @@
+/*
+ * Size-classed buffer pool functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libpff_buffer_pool.h"
+#include "libpff_libcerror.h"
+#include "libpff_libcthreads.h"
+
+static const size_t libpff_buffer_pool_size_classes[ LIBPFF_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES ] = {
+	8192, 65536 };
+
+/* Creates a buffer pool
+ * Make sure the value buffer_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_buffer_pool_initialize(
+     libpff_buffer_pool_t **buffer_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_buffer_pool_initialize";
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid buffer pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer_pool = memory_allocate_structure(
+	                libpff_buffer_pool_t );
+
+	if( *buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *buffer_pool,
+	     0,
+	     sizeof( libpff_buffer_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer pool.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *buffer_pool )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *buffer_pool != NULL )
+	{
+		memory_free(
+		 *buffer_pool );
+
+		*buffer_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a buffer pool
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_buffer_pool_free(
+     libpff_buffer_pool_t **buffer_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_buffer_pool_free";
+	int buffer_index      = 0;
+	int size_class_index  = 0;
+	int result            = 1;
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer_pool != NULL )
+	{
+		for( size_class_index = 0;
+		     size_class_index < LIBPFF_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES;
+		     size_class_index++ )
+		{
+			for( buffer_index = 0;
+			     buffer_index < ( *buffer_pool )->number_of_free_buffers[ size_class_index ];
+			     buffer_index++ )
+			{
+				memory_free(
+				 ( *buffer_pool )->free_buffers[ size_class_index ][ buffer_index ] );
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *buffer_pool )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *buffer_pool );
+
+		*buffer_pool = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves a buffer of at least size bytes
+ * Sizes that fit a size class are rounded up to the size class and reuse a free buffer if available
+ * Larger sizes are allocated as is
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_buffer_pool_get_buffer(
+     libpff_buffer_pool_t *buffer_pool,
+     size_t size,
+     uint8_t **buffer,
+     size_t *buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libpff_buffer_pool_get_buffer";
+	size_t allocation_size = 0;
+	int size_class_index   = 0;
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	allocation_size = size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( size_class_index = 0;
+	     size_class_index < LIBPFF_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES;
+	     size_class_index++ )
+	{
+		if( size <= libpff_buffer_pool_size_classes[ size_class_index ] )
+		{
+			allocation_size = libpff_buffer_pool_size_classes[ size_class_index ];
+
+			if( buffer_pool->number_of_free_buffers[ size_class_index ] > 0 )
+			{
+				buffer_pool->number_of_free_buffers[ size_class_index ] -= 1;
+
+				*buffer = buffer_pool->free_buffers[ size_class_index ][ buffer_pool->number_of_free_buffers[ size_class_index ] ];
+
+				buffer_pool->free_buffers[ size_class_index ][ buffer_pool->number_of_free_buffers[ size_class_index ] ] = NULL;
+			}
+			break;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( *buffer == NULL )
+	{
+		*buffer = (uint8_t *) memory_allocate(
+		                       sizeof( uint8_t ) * allocation_size );
+
+		if( *buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*buffer_size = allocation_size;
+
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( *buffer != NULL )
+	{
+		memory_free(
+		 *buffer );
+
+		*buffer = NULL;
+	}
+	return( -1 );
+#endif
+}
+
+/* Releases a buffer retrieved by libpff_buffer_pool_get_buffer
+ * The buffer is kept for reuse if its size matches a size class that is not full otherwise it is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_buffer_pool_release_buffer(
+     libpff_buffer_pool_t *buffer_pool,
+     uint8_t **buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_buffer_pool_release_buffer";
+	int size_class_index  = 0;
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( size_class_index = 0;
+	     size_class_index < LIBPFF_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES;
+	     size_class_index++ )
+	{
+		if( buffer_size == libpff_buffer_pool_size_classes[ size_class_index ] )
+		{
+			if( buffer_pool->number_of_free_buffers[ size_class_index ] < LIBPFF_BUFFER_POOL_MAXIMUM_NUMBER_OF_FREE_BUFFERS )
+			{
+				buffer_pool->free_buffers[ size_class_index ][ buffer_pool->number_of_free_buffers[ size_class_index ] ] = *buffer;
+
+				buffer_pool->number_of_free_buffers[ size_class_index ] += 1;
+
+				*buffer = NULL;
+			}
+			break;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     buffer_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( *buffer != NULL )
+	{
+		memory_free(
+		 *buffer );
+
+		*buffer = NULL;
+	}
+	return( 1 );
+}
+
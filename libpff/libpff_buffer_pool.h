@@ -0,0 +1,91 @@
+/*
+ * Size-classed buffer pool functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBPFF_BUFFER_POOL_H )
+#define _LIBPFF_BUFFER_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libpff_libcerror.h"
+#include "libpff_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of buffer size classes
+ * 8 KiB the maximum data block size of 32-bit and 64-bit files
+ * 64 KiB the maximum data block size of 64-bit 4k page files
+ */
+#define LIBPFF_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES		2
+
+/* The maximum number of free buffers kept per size class
+ */
+#define LIBPFF_BUFFER_POOL_MAXIMUM_NUMBER_OF_FREE_BUFFERS	16
+
+typedef struct libpff_buffer_pool libpff_buffer_pool_t;
+
+struct libpff_buffer_pool
+{
+	/* The free buffers per size class
+	 */
+	uint8_t *free_buffers[ LIBPFF_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES ][ LIBPFF_BUFFER_POOL_MAXIMUM_NUMBER_OF_FREE_BUFFERS ];
+
+	/* The number of free buffers per size class
+	 */
+	int number_of_free_buffers[ LIBPFF_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES ];
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 * Buffers can be retrieved and released by the read ahead threads
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libpff_buffer_pool_initialize(
+     libpff_buffer_pool_t **buffer_pool,
+     libcerror_error_t **error );
+
+int libpff_buffer_pool_free(
+     libpff_buffer_pool_t **buffer_pool,
+     libcerror_error_t **error );
+
+int libpff_buffer_pool_get_buffer(
+     libpff_buffer_pool_t *buffer_pool,
+     size_t size,
+     uint8_t **buffer,
+     size_t *buffer_size,
+     libcerror_error_t **error );
+
+int libpff_buffer_pool_release_buffer(
+     libpff_buffer_pool_t *buffer_pool,
+     uint8_t **buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBPFF_BUFFER_POOL_H ) */
+
@@ -25,21 +25,24 @@
 #include <common.h>
 #include <types.h>
 
-#include "libpff_extern.h"
 #include "libpff_libcerror.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
-LIBPFF_EXTERN_VARIABLE \
-uint32_t libpff_checksum_crc32_table[ 256 ];
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define LIBPFF_CHECKSUM_HAVE_PCLMULQDQ
 
-LIBPFF_EXTERN_VARIABLE \
-int libpff_checksum_crc32_table_computed;
+int libpff_checksum_have_pclmulqdq(
+     void );
 
-void libpff_checksum_initialize_crc32_table(
-      int );
+#endif
+
+uint32_t libpff_checksum_update_crc32(
+          uint32_t checksum,
+          const uint8_t *buffer,
+          size_t size );
 
 int libpff_checksum_calculate_crc32(
      uint32_t *checksum,
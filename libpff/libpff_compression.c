@@ -33,6 +33,7 @@
 #include "libpff_compression.h"
 #include "libpff_definitions.h"
 #include "libpff_deflate.h"
+#include "libpff_deflate_context.h"
 #include "libpff_libcerror.h"
 #include "libpff_libcnotify.h"
 
@@ -47,7 +48,30 @@ int libpff_decompress_data(
      size_t *uncompressed_data_size,
      libcerror_error_t **error )
 {
-	static char *function              = "libpff_decompress_data";
+	return( libpff_decompress_data_with_context(
+	         NULL,
+	         compressed_data,
+	         compressed_data_size,
+	         compression_method,
+	         uncompressed_data,
+	         uncompressed_data_size,
+	         error ) );
+}
+
+/* Decompresses data using the compression method
+ * The deflate context is optional and is only used when zlib is not available
+ * Returns 1 on success, 0 on failure or -1 on error
+ */
+int libpff_decompress_data_with_context(
+     libpff_deflate_context_t *deflate_context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint16_t compression_method,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "libpff_decompress_data_with_context";
 	int result                         = 0;
 
 #if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_UNCOMPRESS ) ) || defined( ZLIB_DLL )
@@ -195,12 +219,25 @@ int libpff_decompress_data(
 			result = -1;
 		}
 #else
-		result = libpff_deflate_decompress_zlib(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
+		if( deflate_context != NULL )
+		{
+			result = libpff_deflate_decompress_zlib_with_context(
+			          deflate_context,
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+		}
+		else
+		{
+			result = libpff_deflate_decompress_zlib(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
+		}
 
 		if( result != 1 )
 		{
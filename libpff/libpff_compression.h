@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libpff_deflate_context.h"
 #include "libpff_libcerror.h"
 
 #if defined( __cplusplus )
@@ -39,6 +40,15 @@ int libpff_decompress_data(
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int libpff_decompress_data_with_context(
+     libpff_deflate_context_t *deflate_context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint16_t compression_method,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
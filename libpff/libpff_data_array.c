@@ -27,6 +27,7 @@
 #include "libpff_data_array_entry.h"
 #include "libpff_data_block.h"
 #include "libpff_definitions.h"
+#include "libpff_deflate_context.h"
 #include "libpff_encryption.h"
 #include "libpff_index_value.h"
 #include "libpff_io_handle.h"
@@ -34,6 +35,7 @@
 #include "libpff_libcdata.h"
 #include "libpff_libcerror.h"
 #include "libpff_libcnotify.h"
+#include "libpff_libcthreads.h"
 #include "libpff_libfcache.h"
 #include "libpff_libfdata.h"
 #include "libpff_unused.h"
@@ -155,6 +157,10 @@ int libpff_data_array_free(
 	static char *function = "libpff_data_array_free";
 	int result            = 1;
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int job_index         = 0;
+#endif
+
 	if( data_array == NULL )
 	{
 		libcerror_error_set(
@@ -168,6 +174,97 @@ int libpff_data_array_free(
 	}
 	if( *data_array != NULL )
 	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		/* Joining the thread pool waits for the pending read-ahead jobs to finish
+		 */
+		if( ( *data_array )->read_ahead_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *data_array )->read_ahead_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join read-ahead thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		for( job_index = 0;
+		     job_index < LIBPFF_MAXIMUM_NUMBER_OF_READ_AHEAD_SEGMENTS;
+		     job_index++ )
+		{
+			if( ( *data_array )->read_ahead_jobs[ job_index ].data_block != NULL )
+			{
+				if( libpff_data_block_free(
+				     &( ( *data_array )->read_ahead_jobs[ job_index ].data_block ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free read-ahead job: %d data block.",
+					 function,
+					 job_index );
+
+					result = -1;
+				}
+			}
+			if( ( *data_array )->read_ahead_jobs[ job_index ].deflate_context != NULL )
+			{
+				if( libpff_deflate_context_free(
+				     &( ( *data_array )->read_ahead_jobs[ job_index ].deflate_context ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free read-ahead job: %d deflate context.",
+					 function,
+					 job_index );
+
+					result = -1;
+				}
+			}
+		}
+		if( ( *data_array )->read_ahead_jobs_condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *data_array )->read_ahead_jobs_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read-ahead jobs condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *data_array )->read_ahead_jobs_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *data_array )->read_ahead_jobs_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read-ahead jobs mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
 		if( libcdata_array_free(
 		     &( ( *data_array )->entries ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libpff_data_array_entry_free,
@@ -495,6 +592,10 @@ int libpff_data_array_read_entries(
 	{
 		data_array->data_size = *total_data_size;
 	}
+	if( recursion_depth == 0 )
+	{
+		data_array->descriptor_data_list = descriptor_data_list;
+	}
 	if( libcdata_array_get_number_of_entries(
 	     data_array->entries,
 	     &previous_number_of_data_array_entries,
@@ -650,7 +751,10 @@ int libpff_data_array_read_entries(
 
 			goto on_error;
 		}
-		if( libpff_data_block_read_file_io_handle(
+		/* The uncompressed data size is stored in the data block footer
+		 * hence the data of the data blocks of the array entries is not decompressed here
+		 */
+		if( libpff_data_block_read_raw_file_io_handle(
 		     data_block,
 		     file_io_handle,
 		     offset_index_value->file_offset,
@@ -755,6 +859,20 @@ int libpff_data_array_read_entries(
 		}
 		else
 		{
+			if( libpff_data_block_decompress_data(
+			     data_block,
+			     io_handle->deflate_context,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress data block.",
+				 function );
+
+				goto on_error;
+			}
 			if( libpff_data_array_read_entries(
 			     data_array,
 			     io_handle,
@@ -865,6 +983,10 @@ int libpff_data_array_read_element_data(
 	static char *function                       = "libpff_data_array_read_element_data";
 	int element_index                           = 0;
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int result                                  = 0;
+#endif
+
 	LIBPFF_UNREFERENCED_PARAMETER( element_file_index )
 	LIBPFF_UNREFERENCED_PARAMETER( element_flags )
 
@@ -942,58 +1064,131 @@ int libpff_data_array_read_element_data(
 
 		goto on_error;
 	}
-	if( libpff_data_block_initialize(
-	     &data_block,
-	     data_array->io_handle,
-	     data_array->descriptor_identifier,
-	     data_array_entry->data_identifier,
-	     error ) != 1 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( data_array->read_ahead_thread_pool != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data block.",
-		 function );
+		result = libpff_data_array_get_read_ahead_data_block(
+		          data_array,
+		          element_index,
+		          &data_block,
+		          error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve read-ahead data block of element: %d.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( data_block == NULL )
+	{
+		if( libpff_data_block_initialize(
+		     &data_block,
+		     data_array->io_handle,
+		     data_array->descriptor_identifier,
+		     data_array_entry->data_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data block.",
+			 function );
+
+			goto on_error;
+		}
+		if( libpff_data_block_read_raw_file_io_handle(
+		     data_block,
+		     file_io_handle,
+		     element_offset,
+		     (size32_t) element_size,
+		     data_array->io_handle->file_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The data blocks that follow are read ahead when the element is read sequentially
+	 * or was itself read ahead, the data block of the element is decompressed by
+	 * the calling thread while the thread pool decompresses the read-ahead data blocks
+	 */
+	if( ( data_array->io_handle->number_of_read_ahead_threads > 0 )
+	 && ( data_array->descriptor_data_list != NULL )
+	 && ( ( element_index == data_array->next_element_index )
+	  || ( result == 1 ) ) )
+	{
+		if( libpff_data_array_read_ahead(
+		     data_array,
+		     file_io_handle,
+		     cache,
+		     element_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read ahead data array entries.",
+			 function );
+
+			goto on_error;
+		}
 	}
-	if( libpff_data_block_read_file_io_handle(
+#endif
+	data_array->next_element_index = element_index + 1;
+
+	if( libpff_data_block_decompress_data(
 	     data_block,
-	     file_io_handle,
-	     element_offset,
-	     (size32_t) element_size,
-	     data_array->io_handle->file_type,
+	     data_array->io_handle->deflate_context,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read data block.",
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data block.",
 		 function );
 
 		goto on_error;
 	}
 /* TODO move function into data block ? */
-	if( libpff_data_array_decrypt_entry_data(
-	     data_array,
-	     element_index,
-	     data_array->io_handle->encryption_type,
-	     data_block->data,
-	     (size_t) element_size,
-	     read_flags,
-	     error ) != 1 )
+	if( ( data_block->flags & LIBPFF_DATA_BLOCK_FLAG_DECRYPTED ) == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-		 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
-		 "%s: unable to decrypt data array entry: %d data.",
-		 function,
-		 element_index );
+		if( libpff_data_array_decrypt_entry_data(
+		     data_array,
+		     element_index,
+		     data_array->io_handle->encryption_type,
+		     data_block->data,
+		     (size_t) element_size,
+		     read_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt data array entry: %d data.",
+			 function,
+			 element_index );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
 	if( libfdata_list_element_set_element_value(
 	     list_element,
@@ -1025,6 +1220,584 @@ on_error:
 	return( -1 );
 }
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Decompresses the data block of a read-ahead job
+ * Callback function for the read-ahead thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_data_array_read_ahead_job_callback(
+     libpff_data_array_read_ahead_job_t *read_ahead_job,
+     libpff_data_array_t *data_array )
+{
+	int result = 0;
+
+	if( read_ahead_job == NULL )
+	{
+		return( -1 );
+	}
+	if( data_array == NULL )
+	{
+		return( -1 );
+	}
+	/* Failing to decompress a read-ahead data block is not considered an error
+	 * the data block is read again when the element is read
+	 */
+	result = libpff_data_block_decompress_data(
+	          read_ahead_job->data_block,
+	          read_ahead_job->deflate_context,
+	          NULL );
+
+	if( libcthreads_mutex_grab(
+	     data_array->read_ahead_jobs_mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	read_ahead_job->result     = result;
+	read_ahead_job->is_pending = 0;
+
+	if( libcthreads_condition_broadcast(
+	     data_array->read_ahead_jobs_condition,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     data_array->read_ahead_jobs_mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the read-ahead data block of a specific element
+ * Waits for the thread pool if the data block is still being decompressed
+ * The read-ahead jobs of elements outside the read-ahead window are released
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libpff_data_array_get_read_ahead_data_block(
+     libpff_data_array_t *data_array,
+     int element_index,
+     libpff_data_block_t **data_block,
+     libcerror_error_t **error )
+{
+	libpff_data_array_read_ahead_job_t *read_ahead_job = NULL;
+	static char *function                              = "libpff_data_array_get_read_ahead_data_block";
+	int job_index                                      = 0;
+	int result                                         = 0;
+
+	if( data_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data array.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_block != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data block value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_array->read_ahead_thread_pool == NULL )
+	{
+		return( 0 );
+	}
+	if( libcthreads_mutex_grab(
+	     data_array->read_ahead_jobs_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read-ahead jobs mutex.",
+		 function );
+
+		return( -1 );
+	}
+	for( job_index = 0;
+	     job_index < LIBPFF_MAXIMUM_NUMBER_OF_READ_AHEAD_SEGMENTS;
+	     job_index++ )
+	{
+		read_ahead_job = &( data_array->read_ahead_jobs[ job_index ] );
+
+		if( read_ahead_job->data_block == NULL )
+		{
+			continue;
+		}
+		if( ( read_ahead_job->element_index > element_index )
+		 && ( read_ahead_job->element_index <= ( element_index + LIBPFF_MAXIMUM_NUMBER_OF_READ_AHEAD_SEGMENTS ) ) )
+		{
+			continue;
+		}
+		while( read_ahead_job->is_pending != 0 )
+		{
+			if( libcthreads_condition_wait(
+			     data_array->read_ahead_jobs_condition,
+			     data_array->read_ahead_jobs_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for read-ahead job: %d.",
+				 function,
+				 job_index );
+
+				goto on_error;
+			}
+		}
+		if( ( read_ahead_job->element_index == element_index )
+		 && ( read_ahead_job->result == 1 )
+		 && ( *data_block == NULL ) )
+		{
+			*data_block = read_ahead_job->data_block;
+
+			read_ahead_job->data_block = NULL;
+
+			result = 1;
+		}
+		else if( libpff_data_block_free(
+		          &( read_ahead_job->data_block ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead job: %d data block.",
+			 function,
+			 job_index );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     data_array->read_ahead_jobs_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read-ahead jobs mutex.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	libcthreads_mutex_release(
+	 data_array->read_ahead_jobs_mutex,
+	 NULL );
+
+	if( *data_block != NULL )
+	{
+		libpff_data_block_free(
+		 data_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines if the data block of an element is stored in the cache
+ * Returns 1 if the data block is stored in the cache, 0 if not or -1 on error
+ */
+int libpff_data_array_element_is_cached(
+     libfcache_cache_t *cache,
+     int element_file_index,
+     off64_t element_offset,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libpff_data_array_element_is_cached";
+	off64_t cache_value_offset           = 0;
+	int64_t cache_value_timestamp        = 0;
+	int cache_entry_index                = 0;
+	int cache_value_file_index           = 0;
+	int number_of_cache_entries          = 0;
+
+	if( libfcache_cache_get_number_of_entries(
+	     cache,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( cache_entry_index = 0;
+	     cache_entry_index < number_of_cache_entries;
+	     cache_entry_index++ )
+	{
+		if( libfcache_cache_get_value_by_index(
+		     cache,
+		     cache_entry_index,
+		     &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( cache_value == NULL )
+		{
+			continue;
+		}
+		if( libfcache_cache_value_get_identifier(
+		     cache_value,
+		     &cache_value_file_index,
+		     &cache_value_offset,
+		     &cache_value_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d identifier.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( ( cache_value_file_index == element_file_index )
+		 && ( cache_value_offset == element_offset ) )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Reads ahead the data blocks that follow the data block of an element
+ * The data blocks are read sequentially and the compressed data blocks
+ * are pushed onto the read-ahead thread pool of the data array, which
+ * decompresses them while the calling thread continues. Data blocks
+ * that are already stored in the cache are not read again. Failing to
+ * read ahead a data block is not considered an error.
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_data_array_read_ahead(
+     libpff_data_array_t *data_array,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *cache,
+     int element_index,
+     libcerror_error_t **error )
+{
+	libpff_data_array_entry_t *data_array_entry        = NULL;
+	libpff_data_array_read_ahead_job_t *read_ahead_job = NULL;
+	libpff_data_block_t *read_ahead_data_block         = NULL;
+	libcerror_error_t *read_ahead_error                = NULL;
+	static char *function                              = "libpff_data_array_read_ahead";
+	size64_t read_ahead_element_size                   = 0;
+	off64_t read_ahead_element_offset                  = 0;
+	uint32_t read_ahead_element_flags                  = 0;
+	int job_index                                      = 0;
+	int number_of_elements                             = 0;
+	int number_of_threads                              = 0;
+	int read_ahead_element_file_index                  = 0;
+	int result                                         = 0;
+
+	if( data_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data array.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_array->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data array - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     data_array->descriptor_data_list,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from descriptor data list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_array->read_ahead_element_index <= element_index )
+	 || ( data_array->read_ahead_element_index > ( element_index + LIBPFF_MAXIMUM_NUMBER_OF_READ_AHEAD_SEGMENTS + 1 ) ) )
+	{
+		data_array->read_ahead_element_index = element_index + 1;
+	}
+	if( ( data_array->read_ahead_element_index >= number_of_elements )
+	 || ( data_array->read_ahead_element_index > ( element_index + LIBPFF_MAXIMUM_NUMBER_OF_READ_AHEAD_SEGMENTS ) ) )
+	{
+		return( 1 );
+	}
+	/* The thread pool is created once and reused for all the read-ahead jobs of the data array
+	 */
+	if( data_array->read_ahead_jobs_mutex == NULL )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( data_array->read_ahead_jobs_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read-ahead jobs mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( data_array->read_ahead_jobs_condition == NULL )
+	{
+		if( libcthreads_condition_initialize(
+		     &( data_array->read_ahead_jobs_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read-ahead jobs condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( data_array->read_ahead_thread_pool == NULL )
+	{
+		number_of_threads = data_array->io_handle->number_of_read_ahead_threads;
+
+		if( number_of_threads > LIBPFF_MAXIMUM_NUMBER_OF_READ_AHEAD_SEGMENTS )
+		{
+			number_of_threads = LIBPFF_MAXIMUM_NUMBER_OF_READ_AHEAD_SEGMENTS;
+		}
+		if( libcthreads_thread_pool_create(
+		     &( data_array->read_ahead_thread_pool ),
+		     NULL,
+		     number_of_threads,
+		     LIBPFF_MAXIMUM_NUMBER_OF_READ_AHEAD_SEGMENTS,
+		     (int (*)(intptr_t *, void *)) &libpff_data_array_read_ahead_job_callback,
+		     (void *) data_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read-ahead thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The file IO handle cannot be shared between threads hence
+	 * the data blocks are read by the calling thread
+	 */
+	while( ( data_array->read_ahead_element_index < number_of_elements )
+	    && ( data_array->read_ahead_element_index <= ( element_index + LIBPFF_MAXIMUM_NUMBER_OF_READ_AHEAD_SEGMENTS ) ) )
+	{
+		/* Only the calling thread changes which read-ahead jobs are in use
+		 */
+		while( job_index < LIBPFF_MAXIMUM_NUMBER_OF_READ_AHEAD_SEGMENTS )
+		{
+			if( data_array->read_ahead_jobs[ job_index ].data_block == NULL )
+			{
+				break;
+			}
+			job_index++;
+		}
+		if( job_index >= LIBPFF_MAXIMUM_NUMBER_OF_READ_AHEAD_SEGMENTS )
+		{
+			break;
+		}
+		read_ahead_job = &( data_array->read_ahead_jobs[ job_index ] );
+
+		if( libfdata_list_get_element_by_index(
+		     data_array->descriptor_data_list,
+		     data_array->read_ahead_element_index,
+		     &read_ahead_element_file_index,
+		     &read_ahead_element_offset,
+		     &read_ahead_element_size,
+		     &read_ahead_element_flags,
+		     &read_ahead_error ) != 1 )
+		{
+			break;
+		}
+		result = libpff_data_array_element_is_cached(
+		          cache,
+		          read_ahead_element_file_index,
+		          read_ahead_element_offset,
+		          &read_ahead_error );
+
+		if( ( result == 0 )
+		 && ( read_ahead_element_size <= (size64_t) UINT32_MAX ) )
+		{
+			result = libcdata_array_get_entry_by_index(
+			          data_array->entries,
+			          data_array->read_ahead_element_index,
+			          (intptr_t **) &data_array_entry,
+			          &read_ahead_error );
+
+			if( ( result == 1 )
+			 && ( data_array_entry != NULL ) )
+			{
+				result = libpff_data_block_initialize(
+				          &read_ahead_data_block,
+				          data_array->io_handle,
+				          data_array->descriptor_identifier,
+				          data_array_entry->data_identifier,
+				          &read_ahead_error );
+			}
+			if( read_ahead_data_block != NULL )
+			{
+				result = libpff_data_block_read_raw_file_io_handle(
+				          read_ahead_data_block,
+				          file_io_handle,
+				          read_ahead_element_offset,
+				          (size32_t) read_ahead_element_size,
+				          data_array->io_handle->file_type,
+				          &read_ahead_error );
+			}
+			if( ( result == 1 )
+			 && ( read_ahead_data_block != NULL ) )
+			{
+				read_ahead_job->element_index = data_array->read_ahead_element_index;
+				read_ahead_job->element_size  = read_ahead_element_size;
+				read_ahead_job->data_block    = read_ahead_data_block;
+				read_ahead_job->is_pending    = 0;
+				read_ahead_job->result        = 1;
+
+				read_ahead_data_block = NULL;
+			}
+			else if( read_ahead_data_block != NULL )
+			{
+				libpff_data_block_free(
+				 &read_ahead_data_block,
+				 NULL );
+			}
+		}
+		if( read_ahead_error != NULL )
+		{
+			libcerror_error_free(
+			 &read_ahead_error );
+		}
+		data_array->read_ahead_element_index += 1;
+
+		if( ( read_ahead_job->data_block == NULL )
+		 || ( ( read_ahead_job->data_block->flags & LIBPFF_DATA_BLOCK_FLAG_COMPRESSED ) == 0 )
+		 || ( ( read_ahead_job->data_block->flags & LIBPFF_DATA_BLOCK_FLAG_DECOMPRESSED ) != 0 ) )
+		{
+			continue;
+		}
+		if( read_ahead_job->deflate_context == NULL )
+		{
+			if( libpff_deflate_context_initialize(
+			     &( read_ahead_job->deflate_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create read-ahead job: %d deflate context.",
+				 function,
+				 job_index );
+
+				goto on_error;
+			}
+		}
+		read_ahead_job->is_pending = 1;
+
+		if( libcthreads_thread_pool_push(
+		     data_array->read_ahead_thread_pool,
+		     (intptr_t *) read_ahead_job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to push read-ahead job: %d onto thread pool.",
+			 function,
+			 job_index );
+
+			read_ahead_job->is_pending = 0;
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( ( read_ahead_job != NULL )
+	 && ( read_ahead_job->is_pending == 0 )
+	 && ( read_ahead_job->data_block != NULL ) )
+	{
+		libpff_data_block_free(
+		 &( read_ahead_job->data_block ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* Decrypts the data array entry data
  * Returns 1 if successful or -1 on error
  */
@@ -25,10 +25,14 @@
 #include <common.h>
 #include <types.h>
 
+#include "libpff_data_block.h"
+#include "libpff_definitions.h"
+#include "libpff_deflate_context.h"
 #include "libpff_io_handle.h"
 #include "libpff_libbfio.h"
 #include "libpff_libcdata.h"
 #include "libpff_libcerror.h"
+#include "libpff_libcthreads.h"
 #include "libpff_libfcache.h"
 #include "libpff_libfdata.h"
 #include "libpff_offsets_index.h"
@@ -37,6 +41,40 @@
 extern "C" {
 #endif
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libpff_data_array_read_ahead_job libpff_data_array_read_ahead_job_t;
+
+struct libpff_data_array_read_ahead_job
+{
+	/* The element index
+	 */
+	int element_index;
+
+	/* The element size
+	 */
+	size64_t element_size;
+
+	/* The data block
+	 * NULL represents that the read-ahead job is not in use
+	 */
+	libpff_data_block_t *data_block;
+
+	/* The deflate context
+	 */
+	libpff_deflate_context_t *deflate_context;
+
+	/* Value to indicate the data block is being decompressed by the thread pool
+	 */
+	uint8_t is_pending;
+
+	/* The result of decompressing the data block
+	 */
+	int result;
+};
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 typedef struct libpff_data_array libpff_data_array_t;
 
 struct libpff_data_array
@@ -64,6 +102,38 @@ struct libpff_data_array
 	/* The (data array) flags
 	 */
 	uint8_t flags;
+
+	/* A reference to the descriptor data list
+	 * Used to read ahead data blocks, this value is not set in a clone
+	 */
+	libfdata_list_t *descriptor_data_list;
+
+	/* The index of the element expected to be read next by a sequential reader
+	 */
+	int next_element_index;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read-ahead thread pool
+	 */
+	libcthreads_thread_pool_t *read_ahead_thread_pool;
+
+	/* The read-ahead jobs mutex
+	 */
+	libcthreads_mutex_t *read_ahead_jobs_mutex;
+
+	/* The read-ahead jobs condition
+	 * Signalled when the thread pool has finished a read-ahead job
+	 */
+	libcthreads_condition_t *read_ahead_jobs_condition;
+
+	/* The read-ahead jobs
+	 */
+	libpff_data_array_read_ahead_job_t read_ahead_jobs[ LIBPFF_MAXIMUM_NUMBER_OF_READ_AHEAD_SEGMENTS ];
+
+	/* The index of the element that follows the last element that was read ahead
+	 */
+	int read_ahead_element_index;
+#endif
 };
 
 int libpff_data_array_initialize(
@@ -107,6 +177,33 @@ int libpff_data_array_read_element_data(
      uint8_t read_flags,
      libcerror_error_t **error );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libpff_data_array_read_ahead_job_callback(
+     libpff_data_array_read_ahead_job_t *read_ahead_job,
+     libpff_data_array_t *data_array );
+
+int libpff_data_array_get_read_ahead_data_block(
+     libpff_data_array_t *data_array,
+     int element_index,
+     libpff_data_block_t **data_block,
+     libcerror_error_t **error );
+
+int libpff_data_array_element_is_cached(
+     libfcache_cache_t *cache,
+     int element_file_index,
+     off64_t element_offset,
+     libcerror_error_t **error );
+
+int libpff_data_array_read_ahead(
+     libpff_data_array_t *data_array,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *cache,
+     int element_index,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int libpff_data_array_decrypt_entry_data(
      libpff_data_array_t *data_array,
      int array_entry_index,
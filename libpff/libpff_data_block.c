@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libpff_buffer_pool.h"
 #include "libpff_checksum.h"
 #include "libpff_compression.h"
 #include "libpff_definitions.h"
@@ -138,6 +139,7 @@ int libpff_data_block_free(
      libcerror_error_t **error )
 {
 	static char *function = "libpff_data_block_free";
+	int result            = 1;
 
 	if( data_block == NULL )
 	{
@@ -154,15 +156,38 @@ int libpff_data_block_free(
 	{
 		if( ( *data_block )->data != NULL )
 		{
-			memory_free(
-			 ( *data_block )->data );
+			if( ( ( *data_block )->data_buffer_size != 0 )
+			 && ( ( *data_block )->io_handle != NULL )
+			 && ( ( *data_block )->io_handle->buffer_pool != NULL ) )
+			{
+				if( libpff_buffer_pool_release_buffer(
+				     ( *data_block )->io_handle->buffer_pool,
+				     &( ( *data_block )->data ),
+				     ( *data_block )->data_buffer_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release data.",
+					 function );
+
+					result = -1;
+				}
+			}
+			else
+			{
+				memory_free(
+				 ( *data_block )->data );
+			}
 		}
 		memory_free(
 		 *data_block );
 
 		*data_block = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Clones the data block
@@ -525,10 +550,11 @@ int libpff_data_block_read_footer_data(
 	return( 1 );
 }
 
-/* Reads the data block
+/* Reads the data block without decompressing the data
+ * The data of a compressed data block is decompressed by libpff_data_block_decompress_data
  * Returns 1 if successful or -1 on error
  */
-int libpff_data_block_read_file_io_handle(
+int libpff_data_block_read_raw_file_io_handle(
      libpff_data_block_t *data_block,
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
@@ -536,10 +562,9 @@ int libpff_data_block_read_file_io_handle(
      uint8_t file_type,
      libcerror_error_t **error )
 {
-	uint8_t *uncompressed_data            = NULL;
-	static char *function                 = "libpff_data_block_read_file_io_handle";
+	static char *function                 = "libpff_data_block_read_raw_file_io_handle";
 	size_t data_block_footer_offset       = 0;
-	size_t uncompressed_data_size         = 0;
+	ssize_t process_count                 = 0;
 	ssize_t read_count                    = 0;
 	uint64_t data_block_back_pointer      = 0;
 	uint32_t calculated_checksum          = 0;
@@ -547,6 +572,8 @@ int libpff_data_block_read_file_io_handle(
 	uint32_t data_block_increment_size    = 0;
 	uint32_t data_block_footer_size       = 0;
 	uint32_t maximum_data_block_size      = 0;
+	uint8_t decrypt_data                  = 0;
+	int result                            = 0;
 
 #if defined( HAVE_VERBOSE_OUTPUT )
 	size_t data_block_padding_size        = 0;
@@ -575,6 +602,28 @@ int libpff_data_block_read_file_io_handle(
 
 		return( -1 );
 	}
+	if( data_block->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data block - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block->io_handle->buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data block - invalid IO handle - missing buffer pool.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( file_type != LIBPFF_FILE_TYPE_32BIT )
 	 && ( file_type != LIBPFF_FILE_TYPE_64BIT )
 	 && ( file_type != LIBPFF_FILE_TYPE_64BIT_4K_PAGE ) )
@@ -649,10 +698,12 @@ int libpff_data_block_read_file_io_handle(
 
 			goto on_error;
 		}
-		data_block->data = (uint8_t *) memory_allocate(
-		                                sizeof( uint8_t ) * data_block_data_size );
-
-		if( data_block->data == NULL )
+		if( libpff_buffer_pool_get_buffer(
+		     data_block->io_handle->buffer_pool,
+		     (size_t) data_block_data_size,
+		     &( data_block->data ),
+		     &( data_block->data_buffer_size ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -754,6 +805,15 @@ int libpff_data_block_read_file_io_handle(
 				data_block->flags |= LIBPFF_DATA_BLOCK_FLAG_COMPRESSED;
 			}
 		}
+		/* Uncompressed external data of an encrypted file is decrypted as part of the read
+		 * the other cases are handled by libpff_data_block_decrypt_data
+		 */
+		if( ( ( data_block->flags & LIBPFF_DATA_BLOCK_FLAG_COMPRESSED ) == 0 )
+		 && ( ( data_block->data_identifier & LIBPFF_OFFSET_INDEX_IDENTIFIER_FLAG_INTERNAL ) == 0 )
+		 && ( data_block->io_handle->encryption_type != LIBPFF_ENCRYPTION_TYPE_NONE ) )
+		{
+			decrypt_data = 1;
+		}
 		if( ( data_block->flags & LIBPFF_DATA_BLOCK_FLAG_VALIDATED ) == 0 )
 		{
 			if( data_block->data_size != 0 )
@@ -777,12 +837,57 @@ int libpff_data_block_read_file_io_handle(
 			}
 			if( data_block->stored_checksum != 0 )
 			{
-				if( libpff_checksum_calculate_weak_crc32(
-				     &calculated_checksum,
-				     data_block->data,
-				     (size_t) data_size,
-				     0,
-				     error ) != 1 )
+				result = libpff_io_handle_check_if_checksum_should_be_verified(
+				          data_block->io_handle,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine if checksum should be verified.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( result != 0 )
+			{
+				/* If the data will be decrypted, calculate the checksum and decrypt
+				 * the data in a single pass
+				 */
+				if( decrypt_data != 0 )
+				{
+					process_count = libpff_encryption_decrypt_with_weak_crc32(
+					                 data_block->io_handle->encryption_type,
+					                 (uint32_t) data_block->data_identifier,
+					                 data_block->data,
+					                 (size_t) data_size,
+					                 &calculated_checksum,
+					                 0,
+					                 error );
+
+					if( process_count != (ssize_t) data_size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+						 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+						 "%s: unable to decrypt data block data.",
+						 function );
+
+						goto on_error;
+					}
+					data_block->flags |= LIBPFF_DATA_BLOCK_FLAG_DECRYPTED;
+				}
+				else if( libpff_checksum_calculate_weak_crc32(
+				          &calculated_checksum,
+				          data_block->data,
+				          (size_t) data_size,
+				          0,
+				          error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
@@ -807,6 +912,8 @@ int libpff_data_block_read_file_io_handle(
 #endif
 					data_block->flags |= LIBPFF_DATA_BLOCK_FLAG_CRC_MISMATCH;
 
+					data_block->io_handle->number_of_checksum_mismatches += 1;
+
 /* TODO smart error handling */
 				}
 			}
@@ -832,78 +939,293 @@ int libpff_data_block_read_file_io_handle(
 			}
 			data_block->flags |= LIBPFF_DATA_BLOCK_FLAG_VALIDATED;
 		}
-/* TODO refactor after testing */
-		if( ( data_block->flags & LIBPFF_DATA_BLOCK_FLAG_COMPRESSED ) != 0 )
+		if( ( decrypt_data != 0 )
+		 && ( ( data_block->flags & LIBPFF_DATA_BLOCK_FLAG_DECRYPTED ) == 0 ) )
 		{
-			uncompressed_data_size = (size_t) data_block->uncompressed_data_size;
-
-			if( ( uncompressed_data_size == 0 )
-			 || ( uncompressed_data_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+			process_count = libpff_encryption_decrypt(
+			                 data_block->io_handle->encryption_type,
+			                 (uint32_t) data_block->data_identifier,
+			                 data_block->data,
+			                 (size_t) data_block->data_size,
+			                 error );
+
+			if( process_count != (ssize_t) data_block->data_size )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid uncompressed data size value out of bounds.",
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+				 "%s: unable to decrypt data block data.",
 				 function );
 
 				goto on_error;
 			}
-			uncompressed_data = (uint8_t *) memory_allocate(
-			                                 sizeof( uint8_t ) * uncompressed_data_size );
+			data_block->flags |= LIBPFF_DATA_BLOCK_FLAG_DECRYPTED;
+		}
+	}
+	return( 1 );
 
-			if( uncompressed_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create uncompressed data.",
-				 function );
+on_error:
+	if( data_block->data != NULL )
+	{
+		libpff_buffer_pool_release_buffer(
+		 data_block->io_handle->buffer_pool,
+		 &( data_block->data ),
+		 data_block->data_buffer_size,
+		 NULL );
+	}
+	data_block->data_buffer_size = 0;
+	data_block->data_size        = 0;
 
-				goto on_error;
-			}
-			if( libpff_decompress_data(
-			     data_block->data,
-			     (size_t) data_block->data_size,
-			     LIBPFF_COMPRESSION_METHOD_DEFLATE,
-			     uncompressed_data,
-			     &uncompressed_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-				 "%s: unable to decompress data block data.",
-				 function );
+	return( -1 );
+}
 
-				goto on_error;
-			}
-			memory_free(
-			 data_block->data );
+/* Reads the data block
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_data_block_read_file_io_handle(
+     libpff_data_block_t *data_block,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size32_t data_size,
+     uint8_t file_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_data_block_read_file_io_handle";
+
+	if( libpff_data_block_read_raw_file_io_handle(
+	     data_block,
+	     file_io_handle,
+	     file_offset,
+	     data_size,
+	     file_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block.",
+		 function );
 
-			data_block->data      = uncompressed_data;
-			data_block->data_size = data_block->uncompressed_data_size;
-			uncompressed_data     = NULL;
-		}
+		return( -1 );
+	}
+	if( libpff_data_block_decompress_data(
+	     data_block,
+	     data_block->io_handle->deflate_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data block.",
+		 function );
+
+		return( -1 );
 	}
 	return( 1 );
+}
+
+/* Tries to read the data block
+ * Recovery probes offsets that are not expected to contain a valid data block,
+ * hence this function does not construct an error when the data block is invalid
+ * Returns 1 if successful, 0 if the data block could not be read or -1 on invalid arguments
+ */
+int libpff_data_block_try_read_file_io_handle(
+     libpff_data_block_t *data_block,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size32_t data_size,
+     uint8_t file_type )
+{
+	if( data_block == NULL )
+	{
+		return( -1 );
+	}
+	if( data_block->io_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( libpff_data_block_read_raw_file_io_handle(
+	     data_block,
+	     file_io_handle,
+	     file_offset,
+	     data_size,
+	     file_type,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( libpff_data_block_decompress_data(
+	     data_block,
+	     data_block->io_handle->deflate_context,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Decompresses the data of a compressed data block
+ * The data is decompressed directly into the buffer that is kept by the data block
+ * This function does not use the IO handle other than its buffer pool, hence it can be called
+ * from a thread other than the one reading the file as long as each thread uses its own deflate context
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_data_block_decompress_data(
+     libpff_data_block_t *data_block,
+     libpff_deflate_context_t *deflate_context,
+     libcerror_error_t **error )
+{
+	uint8_t *uncompressed_data           = NULL;
+	static char *function                = "libpff_data_block_decompress_data";
+	size_t uncompressed_data_buffer_size = 0;
+	size_t uncompressed_data_size        = 0;
+
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_block->flags & LIBPFF_DATA_BLOCK_FLAG_COMPRESSED ) == 0 )
+	{
+		return( 1 );
+	}
+	if( ( data_block->flags & LIBPFF_DATA_BLOCK_FLAG_DECOMPRESSED ) != 0 )
+	{
+		return( 1 );
+	}
+	if( data_block->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data block - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data block - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block->io_handle->buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data block - invalid IO handle - missing buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	uncompressed_data_size = (size_t) data_block->uncompressed_data_size;
+
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_buffer_pool_get_buffer(
+	     data_block->io_handle->buffer_pool,
+	     uncompressed_data_size,
+	     &uncompressed_data,
+	     &uncompressed_data_buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_decompress_data_with_context(
+	     deflate_context,
+	     data_block->data,
+	     (size_t) data_block->data_size,
+	     LIBPFF_COMPRESSION_METHOD_DEFLATE,
+	     uncompressed_data,
+	     &uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data block data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The compressed data buffer is returned to the buffer pool for reuse
+	 */
+	if( libpff_buffer_pool_release_buffer(
+	     data_block->io_handle->buffer_pool,
+	     &( data_block->data ),
+	     data_block->data_buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release data block data.",
+		 function );
+
+		goto on_error;
+	}
+	data_block->data              = uncompressed_data;
+	data_block->data_buffer_size  = uncompressed_data_buffer_size;
+	data_block->data_size         = data_block->uncompressed_data_size;
+	data_block->flags            |= LIBPFF_DATA_BLOCK_FLAG_DECOMPRESSED;
+
+	return( 1 );
 
 on_error:
 	if( uncompressed_data != NULL )
 	{
-		memory_free(
-		 uncompressed_data );
+		libpff_buffer_pool_release_buffer(
+		 data_block->io_handle->buffer_pool,
+		 &uncompressed_data,
+		 uncompressed_data_buffer_size,
+		 NULL );
 	}
 	if( data_block->data != NULL )
 	{
-		memory_free(
-		 data_block->data );
-
-		data_block->data = NULL;
+		libpff_buffer_pool_release_buffer(
+		 data_block->io_handle->buffer_pool,
+		 &( data_block->data ),
+		 data_block->data_buffer_size,
+		 NULL );
 	}
-	data_block->data_size = 0;
+	data_block->data_buffer_size = 0;
+	data_block->data_size        = 0;
 
 	return( -1 );
 }
@@ -1068,6 +1390,12 @@ int libpff_data_block_decrypt_data(
 
 		return( -1 );
 	}
+	/* The data was already decrypted while the data block was read
+	 */
+	if( ( data_block->flags & LIBPFF_DATA_BLOCK_FLAG_DECRYPTED ) != 0 )
+	{
+		return( 1 );
+	}
 	encryption_type = data_block->io_handle->encryption_type;
 
 	/* Check if internal (unencrypted) flag in the (data) offset index identifier is not set
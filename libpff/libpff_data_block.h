@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libpff_deflate_context.h"
 #include "libpff_io_handle.h"
 #include "libpff_libbfio.h"
 #include "libpff_libcerror.h"
@@ -55,6 +56,11 @@ struct libpff_data_block
 	 */
 	uint8_t *data;
 
+	/* The size of the data buffer allocated from the buffer pool of the IO handle
+	 * 0 if the data was not allocated from the buffer pool
+	 */
+	size_t data_buffer_size;
+
 	/* The (block data) size
 	 */
 	size_t size;
@@ -99,6 +105,14 @@ int libpff_data_block_read_footer_data(
      uint8_t file_type,
      libcerror_error_t **error );
 
+int libpff_data_block_read_raw_file_io_handle(
+     libpff_data_block_t *data_block,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size32_t data_size,
+     uint8_t file_type,
+     libcerror_error_t **error );
+
 int libpff_data_block_read_file_io_handle(
      libpff_data_block_t *data_block,
      libbfio_handle_t *file_io_handle,
@@ -107,6 +121,18 @@ int libpff_data_block_read_file_io_handle(
      uint8_t file_type,
      libcerror_error_t **error );
 
+int libpff_data_block_try_read_file_io_handle(
+     libpff_data_block_t *data_block,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size32_t data_size,
+     uint8_t file_type );
+
+int libpff_data_block_decompress_data(
+     libpff_data_block_t *data_block,
+     libpff_deflate_context_t *deflate_context,
+     libcerror_error_t **error );
+
 int libpff_data_block_read_element_data(
      libpff_data_block_t *data_block,
      libbfio_handle_t *file_io_handle,
@@ -26,10 +26,16 @@
 
 #include "libpff_bit_stream.h"
 #include "libpff_deflate.h"
+#include "libpff_deflate_context.h"
 #include "libpff_huffman_tree.h"
 #include "libpff_libcerror.h"
 #include "libpff_libcnotify.h"
 
+#if defined( LIBPFF_DEFLATE_HAVE_SIMD_ADLER32 )
+#include <emmintrin.h>
+#include <immintrin.h>
+#endif
+
 const uint8_t libpff_deflate_code_sizes_sequence[ 19 ]  = {
 	16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2,
         14, 1, 15 };
@@ -457,14 +463,33 @@ int libpff_deflate_decode_huffman(
      size_t *uncompressed_data_offset,
      libcerror_error_t **error )
 {
+	uint8_t match_pattern[ 8 ];
+
 	static char *function         = "libpff_deflate_decode_huffman";
 	size_t data_offset            = 0;
+	size_t match_end_offset       = 0;
+	size_t match_offset           = 0;
 	uint32_t extra_bits           = 0;
+	uint32_t lookup_value         = 0;
 	uint16_t compression_offset   = 0;
 	uint16_t compression_size     = 0;
+	uint16_t match_step           = 0;
 	uint16_t number_of_extra_bits = 0;
 	uint16_t symbol               = 0;
+	uint8_t code_size             = 0;
+	uint8_t pattern_index         = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
 
+		return( -1 );
+	}
 	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
@@ -502,6 +527,27 @@ int libpff_deflate_decode_huffman(
 
 	do
 	{
+		/* Refill the bit buffer once per symbol so that a literal or a length
+		 * and distance pair, including their extra bits, can be decoded from
+		 * the bit buffer without additional reads
+		 */
+		if( bit_stream->bit_buffer_size < 48 )
+		{
+			if( libpff_bit_stream_read(
+			     bit_stream,
+			     48,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to read bits.",
+				 function );
+
+				return( -1 );
+			}
+		}
 		if( libpff_huffman_tree_get_symbol_from_bit_stream(
 		     literals_tree,
 		     bit_stream,
@@ -531,6 +577,30 @@ int libpff_deflate_decode_huffman(
 				return( -1 );
 			}
 			uncompressed_data[ data_offset++ ] = (uint8_t) symbol;
+
+			/* Decode successive literals directly from the primary lookup table
+			 * while the bit buffer contains sufficient bits
+			 */
+			while( ( literals_tree->lookup_table_bits != 0 )
+			    && ( bit_stream->bit_buffer_size >= literals_tree->lookup_table_bits )
+			    && ( data_offset < uncompressed_data_size ) )
+			{
+				lookup_value = literals_tree->lookup_table[ libpff_bit_stream_peek_bits( bit_stream, literals_tree->lookup_table_bits ) ];
+
+				code_size = (uint8_t) ( lookup_value & LIBPFF_HUFFMAN_TREE_LOOKUP_ENTRY_SIZE_MASK );
+
+				if( ( ( lookup_value & LIBPFF_HUFFMAN_TREE_LOOKUP_ENTRY_FLAG_SUB_TABLE ) != 0 )
+				 || ( code_size == 0 )
+				 || ( ( lookup_value >> 8 ) >= 256 ) )
+				{
+					break;
+				}
+				libpff_bit_stream_skip_bits(
+				 bit_stream,
+				 code_size );
+
+				uncompressed_data[ data_offset++ ] = (uint8_t) ( lookup_value >> 8 );
+			}
 		}
 		else if( ( symbol > 256 )
 		      && ( symbol < 286 ) )
@@ -539,11 +609,21 @@ int libpff_deflate_decode_huffman(
 
 			number_of_extra_bits = libpff_deflate_literal_codes_number_of_extra_bits[ symbol ];
 
-			if( libpff_bit_stream_get_value(
-			     bit_stream,
-			     (uint8_t) number_of_extra_bits,
-			     &extra_bits,
-			     error ) != 1 )
+			if( number_of_extra_bits <= bit_stream->bit_buffer_size )
+			{
+				extra_bits = libpff_bit_stream_peek_bits(
+				              bit_stream,
+				              number_of_extra_bits );
+
+				libpff_bit_stream_skip_bits(
+				 bit_stream,
+				 number_of_extra_bits );
+			}
+			else if( libpff_bit_stream_get_value(
+			          bit_stream,
+			          (uint8_t) number_of_extra_bits,
+			          &extra_bits,
+			          error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
@@ -573,11 +653,21 @@ int libpff_deflate_decode_huffman(
 			}
 			number_of_extra_bits = libpff_deflate_distance_codes_number_of_extra_bits[ symbol ];
 
-			if( libpff_bit_stream_get_value(
-			     bit_stream,
-			     (uint8_t) number_of_extra_bits,
-			     &extra_bits,
-			     error ) != 1 )
+			if( number_of_extra_bits <= bit_stream->bit_buffer_size )
+			{
+				extra_bits = libpff_bit_stream_peek_bits(
+				              bit_stream,
+				              number_of_extra_bits );
+
+				libpff_bit_stream_skip_bits(
+				 bit_stream,
+				 number_of_extra_bits );
+			}
+			else if( libpff_bit_stream_get_value(
+			          bit_stream,
+			          (uint8_t) number_of_extra_bits,
+			          &extra_bits,
+			          error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
@@ -612,12 +702,85 @@ int libpff_deflate_decode_huffman(
 
 				return( -1 );
 			}
-			while( compression_size > 0 )
+			/* Near the end of the uncompressed data copy the match byte by byte
+			 * otherwise copy 8 bytes at a time, which can write up to 7 bytes
+			 * beyond the end of the match
+			 */
+			if( ( uncompressed_data_size - data_offset ) < ( (size_t) compression_size + 8 ) )
+			{
+				while( compression_size > 0 )
+				{
+					uncompressed_data[ data_offset ] = uncompressed_data[ data_offset - compression_offset ];
+
+					data_offset++;
+					compression_size--;
+				}
+			}
+			else
 			{
-				uncompressed_data[ data_offset ] = uncompressed_data[ data_offset - compression_offset ];
+				match_end_offset = data_offset + compression_size;
 
-				data_offset++;
-				compression_size--;
+				if( compression_offset >= 8 )
+				{
+					/* The source and destination of each 8 byte copy do not overlap
+					 */
+					match_offset = data_offset - compression_offset;
+
+					while( data_offset < match_end_offset )
+					{
+						if( memory_copy(
+						     &( uncompressed_data[ data_offset ] ),
+						     &( uncompressed_data[ match_offset ] ),
+						     8 ) == NULL )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_MEMORY,
+							 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+							 "%s: unable to copy match.",
+							 function );
+
+							return( -1 );
+						}
+						data_offset  += 8;
+						match_offset += 8;
+					}
+				}
+				else
+				{
+					/* Broadcast the repeating pattern of a short distance match into 8 bytes
+					 * and write it in steps of the largest multiple of the distance
+					 */
+					match_offset = data_offset - compression_offset;
+
+					for( pattern_index = 0;
+					     pattern_index < 8;
+					     pattern_index++ )
+					{
+						match_pattern[ pattern_index ] = uncompressed_data[ match_offset + ( pattern_index % compression_offset ) ];
+					}
+					match_step = compression_offset * ( 8 / compression_offset );
+
+					while( data_offset < match_end_offset )
+					{
+						if( memory_copy(
+						     &( uncompressed_data[ data_offset ] ),
+						     match_pattern,
+						     8 ) == NULL )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_MEMORY,
+							 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+							 "%s: unable to copy match.",
+							 function );
+
+							return( -1 );
+						}
+						data_offset += match_step;
+					}
+				}
+				data_offset = match_end_offset;
 			}
 		}
 		else if( symbol != 256 )
@@ -640,6 +803,187 @@ int libpff_deflate_decode_huffman(
 	return( 1 );
 }
 
+#if defined( LIBPFF_DEFLATE_HAVE_SIMD_ADLER32 )
+
+/* Determines if the CPU supports the SSE2 instructions
+ * Returns 1 if supported or 0 if not
+ */
+int libpff_deflate_have_sse2(
+     void )
+{
+	if( __builtin_cpu_supports( "sse2" ) != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Determines if the CPU supports the AVX2 instructions
+ * Returns 1 if supported or 0 if not
+ */
+int libpff_deflate_have_avx2(
+     void )
+{
+	if( __builtin_cpu_supports( "avx2" ) != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Updates the Adler-32 lower and upper words of a buffer using SSE2
+ * The data is processed in blocks of 16 bytes and the words are reduced
+ * modulo 65521 per 5552 bytes
+ * Returns the number of bytes processed
+ */
+__attribute__((target("sse2"))) \
+static size_t libpff_deflate_update_adler32_sse2(
+               uint32_t *lower_word,
+               uint32_t *upper_word,
+               const uint8_t *data,
+               size_t data_size )
+{
+	__m128i weights_high   = _mm_setr_epi16( 16, 15, 14, 13, 12, 11, 10, 9 );
+	__m128i weights_low    = _mm_setr_epi16( 8, 7, 6, 5, 4, 3, 2, 1 );
+	__m128i zero           = _mm_setzero_si128();
+	__m128i data_bytes     = _mm_setzero_si128();
+	__m128i lower_sums     = _mm_setzero_si128();
+	__m128i prefix_sums    = _mm_setzero_si128();
+	__m128i upper_sums     = _mm_setzero_si128();
+	size_t block_end_offset = 0;
+	size_t data_offset     = 0;
+	uint32_t safe_lower    = *lower_word;
+	uint32_t safe_upper    = *upper_word;
+
+	while( ( data_size - data_offset ) >= 16 )
+	{
+		block_end_offset = ( data_size - data_offset ) & ~( (size_t) 15 );
+
+		if( block_end_offset > 5552 )
+		{
+			block_end_offset = 5552;
+		}
+		/* Every byte in the block adds the lower word of the start of the block to the upper word
+		 */
+		safe_upper += safe_lower * (uint32_t) block_end_offset;
+
+		block_end_offset += data_offset;
+
+		lower_sums  = _mm_setzero_si128();
+		prefix_sums = _mm_setzero_si128();
+		upper_sums  = _mm_setzero_si128();
+
+		while( data_offset < block_end_offset )
+		{
+			data_bytes = _mm_loadu_si128( (const __m128i *) &( data[ data_offset ] ) );
+
+			prefix_sums = _mm_add_epi32( prefix_sums, lower_sums );
+			lower_sums  = _mm_add_epi32( lower_sums, _mm_sad_epu8( data_bytes, zero ) );
+			upper_sums  = _mm_add_epi32( upper_sums, _mm_madd_epi16( _mm_unpacklo_epi8( data_bytes, zero ), weights_high ) );
+			upper_sums  = _mm_add_epi32( upper_sums, _mm_madd_epi16( _mm_unpackhi_epi8( data_bytes, zero ), weights_low ) );
+
+			data_offset += 16;
+		}
+		upper_sums = _mm_add_epi32( upper_sums, _mm_slli_epi32( prefix_sums, 4 ) );
+
+		/* Add the 4 x 32-bit sums horizontally
+		 */
+		lower_sums = _mm_add_epi32( lower_sums, _mm_shuffle_epi32( lower_sums, 0x4e ) );
+		lower_sums = _mm_add_epi32( lower_sums, _mm_shuffle_epi32( lower_sums, 0xb1 ) );
+		upper_sums = _mm_add_epi32( upper_sums, _mm_shuffle_epi32( upper_sums, 0x4e ) );
+		upper_sums = _mm_add_epi32( upper_sums, _mm_shuffle_epi32( upper_sums, 0xb1 ) );
+
+		safe_lower += (uint32_t) _mm_cvtsi128_si32( lower_sums );
+		safe_upper += (uint32_t) _mm_cvtsi128_si32( upper_sums );
+
+		safe_lower %= 65521;
+		safe_upper %= 65521;
+	}
+	*lower_word = safe_lower;
+	*upper_word = safe_upper;
+
+	return( data_offset );
+}
+
+/* Updates the Adler-32 lower and upper words of a buffer using AVX2
+ * The data is processed in blocks of 32 bytes and the words are reduced
+ * modulo 65521 per 5536 bytes
+ * Returns the number of bytes processed
+ */
+__attribute__((target("avx2"))) \
+static size_t libpff_deflate_update_adler32_avx2(
+               uint32_t *lower_word,
+               uint32_t *upper_word,
+               const uint8_t *data,
+               size_t data_size )
+{
+	__m256i weights         = _mm256_setr_epi8(
+	                           32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+	                           16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 );
+	__m256i ones            = _mm256_set1_epi16( 1 );
+	__m256i zero            = _mm256_setzero_si256();
+	__m256i data_bytes      = _mm256_setzero_si256();
+	__m256i lower_sums      = _mm256_setzero_si256();
+	__m256i prefix_sums     = _mm256_setzero_si256();
+	__m256i upper_sums      = _mm256_setzero_si256();
+	__m128i lower_sums_128  = _mm_setzero_si128();
+	__m128i upper_sums_128  = _mm_setzero_si128();
+	size_t block_end_offset = 0;
+	size_t data_offset      = 0;
+	uint32_t safe_lower     = *lower_word;
+	uint32_t safe_upper     = *upper_word;
+
+	while( ( data_size - data_offset ) >= 32 )
+	{
+		block_end_offset = ( data_size - data_offset ) & ~( (size_t) 31 );
+
+		if( block_end_offset > 5536 )
+		{
+			block_end_offset = 5536;
+		}
+		safe_upper += safe_lower * (uint32_t) block_end_offset;
+
+		block_end_offset += data_offset;
+
+		lower_sums  = _mm256_setzero_si256();
+		prefix_sums = _mm256_setzero_si256();
+		upper_sums  = _mm256_setzero_si256();
+
+		while( data_offset < block_end_offset )
+		{
+			data_bytes = _mm256_loadu_si256( (const __m256i *) &( data[ data_offset ] ) );
+
+			prefix_sums = _mm256_add_epi32( prefix_sums, lower_sums );
+			lower_sums  = _mm256_add_epi32( lower_sums, _mm256_sad_epu8( data_bytes, zero ) );
+			upper_sums  = _mm256_add_epi32( upper_sums, _mm256_madd_epi16( _mm256_maddubs_epi16( data_bytes, weights ), ones ) );
+
+			data_offset += 32;
+		}
+		upper_sums = _mm256_add_epi32( upper_sums, _mm256_slli_epi32( prefix_sums, 5 ) );
+
+		/* Add the 8 x 32-bit sums horizontally
+		 */
+		lower_sums_128 = _mm_add_epi32( _mm256_castsi256_si128( lower_sums ), _mm256_extracti128_si256( lower_sums, 1 ) );
+		lower_sums_128 = _mm_add_epi32( lower_sums_128, _mm_shuffle_epi32( lower_sums_128, 0x4e ) );
+		lower_sums_128 = _mm_add_epi32( lower_sums_128, _mm_shuffle_epi32( lower_sums_128, 0xb1 ) );
+		upper_sums_128 = _mm_add_epi32( _mm256_castsi256_si128( upper_sums ), _mm256_extracti128_si256( upper_sums, 1 ) );
+		upper_sums_128 = _mm_add_epi32( upper_sums_128, _mm_shuffle_epi32( upper_sums_128, 0x4e ) );
+		upper_sums_128 = _mm_add_epi32( upper_sums_128, _mm_shuffle_epi32( upper_sums_128, 0xb1 ) );
+
+		safe_lower += (uint32_t) _mm_cvtsi128_si32( lower_sums_128 );
+		safe_upper += (uint32_t) _mm_cvtsi128_si32( upper_sums_128 );
+
+		safe_lower %= 65521;
+		safe_upper %= 65521;
+	}
+	*lower_word = safe_lower;
+	*upper_word = safe_upper;
+
+	return( data_offset );
+}
+
+#endif /* defined( LIBPFF_DEFLATE_HAVE_SIMD_ADLER32 ) */
+
 /* Calculates the little-endian Adler-32 of a buffer
  * It uses the initial value to calculate a new Adler-32
  * Returns 1 if successful or -1 on error
@@ -694,6 +1038,28 @@ int libpff_deflate_calculate_adler32(
 	lower_word = initial_value & 0xffff;
 	upper_word = ( initial_value >> 16 ) & 0xffff;
 
+#if defined( LIBPFF_DEFLATE_HAVE_SIMD_ADLER32 )
+	if( data_size >= 64 )
+	{
+		if( libpff_deflate_have_avx2() != 0 )
+		{
+			data_offset = libpff_deflate_update_adler32_avx2(
+			               &lower_word,
+			               &upper_word,
+			               data,
+			               data_size );
+		}
+		else if( libpff_deflate_have_sse2() != 0 )
+		{
+			data_offset = libpff_deflate_update_adler32_sse2(
+			               &lower_word,
+			               &upper_word,
+			               data,
+			               data_size );
+		}
+		data_size -= data_offset;
+	}
+#endif
 	while( data_size >= 0x15b0 )
 	{
 		/* The modulo calculation is needed per 5552 (0x15b0) bytes
@@ -1125,19 +1491,19 @@ int libpff_deflate_read_block(
      uint8_t block_type,
      libpff_huffman_tree_t *fixed_huffman_literals_tree,
      libpff_huffman_tree_t *fixed_huffman_distances_tree,
+     libpff_huffman_tree_t *dynamic_huffman_literals_tree,
+     libpff_huffman_tree_t *dynamic_huffman_distances_tree,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
      libcerror_error_t **error )
 {
-	libpff_huffman_tree_t *dynamic_huffman_distances_tree = NULL;
-	libpff_huffman_tree_t *dynamic_huffman_literals_tree  = NULL;
-	static char *function                                 = "libpff_deflate_read_block";
-	size_t safe_uncompressed_data_offset                  = 0;
-	uint32_t block_size                                   = 0;
-	uint32_t block_size_copy                              = 0;
-	uint32_t value_32bit                                  = 0;
-	uint8_t skip_bits                                     = 0;
+	static char *function                = "libpff_deflate_read_block";
+	size_t safe_uncompressed_data_offset = 0;
+	uint32_t block_size                  = 0;
+	uint32_t block_size_copy             = 0;
+	uint32_t value_32bit                 = 0;
+	uint8_t skip_bits                    = 0;
 
 	if( bit_stream == NULL )
 	{
@@ -1241,6 +1607,12 @@ int libpff_deflate_read_block(
 
 				goto on_error;
 			}
+			/* Return the bytes remaining in the bit stream buffer to the byte stream
+			 */
+			bit_stream->byte_stream_offset -= bit_stream->bit_buffer_size >> 3;
+			bit_stream->bit_buffer          = 0;
+			bit_stream->bit_buffer_size     = 0;
+
 			if( block_size == 0 )
 			{
 				break;
@@ -1313,36 +1685,6 @@ int libpff_deflate_read_block(
 			break;
 
 		case LIBPFF_DEFLATE_BLOCK_TYPE_HUFFMAN_DYNAMIC:
-			if( libpff_huffman_tree_initialize(
-			     &dynamic_huffman_literals_tree,
-			     288,
-			     15,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to build dynamic literals Huffman tree.",
-				 function );
-
-				goto on_error;
-			}
-			if( libpff_huffman_tree_initialize(
-			     &dynamic_huffman_distances_tree,
-			     30,
-			     15,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to build dynamic distances Huffman tree.",
-				 function );
-
-				goto on_error;
-			}
 			if( libpff_deflate_build_dynamic_huffman_trees(
 			     bit_stream,
 			     dynamic_huffman_literals_tree,
@@ -1376,32 +1718,6 @@ int libpff_deflate_read_block(
 
 				goto on_error;
 			}
-			if( libpff_huffman_tree_free(
-			     &dynamic_huffman_distances_tree,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free dynamic distances Huffman tree.",
-				 function );
-
-				goto on_error;
-			}
-			if( libpff_huffman_tree_free(
-			     &dynamic_huffman_literals_tree,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free dynamic literals Huffman tree.",
-				 function );
-
-				goto on_error;
-			}
 			break;
 
 		case LIBPFF_DEFLATE_BLOCK_TYPE_RESERVED:
@@ -1420,126 +1736,48 @@ int libpff_deflate_read_block(
 	return( 1 );
 
 on_error:
-	if( dynamic_huffman_distances_tree != NULL )
-	{
-		libpff_huffman_tree_free(
-		 &dynamic_huffman_distances_tree,
-		 NULL );
-	}
-	if( dynamic_huffman_literals_tree != NULL )
-	{
-		libpff_huffman_tree_free(
-		 &dynamic_huffman_literals_tree,
-		 NULL );
-	}
 	return( -1 );
 }
 
-/* Decompresses data using deflate compression
+/* Reads the blocks of compressed data from the bit stream of the deflate context
  * Returns 1 on success or -1 on error
  */
-int libpff_deflate_decompress(
-     const uint8_t *compressed_data,
-     size_t compressed_data_size,
+int libpff_deflate_read_blocks(
+     libpff_deflate_context_t *deflate_context,
      uint8_t *uncompressed_data,
-     size_t *uncompressed_data_size,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
      libcerror_error_t **error )
 {
-	libpff_bit_stream_t *bit_stream                     = NULL;
-	libpff_huffman_tree_t *fixed_huffman_distances_tree = NULL;
-	libpff_huffman_tree_t *fixed_huffman_literals_tree  = NULL;
-	static char *function                               = "libpff_deflate_decompress";
-	size_t compressed_data_offset                       = 0;
-	size_t safe_uncompressed_data_size                  = 0;
-	size_t uncompressed_data_offset                     = 0;
-	uint8_t block_type                                  = 0;
-	uint8_t last_block_flag                             = 0;
-
-	if( compressed_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
-		 function );
-
-		return( -1 );
-	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( uncompressed_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
-		 function );
+	libpff_bit_stream_t *bit_stream = NULL;
+	static char *function           = "libpff_deflate_read_blocks";
+	uint8_t block_type              = 0;
+	uint8_t last_block_flag         = 0;
 
-		return( -1 );
-	}
-	if( uncompressed_data_size == NULL )
+	if( deflate_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data size.",
+		 "%s: invalid deflate context.",
 		 function );
 
 		return( -1 );
 	}
-	safe_uncompressed_data_size = *uncompressed_data_size;
-
-	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( compressed_data_offset >= compressed_data_size )
+	if( deflate_context->bit_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid compressed data value too small.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid deflate context - missing bit stream.",
 		 function );
 
 		return( -1 );
 	}
-	if( libpff_bit_stream_initialize(
-	     &bit_stream,
-	     compressed_data,
-	     compressed_data_size,
-	     compressed_data_offset,
-	     LIBPFF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create bit stream.",
-		 function );
+	bit_stream = deflate_context->bit_stream;
 
-		goto on_error;
-	}
 	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
 	{
 		if( libpff_deflate_read_block_header(
@@ -1555,68 +1793,19 @@ int libpff_deflate_decompress(
 			 "%s: unable to read compressed data block header.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( block_type == LIBPFF_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED )
-		{
-			if( ( fixed_huffman_literals_tree == NULL )
-			 && ( fixed_huffman_distances_tree == NULL ) )
-			{
-				if( libpff_huffman_tree_initialize(
-				     &fixed_huffman_literals_tree,
-				     288,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed literals Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( libpff_huffman_tree_initialize(
-				     &fixed_huffman_distances_tree,
-				     30,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed distances Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( libpff_deflate_build_fixed_huffman_trees(
-				     fixed_huffman_literals_tree,
-				     fixed_huffman_distances_tree,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed Huffman trees.",
-					 function );
-
-					goto on_error;
-				}
-			}
-		}
-		if( libpff_deflate_read_block(
-		     bit_stream,
-		     block_type,
-		     fixed_huffman_literals_tree,
-		     fixed_huffman_distances_tree,
-		     uncompressed_data,
-		     safe_uncompressed_data_size,
-		     &uncompressed_data_offset,
-		     error ) != 1 )
+		if( libpff_deflate_read_block(
+		     bit_stream,
+		     block_type,
+		     deflate_context->fixed_huffman_literals_tree,
+		     deflate_context->fixed_huffman_distances_tree,
+		     deflate_context->dynamic_huffman_literals_tree,
+		     deflate_context->dynamic_huffman_distances_tree,
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     uncompressed_data_offset,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1625,82 +1814,213 @@ int libpff_deflate_decompress(
 			 "%s: unable to read block of compressed data.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( last_block_flag != 0 )
 		{
 			break;
 		}
 	}
-	if( fixed_huffman_distances_tree != NULL )
+	return( 1 );
+}
+
+/* Decompresses data using deflate compression
+ * Returns 1 on success or -1 on error
+ */
+int libpff_deflate_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	libpff_deflate_context_t *deflate_context = NULL;
+	static char *function                     = "libpff_deflate_decompress";
+
+	if( libpff_deflate_context_initialize(
+	     &deflate_context,
+	     error ) != 1 )
 	{
-		if( libpff_huffman_tree_free(
-		     &fixed_huffman_distances_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed distances Huffman tree.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create deflate context.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	if( fixed_huffman_literals_tree != NULL )
+	if( libpff_deflate_decompress_with_context(
+	     deflate_context,
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
 	{
-		if( libpff_huffman_tree_free(
-		     &fixed_huffman_literals_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed literals Huffman tree.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	if( libpff_bit_stream_free(
-	     &bit_stream,
+	if( libpff_deflate_context_free(
+	     &deflate_context,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free bit stream.",
+		 "%s: unable to free deflate context.",
 		 function );
 
 		goto on_error;
 	}
-	*uncompressed_data_size = uncompressed_data_offset;
-
 	return( 1 );
 
 on_error:
-	if( fixed_huffman_distances_tree != NULL )
+	if( deflate_context != NULL )
 	{
-		libpff_huffman_tree_free(
-		 &fixed_huffman_distances_tree,
+		libpff_deflate_context_free(
+		 &deflate_context,
 		 NULL );
 	}
-	if( fixed_huffman_literals_tree != NULL )
+	return( -1 );
+}
+
+/* Decompresses data using deflate compression and a reusable deflate context
+ * Returns 1 on success or -1 on error
+ */
+int libpff_deflate_decompress_with_context(
+     libpff_deflate_context_t *deflate_context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "libpff_deflate_decompress_with_context";
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+
+	if( deflate_context == NULL )
 	{
-		libpff_huffman_tree_free(
-		 &fixed_huffman_literals_tree,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate context.",
+		 function );
+
+		return( -1 );
 	}
-	if( bit_stream != NULL )
+	if( compressed_data == NULL )
 	{
-		libpff_bit_stream_free(
-		 &bit_stream,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_deflate_context_set_byte_stream(
+	     deflate_context,
+	     compressed_data,
+	     compressed_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_deflate_read_blocks(
+	     deflate_context,
+	     uncompressed_data,
+	     safe_uncompressed_data_size,
+	     &uncompressed_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read blocks of compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
 }
 
 /* Decompresses data using zlib compression
@@ -1713,18 +2033,94 @@ int libpff_deflate_decompress_zlib(
      size_t *uncompressed_data_size,
      libcerror_error_t **error )
 {
-	libpff_bit_stream_t *bit_stream                     = NULL;
-	libpff_huffman_tree_t *fixed_huffman_distances_tree = NULL;
-	libpff_huffman_tree_t *fixed_huffman_literals_tree  = NULL;
-	static char *function                               = "libpff_deflate_decompress_zlib";
-	size_t compressed_data_offset                       = 0;
-	size_t safe_uncompressed_data_size                  = 0;
-	size_t uncompressed_data_offset                     = 0;
-	uint32_t calculated_checksum                        = 0;
-	uint32_t stored_checksum                            = 0;
-	uint8_t block_type                                  = 0;
-	uint8_t last_block_flag                             = 0;
+	libpff_deflate_context_t *deflate_context = NULL;
+	static char *function                     = "libpff_deflate_decompress_zlib";
 
+	if( libpff_deflate_context_initialize(
+	     &deflate_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create deflate context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_deflate_decompress_zlib_with_context(
+	     deflate_context,
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_deflate_context_free(
+	     &deflate_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free deflate context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( deflate_context != NULL )
+	{
+		libpff_deflate_context_free(
+		 &deflate_context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decompresses data using zlib compression and a reusable deflate context
+ * Returns 1 on success or -1 on error
+ */
+int libpff_deflate_decompress_zlib_with_context(
+     libpff_deflate_context_t *deflate_context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	libpff_bit_stream_t *bit_stream    = NULL;
+	static char *function              = "libpff_deflate_decompress_zlib_with_context";
+	size_t compressed_data_offset      = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	uint32_t calculated_checksum       = 0;
+	uint32_t stored_checksum           = 0;
+
+	if( deflate_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate context.",
+		 function );
+
+		return( -1 );
+	}
 	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
@@ -1795,7 +2191,7 @@ int libpff_deflate_decompress_zlib(
 		 "%s: unable to read data header.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( compressed_data_offset >= compressed_data_size )
 	{
@@ -1806,124 +2202,49 @@ int libpff_deflate_decompress_zlib(
 		 "%s: invalid compressed data value too small.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libpff_bit_stream_initialize(
-	     &bit_stream,
+	if( libpff_deflate_context_set_byte_stream(
+	     deflate_context,
 	     compressed_data,
 	     compressed_data_size,
 	     compressed_data_offset,
-	     LIBPFF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create bit stream.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set byte stream.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	if( libpff_deflate_read_blocks(
+	     deflate_context,
+	     uncompressed_data,
+	     safe_uncompressed_data_size,
+	     &uncompressed_data_offset,
+	     error ) != 1 )
 	{
-		if( libpff_deflate_read_block_header(
-		     bit_stream,
-		     &block_type,
-		     &last_block_flag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read compressed data block header.",
-			 function );
-
-			goto on_error;
-		}
-		if( block_type == LIBPFF_DEFLATE_BLOCK_TYPE_HUFFMAN_FIXED )
-		{
-			if( ( fixed_huffman_literals_tree == NULL )
-			 && ( fixed_huffman_distances_tree == NULL ) )
-			{
-				if( libpff_huffman_tree_initialize(
-				     &fixed_huffman_literals_tree,
-				     288,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed literals Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( libpff_huffman_tree_initialize(
-				     &fixed_huffman_distances_tree,
-				     30,
-				     15,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed distances Huffman tree.",
-					 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read blocks of compressed data.",
+		 function );
 
-					goto on_error;
-				}
-				if( libpff_deflate_build_fixed_huffman_trees(
-				     fixed_huffman_literals_tree,
-				     fixed_huffman_distances_tree,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build fixed Huffman trees.",
-					 function );
+		return( -1 );
+	}
+	bit_stream = deflate_context->bit_stream;
 
-					goto on_error;
-				}
-			}
-		}
-		if( libpff_deflate_read_block(
-		     bit_stream,
-		     block_type,
-		     fixed_huffman_literals_tree,
-		     fixed_huffman_distances_tree,
-		     uncompressed_data,
-		     safe_uncompressed_data_size,
-		     &uncompressed_data_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read block of compressed data.",
-			 function );
+	/* Return the bytes remaining in the bit stream buffer to the byte stream
+	 */
+	bit_stream->byte_stream_offset -= bit_stream->bit_buffer_size >> 3;
+	bit_stream->bit_buffer_size    &= 0x07;
 
-			goto on_error;
-		}
-		if( last_block_flag != 0 )
-		{
-			break;
-		}
-	}
 	if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) >= 4 )
 	{
-		while( bit_stream->bit_buffer_size >= 8 )
-		{
-			bit_stream->byte_stream_offset -= 1;
-			bit_stream->bit_buffer_size    -= 8;
-		}
 		byte_stream_copy_to_uint32_big_endian(
 		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
 		 stored_checksum );
@@ -1942,7 +2263,7 @@ int libpff_deflate_decompress_zlib(
 			 "%s: unable to calculate checksum.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( stored_checksum != calculated_checksum )
 		{
@@ -1955,77 +2276,11 @@ int libpff_deflate_decompress_zlib(
 			 stored_checksum,
 			 calculated_checksum );
 
-			goto on_error;
-		}
-	}
-	if( fixed_huffman_distances_tree != NULL )
-	{
-		if( libpff_huffman_tree_free(
-		     &fixed_huffman_distances_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed distances Huffman tree.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	if( fixed_huffman_literals_tree != NULL )
-	{
-		if( libpff_huffman_tree_free(
-		     &fixed_huffman_literals_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free fixed literals Huffman tree.",
-			 function );
-
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( libpff_bit_stream_free(
-	     &bit_stream,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free bit stream.",
-		 function );
-
-		goto on_error;
-	}
 	*uncompressed_data_size = uncompressed_data_offset;
 
 	return( 1 );
-
-on_error:
-	if( fixed_huffman_distances_tree != NULL )
-	{
-		libpff_huffman_tree_free(
-		 &fixed_huffman_distances_tree,
-		 NULL );
-	}
-	if( fixed_huffman_literals_tree != NULL )
-	{
-		libpff_huffman_tree_free(
-		 &fixed_huffman_literals_tree,
-		 NULL );
-	}
-	if( bit_stream != NULL )
-	{
-		libpff_bit_stream_free(
-		 &bit_stream,
-		 NULL );
-	}
-	return( -1 );
 }
 
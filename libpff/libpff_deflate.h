@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libpff_bit_stream.h"
+#include "libpff_deflate_context.h"
 #include "libpff_huffman_tree.h"
 #include "libpff_libcerror.h"
 
@@ -63,6 +64,17 @@ int libpff_deflate_decode_huffman(
      size_t *uncompressed_data_offset,
      libcerror_error_t **error );
 
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define LIBPFF_DEFLATE_HAVE_SIMD_ADLER32
+
+int libpff_deflate_have_sse2(
+     void );
+
+int libpff_deflate_have_avx2(
+     void );
+
+#endif
+
 int libpff_deflate_calculate_adler32(
      uint32_t *checksum_value,
      const uint8_t *data,
@@ -87,6 +99,15 @@ int libpff_deflate_read_block(
      uint8_t block_type,
      libpff_huffman_tree_t *fixed_huffman_literals_tree,
      libpff_huffman_tree_t *fixed_huffman_distances_tree,
+     libpff_huffman_tree_t *dynamic_huffman_literals_tree,
+     libpff_huffman_tree_t *dynamic_huffman_distances_tree,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+int libpff_deflate_read_blocks(
+     libpff_deflate_context_t *deflate_context,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
      size_t *uncompressed_data_offset,
@@ -99,6 +120,14 @@ int libpff_deflate_decompress(
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int libpff_deflate_decompress_with_context(
+     libpff_deflate_context_t *deflate_context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
 int libpff_deflate_decompress_zlib(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -106,6 +135,14 @@ int libpff_deflate_decompress_zlib(
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int libpff_deflate_decompress_zlib_with_context(
+     libpff_deflate_context_t *deflate_context,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,357 @@
+/*
+ * Deflate decompression context functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libpff_bit_stream.h"
+#include "libpff_deflate.h"
+#include "libpff_deflate_context.h"
+#include "libpff_huffman_tree.h"
+#include "libpff_libcerror.h"
+
+/* Creates a deflate context
+ * The fixed Huffman trees are built once when the context is created
+ * Make sure the value deflate_context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_deflate_context_initialize(
+     libpff_deflate_context_t **deflate_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_deflate_context_initialize";
+
+	if( deflate_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *deflate_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid deflate context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*deflate_context = memory_allocate_structure(
+	                    libpff_deflate_context_t );
+
+	if( *deflate_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create deflate context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *deflate_context,
+	     0,
+	     sizeof( libpff_deflate_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear deflate context.",
+		 function );
+
+		memory_free(
+		 *deflate_context );
+
+		*deflate_context = NULL;
+
+		return( -1 );
+	}
+	if( libpff_huffman_tree_initialize(
+	     &( ( *deflate_context )->fixed_huffman_literals_tree ),
+	     288,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create fixed literals Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_huffman_tree_initialize(
+	     &( ( *deflate_context )->fixed_huffman_distances_tree ),
+	     30,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create fixed distances Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_deflate_build_fixed_huffman_trees(
+	     ( *deflate_context )->fixed_huffman_literals_tree,
+	     ( *deflate_context )->fixed_huffman_distances_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build fixed Huffman trees.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_huffman_tree_initialize(
+	     &( ( *deflate_context )->dynamic_huffman_literals_tree ),
+	     288,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create dynamic literals Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_huffman_tree_initialize(
+	     &( ( *deflate_context )->dynamic_huffman_distances_tree ),
+	     30,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create dynamic distances Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *deflate_context != NULL )
+	{
+		libpff_deflate_context_free(
+		 deflate_context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a deflate context
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_deflate_context_free(
+     libpff_deflate_context_t **deflate_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_deflate_context_free";
+	int result            = 1;
+
+	if( deflate_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *deflate_context != NULL )
+	{
+		if( ( *deflate_context )->dynamic_huffman_distances_tree != NULL )
+		{
+			if( libpff_huffman_tree_free(
+			     &( ( *deflate_context )->dynamic_huffman_distances_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free dynamic distances Huffman tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *deflate_context )->dynamic_huffman_literals_tree != NULL )
+		{
+			if( libpff_huffman_tree_free(
+			     &( ( *deflate_context )->dynamic_huffman_literals_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free dynamic literals Huffman tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *deflate_context )->fixed_huffman_distances_tree != NULL )
+		{
+			if( libpff_huffman_tree_free(
+			     &( ( *deflate_context )->fixed_huffman_distances_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free fixed distances Huffman tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *deflate_context )->fixed_huffman_literals_tree != NULL )
+		{
+			if( libpff_huffman_tree_free(
+			     &( ( *deflate_context )->fixed_huffman_literals_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free fixed literals Huffman tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *deflate_context )->bit_stream != NULL )
+		{
+			if( libpff_bit_stream_free(
+			     &( ( *deflate_context )->bit_stream ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free bit stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *deflate_context );
+
+		*deflate_context = NULL;
+	}
+	return( result );
+}
+
+/* Sets the byte stream of the deflate context
+ * The bit stream is created on first use and reused afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_deflate_context_set_byte_stream(
+     libpff_deflate_context_t *deflate_context,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t byte_stream_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_deflate_context_set_byte_stream";
+
+	if( deflate_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate context.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_context->bit_stream == NULL )
+	{
+		if( libpff_bit_stream_initialize(
+		     &( deflate_context->bit_stream ),
+		     byte_stream,
+		     byte_stream_size,
+		     byte_stream_offset,
+		     LIBPFF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create bit stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( libpff_bit_stream_set_byte_stream(
+	          deflate_context->bit_stream,
+	          byte_stream,
+	          byte_stream_size,
+	          byte_stream_offset,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set byte stream of bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,81 @@
+/*
+ * Deflate decompression context functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBPFF_DEFLATE_CONTEXT_H )
+#define _LIBPFF_DEFLATE_CONTEXT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libpff_bit_stream.h"
+#include "libpff_huffman_tree.h"
+#include "libpff_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libpff_deflate_context libpff_deflate_context_t;
+
+struct libpff_deflate_context
+{
+	/* The bit stream
+	 */
+	libpff_bit_stream_t *bit_stream;
+
+	/* The fixed literals Huffman tree
+	 */
+	libpff_huffman_tree_t *fixed_huffman_literals_tree;
+
+	/* The fixed distances Huffman tree
+	 */
+	libpff_huffman_tree_t *fixed_huffman_distances_tree;
+
+	/* The dynamic literals Huffman tree
+	 */
+	libpff_huffman_tree_t *dynamic_huffman_literals_tree;
+
+	/* The dynamic distances Huffman tree
+	 */
+	libpff_huffman_tree_t *dynamic_huffman_distances_tree;
+};
+
+int libpff_deflate_context_initialize(
+     libpff_deflate_context_t **deflate_context,
+     libcerror_error_t **error );
+
+int libpff_deflate_context_free(
+     libpff_deflate_context_t **deflate_context,
+     libcerror_error_t **error );
+
+int libpff_deflate_context_set_byte_stream(
+     libpff_deflate_context_t *deflate_context,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t byte_stream_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBPFF_DEFLATE_CONTEXT_H ) */
+
@@ -162,6 +162,11 @@ int libpff_descriptor_data_stream_data_handle_free(
 				}
 			}
 		}
+		if( ( *data_handle )->segment_offsets != NULL )
+		{
+			memory_free(
+			 ( *data_handle )->segment_offsets );
+		}
 		memory_free(
 		 *data_handle );
 
@@ -236,12 +241,50 @@ int libpff_descriptor_data_stream_data_handle_clone(
 
 		goto on_error;
 	}
+	( *destination_data_handle )->segment_offsets = NULL;
+
+	if( source_data_handle->segment_offsets != NULL )
+	{
+		( *destination_data_handle )->segment_offsets = (off64_t *) memory_allocate(
+		                                                 sizeof( off64_t ) * ( source_data_handle->number_of_segments + 1 ) );
+
+		if( ( *destination_data_handle )->segment_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination segment offsets.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_data_handle )->segment_offsets,
+		     source_data_handle->segment_offsets,
+		     sizeof( off64_t ) * ( source_data_handle->number_of_segments + 1 ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source to destination segment offsets.",
+			 function );
+
+			goto on_error;
+		}
+	}
 /* TODO clone list and cache ? */
 	return( 1 );
 
 on_error:
 	if( *destination_data_handle != NULL )
 	{
+		if( ( *destination_data_handle )->segment_offsets != NULL )
+		{
+			memory_free(
+			 ( *destination_data_handle )->segment_offsets );
+		}
 		memory_free(
 		 *destination_data_handle );
 
@@ -307,37 +350,76 @@ ssize_t libpff_descriptor_data_stream_data_handle_read_segment_data(
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_at_offset(
-	     data_handle->descriptor_data_list,
-	     file_io_handle,
-	     (libfdata_cache_t *) data_handle->descriptor_data_cache,
-	     data_handle->current_offset,
-	     &element_index,
-	     &element_data_offset,
-	     (intptr_t **) &data_block,
-	     read_flags,
-	     error ) != 1 )
+	if( data_handle->segment_offsets != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve data block: %d.",
-		 function,
-		 segment_index );
+		/* The segment that contains the current offset was determined by the seek
+		 */
+		if( data_handle->current_segment_index != segment_index )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: current segment index value out of bounds.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
+		if( libfdata_list_get_element_value_by_index(
+		     data_handle->descriptor_data_list,
+		     file_io_handle,
+		     (libfdata_cache_t *) data_handle->descriptor_data_cache,
+		     segment_index,
+		     (intptr_t **) &data_block,
+		     read_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data block: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		element_data_offset = data_handle->current_segment_data_offset;
 	}
-	if( element_index != segment_index )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: element index value out of bounds.",
-		 function );
+		if( libfdata_list_get_element_value_at_offset(
+		     data_handle->descriptor_data_list,
+		     file_io_handle,
+		     (libfdata_cache_t *) data_handle->descriptor_data_cache,
+		     data_handle->current_offset,
+		     &element_index,
+		     &element_data_offset,
+		     (intptr_t **) &data_block,
+		     read_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data block: %d.",
+			 function,
+			 segment_index );
 
-		return( -1 );
+			return( -1 );
+		}
+		if( element_index != segment_index )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: element index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
 	}
 	if( data_block == NULL )
 	{
@@ -388,6 +470,99 @@ ssize_t libpff_descriptor_data_stream_data_handle_read_segment_data(
 	return( read_count );
 }
 
+/* Retrieves the index of the segment that contains a specific offset
+ * The segment offsets are searched using a binary search, the segment index hint
+ * is checked first since the descriptor data stream already tracks the current segment
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset(
+     libpff_descriptor_data_stream_data_handle_t *data_handle,
+     off64_t offset,
+     int segment_index_hint,
+     int *segment_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset";
+	int lower_index       = 0;
+	int middle_index      = 0;
+	int upper_index       = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->segment_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - missing segment offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( offset >= data_handle->segment_offsets[ data_handle->number_of_segments ] ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_index_hint >= 0 )
+	 && ( segment_index_hint < data_handle->number_of_segments )
+	 && ( offset >= data_handle->segment_offsets[ segment_index_hint ] )
+	 && ( offset < data_handle->segment_offsets[ segment_index_hint + 1 ] ) )
+	{
+		*segment_index = segment_index_hint;
+
+		return( 1 );
+	}
+	/* Find the last segment that starts at or before the offset
+	 */
+	upper_index = data_handle->number_of_segments - 1;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index + 1 ) / 2 );
+
+		if( data_handle->segment_offsets[ middle_index ] <= offset )
+		{
+			lower_index = middle_index;
+		}
+		else
+		{
+			upper_index = middle_index - 1;
+		}
+	}
+	*segment_index = lower_index;
+
+	return( 1 );
+}
+
 /* Seeks a certain offset of the data
  * Callback for the descriptor data stream
  * Returns the offset if seek is successful or -1 on error
@@ -395,7 +570,7 @@ ssize_t libpff_descriptor_data_stream_data_handle_read_segment_data(
 off64_t libpff_descriptor_data_stream_data_handle_seek_segment_offset(
          libpff_descriptor_data_stream_data_handle_t *data_handle,
          intptr_t *file_io_handle LIBPFF_ATTRIBUTE_UNUSED,
-         int segment_index LIBPFF_ATTRIBUTE_UNUSED,
+         int segment_index,
          int segment_file_index LIBPFF_ATTRIBUTE_UNUSED,
          off64_t segment_offset,
          libcerror_error_t **error )
@@ -403,7 +578,6 @@ off64_t libpff_descriptor_data_stream_data_handle_seek_segment_offset(
 	static char *function = "libpff_descriptor_data_stream_data_handle_seek_segment_offset";
 
 	LIBPFF_UNREFERENCED_PARAMETER( file_io_handle )
-	LIBPFF_UNREFERENCED_PARAMETER( segment_index )
 	LIBPFF_UNREFERENCED_PARAMETER( segment_file_index )
 
 	if( data_handle == NULL )
@@ -428,6 +602,37 @@ off64_t libpff_descriptor_data_stream_data_handle_seek_segment_offset(
 
 		return( -1 );
 	}
+	if( ( data_handle->segment_offsets != NULL )
+	 && ( segment_offset >= data_handle->segment_offsets[ data_handle->number_of_segments ] ) )
+	{
+		/* Seeking beyond the end of the data is allowed but no segment contains the offset
+		 */
+		data_handle->current_segment_index       = data_handle->number_of_segments;
+		data_handle->current_segment_data_offset = 0;
+	}
+	else if( data_handle->segment_offsets != NULL )
+	{
+		if( libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset(
+		     data_handle,
+		     segment_offset,
+		     segment_index,
+		     &( data_handle->current_segment_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment index at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 segment_offset,
+			 segment_offset );
+
+			return( -1 );
+		}
+		data_handle->current_segment_data_offset = segment_offset
+		                                         - data_handle->segment_offsets[ data_handle->current_segment_index ];
+	}
 	data_handle->current_offset = segment_offset;
 
 	return( segment_offset );
@@ -546,6 +751,41 @@ int libpff_descriptor_data_stream_initialize(
 
 		goto on_error;
 	}
+	if( ( number_of_elements < 0 )
+	 || ( (size_t) number_of_elements >= ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of descriptor data list elements value out of bounds.",
+		 function );
+
+		data_handle = NULL;
+
+		goto on_error;
+	}
+	/* The segment offsets are stored in the data handle so that seeking does not require
+	 * the descriptor data list to search its elements for the one that contains the offset
+	 */
+	data_handle->segment_offsets = (off64_t *) memory_allocate(
+	                                            sizeof( off64_t ) * ( number_of_elements + 1 ) );
+
+	if( data_handle->segment_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment offsets.",
+		 function );
+
+		data_handle = NULL;
+
+		goto on_error;
+	}
+	data_handle->number_of_segments = number_of_elements;
+
 	for( element_index = 0;
 	     element_index < number_of_elements;
 	     element_index++ )
@@ -589,8 +829,12 @@ int libpff_descriptor_data_stream_initialize(
 
 			goto on_error;
 		}
+		data_handle->segment_offsets[ element_index ] = segment_offset;
+
 		segment_offset += segment_size;
 	}
+	data_handle->segment_offsets[ number_of_elements ] = segment_offset;
+
 	data_handle->descriptor_data_list  = descriptor_data_list;
 	data_handle->descriptor_data_cache = descriptor_data_cache;
 	data_handle->flags                 = flags;
@@ -613,3 +857,184 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the extents of the file that contain the data of a descriptor data list
+ * The extents are only available when the data of every element is stored as-is,
+ * meaning the element size in the file equals the mapped (uncompressed) size
+ * The caller is responsible for checking that the data is not encrypted and decryption was not forced
+ * The extents are allocated and should be freed by the caller using memory_free
+ * A descriptor data list without elements has no extents, extents is not set and the number of extents is 0
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libpff_descriptor_data_stream_get_extents(
+     libfdata_list_t *descriptor_data_list,
+     libpff_descriptor_data_extent_t **extents,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	libpff_descriptor_data_extent_t *safe_extents = NULL;
+	static char *function                         = "libpff_descriptor_data_stream_get_extents";
+	size64_t element_mapped_size                  = 0;
+	size64_t element_size                         = 0;
+	off64_t element_offset                        = 0;
+	uint32_t element_flags                        = 0;
+	int element_file_index                        = 0;
+	int element_index                             = 0;
+	int number_of_elements                        = 0;
+	int result                                    = 0;
+
+	if( descriptor_data_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor data list.",
+		 function );
+
+		return( -1 );
+	}
+	if( extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extents != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extents value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     descriptor_data_list,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of descriptor data list elements.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_elements < 0 )
+	 || ( (size_t) number_of_elements > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libpff_descriptor_data_extent_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of descriptor data list elements value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_elements > 0 )
+	{
+		safe_extents = (libpff_descriptor_data_extent_t *) memory_allocate(
+		                                                    sizeof( libpff_descriptor_data_extent_t ) * number_of_elements );
+
+		if( safe_extents == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create extents.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfdata_list_get_element_by_index(
+		     descriptor_data_list,
+		     element_index,
+		     &element_file_index,
+		     &element_offset,
+		     &element_size,
+		     &element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve descriptor data list element: %d.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		result = libfdata_list_get_mapped_size_by_index(
+		          descriptor_data_list,
+		          element_index,
+		          &element_mapped_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve descriptor data list element: %d mapped size.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		/* A compressed data block is stored with a size that differs from its mapped size
+		 * and cannot be referenced as an extent of the file
+		 */
+		if( ( result == 0 )
+		 || ( element_offset < 0 )
+		 || ( element_size != element_mapped_size ) )
+		{
+			memory_free(
+			 safe_extents );
+
+			return( 0 );
+		}
+		safe_extents[ element_index ].file_offset = element_offset;
+		safe_extents[ element_index ].size        = element_size;
+	}
+	*extents           = safe_extents;
+	*number_of_extents = number_of_elements;
+
+	return( 1 );
+
+on_error:
+	if( safe_extents != NULL )
+	{
+		memory_free(
+		 safe_extents );
+	}
+	return( -1 );
+}
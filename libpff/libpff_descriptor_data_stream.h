@@ -33,6 +33,19 @@
 extern "C" {
 #endif
 
+typedef struct libpff_descriptor_data_extent libpff_descriptor_data_extent_t;
+
+struct libpff_descriptor_data_extent
+{
+	/* The file offset
+	 */
+	off64_t file_offset;
+
+	/* The size
+	 */
+	size64_t size;
+};
+
 typedef struct libpff_descriptor_data_stream_data_handle libpff_descriptor_data_stream_data_handle_t;
 
 struct libpff_descriptor_data_stream_data_handle
@@ -49,6 +62,23 @@ struct libpff_descriptor_data_stream_data_handle
 	 */
 	libfcache_cache_t *descriptor_data_cache;
 
+	/* The segment offsets
+	 * Contains the logical offset of every segment followed by the size of the stream
+	 */
+	off64_t *segment_offsets;
+
+	/* The number of segments
+	 */
+	int number_of_segments;
+
+	/* The index of the segment that contains the current offset
+	 */
+	int current_segment_index;
+
+	/* The offset relative to the start of the current segment
+	 */
+	off64_t current_segment_data_offset;
+
 	/* The flags
 	 */
 	uint8_t flags;
@@ -78,6 +108,13 @@ ssize_t libpff_descriptor_data_stream_data_handle_read_segment_data(
          uint8_t read_flags,
          libcerror_error_t **error );
 
+int libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset(
+     libpff_descriptor_data_stream_data_handle_t *data_handle,
+     off64_t offset,
+     int segment_index_hint,
+     int *segment_index,
+     libcerror_error_t **error );
+
 off64_t libpff_descriptor_data_stream_data_handle_seek_segment_offset(
          libpff_descriptor_data_stream_data_handle_t *data_handle,
          intptr_t *file_io_handle,
@@ -93,6 +130,12 @@ int libpff_descriptor_data_stream_initialize(
      uint8_t flags,
      libcerror_error_t **error );
 
+int libpff_descriptor_data_stream_get_extents(
+     libfdata_list_t *descriptor_data_list,
+     libpff_descriptor_data_extent_t **extents,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
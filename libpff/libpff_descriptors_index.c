@@ -23,10 +23,12 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libpff_bloom_filter.h"
 #include "libpff_definitions.h"
 #include "libpff_descriptors_index.h"
 #include "libpff_index.h"
 #include "libpff_index_value.h"
+#include "libpff_index_value_set.h"
 #include "libpff_index_values_list.h"
 #include "libpff_io_handle.h"
 #include "libpff_libbfio.h"
@@ -130,6 +132,20 @@ int libpff_descriptors_index_initialize(
 
 		goto on_error;
 	}
+	if( libpff_index_value_set_initialize(
+	     &( ( *descriptors_index )->recovered_index_value_set ),
+	     LIBPFF_INDEX_TYPE_DESCRIPTOR,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovered index value set.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -193,6 +209,35 @@ int libpff_descriptors_index_free(
 
 			result = -1;
 		}
+		if( libpff_index_value_set_free(
+		     &( ( *descriptors_index )->recovered_index_value_set ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free recovered index value set.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *descriptors_index )->allocated_index_values_filter != NULL )
+		{
+			if( libpff_bloom_filter_free(
+			     &( ( *descriptors_index )->allocated_index_values_filter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free allocated index values filter.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libpff_index_free(
 		     &( ( *descriptors_index )->index ),
 		     error ) != 1 )
@@ -458,6 +503,20 @@ int libpff_descriptors_index_insert_recovered_index_value(
 			goto on_error;
 		}
 	}
+	if( libpff_index_value_set_insert_value(
+	     descriptors_index->recovered_index_value_set,
+	     index_value,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert index value in recovered index value set.",
+		 function );
+
+		goto on_error;
+	}
 	if( libpff_index_values_list_append_value(
 	     existing_index_values_list,
 	     index_value,
@@ -484,3 +543,80 @@ on_error:
 	return( -1 );
 }
 
+/* Empties the recovered index values of the descriptors index
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_descriptors_index_empty_recovered_index_values(
+     libpff_descriptors_index_t *descriptors_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_descriptors_index_empty_recovered_index_values";
+
+	if( descriptors_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptors index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_free(
+	     &( descriptors_index->recovered_index_values_tree ),
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libpff_index_values_list_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free recovered index values tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_index_value_set_free(
+	     &( descriptors_index->recovered_index_value_set ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free recovered index value set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_initialize(
+	     &( descriptors_index->recovered_index_values_tree ),
+	     257,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovered index values B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_index_value_set_initialize(
+	     &( descriptors_index->recovered_index_value_set ),
+	     LIBPFF_INDEX_TYPE_DESCRIPTOR,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovered index value set.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
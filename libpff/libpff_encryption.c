@@ -22,10 +22,15 @@
 #include <common.h>
 #include <types.h>
 
-#include "libpff_encryption.h"
+#include "libpff_checksum.h"
 #include "libpff_definitions.h"
+#include "libpff_encryption.h"
 #include "libpff_libcerror.h"
 
+/* The size of the chunks processed by the decrypt with checksum function
+ */
+#define LIBPFF_ENCRYPTION_CHUNK_SIZE	4096
+
 /* The transposition array contains the un-encrypted (plain) values.
  * The un-encrypted value is in the position of the encrypted value.
  * i.e. the encrypted value 0x13 represents 0x02
@@ -94,6 +99,53 @@ static uint8_t libpff_encryption_high2[ 256 ] = {
 	0x61, 0xe0, 0xc6, 0xc1, 0x59, 0xab, 0xbb, 0x58, 0xde, 0x5f, 0xdf, 0x60, 0x79, 0x7e, 0xb2, 0x8a
 };
 
+/* Decrypts the data in-place
+ * The salt is only used by high encryption and is incremented for every byte
+ */
+static void libpff_encryption_decrypt_buffer(
+             uint8_t encryption_type,
+             uint16_t salt,
+             uint8_t *data,
+             size_t data_size )
+{
+	size_t data_offset = 0;
+	uint8_t index      = 0;
+	uint8_t upper_salt = 0;
+	uint8_t lower_salt = 0;
+
+	if( encryption_type == LIBPFF_ENCRYPTION_TYPE_COMPRESSIBLE )
+	{
+		for( data_offset = 0;
+		     data_offset < data_size;
+		     data_offset++ )
+		{
+			index               = data[ data_offset ];
+			data[ data_offset ] = libpff_encryption_compressible[ index ];
+		}
+	}
+	else if( encryption_type == LIBPFF_ENCRYPTION_TYPE_HIGH )
+	{
+		for( data_offset = 0;
+		     data_offset < data_size;
+		     data_offset++ )
+		{
+			lower_salt          = salt & 0x00ff;
+			upper_salt          = ( salt & 0xff00 ) >> 8;
+			index               = data[ data_offset ];
+			index              += lower_salt;
+			index               = libpff_encryption_high1[ index ];
+			index              += upper_salt;
+			index               = libpff_encryption_high2[ index ];
+			index              -= upper_salt;
+			index               = libpff_encryption_compressible[ index ];
+			index              -= lower_salt;
+			data[ data_offset ] = index;
+
+			salt++;
+		}
+	}
+}
+
 /* Decrypts the data
  * Returns the number of bytes decrypted if successful or -1 on error
  */
@@ -105,11 +157,7 @@ ssize_t libpff_encryption_decrypt(
          libcerror_error_t **error )
 {
 	static char *function = "libpff_encryption_decrypt";
-	size_t data_offset    = 0;
 	uint16_t salt         = 0;
-	uint8_t index         = 0;
-	uint8_t upper_salt    = 0;
-	uint8_t lower_salt    = 0;
 
 	if( ( encryption_type != LIBPFF_ENCRYPTION_TYPE_COMPRESSIBLE )
 	 && ( encryption_type != LIBPFF_ENCRYPTION_TYPE_NONE )
@@ -146,43 +194,110 @@ ssize_t libpff_encryption_decrypt(
 
 		return( -1 );
 	}
-	if( encryption_type == LIBPFF_ENCRYPTION_TYPE_COMPRESSIBLE )
+	salt = (uint16_t) ( ( ( key & 0xffff0000 ) >> 16 ) ^ ( key & 0x0000ffff ) );
+
+	libpff_encryption_decrypt_buffer(
+	 encryption_type,
+	 salt,
+	 data,
+	 data_size );
+
+	return( (ssize_t) data_size );
+}
+
+/* Calculates the weak CRC-32 checksum of the (encrypted) data and decrypts the data
+ * The data is processed in chunks small enough to remain in the CPU cache
+ * so that both operations only require a single pass over the data in memory
+ * Returns the number of bytes decrypted if successful or -1 on error
+ */
+ssize_t libpff_encryption_decrypt_with_weak_crc32(
+         uint8_t encryption_type,
+         uint32_t key,
+         uint8_t *data,
+         size_t data_size,
+         uint32_t *checksum,
+         uint32_t initial_value,
+         libcerror_error_t **error )
+{
+	static char *function  = "libpff_encryption_decrypt_with_weak_crc32";
+	size_t chunk_size      = 0;
+	size_t data_offset     = 0;
+	uint32_t safe_checksum = 0;
+	uint16_t salt          = 0;
+
+	if( ( encryption_type != LIBPFF_ENCRYPTION_TYPE_COMPRESSIBLE )
+	 && ( encryption_type != LIBPFF_ENCRYPTION_TYPE_NONE )
+	 && ( encryption_type != LIBPFF_ENCRYPTION_TYPE_HIGH ) )
 	{
-		for( data_offset = 0;
-		     data_offset < data_size;
-		     data_offset++ )
-		{
-			index               = data[ data_offset ];
-			data[ data_offset ] = libpff_encryption_compressible[ index ];
-		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression type.",
+		 function );
+
+		return( -1 );
 	}
-	else if( encryption_type == LIBPFF_ENCRYPTION_TYPE_NONE )
+	if( data == NULL )
 	{
-		data_offset = data_size;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
 	}
-	else if( encryption_type == LIBPFF_ENCRYPTION_TYPE_HIGH )
+	if( data_size > (size_t) SSIZE_MAX )
 	{
-		salt = (uint16_t) ( ( ( key & 0xffff0000 ) >> 16 ) ^ ( key & 0x0000ffff ) );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
 
-		for( data_offset = 0;
-		     data_offset < data_size;
-		     data_offset++ )
-		{
-			lower_salt          = salt & 0x00ff;
-			upper_salt          = ( salt & 0xff00 ) >> 8;
-			index               = data[ data_offset ];
-			index              += lower_salt;
-			index               = libpff_encryption_high1[ index ];
-			index              += upper_salt;
-			index               = libpff_encryption_high2[ index ];
-			index              -= upper_salt;
-			index               = libpff_encryption_compressible[ index ];
-			index              -= lower_salt;
-			data[ data_offset ] = index;
+		return( -1 );
+	}
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
 
-			salt++;
+		return( -1 );
+	}
+	salt          = (uint16_t) ( ( ( key & 0xffff0000 ) >> 16 ) ^ ( key & 0x0000ffff ) );
+	safe_checksum = initial_value;
+
+	while( data_offset < data_size )
+	{
+		chunk_size = data_size - data_offset;
+
+		if( chunk_size > LIBPFF_ENCRYPTION_CHUNK_SIZE )
+		{
+			chunk_size = LIBPFF_ENCRYPTION_CHUNK_SIZE;
 		}
+		safe_checksum = libpff_checksum_update_crc32(
+		                 safe_checksum,
+		                 &( data[ data_offset ] ),
+		                 chunk_size );
+
+		libpff_encryption_decrypt_buffer(
+		 encryption_type,
+		 salt,
+		 &( data[ data_offset ] ),
+		 chunk_size );
+
+		salt        += (uint16_t) chunk_size;
+		data_offset += chunk_size;
 	}
-	return( (ssize_t) data_offset );
+	*checksum = safe_checksum;
+
+	return( (ssize_t) data_size );
 }
 
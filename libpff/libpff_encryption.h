@@ -38,6 +38,15 @@ ssize_t libpff_encryption_decrypt(
          size_t data_size,
          libcerror_error_t **error );
 
+ssize_t libpff_encryption_decrypt_with_weak_crc32(
+         uint8_t encryption_type,
+         uint32_t key,
+         uint8_t *data,
+         size_t data_size,
+         uint32_t *checksum,
+         uint32_t initial_value,
+         libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -25,6 +25,7 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libpff_allocation_bitmap.h"
 #include "libpff_codepage.h"
 #include "libpff_debug.h"
 #include "libpff_definitions.h"
@@ -45,6 +46,7 @@
 #include "libpff_name_to_id_map.h"
 #include "libpff_offsets_index.h"
 #include "libpff_recover.h"
+#include "libpff_recover_checkpoint.h"
 #include "libpff_types.h"
 
 /* Creates a file
@@ -546,6 +548,10 @@ int libpff_file_open_file_io_handle(
 	{
 		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
 	}
+	if( ( access_flags & LIBPFF_ACCESS_FLAG_SKIP_CHECKSUM_VERIFICATION ) != 0 )
+	{
+		internal_file->io_handle->flags |= LIBPFF_IO_HANDLE_FLAG_SKIP_CHECKSUM_VERIFICATION;
+	}
 	file_io_handle_is_open = libbfio_handle_is_open(
 	                          file_io_handle,
 	                          error );
@@ -607,6 +613,8 @@ on_error:
 
 		internal_file->file_io_handle_opened_in_library = 0;
 	}
+	internal_file->io_handle->flags &= ~( LIBPFF_IO_HANDLE_FLAG_SKIP_CHECKSUM_VERIFICATION );
+
 	internal_file->file_io_handle = NULL;
 
 	return( -1 );
@@ -771,8 +779,8 @@ int libpff_file_close(
 	}
 	internal_file->root_folder_item_tree_node = NULL;
 
-	if( libcdata_list_free(
-	     &( internal_file->orphan_item_list ),
+	if( libcdata_array_free(
+	     &( internal_file->orphan_item_array ),
 	     (int (*)(intptr_t **, libcerror_error_t **)) &libpff_item_tree_node_free_recovered,
 	     error ) != 1 )
 	{
@@ -780,7 +788,7 @@ int libpff_file_close(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free orphan item list.",
+		 "%s: unable to free orphan item array.",
 		 function );
 
 		result = -1;
@@ -799,10 +807,10 @@ int libpff_file_close(
 
 		result = -1;
 	}
-	if( internal_file->recovered_item_list != NULL )
+	if( internal_file->recovered_item_array != NULL )
 	{
-		if( libcdata_list_free(
-		     &( internal_file->recovered_item_list ),
+		if( libcdata_array_free(
+		     &( internal_file->recovered_item_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libpff_item_tree_node_free_recovered,
 		     error ) != 1 )
 		{
@@ -810,41 +818,39 @@ int libpff_file_close(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free recovered item list.",
+			 "%s: unable to free recovered item array.",
 			 function );
 
 			result = -1;
 		}
 	}
-	if( internal_file->unallocated_data_block_list != NULL )
+	if( internal_file->unallocated_data_block_bitmap != NULL )
 	{
-		if( libcdata_range_list_free(
-		     &( internal_file->unallocated_data_block_list ),
-		     NULL,
+		if( libpff_allocation_bitmap_free(
+		     &( internal_file->unallocated_data_block_bitmap ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free unallocated data block list.",
+			 "%s: unable to free unallocated data block bitmap.",
 			 function );
 
 			result = -1;
 		}
 	}
-	if( internal_file->unallocated_page_block_list != NULL )
+	if( internal_file->unallocated_page_block_bitmap != NULL )
 	{
-		if( libcdata_range_list_free(
-		     &( internal_file->unallocated_page_block_list ),
-		     NULL,
+		if( libpff_allocation_bitmap_free(
+		     &( internal_file->unallocated_page_block_bitmap ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free unallocated page block list.",
+			 "%s: unable to free unallocated page block bitmap.",
 			 function );
 
 			result = -1;
@@ -934,13 +940,13 @@ int libpff_internal_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->orphan_item_list != NULL )
+	if( internal_file->orphan_item_array != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - orphan item list value already set.",
+		 "%s: invalid file - orphan item array value already set.",
 		 function );
 
 		return( -1 );
@@ -1070,15 +1076,16 @@ int libpff_internal_file_open_read(
 
 		goto on_error;
 	}
-	if( libcdata_list_initialize(
-	     &( internal_file->orphan_item_list ),
+	if( libcdata_array_initialize(
+	     &( internal_file->orphan_item_array ),
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create orphan item list.",
+		 "%s: unable to create orphan item array.",
 		 function );
 
 		goto on_error;
@@ -1101,7 +1108,7 @@ int libpff_internal_file_open_read(
              internal_file->io_handle,
 	     file_io_handle,
 	     internal_file->descriptors_index,
-	     internal_file->orphan_item_list,
+	     internal_file->orphan_item_array,
 	     &( internal_file->root_folder_item_tree_node ),
 	     error ) != 1 )
 	{
@@ -1166,10 +1173,10 @@ on_error:
 	}
 	internal_file->root_folder_item_tree_node = NULL;
 
-	if( internal_file->orphan_item_list != NULL )
+	if( internal_file->orphan_item_array != NULL )
 	{
-		libcdata_list_free(
-		 &( internal_file->orphan_item_list ),
+		libcdata_array_free(
+		 &( internal_file->orphan_item_array ),
 		 (int (*)(intptr_t **, libcerror_error_t **)) &libpff_item_tree_node_free_recovered,
 		 NULL );
 	}
@@ -1207,7 +1214,8 @@ int libpff_internal_file_read_allocation_tables(
      libpff_internal_file_t *internal_file,
      libcerror_error_t **error )
 {
-	static char *function = "libpff_internal_file_read_allocation_tables";
+	static char *function          = "libpff_internal_file_read_allocation_tables";
+	size32_t data_block_unit_size  = 0;
 
 	if( internal_file == NULL )
 	{
@@ -1255,24 +1263,24 @@ int libpff_internal_file_read_allocation_tables(
 
 		return( -1 );
 	}
-	if( internal_file->unallocated_data_block_list != NULL )
+	if( internal_file->unallocated_data_block_bitmap != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - allocaled data block list already set.",
+		 "%s: invalid file - unallocated data block bitmap already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->unallocated_page_block_list != NULL )
+	if( internal_file->unallocated_page_block_bitmap != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - allocaled page block list already set.",
+		 "%s: invalid file - unallocated page block bitmap already set.",
 		 function );
 
 		return( -1 );
@@ -1284,15 +1292,27 @@ int libpff_internal_file_read_allocation_tables(
 		 "Reading the unallocated data blocks:\n" );
 	}
 #endif
-	if( libcdata_range_list_initialize(
-	     &( internal_file->unallocated_data_block_list ),
+	/* In 4k page files every bit of a data allocation table represents 512 bytes
+	 */
+	if( internal_file->io_handle->file_type == LIBPFF_FILE_TYPE_64BIT_4K_PAGE )
+	{
+		data_block_unit_size = 512;
+	}
+	else
+	{
+		data_block_unit_size = 64;
+	}
+	if( libpff_allocation_bitmap_initialize(
+	     &( internal_file->unallocated_data_block_bitmap ),
+	     internal_file->io_handle->file_size,
+	     data_block_unit_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create unallocated data block list.",
+		 "%s: unable to create unallocated data block bitmap.",
 		 function );
 
 		goto on_error;
@@ -1300,7 +1320,7 @@ int libpff_internal_file_read_allocation_tables(
 	if( libpff_io_handle_read_unallocated_data_blocks(
 	     internal_file->io_handle,
 	     internal_file->file_io_handle,
-	     internal_file->unallocated_data_block_list,
+	     internal_file->unallocated_data_block_bitmap,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1322,15 +1342,17 @@ int libpff_internal_file_read_allocation_tables(
 			 "Reading the unallocated page blocks:\n" );
 		}
 #endif
-		if( libcdata_range_list_initialize(
-		     &( internal_file->unallocated_page_block_list ),
+		if( libpff_allocation_bitmap_initialize(
+		     &( internal_file->unallocated_page_block_bitmap ),
+		     internal_file->io_handle->file_size,
+		     512,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create unallocated page block list.",
+			 "%s: unable to create unallocated page block bitmap.",
 			 function );
 
 			goto on_error;
@@ -1338,7 +1360,7 @@ int libpff_internal_file_read_allocation_tables(
 		if( libpff_io_handle_read_unallocated_page_blocks(
 		     internal_file->io_handle,
 		     internal_file->file_io_handle,
-		     internal_file->unallocated_page_block_list,
+		     internal_file->unallocated_page_block_bitmap,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1356,18 +1378,16 @@ int libpff_internal_file_read_allocation_tables(
 	return( 1 );
 
 on_error:
-	if( internal_file->unallocated_page_block_list != NULL )
+	if( internal_file->unallocated_page_block_bitmap != NULL )
 	{
-		libcdata_range_list_free(
-		 &( internal_file->unallocated_page_block_list ),
-		 NULL,
+		libpff_allocation_bitmap_free(
+		 &( internal_file->unallocated_page_block_bitmap ),
 		 NULL );
 	}
-	if( internal_file->unallocated_data_block_list != NULL )
+	if( internal_file->unallocated_data_block_bitmap != NULL )
 	{
-		libcdata_range_list_free(
-		 &( internal_file->unallocated_data_block_list ),
-		 NULL,
+		libpff_allocation_bitmap_free(
+		 &( internal_file->unallocated_data_block_bitmap ),
 		 NULL );
 	}
 	return( -1 );
@@ -1414,18 +1434,18 @@ int libpff_file_is_corrupted(
 	return( 0 );
 }
 
-/* Recovers deleted items
- * By default only the unallocated space is checked for recoverable items
+/* Retrieves the number of checksum mismatches
+ * This is the number of data block and index node checksums that were verified
+ * and did not match the stored checksum
  * Returns 1 if successful or -1 on error
  */
-int libpff_file_recover_items(
+int libpff_file_get_number_of_checksum_mismatches(
      libpff_file_t *file,
-     uint8_t recovery_flags,
+     uint32_t *number_of_checksum_mismatches,
      libcerror_error_t **error )
 {
 	libpff_internal_file_t *internal_file = NULL;
-	static char *function                 = "libpff_file_recover_items";
-	int result                            = 0;
+	static char *function                 = "libpff_file_get_number_of_checksum_mismatches";
 
 	if( file == NULL )
 	{
@@ -1451,69 +1471,295 @@ int libpff_file_recover_items(
 
 		return( -1 );
 	}
-	if( internal_file->recovered_item_list != NULL )
+	if( number_of_checksum_mismatches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of checksum mismatches.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_checksum_mismatches = internal_file->io_handle->number_of_checksum_mismatches;
+
+	return( 1 );
+}
+
+/* Sets the checksum verification sample interval
+ * When the file is opened with LIBPFF_ACCESS_FLAG_SKIP_CHECKSUM_VERIFICATION
+ * the checksum of every Nth block read is still verified, where N is the sample interval
+ * A sample interval of 0 disables checksum verification entirely, which is the default
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_set_checksum_verification_sample_interval(
+     libpff_file_t *file,
+     uint32_t sample_interval,
+     libcerror_error_t **error )
+{
+	libpff_internal_file_t *internal_file = NULL;
+	static char *function                 = "libpff_file_set_checksum_verification_sample_interval";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libpff_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - recovered item list already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->read_allocation_tables == 0 )
+	internal_file->io_handle->checksum_verification_sample_interval = sample_interval;
+	internal_file->io_handle->checksum_verification_sample_count    = 0;
+
+	return( 1 );
+}
+
+/* Sets the number of read-ahead threads
+ * When set, a sequential read of data stored in a data array (XBLOCK)
+ * reads ahead the data blocks that follow and decompresses them in parallel
+ * A number of threads of 0 disables read-ahead, which is the default
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_set_number_of_read_ahead_threads(
+     libpff_file_t *file,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libpff_internal_file_t *internal_file = NULL;
+	static char *function                 = "libpff_file_set_number_of_read_ahead_threads";
+
+	if( file == NULL )
 	{
-		if( libpff_internal_file_read_allocation_tables(
-		     internal_file,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read allocation tables.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
+		return( -1 );
+	}
+	internal_file = (libpff_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of threads - multi-threading support is not available.",
+		 function );
+
+		return( -1 );
+	}
 #endif
-			libcerror_error_free(
-			 error );
+	internal_file->io_handle->number_of_read_ahead_threads = number_of_threads;
 
-/* TODO set recovery_flags |= LIBPFF_RECOVERY_FLAG_IGNORE_ALLOCATION_DATA ? */
-		}
+	return( 1 );
+}
+
+/* Sets the number of recovery threads
+ * When set, the unallocated data is scanned for recoverable items in parallel
+ * A number of threads of 0 scans by the calling thread, which is the default
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_set_number_of_recovery_threads(
+     libpff_file_t *file,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libpff_internal_file_t *internal_file = NULL;
+	static char *function                 = "libpff_file_set_number_of_recovery_threads";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-	if( libcdata_list_initialize(
-	     &( internal_file->recovered_item_list ),
+	internal_file = (libpff_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of threads - multi-threading support is not available.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->io_handle->number_of_recovery_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Recovers deleted items
+ * By default only the unallocated space is checked for recoverable items
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_recover_items(
+     libpff_file_t *file,
+     uint8_t recovery_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_file_recover_items";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_internal_file_recover_items(
+	     (libpff_internal_file_t *) file,
+	     recovery_flags,
+	     NULL,
+	     NULL,
+	     NULL,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create recovered item list.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to recover items.",
 		 function );
 
 		return( -1 );
 	}
-	result = libpff_recover_items(
-	          internal_file->io_handle,
-	          internal_file->file_io_handle,
-	          internal_file->descriptors_index,
-	          internal_file->offsets_index,
-	          internal_file->unallocated_data_block_list,
-	          internal_file->unallocated_page_block_list,
-	          internal_file->recovered_item_list,
-	          recovery_flags,
-	          error );
+	return( 1 );
+}
 
-	if( result != 1 )
+/* Recovers deleted items and passes each recovered item to a callback function
+ * The callback function is called for each recovered item once it has been validated,
+ * which is after the unallocated data has been scanned
+ * The recovered item is freed after the callback function returns
+ * The recovery is aborted if the callback function returns -1
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_recover_items_with_callback(
+     libpff_file_t *file,
+     uint8_t recovery_flags,
+     int (*recovered_item_callback)(
+            libpff_item_t *recovered_item,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libpff_file_recovered_item_callback_data_t recovered_item_callback_data;
+
+	static char *function = "libpff_file_recover_items_with_callback";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_item_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered item callback.",
+		 function );
+
+		return( -1 );
+	}
+	recovered_item_callback_data.internal_file           = (libpff_internal_file_t *) file;
+	recovered_item_callback_data.recovered_item_callback = recovered_item_callback;
+	recovered_item_callback_data.callback_data           = callback_data;
+
+	if( libpff_internal_file_recover_items(
+	     (libpff_internal_file_t *) file,
+	     recovery_flags,
+	     NULL,
+	     (int (*)(libcdata_tree_node_t *, void *, libcerror_error_t **)) &libpff_internal_file_recovered_item_callback,
+	     (void *) &recovered_item_callback_data,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1524,11 +1770,1490 @@ int libpff_file_recover_items(
 
 		return( -1 );
 	}
-        if( internal_file->io_handle->abort != 0 )
-        {
-                internal_file->io_handle->abort = 0;
-        }
-	return( result );
+	return( 1 );
+}
+
+/* Recovers deleted items using a checkpoint file
+ * The checkpoint file is written periodically while scanning and when the scan is aborted
+ * The checkpoint is written alternately to the checkpoint file and the checkpoint file with
+ * the suffix .1, hence an interrupted write does not affect the previous checkpoint
+ * If the checkpoint file exists the recovery continues from the checkpoint stored in it
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_recover_items_with_checkpoint(
+     libpff_file_t *file,
+     uint8_t recovery_flags,
+     const char *checkpoint_filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *alternate_checkpoint_file_io_handle = NULL;
+	libbfio_handle_t *checkpoint_file_io_handle           = NULL;
+	libpff_recover_checkpoint_t *checkpoint               = NULL;
+	char *alternate_checkpoint_filename                   = NULL;
+	static char *function                                 = "libpff_file_recover_items_with_checkpoint";
+	size_t checkpoint_filename_length                     = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &checkpoint_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create checkpoint file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	checkpoint_filename_length = narrow_string_length(
+	                              checkpoint_filename );
+
+	if( libbfio_file_set_name(
+	     checkpoint_file_io_handle,
+	     checkpoint_filename,
+	     checkpoint_filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in checkpoint file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The checkpoint is written alternately to the checkpoint file
+	 * and to the checkpoint file with the suffix .1
+	 */
+	alternate_checkpoint_filename = narrow_string_allocate(
+	                                 checkpoint_filename_length + 3 );
+
+	if( alternate_checkpoint_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create alternate checkpoint filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     alternate_checkpoint_filename,
+	     checkpoint_filename,
+	     checkpoint_filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy alternate checkpoint filename.",
+		 function );
+
+		goto on_error;
+	}
+	alternate_checkpoint_filename[ checkpoint_filename_length ]     = '.';
+	alternate_checkpoint_filename[ checkpoint_filename_length + 1 ] = '1';
+	alternate_checkpoint_filename[ checkpoint_filename_length + 2 ] = 0;
+
+	if( libbfio_file_initialize(
+	     &alternate_checkpoint_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create alternate checkpoint file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     alternate_checkpoint_file_io_handle,
+	     alternate_checkpoint_filename,
+	     checkpoint_filename_length + 3,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in alternate checkpoint file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 alternate_checkpoint_filename );
+
+	alternate_checkpoint_filename = NULL;
+
+	if( libpff_recover_checkpoint_initialize(
+	     &checkpoint,
+	     checkpoint_file_io_handle,
+	     alternate_checkpoint_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_internal_file_recover_items(
+	     (libpff_internal_file_t *) file,
+	     recovery_flags,
+	     checkpoint,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to recover items.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_recover_checkpoint_free(
+	     &checkpoint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &alternate_checkpoint_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free alternate checkpoint file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &checkpoint_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free checkpoint file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( checkpoint != NULL )
+	{
+		libpff_recover_checkpoint_free(
+		 &checkpoint,
+		 NULL );
+	}
+	if( alternate_checkpoint_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &alternate_checkpoint_file_io_handle,
+		 NULL );
+	}
+	if( alternate_checkpoint_filename != NULL )
+	{
+		memory_free(
+		 alternate_checkpoint_filename );
+	}
+	if( checkpoint_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &checkpoint_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Recovers deleted items using a checkpoint file
+ * The checkpoint file is written periodically while scanning and when the scan is aborted
+ * The checkpoint is written alternately to the checkpoint file and the checkpoint file with
+ * the suffix .1, hence an interrupted write does not affect the previous checkpoint
+ * If the checkpoint file exists the recovery continues from the checkpoint stored in it
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_recover_items_with_checkpoint_wide(
+     libpff_file_t *file,
+     uint8_t recovery_flags,
+     const wchar_t *checkpoint_filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *alternate_checkpoint_file_io_handle = NULL;
+	libbfio_handle_t *checkpoint_file_io_handle           = NULL;
+	libpff_recover_checkpoint_t *checkpoint               = NULL;
+	wchar_t *alternate_checkpoint_filename                = NULL;
+	static char *function                                 = "libpff_file_recover_items_with_checkpoint_wide";
+	size_t checkpoint_filename_length                     = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &checkpoint_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create checkpoint file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	checkpoint_filename_length = wide_string_length(
+	                              checkpoint_filename );
+
+	if( libbfio_file_set_name_wide(
+	     checkpoint_file_io_handle,
+	     checkpoint_filename,
+	     checkpoint_filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in checkpoint file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The checkpoint is written alternately to the checkpoint file
+	 * and to the checkpoint file with the suffix .1
+	 */
+	alternate_checkpoint_filename = wide_string_allocate(
+	                                 checkpoint_filename_length + 3 );
+
+	if( alternate_checkpoint_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create alternate checkpoint filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( wide_string_copy(
+	     alternate_checkpoint_filename,
+	     checkpoint_filename,
+	     checkpoint_filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy alternate checkpoint filename.",
+		 function );
+
+		goto on_error;
+	}
+	alternate_checkpoint_filename[ checkpoint_filename_length ]     = (wchar_t) '.';
+	alternate_checkpoint_filename[ checkpoint_filename_length + 1 ] = (wchar_t) '1';
+	alternate_checkpoint_filename[ checkpoint_filename_length + 2 ] = 0;
+
+	if( libbfio_file_initialize(
+	     &alternate_checkpoint_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create alternate checkpoint file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     alternate_checkpoint_file_io_handle,
+	     alternate_checkpoint_filename,
+	     checkpoint_filename_length + 3,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in alternate checkpoint file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 alternate_checkpoint_filename );
+
+	alternate_checkpoint_filename = NULL;
+
+	if( libpff_recover_checkpoint_initialize(
+	     &checkpoint,
+	     checkpoint_file_io_handle,
+	     alternate_checkpoint_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_internal_file_recover_items(
+	     (libpff_internal_file_t *) file,
+	     recovery_flags,
+	     checkpoint,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to recover items.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_recover_checkpoint_free(
+	     &checkpoint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &alternate_checkpoint_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free alternate checkpoint file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &checkpoint_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free checkpoint file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( checkpoint != NULL )
+	{
+		libpff_recover_checkpoint_free(
+		 &checkpoint,
+		 NULL );
+	}
+	if( alternate_checkpoint_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &alternate_checkpoint_file_io_handle,
+		 NULL );
+	}
+	if( alternate_checkpoint_filename != NULL )
+	{
+		memory_free(
+		 alternate_checkpoint_filename );
+	}
+	if( checkpoint_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &checkpoint_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Recovers deleted items
+ * If a checkpoint is provided the recovery continues from and updates the checkpoint
+ * If a recovered item callback is provided the recovered items are passed to the callback
+ * instead of being added to the recovered item array
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_internal_file_recover_items(
+     libpff_internal_file_t *internal_file,
+     uint8_t recovery_flags,
+     libpff_recover_checkpoint_t *checkpoint,
+     int (*recovered_item_callback)(
+            libcdata_tree_node_t *item_tree_node,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_internal_file_recover_items";
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->recovered_item_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - recovered item array already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->read_allocation_tables == 0 )
+	{
+		if( libpff_internal_file_read_allocation_tables(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read allocation tables.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+/* TODO set recovery_flags |= LIBPFF_RECOVERY_FLAG_IGNORE_ALLOCATION_DATA ? */
+		}
+	}
+	if( libcdata_array_initialize(
+	     &( internal_file->recovered_item_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovered item array.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_recover_items(
+	          internal_file->io_handle,
+	          internal_file->file_io_handle,
+	          internal_file->descriptors_index,
+	          internal_file->offsets_index,
+	          internal_file->unallocated_data_block_bitmap,
+	          internal_file->unallocated_page_block_bitmap,
+	          internal_file->recovered_item_array,
+	          recovered_item_callback,
+	          callback_data,
+	          recovery_flags,
+	          checkpoint,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to recover items.",
+		 function );
+
+		goto on_error;
+	}
+        if( internal_file->io_handle->abort != 0 )
+        {
+                internal_file->io_handle->abort = 0;
+        }
+	return( result );
+
+on_error:
+	/* Discard the partially recovered items and index values so that
+	 * the recovery can be restarted, e.g. from a checkpoint
+	 */
+	if( internal_file->recovered_item_array != NULL )
+	{
+		libcdata_array_free(
+		 &( internal_file->recovered_item_array ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libpff_item_tree_node_free_recovered,
+		 NULL );
+	}
+	if( internal_file->descriptors_index != NULL )
+	{
+		libpff_descriptors_index_empty_recovered_index_values(
+		 internal_file->descriptors_index,
+		 NULL );
+	}
+	if( internal_file->offsets_index != NULL )
+	{
+		libpff_offsets_index_empty_recovered_index_values(
+		 internal_file->offsets_index,
+		 NULL );
+	}
+	internal_file->io_handle->abort = 0;
+
+	return( -1 );
+}
+
+/* Passes a recovered item to the recovered item callback function
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_internal_file_recovered_item_callback(
+     libcdata_tree_node_t *item_tree_node,
+     libpff_file_recovered_item_callback_data_t *recovered_item_callback_data,
+     libcerror_error_t **error )
+{
+	libpff_internal_file_t *internal_file = NULL;
+	libpff_item_t *recovered_item         = NULL;
+	static char *function                 = "libpff_internal_file_recovered_item_callback";
+
+	if( recovered_item_callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered item callback data.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_item_callback_data->recovered_item_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid recovered item callback data - missing recovered item callback.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = recovered_item_callback_data->internal_file;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid recovered item callback data - missing file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_item_initialize(
+	     &recovered_item,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     internal_file->name_to_id_map_list,
+	     internal_file->descriptors_index,
+	     internal_file->offsets_index,
+	     internal_file->item_tree,
+	     item_tree_node,
+	     LIBPFF_ITEM_FLAGS_DEFAULT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovered item.",
+		 function );
+
+		goto on_error;
+	}
+	if( recovered_item_callback_data->recovered_item_callback(
+	     recovered_item,
+	     recovered_item_callback_data->callback_data,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: recovered item callback failed.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_item_free(
+	     &recovered_item,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free recovered item.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( recovered_item != NULL )
+	{
+		libpff_item_free(
+		 &recovered_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the recovered items to a file
+ * The recovered items and recovered index values are written to the file,
+ * so that they can be imported without scanning for recoverable items again
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_export_recovered_items(
+     libpff_file_t *file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libpff_file_export_recovered_items";
+	size_t filename_length           = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_file_export_recovered_items_file_io_handle(
+	     file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to export recovered items to file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Exports the recovered items to a file
+ * The recovered items and recovered index values are written to the file,
+ * so that they can be imported without scanning for recoverable items again
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_export_recovered_items_wide(
+     libpff_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libpff_file_export_recovered_items_wide";
+	size_t filename_length           = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_file_export_recovered_items_file_io_handle(
+	     file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to export recovered items to file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Exports the recovered items using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_file_export_recovered_items_file_io_handle(
+     libpff_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libpff_internal_file_t *internal_file   = NULL;
+	libpff_recover_checkpoint_t *checkpoint = NULL;
+	static char *function                   = "libpff_file_export_recovered_items_file_io_handle";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libpff_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->recovered_item_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing recovered item array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_recover_checkpoint_initialize(
+	     &checkpoint,
+	     file_io_handle,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_recover_checkpoint_set_file_parameters(
+	     checkpoint,
+	     internal_file->io_handle->file_type,
+	     internal_file->io_handle->file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set checkpoint file parameters.",
+		 function );
+
+		goto on_error;
+	}
+	checkpoint->flags = LIBPFF_RECOVER_CHECKPOINT_FLAG_SCAN_COMPLETED
+	                  | LIBPFF_RECOVER_CHECKPOINT_FLAG_ITEMS_ANALYZED;
+
+	if( libpff_recover_checkpoint_write(
+	     checkpoint,
+	     internal_file->descriptors_index,
+	     internal_file->offsets_index,
+	     internal_file->recovered_item_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write recovered items.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_recover_checkpoint_free(
+	     &checkpoint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( checkpoint != NULL )
+	{
+		libpff_recover_checkpoint_free(
+		 &checkpoint,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Imports the recovered items from a file
+ * The file must have been created by libpff_file_export_recovered_items for the same file
+ * and its index root nodes must not have changed since
+ * Returns 1 if successful, 0 if the file does not exist or -1 on error
+ */
+int libpff_file_import_recovered_items(
+     libpff_file_t *file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libpff_file_import_recovered_items";
+	size_t filename_length           = 0;
+	int result                       = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libpff_file_import_recovered_items_file_io_handle(
+	          file,
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to import recovered items from file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Imports the recovered items from a file
+ * The file must have been created by libpff_file_export_recovered_items for the same file
+ * and its index root nodes must not have changed since
+ * Returns 1 if successful, 0 if the file does not exist or -1 on error
+ */
+int libpff_file_import_recovered_items_wide(
+     libpff_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libpff_file_import_recovered_items_wide";
+	size_t filename_length           = 0;
+	int result                       = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libpff_file_import_recovered_items_file_io_handle(
+	          file,
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to import recovered items from file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Imports the recovered items using a Basic File IO (bfio) handle
+ * If the import fails the recovered items and recovered index values are removed
+ * Returns 1 if successful, 0 if the file does not exist or -1 on error
+ */
+int libpff_file_import_recovered_items_file_io_handle(
+     libpff_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libpff_internal_file_t *internal_file   = NULL;
+	libpff_recover_checkpoint_t *checkpoint = NULL;
+	static char *function                   = "libpff_file_import_recovered_items_file_io_handle";
+	int result                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libpff_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->recovered_item_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - recovered item array already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_recover_checkpoint_initialize(
+	     &checkpoint,
+	     file_io_handle,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_recover_checkpoint_set_file_parameters(
+	     checkpoint,
+	     internal_file->io_handle->file_type,
+	     internal_file->io_handle->file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set checkpoint file parameters.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_file->recovered_item_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovered item array.",
+		 function );
+
+		goto on_error;
+	}
+	result = libpff_recover_checkpoint_read(
+	          checkpoint,
+	          internal_file->descriptors_index,
+	          internal_file->offsets_index,
+	          internal_file->recovered_item_array,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read recovered items.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libcdata_array_free(
+		     &( internal_file->recovered_item_array ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free recovered item array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libpff_recover_checkpoint_free(
+	     &checkpoint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( internal_file->recovered_item_array != NULL )
+	{
+		libcdata_array_free(
+		 &( internal_file->recovered_item_array ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libpff_item_tree_node_free_recovered,
+		 NULL );
+	}
+	/* A partially read checkpoint leaves recovered index values behind
+	 */
+	if( internal_file->descriptors_index != NULL )
+	{
+		libpff_descriptors_index_empty_recovered_index_values(
+		 internal_file->descriptors_index,
+		 NULL );
+	}
+	if( internal_file->offsets_index != NULL )
+	{
+		libpff_offsets_index_empty_recovered_index_values(
+		 internal_file->offsets_index,
+		 NULL );
+	}
+	if( checkpoint != NULL )
+	{
+		libpff_recover_checkpoint_free(
+		 &checkpoint,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieves the file size
@@ -1876,9 +3601,9 @@ int libpff_file_get_number_of_unallocated_blocks(
      int *number_of_unallocated_blocks,
      libcerror_error_t **error )
 {
-	libcdata_range_list_t *unallocated_block_list = NULL;
-	libpff_internal_file_t *internal_file         = NULL;
-	static char *function                         = "libpff_file_get_number_of_unallocated_blocks";
+	libpff_allocation_bitmap_t *unallocated_block_bitmap = NULL;
+	libpff_internal_file_t *internal_file                = NULL;
+	static char *function                                = "libpff_file_get_number_of_unallocated_blocks";
 
 	if( file == NULL )
 	{
@@ -1923,13 +3648,13 @@ int libpff_file_get_number_of_unallocated_blocks(
 	}
 	if( unallocated_block_type == LIBPFF_UNALLOCATED_BLOCK_TYPE_DATA )
 	{
-		unallocated_block_list = internal_file->unallocated_data_block_list;
+		unallocated_block_bitmap = internal_file->unallocated_data_block_bitmap;
 	}
 	else if( unallocated_block_type == LIBPFF_UNALLOCATED_BLOCK_TYPE_PAGE )
 	{
-		unallocated_block_list = internal_file->unallocated_page_block_list;
+		unallocated_block_bitmap = internal_file->unallocated_page_block_bitmap;
 	}
-	if( unallocated_block_list == NULL )
+	if( unallocated_block_bitmap == NULL )
 	{
 		if( number_of_unallocated_blocks == NULL )
 		{
@@ -1946,8 +3671,8 @@ int libpff_file_get_number_of_unallocated_blocks(
 	}
 	else
 	{
-		if( libcdata_range_list_get_number_of_elements(
-		     unallocated_block_list,
+		if( libpff_allocation_bitmap_get_number_of_ranges(
+		     unallocated_block_bitmap,
 		     number_of_unallocated_blocks,
 		     error ) != 1 )
 		{
@@ -1975,10 +3700,9 @@ int libpff_file_get_unallocated_block(
      size64_t *size,
      libcerror_error_t **error )
 {
-	libcdata_range_list_t *unallocated_block_list = NULL;
-	libpff_internal_file_t *internal_file         = NULL;
-	intptr_t *value                               = NULL;
-	static char *function                         = "libpff_file_get_unallocated_block";
+	libpff_allocation_bitmap_t *unallocated_block_bitmap = NULL;
+	libpff_internal_file_t *internal_file                = NULL;
+	static char *function                                = "libpff_file_get_unallocated_block";
 
 	if( file == NULL )
 	{
@@ -2007,19 +3731,19 @@ int libpff_file_get_unallocated_block(
 
 	if( unallocated_block_type == LIBPFF_UNALLOCATED_BLOCK_TYPE_DATA )
 	{
-		unallocated_block_list = internal_file->unallocated_data_block_list;
+		unallocated_block_bitmap = internal_file->unallocated_data_block_bitmap;
 	}
 	else if( unallocated_block_type == LIBPFF_UNALLOCATED_BLOCK_TYPE_PAGE )
 	{
-		unallocated_block_list = internal_file->unallocated_page_block_list;
+		unallocated_block_bitmap = internal_file->unallocated_page_block_bitmap;
 	}
-	if( unallocated_block_list == NULL )
+	if( unallocated_block_bitmap == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing unallocated block list.",
+		 "%s: invalid file - missing unallocated block bitmap.",
 		 function );
 
 		return( -1 );
@@ -2040,19 +3764,18 @@ int libpff_file_get_unallocated_block(
 			return( -1 );
 		}
 	}
-	if( libcdata_range_list_get_range_by_index(
-	     unallocated_block_list,
+	if( libpff_allocation_bitmap_get_range_by_index(
+	     unallocated_block_bitmap,
 	     unallocated_block_index,
-	     (uint64_t *) offset,
-	     (uint64_t *) size,
-	     &value,
+	     offset,
+	     size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve range list element: %d.",
+		 "%s: unable to retrieve unallocated block: %d.",
 		 function,
 		 unallocated_block_index );
 
@@ -2598,8 +4321,8 @@ int libpff_file_get_number_of_orphan_items(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_number_of_elements(
-	     internal_file->orphan_item_list,
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->orphan_item_array,
 	     number_of_orphan_items,
 	     error ) != 1 )
 	{
@@ -2663,8 +4386,8 @@ int libpff_file_get_orphan_item_by_index(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_value_by_index(
-	     internal_file->orphan_item_list,
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->orphan_item_array,
 	     orphan_item_index,
 	     (intptr_t **) &orphan_item_tree_node,
 	     error ) != 1 )
@@ -2738,8 +4461,8 @@ int libpff_file_get_number_of_recovered_items(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_number_of_elements(
-	     internal_file->recovered_item_list,
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->recovered_item_array,
 	     number_of_recovered_items,
 	     error ) != 1 )
 	{
@@ -2803,8 +4526,8 @@ int libpff_file_get_recovered_item_by_index(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_value_by_index(
-	     internal_file->recovered_item_list,
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->recovered_item_array,
 	     recovered_item_index,
 	     (intptr_t **) &recovered_item_tree_node,
 	     error ) != 1 )
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libpff_allocation_bitmap.h"
 #include "libpff_descriptors_index.h"
 #include "libpff_extern.h"
 #include "libpff_file_header.h"
@@ -36,6 +37,7 @@
 #include "libpff_libfcache.h"
 #include "libpff_libfdata.h"
 #include "libpff_offsets_index.h"
+#include "libpff_recover_checkpoint.h"
 #include "libpff_types.h"
 
 #if defined( _MSC_VER ) || defined( __BORLANDC__ ) || defined( __MINGW32__ )
@@ -90,26 +92,26 @@ struct libpff_internal_file
 	 */
 	libcdata_tree_node_t *root_folder_item_tree_node;
 
-	/* The orphan item list
+	/* The orphan item array
 	 */
-	libcdata_list_t *orphan_item_list;
+	libcdata_array_t *orphan_item_array;
 
-	/* The recovered item list
+	/* The recovered item array
 	 */
-	libcdata_list_t *recovered_item_list;
+	libcdata_array_t *recovered_item_array;
 
 	/* Value to indicate if the allocation tables
 	 * have been read
 	 */
 	int read_allocation_tables;
 
-	/* The unallocated data block (offset) list
+	/* The unallocated data block allocation bitmap
 	 */
-	libcdata_range_list_t *unallocated_data_block_list;
+	libpff_allocation_bitmap_t *unallocated_data_block_bitmap;
 
-	/* The unallocated page block (offset) list
+	/* The unallocated page block allocation bitmap
 	 */
-	libcdata_range_list_t *unallocated_page_block_list;
+	libpff_allocation_bitmap_t *unallocated_page_block_bitmap;
 
 	/* The name to id map list
 	 */
@@ -120,6 +122,26 @@ struct libpff_internal_file
 	int content_type;
 };
 
+typedef struct libpff_file_recovered_item_callback_data libpff_file_recovered_item_callback_data_t;
+
+struct libpff_file_recovered_item_callback_data
+{
+	/* The file
+	 */
+	libpff_internal_file_t *internal_file;
+
+	/* The recovered item callback function
+	 */
+	int (*recovered_item_callback)(
+	       libpff_item_t *recovered_item,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The callback data
+	 */
+	void *callback_data;
+};
+
 LIBPFF_EXTERN \
 int libpff_file_initialize(
      libpff_file_t **file,
@@ -179,12 +201,125 @@ int libpff_file_is_corrupted(
      libpff_file_t *file,
      libcerror_error_t **error );
 
+LIBPFF_EXTERN \
+int libpff_file_get_number_of_checksum_mismatches(
+     libpff_file_t *file,
+     uint32_t *number_of_checksum_mismatches,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_file_set_checksum_verification_sample_interval(
+     libpff_file_t *file,
+     uint32_t sample_interval,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_file_set_number_of_read_ahead_threads(
+     libpff_file_t *file,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_file_set_number_of_recovery_threads(
+     libpff_file_t *file,
+     int number_of_threads,
+     libcerror_error_t **error );
+
 LIBPFF_EXTERN \
 int libpff_file_recover_items(
      libpff_file_t *file,
      uint8_t recovery_flags,
      libcerror_error_t **error );
 
+LIBPFF_EXTERN \
+int libpff_file_recover_items_with_callback(
+     libpff_file_t *file,
+     uint8_t recovery_flags,
+     int (*recovered_item_callback)(
+            libpff_item_t *recovered_item,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_file_recover_items_with_checkpoint(
+     libpff_file_t *file,
+     uint8_t recovery_flags,
+     const char *checkpoint_filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBPFF_EXTERN \
+int libpff_file_recover_items_with_checkpoint_wide(
+     libpff_file_t *file,
+     uint8_t recovery_flags,
+     const wchar_t *checkpoint_filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libpff_internal_file_recover_items(
+     libpff_internal_file_t *internal_file,
+     uint8_t recovery_flags,
+     libpff_recover_checkpoint_t *checkpoint,
+     int (*recovered_item_callback)(
+            libcdata_tree_node_t *item_tree_node,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libpff_internal_file_recovered_item_callback(
+     libcdata_tree_node_t *item_tree_node,
+     libpff_file_recovered_item_callback_data_t *recovered_item_callback_data,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_file_export_recovered_items(
+     libpff_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBPFF_EXTERN \
+int libpff_file_export_recovered_items_wide(
+     libpff_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBPFF_EXTERN \
+int libpff_file_export_recovered_items_file_io_handle(
+     libpff_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_file_import_recovered_items(
+     libpff_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBPFF_EXTERN \
+int libpff_file_import_recovered_items_wide(
+     libpff_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBPFF_EXTERN \
+int libpff_file_import_recovered_items_file_io_handle(
+     libpff_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 LIBPFF_EXTERN \
 int libpff_file_get_size(
      libpff_file_t *file,
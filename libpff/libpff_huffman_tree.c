@@ -226,6 +226,11 @@ int libpff_huffman_tree_free(
 	}
 	if( *huffman_tree != NULL )
 	{
+		if( ( *huffman_tree )->lookup_table != NULL )
+		{
+			memory_free(
+			 ( *huffman_tree )->lookup_table );
+		}
 		if( ( *huffman_tree )->code_size_counts != NULL )
 		{
 			memory_free(
@@ -244,6 +249,220 @@ int libpff_huffman_tree_free(
 	return( 1 );
 }
 
+/* Reverses the bits of a Huffman code
+ * Returns the reversed Huffman code
+ */
+static uint32_t libpff_huffman_tree_reverse_code(
+                 uint32_t huffman_code,
+                 uint8_t code_size )
+{
+	uint32_t reversed_code = 0;
+
+	while( code_size > 0 )
+	{
+		reversed_code <<= 1;
+		reversed_code  |= huffman_code & 0x00000001UL;
+		huffman_code   >>= 1;
+
+		code_size--;
+	}
+	return( reversed_code );
+}
+
+/* Builds the Huffman tree lookup table
+ * The table is indexed by the next bits of a least-significant bit first bit stream.
+ * Codes that are larger than the primary table are stored in sub tables
+ * Returns 1 on success or -1 on error
+ */
+static int libpff_huffman_tree_build_lookup_table(
+            libpff_huffman_tree_t *huffman_tree,
+            libcerror_error_t **error )
+{
+	uint8_t sub_table_bits[ 1 << LIBPFF_HUFFMAN_TREE_LOOKUP_TABLE_BITS ];
+
+	uint32_t *lookup_table   = NULL;
+	static char *function    = "libpff_huffman_tree_build_lookup_table";
+	uint32_t huffman_code    = 0;
+	uint32_t lookup_value    = 0;
+	uint32_t reversed_code   = 0;
+	uint32_t sub_table_value = 0;
+	uint32_t table_index     = 0;
+	uint8_t code_size        = 0;
+	uint8_t lookup_bits      = 0;
+	uint8_t number_of_bits   = 0;
+	int code_size_count      = 0;
+	int lookup_table_size    = 0;
+	int primary_table_size   = 0;
+	int sub_table_offset     = 0;
+	int symbol_index         = 0;
+
+	lookup_bits = huffman_tree->maximum_code_size;
+
+	if( lookup_bits > LIBPFF_HUFFMAN_TREE_LOOKUP_TABLE_BITS )
+	{
+		lookup_bits = LIBPFF_HUFFMAN_TREE_LOOKUP_TABLE_BITS;
+	}
+	primary_table_size = 1 << lookup_bits;
+
+	if( memory_set(
+	     sub_table_bits,
+	     0,
+	     sizeof( uint8_t ) * primary_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sub table bits.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the size of the sub tables needed for the codes larger than the primary table
+	 */
+	for( code_size = lookup_bits + 1;
+	     code_size <= huffman_tree->maximum_code_size;
+	     code_size++ )
+	{
+		huffman_code = 0;
+
+		for( number_of_bits = 1;
+		     number_of_bits < code_size;
+		     number_of_bits++ )
+		{
+			huffman_code += huffman_tree->code_size_counts[ number_of_bits ];
+			huffman_code <<= 1;
+		}
+		for( code_size_count = 0;
+		     code_size_count < huffman_tree->code_size_counts[ code_size ];
+		     code_size_count++ )
+		{
+			reversed_code = libpff_huffman_tree_reverse_code(
+			                 huffman_code,
+			                 code_size );
+
+			table_index = reversed_code & ( primary_table_size - 1 );
+
+			if( sub_table_bits[ table_index ] < ( code_size - lookup_bits ) )
+			{
+				sub_table_bits[ table_index ] = code_size - lookup_bits;
+			}
+			huffman_code++;
+		}
+	}
+	lookup_table_size = primary_table_size;
+
+	for( table_index = 0;
+	     table_index < (uint32_t) primary_table_size;
+	     table_index++ )
+	{
+		if( sub_table_bits[ table_index ] != 0 )
+		{
+			lookup_table_size += 1 << sub_table_bits[ table_index ];
+		}
+	}
+	if( lookup_table_size > huffman_tree->lookup_table_size )
+	{
+		lookup_table = (uint32_t *) memory_reallocate(
+		                             huffman_tree->lookup_table,
+		                             sizeof( uint32_t ) * lookup_table_size );
+
+		if( lookup_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize lookup table.",
+			 function );
+
+			return( -1 );
+		}
+		huffman_tree->lookup_table      = lookup_table;
+		huffman_tree->lookup_table_size = lookup_table_size;
+	}
+	/* Unused entries are 0 and represent an invalid Huffman code
+	 */
+	if( memory_set(
+	     huffman_tree->lookup_table,
+	     0,
+	     sizeof( uint32_t ) * lookup_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup table.",
+		 function );
+
+		return( -1 );
+	}
+	sub_table_offset = primary_table_size;
+
+	for( table_index = 0;
+	     table_index < (uint32_t) primary_table_size;
+	     table_index++ )
+	{
+		if( sub_table_bits[ table_index ] != 0 )
+		{
+			huffman_tree->lookup_table[ table_index ] = ( (uint32_t) sub_table_offset << 8 )
+			                                          | LIBPFF_HUFFMAN_TREE_LOOKUP_ENTRY_FLAG_SUB_TABLE
+			                                          | sub_table_bits[ table_index ];
+
+			sub_table_offset += 1 << sub_table_bits[ table_index ];
+		}
+	}
+	/* Fill the entries of the canonical Huffman codes, which are stored in the bit stream
+	 * with the most significant bit first and hence are reversed in the lookup table
+	 */
+	huffman_code = 0;
+
+	for( code_size = 1;
+	     code_size <= huffman_tree->maximum_code_size;
+	     code_size++ )
+	{
+		for( code_size_count = 0;
+		     code_size_count < huffman_tree->code_size_counts[ code_size ];
+		     code_size_count++ )
+		{
+			reversed_code = libpff_huffman_tree_reverse_code(
+			                 huffman_code,
+			                 code_size );
+
+			lookup_value = ( (uint32_t) huffman_tree->symbols[ symbol_index ] << 8 ) | code_size;
+
+			if( code_size <= lookup_bits )
+			{
+				for( table_index = reversed_code;
+				     table_index < (uint32_t) primary_table_size;
+				     table_index += (uint32_t) 1 << code_size )
+				{
+					huffman_tree->lookup_table[ table_index ] = lookup_value;
+				}
+			}
+			else
+			{
+				sub_table_value  = huffman_tree->lookup_table[ reversed_code & ( primary_table_size - 1 ) ];
+				sub_table_offset = (int) ( sub_table_value >> 8 );
+				number_of_bits   = (uint8_t) ( sub_table_value & LIBPFF_HUFFMAN_TREE_LOOKUP_ENTRY_SIZE_MASK );
+
+				for( table_index = reversed_code >> lookup_bits;
+				     table_index < ( (uint32_t) 1 << number_of_bits );
+				     table_index += (uint32_t) 1 << ( code_size - lookup_bits ) )
+				{
+					huffman_tree->lookup_table[ sub_table_offset + table_index ] = lookup_value;
+				}
+			}
+			huffman_code++;
+			symbol_index++;
+		}
+		huffman_code <<= 1;
+	}
+	huffman_tree->lookup_table_bits = lookup_bits;
+
+	return( 1 );
+}
+
 /* Builds the Huffman tree
  * Returns 1 on success, 0 if the tree is empty or -1 on error
  */
@@ -307,6 +526,8 @@ int libpff_huffman_tree_build(
 
 		return( -1 );
 	}
+	huffman_tree->lookup_table_bits = 0;
+
 	/* Determine the code size frequencies
 	 */
 	array_size = sizeof( int ) * ( huffman_tree->maximum_code_size + 1 );
@@ -448,6 +669,24 @@ int libpff_huffman_tree_build(
 	memory_free(
 	 symbol_offsets );
 
+	symbol_offsets = NULL;
+
+	if( huffman_tree->maximum_code_size <= LIBPFF_HUFFMAN_TREE_LOOKUP_TABLE_MAXIMUM_CODE_SIZE )
+	{
+		if( libpff_huffman_tree_build_lookup_table(
+		     huffman_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build lookup table.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
 
 on_error:
@@ -469,9 +708,11 @@ int libpff_huffman_tree_get_symbol_from_bit_stream(
      libcerror_error_t **error )
 {
 	static char *function  = "libpff_huffman_tree_get_symbol_from_bit_stream";
+	uint32_t lookup_value  = 0;
 	uint32_t value_32bit   = 0;
 	uint16_t safe_symbol   = 0;
 	uint8_t bit_index      = 0;
+	uint8_t code_size      = 0;
 	int code_size_count    = 0;
 	int first_huffman_code = 0;
 	int first_index        = 0;
@@ -511,8 +752,63 @@ int libpff_huffman_tree_get_symbol_from_bit_stream(
 
 		return( -1 );
 	}
-/* TODO get maximum_code_size of bits into local bit buffer */
+	if( ( huffman_tree->lookup_table_bits != 0 )
+	 && ( bit_stream->storage_type == LIBPFF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT ) )
+	{
+		/* Near the end of the byte stream less bits than the maximum code size
+		 * can be available, which is checked after the lookup
+		 */
+		if( bit_stream->bit_buffer_size < huffman_tree->maximum_code_size )
+		{
+			if( libpff_bit_stream_read(
+			     bit_stream,
+			     huffman_tree->maximum_code_size,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read bits from bit stream.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		lookup_value = huffman_tree->lookup_table[ libpff_bit_stream_peek_bits( bit_stream, huffman_tree->lookup_table_bits ) ];
+
+		if( ( lookup_value & LIBPFF_HUFFMAN_TREE_LOOKUP_ENTRY_FLAG_SUB_TABLE ) != 0 )
+		{
+			value_32bit = (uint32_t) ( bit_stream->bit_buffer >> huffman_tree->lookup_table_bits )
+			            & ( ( 1UL << ( lookup_value & LIBPFF_HUFFMAN_TREE_LOOKUP_ENTRY_SIZE_MASK ) ) - 1 );
+
+			lookup_value = huffman_tree->lookup_table[ ( lookup_value >> 8 ) + value_32bit ];
+		}
+		code_size = (uint8_t) ( lookup_value & LIBPFF_HUFFMAN_TREE_LOOKUP_ENTRY_SIZE_MASK );
+
+		if( ( code_size == 0 )
+		 || ( code_size > bit_stream->bit_buffer_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid Huffman code: 0x%08" PRIx32 ".",
+			 function,
+			 libpff_bit_stream_peek_bits( bit_stream, huffman_tree->maximum_code_size ) );
+
+			return( -1 );
+		}
+		libpff_bit_stream_skip_bits(
+		 bit_stream,
+		 code_size );
 
+		*symbol = (uint16_t) ( lookup_value >> 8 );
+
+		return( 1 );
+	}
+	/* Fallback to determining the code bit by bit
+	 */
 	for( bit_index = 1;
 	     bit_index <= huffman_tree->maximum_code_size;
 	     bit_index++ )
@@ -32,6 +32,22 @@
 extern "C" {
 #endif
 
+/* The number of bits used to index the primary lookup table
+ */
+#define LIBPFF_HUFFMAN_TREE_LOOKUP_TABLE_BITS		10
+
+/* The maximum code size supported by the lookup table
+ */
+#define LIBPFF_HUFFMAN_TREE_LOOKUP_TABLE_MAXIMUM_CODE_SIZE	16
+
+/* The lookup table entry values
+ * bit 0-4      the code size or the number of bits of the sub table
+ * bit 7        set if the entry refers to a sub table
+ * bit 8-31     the symbol or the index of the sub table
+ */
+#define LIBPFF_HUFFMAN_TREE_LOOKUP_ENTRY_SIZE_MASK	0x0000001fUL
+#define LIBPFF_HUFFMAN_TREE_LOOKUP_ENTRY_FLAG_SUB_TABLE	0x00000080UL
+
 typedef struct libpff_huffman_tree libpff_huffman_tree_t;
 
 struct libpff_huffman_tree
@@ -47,6 +63,19 @@ struct libpff_huffman_tree
 	/* The code size counts array
 	 */
 	int *code_size_counts;
+
+	/* The lookup table, the primary table followed by the sub tables
+	 */
+	uint32_t *lookup_table;
+
+	/* The number of entries allocated for the lookup table
+	 */
+	int lookup_table_size;
+
+	/* The number of bits used to index the primary lookup table
+	 * 0 represents the lookup table is not used
+	 */
+	uint8_t lookup_table_bits;
 };
 
 int libpff_huffman_tree_initialize(
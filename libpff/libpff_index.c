@@ -351,6 +351,25 @@ int libpff_index_get_leaf_node_from_node_by_identifier(
 
 		goto on_error;
 	}
+	result = libpff_io_handle_check_if_checksum_should_be_verified(
+	          io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if checksum should be verified.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		index_node->flags |= LIBPFF_INDEX_NODE_FLAG_SKIP_CHECKSUM_VERIFICATION;
+	}
 	if( libpff_index_node_read_file_io_handle(
 	     index_node,
 	     file_io_handle,
@@ -369,6 +388,10 @@ int libpff_index_get_leaf_node_from_node_by_identifier(
 
 		goto on_error;
 	}
+	if( ( index_node->flags & LIBPFF_INDEX_NODE_FLAG_CRC_MISMATCH ) != 0 )
+	{
+		io_handle->number_of_checksum_mismatches += 1;
+	}
 	if( index->type != index_node->type )
 	{
 		libcerror_error_set(
@@ -350,35 +350,40 @@ int libpff_index_node_read_data(
 
 		return( -1 );
 	}
-	if( libpff_checksum_calculate_weak_crc32(
-	     &calculated_checksum,
-	     data,
-	     checksum_data_size,
-	     0,
-	     error ) != 1 )
+	if( ( index_node->flags & LIBPFF_INDEX_NODE_FLAG_SKIP_CHECKSUM_VERIFICATION ) == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to calculate weak CRC-32.",
-		 function );
-
-		return( -1 );
-	}
-	if( index_node->stored_checksum != calculated_checksum )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( libpff_checksum_calculate_weak_crc32(
+		     &calculated_checksum,
+		     data,
+		     checksum_data_size,
+		     0,
+		     error ) != 1 )
 		{
-			libcnotify_printf(
-			 "%s: mismatch in checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
-			 function,
-			 index_node->stored_checksum,
-			 calculated_checksum );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate weak CRC-32.",
+			 function );
+
+			return( -1 );
 		}
+		if( index_node->stored_checksum != calculated_checksum )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch in checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+				 function,
+				 index_node->stored_checksum,
+				 calculated_checksum );
+			}
 #endif
-		/* TODO smart error handling */
+			index_node->flags |= LIBPFF_INDEX_NODE_FLAG_CRC_MISMATCH;
+
+			/* TODO smart error handling */
+		}
 	}
 	if( file_type == LIBPFF_FILE_TYPE_32BIT )
 	{
@@ -752,6 +757,91 @@ int libpff_index_node_read_data(
 	return( 1 );
 }
 
+/* Tries to read an index node
+ * Recovery probes data that is not expected to contain an index node,
+ * hence this function does not construct an error when the data is invalid
+ * Returns 1 if successful, 0 if the data does not contain an index node or -1 on invalid arguments
+ */
+int libpff_index_node_try_read_data(
+     libpff_index_node_t *index_node,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t file_type )
+{
+	const uint8_t *footer_data         = NULL;
+	size_t index_node_data_size        = 0;
+	size_t index_node_footer_data_size = 0;
+	uint8_t index_node_type            = 0;
+	uint8_t index_node_type_copy       = 0;
+
+	if( ( index_node == NULL )
+	 || ( data == NULL )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		return( -1 );
+	}
+	if( file_type == LIBPFF_FILE_TYPE_32BIT )
+	{
+		index_node_data_size        = 512;
+		index_node_footer_data_size = sizeof( pff_index_node_32bit_footer_t );
+	}
+	else if( file_type == LIBPFF_FILE_TYPE_64BIT )
+	{
+		index_node_data_size        = 512;
+		index_node_footer_data_size = sizeof( pff_index_node_64bit_footer_t );
+	}
+	else if( file_type == LIBPFF_FILE_TYPE_64BIT_4K_PAGE )
+	{
+		index_node_data_size        = 4096;
+		index_node_footer_data_size = sizeof( pff_index_node_64bit_4k_page_footer_t );
+	}
+	else
+	{
+		return( -1 );
+	}
+	if( data_size < index_node_data_size )
+	{
+		return( -1 );
+	}
+	/* Reject data without a supported index node type in the footer
+	 * before calculating the checksum
+	 */
+	footer_data = &( data[ index_node_data_size - index_node_footer_data_size ] );
+
+	if( file_type == LIBPFF_FILE_TYPE_32BIT )
+	{
+		index_node_type      = ( (pff_index_node_32bit_footer_t *) footer_data )->type;
+		index_node_type_copy = ( (pff_index_node_32bit_footer_t *) footer_data )->type_copy;
+	}
+	else if( file_type == LIBPFF_FILE_TYPE_64BIT )
+	{
+		index_node_type      = ( (pff_index_node_64bit_footer_t *) footer_data )->type;
+		index_node_type_copy = ( (pff_index_node_64bit_footer_t *) footer_data )->type_copy;
+	}
+	else
+	{
+		index_node_type      = ( (pff_index_node_64bit_4k_page_footer_t *) footer_data )->type;
+		index_node_type_copy = ( (pff_index_node_64bit_4k_page_footer_t *) footer_data )->type_copy;
+	}
+	if( ( index_node_type != LIBPFF_INDEX_TYPE_DESCRIPTOR )
+	 && ( index_node_type != LIBPFF_INDEX_TYPE_OFFSET )
+	 && ( index_node_type_copy != LIBPFF_INDEX_TYPE_DESCRIPTOR )
+	 && ( index_node_type_copy != LIBPFF_INDEX_TYPE_OFFSET ) )
+	{
+		return( 0 );
+	}
+	if( libpff_index_node_read_data(
+	     index_node,
+	     data,
+	     data_size,
+	     file_type,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
 /* Reads an index node footer
  * Returns 1 if successful or -1 on error
  */
@@ -1202,6 +1292,77 @@ on_error:
 	return( -1 );
 }
 
+/* Tries to read an index node
+ * Recovery probes offsets that are not expected to contain an index node,
+ * hence this function does not construct an error when the index node is invalid
+ * Returns 1 if successful, 0 if no index node could be read or -1 on error
+ */
+int libpff_index_node_try_read_file_io_handle(
+     libpff_index_node_t *index_node,
+     libbfio_handle_t *file_io_handle,
+     off64_t node_offset,
+     uint8_t file_type )
+{
+	ssize_t read_count = 0;
+	int result         = 0;
+
+	if( index_node == NULL )
+	{
+		return( -1 );
+	}
+	if( index_node->data != NULL )
+	{
+		return( -1 );
+	}
+	if( ( file_type == LIBPFF_FILE_TYPE_32BIT )
+	 || ( file_type == LIBPFF_FILE_TYPE_64BIT ) )
+	{
+		index_node->data_size = 512;
+	}
+	else if( file_type == LIBPFF_FILE_TYPE_64BIT_4K_PAGE )
+	{
+		index_node->data_size = 4096;
+	}
+	else
+	{
+		return( -1 );
+	}
+	index_node->data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * index_node->data_size );
+
+	if( index_node->data == NULL )
+	{
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              index_node->data,
+	              index_node->data_size,
+	              node_offset,
+	              NULL );
+
+	if( read_count == (ssize_t) index_node->data_size )
+	{
+		result = libpff_index_node_try_read_data(
+		          index_node,
+		          index_node->data,
+		          index_node->data_size,
+		          file_type );
+	}
+	if( result != 1 )
+	{
+		memory_free(
+		 index_node->data );
+
+		index_node->data = NULL;
+
+		return( result );
+	}
+	index_node->entries_data = index_node->data;
+
+	return( 1 );
+}
+
 /* Checks if a buffer containing the chunk data is filled with same value bytes (empty-block)
  * Returns 1 if a pattern was found, 0 if not or -1 on error
  */
@@ -80,6 +80,10 @@ struct libpff_index_node
 	/* The stored checksum
 	 */
 	uint32_t stored_checksum;
+
+	/* Various flags
+	 */
+	uint8_t flags;
 };
 
 int libpff_index_node_initialize(
@@ -103,6 +107,12 @@ int libpff_index_node_read_data(
      uint8_t file_type,
      libcerror_error_t **error );
 
+int libpff_index_node_try_read_data(
+     libpff_index_node_t *index_node,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t file_type );
+
 int libpff_index_node_read_footer_data(
      libpff_index_node_t *index_node,
      const uint8_t *data,
@@ -117,6 +127,12 @@ int libpff_index_node_read_file_io_handle(
      uint8_t file_type,
      libcerror_error_t **error );
 
+int libpff_index_node_try_read_file_io_handle(
+     libpff_index_node_t *index_node,
+     libbfio_handle_t *file_io_handle,
+     off64_t node_offset,
+     uint8_t file_type );
+
 int libpff_index_node_check_for_empty_block(
      const uint8_t *data,
      size_t data_size,
@@ -0,0 +1,579 @@
+/*
+ * Index value set functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libpff_definitions.h"
+#include "libpff_index_value.h"
+#include "libpff_index_value_set.h"
+#include "libpff_libcerror.h"
+
+/* Creates an index value set
+ * Make sure the value index_value_set is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_index_value_set_initialize(
+     libpff_index_value_set_t **index_value_set,
+     uint8_t index_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_index_value_set_initialize";
+
+	if( index_value_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index value set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_value_set != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index value set value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( index_type != LIBPFF_INDEX_TYPE_DESCRIPTOR )
+	 && ( index_type != LIBPFF_INDEX_TYPE_OFFSET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported index type.",
+		 function );
+
+		return( -1 );
+	}
+	*index_value_set = memory_allocate_structure(
+	                    libpff_index_value_set_t );
+
+	if( *index_value_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index value set.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *index_value_set,
+	     0,
+	     sizeof( libpff_index_value_set_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index value set.",
+		 function );
+
+		memory_free(
+		 *index_value_set );
+
+		*index_value_set = NULL;
+
+		return( -1 );
+	}
+	( *index_value_set )->index_type = index_type;
+
+	if( libpff_index_value_set_resize(
+	     *index_value_set,
+	     LIBPFF_INDEX_VALUE_SET_INITIAL_NUMBER_OF_ENTRIES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize index value set.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *index_value_set != NULL )
+	{
+		memory_free(
+		 *index_value_set );
+
+		*index_value_set = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an index value set
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_index_value_set_free(
+     libpff_index_value_set_t **index_value_set,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_index_value_set_free";
+
+	if( index_value_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index value set.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_value_set != NULL )
+	{
+		if( ( *index_value_set )->entries != NULL )
+		{
+			memory_free(
+			 ( *index_value_set )->entries );
+		}
+		memory_free(
+		 *index_value_set );
+
+		*index_value_set = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the key of an index value
+ * The key consists of the values that are compared to determine if two index values are the same
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_index_value_set_get_key(
+     uint8_t index_type,
+     libpff_index_value_t *index_value,
+     uint64_t *identifier,
+     uint64_t *key_value1,
+     uint64_t *key_value2,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_index_value_set_get_key";
+
+	if( index_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index value.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_value1 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key value1.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_value2 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key value2.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_type == LIBPFF_INDEX_TYPE_DESCRIPTOR )
+	{
+		/* Ignore the upper 32-bit of descriptor identifiers
+		 */
+		*identifier = index_value->identifier & 0xffffffffUL;
+		*key_value1 = index_value->data_identifier;
+		*key_value2 = index_value->local_descriptors_identifier;
+	}
+	else if( index_type == LIBPFF_INDEX_TYPE_OFFSET )
+	{
+		*identifier = index_value->identifier;
+		*key_value1 = (uint64_t) index_value->file_offset;
+		*key_value2 = (uint64_t) index_value->data_size;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported index type.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Calculates the hash of an index value key
+ * Returns the hash
+ */
+uint64_t libpff_index_value_set_calculate_hash(
+          uint64_t identifier,
+          uint64_t key_value1,
+          uint64_t key_value2 )
+{
+	uint64_t hash = 0;
+
+	/* Each key value is mixed into the hash using the 64-bit finalizer of MurmurHash3
+	 */
+	hash = identifier;
+
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33;
+
+	hash ^= key_value1;
+	hash *= 0xc4ceb9fe1a85ec53ULL;
+	hash ^= hash >> 33;
+
+	hash ^= key_value2;
+	hash *= 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33;
+	hash *= 0xc4ceb9fe1a85ec53ULL;
+	hash ^= hash >> 33;
+
+	return( hash );
+}
+
+/* Resizes an index value set
+ * The number of entries must be a power of 2 and larger than the number of values
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_index_value_set_resize(
+     libpff_index_value_set_t *index_value_set,
+     uint32_t number_of_entries,
+     libcerror_error_t **error )
+{
+	libpff_index_value_set_entry_t *entries = NULL;
+	libpff_index_value_set_entry_t *entry   = NULL;
+	static char *function                   = "libpff_index_value_set_resize";
+	size_t entries_size                     = 0;
+	uint64_t hash                           = 0;
+	uint32_t entry_index                    = 0;
+	uint32_t entry_mask                     = 0;
+	uint32_t old_entry_index                = 0;
+
+	if( index_value_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index value set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries == 0 )
+	 || ( ( number_of_entries & ( number_of_entries - 1 ) ) != 0 )
+	 || ( number_of_entries <= index_value_set->number_of_values )
+	 || ( (size_t) number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libpff_index_value_set_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entries_size = sizeof( libpff_index_value_set_entry_t ) * number_of_entries;
+
+	entries = (libpff_index_value_set_entry_t *) memory_allocate(
+	                                              entries_size );
+
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		memory_free(
+		 entries );
+
+		return( -1 );
+	}
+	entry_mask = number_of_entries - 1;
+
+	/* Rehash the existing entries
+	 */
+	for( old_entry_index = 0;
+	     old_entry_index < index_value_set->number_of_entries;
+	     old_entry_index++ )
+	{
+		entry = &( index_value_set->entries[ old_entry_index ] );
+
+		if( entry->is_set == 0 )
+		{
+			continue;
+		}
+		hash = libpff_index_value_set_calculate_hash(
+		        entry->identifier,
+		        entry->key_value1,
+		        entry->key_value2 );
+
+		entry_index = (uint32_t) hash & entry_mask;
+
+		while( entries[ entry_index ].is_set != 0 )
+		{
+			entry_index = ( entry_index + 1 ) & entry_mask;
+		}
+		entries[ entry_index ] = *entry;
+	}
+	if( index_value_set->entries != NULL )
+	{
+		memory_free(
+		 index_value_set->entries );
+	}
+	index_value_set->entries           = entries;
+	index_value_set->number_of_entries = number_of_entries;
+
+	return( 1 );
+}
+
+/* Inserts an index value in the index value set
+ * Only the key of the index value is stored, the index value is not referenced
+ * Returns 1 if successful, 0 if the index value already exists or -1 on error
+ */
+int libpff_index_value_set_insert_value(
+     libpff_index_value_set_t *index_value_set,
+     libpff_index_value_t *index_value,
+     libcerror_error_t **error )
+{
+	libpff_index_value_set_entry_t *entry = NULL;
+	static char *function                 = "libpff_index_value_set_insert_value";
+	uint64_t hash                         = 0;
+	uint64_t identifier                   = 0;
+	uint64_t key_value1                   = 0;
+	uint64_t key_value2                   = 0;
+	uint32_t entry_index                  = 0;
+	uint32_t entry_mask                   = 0;
+
+	if( index_value_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index value set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_index_value_set_get_key(
+	     index_value_set->index_type,
+	     index_value,
+	     &identifier,
+	     &key_value1,
+	     &key_value2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index value key.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the load factor at or below 3/4 to keep the probe sequences short
+	 */
+	if( ( index_value_set->number_of_values + 1 ) > ( ( index_value_set->number_of_entries / 4 ) * 3 ) )
+	{
+		if( index_value_set->number_of_entries > ( (uint32_t) INT32_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid index value set - number of entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( libpff_index_value_set_resize(
+		     index_value_set,
+		     index_value_set->number_of_entries * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize index value set.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	hash = libpff_index_value_set_calculate_hash(
+	        identifier,
+	        key_value1,
+	        key_value2 );
+
+	entry_mask  = index_value_set->number_of_entries - 1;
+	entry_index = (uint32_t) hash & entry_mask;
+
+	while( index_value_set->entries[ entry_index ].is_set != 0 )
+	{
+		entry = &( index_value_set->entries[ entry_index ] );
+
+		if( ( entry->identifier == identifier )
+		 && ( entry->key_value1 == key_value1 )
+		 && ( entry->key_value2 == key_value2 ) )
+		{
+			return( 0 );
+		}
+		entry_index = ( entry_index + 1 ) & entry_mask;
+	}
+	entry = &( index_value_set->entries[ entry_index ] );
+
+	entry->identifier = identifier;
+	entry->key_value1 = key_value1;
+	entry->key_value2 = key_value2;
+	entry->is_set     = 1;
+
+	index_value_set->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Determines if the index value set contains an index value with the same key
+ * Returns 1 if the index value set contains the index value, 0 if not or -1 on error
+ */
+int libpff_index_value_set_contains_value(
+     libpff_index_value_set_t *index_value_set,
+     libpff_index_value_t *index_value,
+     libcerror_error_t **error )
+{
+	libpff_index_value_set_entry_t *entry = NULL;
+	static char *function                 = "libpff_index_value_set_contains_value";
+	uint64_t hash                         = 0;
+	uint64_t identifier                   = 0;
+	uint64_t key_value1                   = 0;
+	uint64_t key_value2                   = 0;
+	uint32_t entry_index                  = 0;
+	uint32_t entry_mask                   = 0;
+
+	if( index_value_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index value set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_index_value_set_get_key(
+	     index_value_set->index_type,
+	     index_value,
+	     &identifier,
+	     &key_value1,
+	     &key_value2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index value key.",
+		 function );
+
+		return( -1 );
+	}
+	hash = libpff_index_value_set_calculate_hash(
+	        identifier,
+	        key_value1,
+	        key_value2 );
+
+	entry_mask  = index_value_set->number_of_entries - 1;
+	entry_index = (uint32_t) hash & entry_mask;
+
+	while( index_value_set->entries[ entry_index ].is_set != 0 )
+	{
+		entry = &( index_value_set->entries[ entry_index ] );
+
+		if( ( entry->identifier == identifier )
+		 && ( entry->key_value1 == key_value1 )
+		 && ( entry->key_value2 == key_value2 ) )
+		{
+			return( 1 );
+		}
+		entry_index = ( entry_index + 1 ) & entry_mask;
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,126 @@
+/*
+ * Index value set functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBPFF_INDEX_VALUE_SET_H )
+#define _LIBPFF_INDEX_VALUE_SET_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libpff_index_value.h"
+#include "libpff_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define LIBPFF_INDEX_VALUE_SET_INITIAL_NUMBER_OF_ENTRIES	256
+
+typedef struct libpff_index_value_set_entry libpff_index_value_set_entry_t;
+
+struct libpff_index_value_set_entry
+{
+	/* The identifier
+	 */
+	uint64_t identifier;
+
+	/* The first key value
+	 * Contains the file offset of an offsets index value
+	 * or the data identifier of a descriptors index value
+	 */
+	uint64_t key_value1;
+
+	/* The second key value
+	 * Contains the data size of an offsets index value
+	 * or the local descriptors identifier of a descriptors index value
+	 */
+	uint64_t key_value2;
+
+	/* Value to indicate the entry is set
+	 */
+	uint8_t is_set;
+};
+
+typedef struct libpff_index_value_set libpff_index_value_set_t;
+
+struct libpff_index_value_set
+{
+	/* The index type
+	 */
+	uint8_t index_type;
+
+	/* The entries
+	 */
+	libpff_index_value_set_entry_t *entries;
+
+	/* The number of entries
+	 * This value is always a power of 2
+	 */
+	uint32_t number_of_entries;
+
+	/* The number of values
+	 */
+	uint32_t number_of_values;
+};
+
+int libpff_index_value_set_initialize(
+     libpff_index_value_set_t **index_value_set,
+     uint8_t index_type,
+     libcerror_error_t **error );
+
+int libpff_index_value_set_free(
+     libpff_index_value_set_t **index_value_set,
+     libcerror_error_t **error );
+
+int libpff_index_value_set_get_key(
+     uint8_t index_type,
+     libpff_index_value_t *index_value,
+     uint64_t *identifier,
+     uint64_t *key_value1,
+     uint64_t *key_value2,
+     libcerror_error_t **error );
+
+uint64_t libpff_index_value_set_calculate_hash(
+          uint64_t identifier,
+          uint64_t key_value1,
+          uint64_t key_value2 );
+
+int libpff_index_value_set_resize(
+     libpff_index_value_set_t *index_value_set,
+     uint32_t number_of_entries,
+     libcerror_error_t **error );
+
+int libpff_index_value_set_insert_value(
+     libpff_index_value_set_t *index_value_set,
+     libpff_index_value_t *index_value,
+     libcerror_error_t **error );
+
+int libpff_index_value_set_contains_value(
+     libpff_index_value_set_t *index_value_set,
+     libpff_index_value_t *index_value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBPFF_INDEX_VALUE_SET_H ) */
+
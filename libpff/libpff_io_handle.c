@@ -23,9 +23,12 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libpff_allocation_bitmap.h"
 #include "libpff_allocation_table.h"
+#include "libpff_buffer_pool.h"
 #include "libpff_codepage.h"
 #include "libpff_definitions.h"
+#include "libpff_deflate_context.h"
 #include "libpff_io_handle.h"
 #include "libpff_libbfio.h"
 #include "libpff_libcdata.h"
@@ -95,11 +98,43 @@ int libpff_io_handle_initialize(
 	}
 	( *io_handle )->ascii_codepage = LIBPFF_CODEPAGE_WINDOWS_1252;
 
+	if( libpff_deflate_context_initialize(
+	     &( ( *io_handle )->deflate_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create deflate context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_buffer_pool_initialize(
+	     &( ( *io_handle )->buffer_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create buffer pool.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->deflate_context != NULL )
+		{
+			libpff_deflate_context_free(
+			 &( ( *io_handle )->deflate_context ),
+			 NULL );
+		}
 		memory_free(
 		 *io_handle );
 
@@ -131,6 +166,32 @@ int libpff_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( libpff_buffer_pool_free(
+		     &( ( *io_handle )->buffer_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free buffer pool.",
+			 function );
+
+			result = -1;
+		}
+		if( libpff_deflate_context_free(
+		     &( ( *io_handle )->deflate_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free deflate context.",
+			 function );
+
+			result = -1;
+		}
 		if( libpff_io_handle_clear(
 		     *io_handle,
 		     error ) != 1 )
@@ -159,8 +220,13 @@ int libpff_io_handle_clear(
      libpff_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libpff_io_handle_clear";
-	int result            = 1;
+	libpff_buffer_pool_t *buffer_pool              = NULL;
+	libpff_deflate_context_t *deflate_context      = NULL;
+	static char *function                          = "libpff_io_handle_clear";
+	uint32_t checksum_verification_sample_interval = 0;
+	int number_of_read_ahead_threads               = 0;
+	int number_of_recovery_threads                 = 0;
+	int result                                     = 1;
 
 	if( io_handle == NULL )
 	{
@@ -173,6 +239,14 @@ int libpff_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The deflate context, buffer pool, checksum verification, read ahead and recovery settings are kept for reuse
+	 */
+	deflate_context                       = io_handle->deflate_context;
+	buffer_pool                           = io_handle->buffer_pool;
+	checksum_verification_sample_interval = io_handle->checksum_verification_sample_interval;
+	number_of_read_ahead_threads          = io_handle->number_of_read_ahead_threads;
+	number_of_recovery_threads            = io_handle->number_of_recovery_threads;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -187,18 +261,64 @@ int libpff_io_handle_clear(
 
 		result = -1;
 	}
-	io_handle->ascii_codepage = LIBPFF_CODEPAGE_WINDOWS_1252;
+	io_handle->ascii_codepage                        = LIBPFF_CODEPAGE_WINDOWS_1252;
+	io_handle->deflate_context                       = deflate_context;
+	io_handle->buffer_pool                           = buffer_pool;
+	io_handle->checksum_verification_sample_interval = checksum_verification_sample_interval;
+	io_handle->number_of_read_ahead_threads          = number_of_read_ahead_threads;
+	io_handle->number_of_recovery_threads            = number_of_recovery_threads;
 
 	return( result );
 }
 
+/* Determines if the checksum of the next block read should be verified
+ * If checksum verification is skipped only every Nth block is verified
+ * where N is the checksum verification sample interval
+ * Returns 1 if the checksum should be verified, 0 if not or -1 on error
+ */
+int libpff_io_handle_check_if_checksum_should_be_verified(
+     libpff_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_io_handle_check_if_checksum_should_be_verified";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->flags & LIBPFF_IO_HANDLE_FLAG_SKIP_CHECKSUM_VERIFICATION ) == 0 )
+	{
+		return( 1 );
+	}
+	if( io_handle->checksum_verification_sample_interval == 0 )
+	{
+		return( 0 );
+	}
+	io_handle->checksum_verification_sample_count += 1;
+
+	if( io_handle->checksum_verification_sample_count < io_handle->checksum_verification_sample_interval )
+	{
+		return( 0 );
+	}
+	io_handle->checksum_verification_sample_count = 0;
+
+	return( 1 );
+}
+
 /* Reads the unallocated data blocks
  * Returns 1 if successful or -1 on error
  */
 int libpff_io_handle_read_unallocated_data_blocks(
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     libcdata_range_list_t *unallocated_data_block_list,
+     libpff_allocation_bitmap_t *unallocated_data_block_bitmap,
      libcerror_error_t **error )
 {
 	static char *function           = "libpff_io_handle_read_unallocated_data_blocks";
@@ -240,26 +360,23 @@ int libpff_io_handle_read_unallocated_data_blocks(
 		allocation_table_offset = 0x22000;
 		allocation_block_size   = 4072 * 8 * 512;
 	}
-	while( allocation_table_offset < (off64_t) io_handle->file_size )
+	if( libpff_allocation_table_read_tables_file_io_handle(
+	     unallocated_data_block_bitmap,
+	     file_io_handle,
+	     allocation_table_offset,
+	     allocation_block_size,
+	     io_handle->file_size,
+	     io_handle->file_type,
+	     error ) != 1 )
 	{
-		if( libpff_allocation_table_read_file_io_handle(
-		     unallocated_data_block_list,
-		     file_io_handle,
-		     allocation_table_offset,
-		     (int) io_handle->file_type,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read allocation table at offset: %" PRIi64 ".",
-			 function,
-			 allocation_table_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data allocation tables.",
+		 function );
 
-			return( -1 );
-		}
-		allocation_table_offset += allocation_block_size;
+		return( -1 );
 	}
 	return( 1 );
 }
@@ -270,7 +387,7 @@ int libpff_io_handle_read_unallocated_data_blocks(
 int libpff_io_handle_read_unallocated_page_blocks(
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     libcdata_range_list_t *unallocated_page_block_list,
+     libpff_allocation_bitmap_t *unallocated_page_block_bitmap,
      libcerror_error_t **error )
 {
 	static char *function           = "libpff_io_handle_read_unallocated_page_blocks";
@@ -303,26 +420,23 @@ int libpff_io_handle_read_unallocated_page_blocks(
 	allocation_table_offset = 0x4600;
 	allocation_block_size   = 496 * 8 * 512;
 
-	while( allocation_table_offset < (off64_t) io_handle->file_size )
+	if( libpff_allocation_table_read_tables_file_io_handle(
+	     unallocated_page_block_bitmap,
+	     file_io_handle,
+	     allocation_table_offset,
+	     allocation_block_size,
+	     io_handle->file_size,
+	     io_handle->file_type,
+	     error ) != 1 )
 	{
-		if( libpff_allocation_table_read_file_io_handle(
-		     unallocated_page_block_list,
-		     file_io_handle,
-		     allocation_table_offset,
-		     (int) io_handle->file_type,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read allocation table at offset: %" PRIi64 ".",
-			 function,
-			 allocation_table_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page allocation tables.",
+		 function );
 
-			return( -1 );
-		}
-		allocation_table_offset += allocation_block_size;
+		return( -1 );
 	}
 	return( 1 );
 }
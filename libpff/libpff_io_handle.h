@@ -25,6 +25,10 @@
 #include <common.h>
 #include <types.h>
 
+#include "libpff_allocation_bitmap.h"
+#include "libpff_buffer_pool.h"
+#include "libpff_definitions.h"
+#include "libpff_deflate_context.h"
 #include "libpff_libbfio.h"
 #include "libpff_libcdata.h"
 #include "libpff_libcerror.h"
@@ -63,6 +67,37 @@ struct libpff_io_handle
 	 */
 	int ascii_codepage;
 
+	/* The checksum verification sample interval
+	 * 0 represents no checksums are verified when checksum verification is skipped
+	 */
+	uint32_t checksum_verification_sample_interval;
+
+	/* The number of blocks read since the last sampled checksum verification
+	 */
+	uint32_t checksum_verification_sample_count;
+
+	/* The number of checksum mismatches
+	 */
+	uint32_t number_of_checksum_mismatches;
+
+	/* The deflate context used to decompress data blocks
+	 */
+	libpff_deflate_context_t *deflate_context;
+
+	/* The buffer pool used for data block data
+	 */
+	libpff_buffer_pool_t *buffer_pool;
+
+	/* The number of threads used to decompress read ahead data array segments
+	 * 0 represents that read ahead is disabled
+	 */
+	int number_of_read_ahead_threads;
+
+	/* The number of threads used to scan the unallocated data for recoverable items
+	 * 0 represents that the unallocated data is scanned by the calling thread
+	 */
+	int number_of_recovery_threads;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -80,16 +115,20 @@ int libpff_io_handle_clear(
      libpff_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libpff_io_handle_check_if_checksum_should_be_verified(
+     libpff_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
 int libpff_io_handle_read_unallocated_data_blocks(
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     libcdata_range_list_t *unallocated_data_block_list,
+     libpff_allocation_bitmap_t *unallocated_data_block_bitmap,
      libcerror_error_t **error );
 
 int libpff_io_handle_read_unallocated_page_blocks(
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     libcdata_range_list_t *unallocated_page_block_list,
+     libpff_allocation_bitmap_t *unallocated_page_block_bitmap,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -25,6 +25,7 @@
 #include <narrow_string.h>
 #include <types.h>
 
+#include "libpff_data_block.h"
 #include "libpff_debug.h"
 #include "libpff_definitions.h"
 #include "libpff_descriptor_data_stream.h"
@@ -367,6 +368,80 @@ int libpff_item_free(
 				result = -1;
 			}
 		}
+		if( internal_item->embedded_object_data_extents != NULL )
+		{
+			memory_free(
+			 internal_item->embedded_object_data_extents );
+		}
+		if( internal_item->rtf_body_lzfu_decoder != NULL )
+		{
+			if( libpff_lzfu_decoder_free(
+			     &( internal_item->rtf_body_lzfu_decoder ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free RTF body LZFu decoder.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_item->rtf_body_record_entry != NULL )
+		{
+			if( libpff_record_entry_free(
+			     &( internal_item->rtf_body_record_entry ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free RTF body record entry.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_item->rtf_body_data != NULL )
+		{
+			memory_free(
+			 internal_item->rtf_body_data );
+		}
+		if( internal_item->plain_text_body_stream != NULL )
+		{
+			if( libpff_message_body_stream_free(
+			     &( internal_item->plain_text_body_stream ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free plain text body stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_item->html_body_stream != NULL )
+		{
+			if( libpff_message_body_stream_free(
+			     &( internal_item->html_body_stream ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free HTML body stream.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_item );
 	}
@@ -1976,6 +2051,9 @@ int libpff_internal_item_get_embedded_object_data(
 
 		goto on_error;
 	}
+	internal_item->embedded_object_data_list  = embedded_object_data_list;
+	internal_item->embedded_object_data_cache = embedded_object_data_cache;
+
 	if( libpff_local_descriptor_value_free(
 	     &local_descriptor_value,
 	     error ) != 1 )
@@ -2013,6 +2091,153 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the embedded object data extents
+ * The extents are determined on the first call, the data blocks are read to
+ * determine if the embedded object data is stored as-is in the file
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libpff_internal_item_get_embedded_object_data_extents(
+     libpff_internal_item_t *internal_item,
+     libcerror_error_t **error )
+{
+	libpff_data_block_t *data_block = NULL;
+	static char *function           = "libpff_internal_item_get_embedded_object_data_extents";
+	uint8_t data_block_flags        = 0;
+	int element_index               = 0;
+	int number_of_elements          = 0;
+	int result                      = 0;
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->embedded_object_data_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing embedded object data list.",
+		 function );
+
+		return( -1 );
+	}
+	/* Decryption can be forced after the extents were determined
+	 */
+	if( ( internal_item->io_handle->encryption_type != LIBPFF_ENCRYPTION_TYPE_NONE )
+	 || ( internal_item->io_handle->force_decryption != 0 ) )
+	{
+		return( 0 );
+	}
+	if( internal_item->embedded_object_data_extents_determined == 0 )
+	{
+		if( libfdata_list_get_number_of_elements(
+		     internal_item->embedded_object_data_list,
+		     &number_of_elements,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of embedded object data list elements.",
+			 function );
+
+			return( -1 );
+		}
+		/* Whether decryption is forced or a data block is compressed or fails
+		 * validation is only known after the data block has been read
+		 */
+		for( element_index = 0;
+		     element_index < number_of_elements;
+		     element_index++ )
+		{
+			if( libfdata_list_get_element_value_by_index(
+			     internal_item->embedded_object_data_list,
+			     (intptr_t *) internal_item->file_io_handle,
+			     (libfdata_cache_t *) internal_item->embedded_object_data_cache,
+			     element_index,
+			     (intptr_t **) &data_block,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data block: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			if( data_block == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing data block: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			data_block_flags |= data_block->flags;
+		}
+		if( ( data_block_flags & ( LIBPFF_DATA_BLOCK_FLAG_COMPRESSED | LIBPFF_DATA_BLOCK_FLAG_DECRYPTION_FORCED | LIBPFF_DATA_BLOCK_FLAG_CRC_MISMATCH | LIBPFF_DATA_BLOCK_FLAG_IDENTIFIER_MISMATCH ) ) == 0 )
+		{
+			result = libpff_descriptor_data_stream_get_extents(
+			          internal_item->embedded_object_data_list,
+			          &( internal_item->embedded_object_data_extents ),
+			          &( internal_item->number_of_embedded_object_data_extents ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve embedded object data extents.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				internal_item->embedded_object_data_extents_available = 1;
+			}
+		}
+		internal_item->embedded_object_data_extents_determined = 1;
+	}
+	/* The embedded object data extents are not set for empty embedded object data
+	 */
+	if( internal_item->embedded_object_data_extents_available == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the type
  * Determines the item type if neccessary
  * Returns 1 if successful or -1 on error
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libpff_descriptor_data_stream.h"
 #include "libpff_descriptors_index.h"
 #include "libpff_extern.h"
 #include "libpff_file.h"
@@ -37,6 +38,8 @@
 #include "libpff_libcdata.h"
 #include "libpff_libfcache.h"
 #include "libpff_libfdata.h"
+#include "libpff_lzfu.h"
+#include "libpff_message_body_stream.h"
 #include "libpff_offsets_index.h"
 #include "libpff_types.h"
 
@@ -117,6 +120,62 @@ struct libpff_internal_item
 	/* Embedded object data stream
 	 */
 	libfdata_stream_t *embedded_object_data_stream;
+
+	/* Embedded object data list
+	 * This is a reference to the list managed by the embedded object data stream
+	 */
+	libfdata_list_t *embedded_object_data_list;
+
+	/* Embedded object data cache
+	 * This is a reference to the cache managed by the embedded object data stream
+	 */
+	libfcache_cache_t *embedded_object_data_cache;
+
+	/* Embedded object data extents
+	 * Only set when the embedded object data is stored as-is in the file
+	 */
+	libpff_descriptor_data_extent_t *embedded_object_data_extents;
+
+	/* The number of embedded object data extents
+	 */
+	int number_of_embedded_object_data_extents;
+
+	/* Value to indicate the embedded object data extents were determined
+	 */
+	uint8_t embedded_object_data_extents_determined;
+
+	/* Value to indicate the embedded object data extents are available
+	 */
+	uint8_t embedded_object_data_extents_available;
+
+	/* The RTF body record entry
+	 */
+	libpff_record_entry_t *rtf_body_record_entry;
+
+	/* The RTF body LZFu decoder
+	 */
+	libpff_lzfu_decoder_t *rtf_body_lzfu_decoder;
+
+	/* The current RTF body offset
+	 */
+	off64_t rtf_body_offset;
+
+	/* The decompressed RTF body data
+	 * This value is cached when the RTF body size is retrieved
+	 */
+	uint8_t *rtf_body_data;
+
+	/* The decompressed RTF body data size
+	 */
+	size_t rtf_body_data_size;
+
+	/* The plain text body stream
+	 */
+	libpff_message_body_stream_t *plain_text_body_stream;
+
+	/* The HTML body stream
+	 */
+	libpff_message_body_stream_t *html_body_stream;
 };
 
 int libpff_item_initialize(
@@ -212,6 +271,10 @@ int libpff_internal_item_get_embedded_object_data(
      libpff_record_entry_t *record_entry,
      libcerror_error_t **error );
 
+int libpff_internal_item_get_embedded_object_data_extents(
+     libpff_internal_item_t *internal_item,
+     libcerror_error_t **error );
+
 LIBPFF_EXTERN \
 int libpff_item_get_type(
      libpff_item_t *item,
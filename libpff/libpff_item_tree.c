@@ -630,7 +630,7 @@ int libpff_item_tree_create(
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libpff_descriptors_index_t *descriptors_index,
-     libcdata_list_t *orphan_node_list,
+     libcdata_array_t *orphan_node_array,
      libcdata_tree_node_t **root_folder_item_tree_node,
      libcerror_error_t **error )
 {
@@ -735,7 +735,7 @@ int libpff_item_tree_create(
 	     file_io_handle,
 	     descriptors_index,
 	     descriptors_index->index->root_node_offset,
-	     orphan_node_list,
+	     orphan_node_array,
 	     root_folder_item_tree_node,
 	     0,
 	     error ) != 1 )
@@ -770,7 +770,7 @@ on_error:
 
 /* Creates an item tree node from a descriptor index node
  *
- * If a descriptor index value has no existing parent it is added to the orphan node list
+ * If a descriptor index value has no existing parent it is added to the orphan node array
  *
  * Returns 1 if successful or -1 on error
  */
@@ -780,7 +780,7 @@ int libpff_item_tree_create_node_from_descriptor_index_node(
      libbfio_handle_t *file_io_handle,
      libpff_descriptors_index_t *descriptors_index,
      off64_t node_offset,
-     libcdata_list_t *orphan_node_list,
+     libcdata_array_t *orphan_node_array,
      libcdata_tree_node_t **root_folder_item_tree_node,
      int recursion_depth,
      libcerror_error_t **error )
@@ -791,6 +791,7 @@ int libpff_item_tree_create_node_from_descriptor_index_node(
 	static char *function             = "libpff_item_tree_create_node_from_descriptor_index_node";
 	uint64_t sub_node_offset          = 0;
 	uint16_t entry_index              = 0;
+	int result                        = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint64_t sub_node_back_pointer    = 0;
@@ -865,6 +866,25 @@ int libpff_item_tree_create_node_from_descriptor_index_node(
 
 		goto on_error;
 	}
+	result = libpff_io_handle_check_if_checksum_should_be_verified(
+	          io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if checksum should be verified.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		index_node->flags |= LIBPFF_INDEX_NODE_FLAG_SKIP_CHECKSUM_VERIFICATION;
+	}
 	if( libpff_index_node_read_file_io_handle(
 	     index_node,
 	     file_io_handle,
@@ -883,6 +903,10 @@ int libpff_item_tree_create_node_from_descriptor_index_node(
 
 		goto on_error;
 	}
+	if( ( index_node->flags & LIBPFF_INDEX_NODE_FLAG_CRC_MISMATCH ) != 0 )
+	{
+		io_handle->number_of_checksum_mismatches += 1;
+	}
 	for( entry_index = 0;
 	     entry_index < index_node->number_of_entries;
 	     entry_index++ )
@@ -953,7 +977,7 @@ int libpff_item_tree_create_node_from_descriptor_index_node(
 			     file_io_handle,
 			     descriptors_index,
 			     index_value,
-			     orphan_node_list,
+			     orphan_node_array,
 			     root_folder_item_tree_node,
 			     recursion_depth,
 			     error ) != 1 )
@@ -1024,7 +1048,7 @@ int libpff_item_tree_create_node_from_descriptor_index_node(
 			     file_io_handle,
 			     descriptors_index,
 			     sub_node_offset,
-			     orphan_node_list,
+			     orphan_node_array,
 			     root_folder_item_tree_node,
 			     recursion_depth + 1,
 			     error ) != 1 )
@@ -1082,7 +1106,7 @@ on_error:
 
 /* Creates an item tree leaf node from the descriptor index value
  *
- * If a descriptor index value has no existing parent it is added to the orphan node list
+ * If a descriptor index value has no existing parent it is added to the orphan node array
  *
  * Returns 1 if successful or -1 on error
  */
@@ -1092,7 +1116,7 @@ int libpff_item_tree_create_leaf_node_from_descriptor_index_value(
      libbfio_handle_t *file_io_handle,
      libpff_descriptors_index_t *descriptors_index,
      libpff_index_value_t *descriptor_index_value,
-     libcdata_list_t *orphan_node_list,
+     libcdata_array_t *orphan_node_array,
      libcdata_tree_node_t **root_folder_item_tree_node,
      int recursion_depth,
      libcerror_error_t **error )
@@ -1102,6 +1126,7 @@ int libpff_item_tree_create_leaf_node_from_descriptor_index_value(
 	libpff_index_value_t *parent_descriptor_index_value = NULL;
 	libpff_item_descriptor_t *item_descriptor           = NULL;
 	static char *function                               = "libpff_item_tree_create_leaf_node_from_descriptor_index_value";
+	int entry_index                                     = 0;
 	int result                                          = 0;
 
 	if( item_tree == NULL )
@@ -1310,7 +1335,7 @@ int libpff_item_tree_create_leaf_node_from_descriptor_index_value(
 				     file_io_handle,
 				     descriptors_index,
 				     parent_descriptor_index_value,
-				     orphan_node_list,
+				     orphan_node_array,
 				     root_folder_item_tree_node,
 				     recursion_depth + 1,
 				     error ) != 1 )
@@ -1401,8 +1426,9 @@ int libpff_item_tree_create_leaf_node_from_descriptor_index_value(
 			}
 			item_descriptor = NULL;
 
-			if( libcdata_list_append_value(
-			     orphan_node_list,
+			if( libcdata_array_append_entry(
+			     orphan_node_array,
+			     &entry_index,
 			     (intptr_t *) item_tree_node,
 			     error ) != 1 )
 			{
@@ -1410,7 +1436,7 @@ int libpff_item_tree_create_leaf_node_from_descriptor_index_value(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append orphan node in orphan node list.",
+				 "%s: unable to append orphan node to orphan node array.",
 				 function );
 
 				goto on_error;
@@ -84,7 +84,7 @@ int libpff_item_tree_create(
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libpff_descriptors_index_t *descriptors_index,
-     libcdata_list_t *orphan_node_list,
+     libcdata_array_t *orphan_node_array,
      libcdata_tree_node_t **root_folder_item_tree_node,
      libcerror_error_t **error );
 
@@ -94,7 +94,7 @@ int libpff_item_tree_create_node_from_descriptor_index_node(
      libbfio_handle_t *file_io_handle,
      libpff_descriptors_index_t *descriptors_index,
      off64_t node_offset,
-     libcdata_list_t *orphan_node_list,
+     libcdata_array_t *orphan_node_array,
      libcdata_tree_node_t **root_folder_item_tree_node,
      int recursion_depth,
      libcerror_error_t **error );
@@ -105,7 +105,7 @@ int libpff_item_tree_create_leaf_node_from_descriptor_index_value(
      libbfio_handle_t *file_io_handle,
      libpff_descriptors_index_t *descriptors_index,
      libpff_index_value_t *descriptor_index_value,
-     libcdata_list_t *orphan_node_list,
+     libcdata_array_t *orphan_node_array,
      libcdata_tree_node_t **root_folder_item_tree_node,
      int recursion_depth,
      libcerror_error_t **error );
@@ -0,0 +1,502 @@
+/*
+ * LZFu (compressed RTF) decompression functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libpff_libcerror.h"
+#include "libpff_lzfu.h"
+
+/* The initial dictionary of compressed RTF
+ */
+const char *libpff_lzfu_rtf_dictionary = \
+	"{\\rtf1\\ansi\\mac\\deff0\\deftab720{\\fonttbl;}"
+	"{\\f0\\fnil \\froman \\fswiss \\fmodern \\fscript \\fdecor MS Sans SerifSymbolArialTimes New RomanCourier"
+	"{\\colortbl\\red0\\green0\\blue0\r\n\\par \\pard\\plain\\f0\\fs20\\b\\i\\u\\tab\\tx";
+
+#define LIBPFF_LZFU_RTF_DICTIONARY_SIZE		207
+
+/* Creates a LZFu decoder
+ * Make sure the value lzfu_decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_lzfu_decoder_initialize(
+     libpff_lzfu_decoder_t **lzfu_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_lzfu_decoder_initialize";
+
+	if( lzfu_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid LZFu decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *lzfu_decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid LZFu decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*lzfu_decoder = memory_allocate_structure(
+	                 libpff_lzfu_decoder_t );
+
+	if( *lzfu_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create LZFu decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *lzfu_decoder,
+	     0,
+	     sizeof( libpff_lzfu_decoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear LZFu decoder.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *lzfu_decoder != NULL )
+	{
+		memory_free(
+		 *lzfu_decoder );
+
+		*lzfu_decoder = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a LZFu decoder
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_lzfu_decoder_free(
+     libpff_lzfu_decoder_t **lzfu_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_lzfu_decoder_free";
+
+	if( lzfu_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid LZFu decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *lzfu_decoder != NULL )
+	{
+		/* The compressed data reference is freed elsewhere
+		 */
+		memory_free(
+		 *lzfu_decoder );
+
+		*lzfu_decoder = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the compressed data
+ * The compressed data must remain available while the decoder is used
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_lzfu_decoder_set_compressed_data(
+     libpff_lzfu_decoder_t *lzfu_decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libpff_lzfu_decoder_set_compressed_data";
+	uint32_t compressed_size      = 0;
+	uint32_t signature            = 0;
+	uint32_t uncompressed_size    = 0;
+
+	if( lzfu_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid LZFu decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < LIBPFF_LZFU_HEADER_SIZE )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 0 ] ),
+	 compressed_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 4 ] ),
+	 uncompressed_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 8 ] ),
+	 signature );
+
+	if( ( signature != LIBPFF_LZFU_SIGNATURE_COMPRESSED )
+	 && ( signature != LIBPFF_LZFU_SIGNATURE_UNCOMPRESSED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression signature: 0x%08" PRIx32 ".",
+		 function,
+		 signature );
+
+		return( -1 );
+	}
+	/* The compressed size includes the last 12 bytes of the header
+	 */
+	if( ( compressed_size < ( LIBPFF_LZFU_HEADER_SIZE - 4 ) )
+	 || ( (size_t) compressed_size > ( compressed_data_size - 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	lzfu_decoder->compressed_data        = compressed_data;
+	lzfu_decoder->compressed_data_size   = (size_t) compressed_size + 4;
+	lzfu_decoder->signature              = signature;
+	lzfu_decoder->uncompressed_data_size = uncompressed_size;
+
+	if( libpff_lzfu_decoder_reset(
+	     lzfu_decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset LZFu decoder.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Resets the decoder to the start of the compressed data
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_lzfu_decoder_reset(
+     libpff_lzfu_decoder_t *lzfu_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_lzfu_decoder_reset";
+
+	if( lzfu_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid LZFu decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     lzfu_decoder->dictionary,
+	     libpff_lzfu_rtf_dictionary,
+	     LIBPFF_LZFU_RTF_DICTIONARY_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy RTF dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &( lzfu_decoder->dictionary[ LIBPFF_LZFU_RTF_DICTIONARY_SIZE ] ),
+	     0,
+	     LIBPFF_LZFU_DICTIONARY_SIZE - LIBPFF_LZFU_RTF_DICTIONARY_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	lzfu_decoder->compressed_data_offset   = LIBPFF_LZFU_HEADER_SIZE;
+	lzfu_decoder->uncompressed_data_offset = 0;
+	lzfu_decoder->dictionary_offset        = LIBPFF_LZFU_RTF_DICTIONARY_SIZE;
+	lzfu_decoder->flag_byte                = 0;
+	lzfu_decoder->flag_byte_bit_mask       = 0;
+	lzfu_decoder->reference_offset         = 0;
+	lzfu_decoder->reference_size           = 0;
+	lzfu_decoder->end_of_data              = 0;
+
+	return( 1 );
+}
+
+/* Decompresses the next part of the compressed data
+ * The decoder state is retained between calls, which allows the data to be decompressed
+ * incrementally into a buffer of any size
+ * Returns the number of bytes decompressed, 0 when no more data is available or -1 on error
+ */
+ssize_t libpff_lzfu_decoder_read(
+         libpff_lzfu_decoder_t *lzfu_decoder,
+         uint8_t *uncompressed_data,
+         size_t uncompressed_data_size,
+         libcerror_error_t **error )
+{
+	static char *function           = "libpff_lzfu_decoder_read";
+	size_t compressed_data_offset   = 0;
+	size_t read_size                = 0;
+	size_t uncompressed_data_offset = 0;
+	uint16_t dictionary_offset      = 0;
+	uint16_t reference              = 0;
+	uint8_t byte_value              = 0;
+
+	if( lzfu_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid LZFu decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( lzfu_decoder->compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid LZFu decoder - missing compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( lzfu_decoder->end_of_data != 0 )
+	{
+		return( 0 );
+	}
+	compressed_data_offset = lzfu_decoder->compressed_data_offset;
+
+	if( lzfu_decoder->signature == LIBPFF_LZFU_SIGNATURE_UNCOMPRESSED )
+	{
+		read_size = lzfu_decoder->compressed_data_size - compressed_data_offset;
+
+		if( (size64_t) read_size > ( (size64_t) lzfu_decoder->uncompressed_data_size - lzfu_decoder->uncompressed_data_offset ) )
+		{
+			read_size = (size_t) ( lzfu_decoder->uncompressed_data_size - lzfu_decoder->uncompressed_data_offset );
+		}
+		if( read_size > uncompressed_data_size )
+		{
+			read_size = uncompressed_data_size;
+		}
+		if( read_size == 0 )
+		{
+			lzfu_decoder->end_of_data = 1;
+
+			return( 0 );
+		}
+		if( memory_copy(
+		     uncompressed_data,
+		     &( lzfu_decoder->compressed_data[ compressed_data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		lzfu_decoder->compressed_data_offset   += read_size;
+		lzfu_decoder->uncompressed_data_offset += read_size;
+
+		return( (ssize_t) read_size );
+	}
+	dictionary_offset = lzfu_decoder->dictionary_offset;
+
+	while( uncompressed_data_offset < uncompressed_data_size )
+	{
+		if( lzfu_decoder->reference_size > 0 )
+		{
+			byte_value = lzfu_decoder->dictionary[ lzfu_decoder->reference_offset ];
+
+			lzfu_decoder->reference_offset = ( lzfu_decoder->reference_offset + 1 ) % LIBPFF_LZFU_DICTIONARY_SIZE;
+			lzfu_decoder->reference_size  -= 1;
+		}
+		else
+		{
+			if( lzfu_decoder->flag_byte_bit_mask == 0 )
+			{
+				if( compressed_data_offset >= lzfu_decoder->compressed_data_size )
+				{
+					lzfu_decoder->end_of_data = 1;
+
+					break;
+				}
+				lzfu_decoder->flag_byte          = lzfu_decoder->compressed_data[ compressed_data_offset++ ];
+				lzfu_decoder->flag_byte_bit_mask = 0x01;
+			}
+			if( compressed_data_offset >= lzfu_decoder->compressed_data_size )
+			{
+				lzfu_decoder->end_of_data = 1;
+
+				break;
+			}
+			if( ( lzfu_decoder->flag_byte & lzfu_decoder->flag_byte_bit_mask ) == 0 )
+			{
+				byte_value = lzfu_decoder->compressed_data[ compressed_data_offset++ ];
+			}
+			else
+			{
+				if( ( compressed_data_offset + 2 ) > lzfu_decoder->compressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+					 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+					 "%s: compressed data too small for dictionary reference.",
+					 function );
+
+					return( -1 );
+				}
+				byte_stream_copy_to_uint16_big_endian(
+				 &( lzfu_decoder->compressed_data[ compressed_data_offset ] ),
+				 reference );
+
+				compressed_data_offset += 2;
+
+				/* A reference to the current dictionary offset marks the end of the data
+				 */
+				if( (uint16_t) ( reference >> 4 ) == dictionary_offset )
+				{
+					lzfu_decoder->end_of_data = 1;
+
+					break;
+				}
+				lzfu_decoder->reference_offset = (uint16_t) ( reference >> 4 );
+				lzfu_decoder->reference_size   = (uint8_t) ( reference & 0x000f ) + 2;
+			}
+			lzfu_decoder->flag_byte_bit_mask <<= 1;
+
+			if( lzfu_decoder->reference_size > 0 )
+			{
+				continue;
+			}
+		}
+		lzfu_decoder->dictionary[ dictionary_offset ] = byte_value;
+
+		dictionary_offset = ( dictionary_offset + 1 ) % LIBPFF_LZFU_DICTIONARY_SIZE;
+
+		uncompressed_data[ uncompressed_data_offset++ ] = byte_value;
+	}
+	lzfu_decoder->compressed_data_offset    = compressed_data_offset;
+	lzfu_decoder->dictionary_offset         = dictionary_offset;
+	lzfu_decoder->uncompressed_data_offset += uncompressed_data_offset;
+
+	return( (ssize_t) uncompressed_data_offset );
+}
+
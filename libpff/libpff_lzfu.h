@@ -0,0 +1,130 @@
+/*
+ * LZFu (compressed RTF) decompression functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBPFF_LZFU_H )
+#define _LIBPFF_LZFU_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libpff_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define LIBPFF_LZFU_HEADER_SIZE				16
+
+#define LIBPFF_LZFU_DICTIONARY_SIZE			4096
+
+#define LIBPFF_LZFU_SIGNATURE_COMPRESSED		0x75465a4cUL
+#define LIBPFF_LZFU_SIGNATURE_UNCOMPRESSED		0x414c454dUL
+
+typedef struct libpff_lzfu_decoder libpff_lzfu_decoder_t;
+
+struct libpff_lzfu_decoder
+{
+	/* The compressed data
+	 * This is a reference to the data, including the LZFu header
+	 */
+	const uint8_t *compressed_data;
+
+	/* The compressed data size
+	 * This is the size of the data up to the end of the compressed payload
+	 */
+	size_t compressed_data_size;
+
+	/* The current compressed data offset
+	 */
+	size_t compressed_data_offset;
+
+	/* The signature
+	 */
+	uint32_t signature;
+
+	/* The uncompressed data size as stored in the header
+	 */
+	uint32_t uncompressed_data_size;
+
+	/* The number of bytes decompressed so far
+	 */
+	size64_t uncompressed_data_offset;
+
+	/* The dictionary
+	 */
+	uint8_t dictionary[ LIBPFF_LZFU_DICTIONARY_SIZE ];
+
+	/* The dictionary write offset
+	 */
+	uint16_t dictionary_offset;
+
+	/* The current flag byte
+	 */
+	uint8_t flag_byte;
+
+	/* The bit mask of the next flag in the flag byte
+	 * 0 if a new flag byte needs to be read
+	 */
+	uint8_t flag_byte_bit_mask;
+
+	/* The dictionary offset of the reference that is being copied
+	 */
+	uint16_t reference_offset;
+
+	/* The remaining number of bytes of the reference that is being copied
+	 */
+	uint8_t reference_size;
+
+	/* Value to indicate the end of the compressed data was reached
+	 */
+	uint8_t end_of_data;
+};
+
+int libpff_lzfu_decoder_initialize(
+     libpff_lzfu_decoder_t **lzfu_decoder,
+     libcerror_error_t **error );
+
+int libpff_lzfu_decoder_free(
+     libpff_lzfu_decoder_t **lzfu_decoder,
+     libcerror_error_t **error );
+
+int libpff_lzfu_decoder_set_compressed_data(
+     libpff_lzfu_decoder_t *lzfu_decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error );
+
+int libpff_lzfu_decoder_reset(
+     libpff_lzfu_decoder_t *lzfu_decoder,
+     libcerror_error_t **error );
+
+ssize_t libpff_lzfu_decoder_read(
+         libpff_lzfu_decoder_t *lzfu_decoder,
+         uint8_t *uncompressed_data,
+         size_t uncompressed_data_size,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBPFF_LZFU_H ) */
+
@@ -33,11 +33,12 @@
 #include "libpff_libcnotify.h"
 #include "libpff_libfcache.h"
 #include "libpff_libfdata.h"
-#include "libpff_libfmapi.h"
 #include "libpff_mapi.h"
 #include "libpff_message.h"
 #include "libpff_item.h"
 #include "libpff_libuna.h"
+#include "libpff_lzfu.h"
+#include "libpff_message_body_stream.h"
 #include "libpff_record_entry.h"
 #include "libpff_value_type.h"
 
@@ -2473,20 +2474,135 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the RTF message body size
- * Size includes the end of string character
+/* Retrieves the codepage used to convert a message body stream to UTF-8
+ * The function uses the same codepages as libpff_message_get_plain_text_body
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_message_get_body_stream_codepage(
+     libpff_internal_item_t *internal_item,
+     int *ascii_codepage,
+     libcerror_error_t **error )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	static char *function                        = "libpff_message_get_body_stream_codepage";
+	size_t byte_stream_index                     = 0;
+	uint32_t message_codepage                    = 0;
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_codepage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->message_codepage == 0 )
+	{
+		if( libpff_internal_item_get_entry_value_32bit_integer(
+		     internal_item,
+		     LIBPFF_ENTRY_TYPE_MESSAGE_CODEPAGE,
+		     &( internal_item->message_codepage ),
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the message codepage.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_item->message_codepage == 0 )
+		{
+			internal_item->message_codepage = internal_item->ascii_codepage;
+		}
+	}
+	if( internal_item->message_body_codepage == 0 )
+	{
+		if( libpff_internal_item_get_entry_value_32bit_integer(
+		     internal_item,
+		     LIBPFF_ENTRY_TYPE_MESSAGE_BODY_CODEPAGE,
+		     &( internal_item->message_body_codepage ),
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve the message body codepage.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_item->message_body_codepage == 0 )
+		{
+			internal_item->message_body_codepage = internal_item->message_codepage;
+		}
+	}
+/* TODO ignore the message body codepage for now */
+	*ascii_codepage = internal_item->message_codepage;
+
+	/* The string is converted one character at a time so it cannot be retried
+	 * with another codepage afterwards, hence check if the codepage is supported
+	 */
+	if( ( *ascii_codepage != 1200 )
+	 && ( *ascii_codepage != 65000 )
+	 && ( *ascii_codepage != 65001 ) )
+	{
+		if( libuna_unicode_character_copy_from_byte_stream(
+		     &unicode_character,
+		     (uint8_t *) "A",
+		     1,
+		     &byte_stream_index,
+		     *ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_free(
+			 error );
+
+			message_codepage = internal_item->message_codepage;
+
+			/* Sometimes the message codepage is not available
+			 */
+			if( ( message_codepage == internal_item->message_body_codepage )
+			 || ( message_codepage == 0 ) )
+			{
+				message_codepage = internal_item->ascii_codepage;
+			}
+			*ascii_codepage = (int) message_codepage;
+		}
+	}
+	return( 1 );
+}
+
+/* Opens the plain text message body for reading
+ * The body is converted to UTF-8 incrementally by libpff_message_plain_text_body_read_buffer
+ * The function uses the same codepages as libpff_message_get_plain_text_body
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libpff_message_get_rtf_body_size(
+int libpff_message_plain_text_body_open(
      libpff_item_t *message,
-     size_t *size,
      libcerror_error_t **error )
 {
 	libpff_internal_item_t *internal_item = NULL;
 	libpff_record_entry_t *record_entry   = NULL;
-	uint8_t *value_data                   = NULL;
-	static char *function                 = "libpff_message_get_rtf_body_size";
-	size_t value_data_size                = 0;
+	static char *function                 = "libpff_message_plain_text_body_open";
+	int ascii_codepage                    = 0;
 	int result                            = 0;
 
 	if( message == NULL )
@@ -2502,16 +2618,21 @@ int libpff_message_get_rtf_body_size(
 	}
 	internal_item = (libpff_internal_item_t *) message;
 
-	if( size == NULL )
+	if( internal_item->plain_text_body_stream != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
-		 function );
+		if( libpff_message_body_stream_free(
+		     &( internal_item->plain_text_body_stream ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free plain text body stream.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
 	}
 	result = libpff_item_values_get_record_entry_by_type(
 	          internal_item->item_values,
@@ -2520,10 +2641,10 @@ int libpff_message_get_rtf_body_size(
 	          internal_item->file_io_handle,
 	          internal_item->offsets_index,
 	          0,
-		  LIBPFF_ENTRY_TYPE_MESSAGE_BODY_COMPRESSED_RTF,
-	          LIBPFF_VALUE_TYPE_BINARY_DATA,
-	          &record_entry,
+		  LIBPFF_ENTRY_TYPE_MESSAGE_BODY_PLAIN_TEXT,
 	          0,
+	          &record_entry,
+	          LIBPFF_ENTRY_VALUE_FLAG_MATCH_ANY_VALUE_TYPE,
 	          error );
 
 	if( result == -1 )
@@ -2537,53 +2658,41 @@ int libpff_message_get_rtf_body_size(
 
 		goto on_error;
 	}
-	else if( result != 0 )
+	else if( result == 0 )
 	{
-		if( libpff_record_entry_get_value_data(
-		     record_entry,
-		     &value_data,
-		     &value_data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value data.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfmapi_lzfu_get_uncompressed_data_size(
-		     value_data,
-		     value_data_size,
-		     size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-			 "%s: unable to determine uncompressed value data size.",
-			 function );
+		return( 0 );
+	}
+	if( libpff_message_get_body_stream_codepage(
+	     internal_item,
+	     &ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve body stream codepage.",
+		 function );
 
-			goto on_error;
-		}
-		if( libpff_record_entry_free(
-		     &record_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record entry.",
-			 function );
+		goto on_error;
+	}
+	if( libpff_message_body_stream_initialize(
+	     &( internal_item->plain_text_body_stream ),
+	     record_entry,
+	     ascii_codepage,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create plain text body stream.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	return( result );
+	return( 1 );
 
 on_error:
 	if( record_entry != NULL )
@@ -2595,23 +2704,15 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the RTF message body
- * The body is encoded in UTF-8
- * Size should include the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Closes the plain text message body
+ * Returns 0 if successful or -1 on error
  */
-int libpff_message_get_rtf_body(
+int libpff_message_plain_text_body_close(
      libpff_item_t *message,
-     uint8_t *message_body,
-     size_t size,
      libcerror_error_t **error )
 {
 	libpff_internal_item_t *internal_item = NULL;
-	libpff_record_entry_t *record_entry   = NULL;
-	uint8_t *value_data                   = NULL;
-	static char *function                 = "libpff_message_get_rtf_body";
-	size_t value_data_size                = 0;
-	int result                            = 0;
+	static char *function                 = "libpff_message_plain_text_body_close";
 
 	if( message == NULL )
 	{
@@ -2626,98 +2727,971 @@ int libpff_message_get_rtf_body(
 	}
 	internal_item = (libpff_internal_item_t *) message;
 
-	if( message_body == NULL )
+	if( libpff_message_body_stream_free(
+	     &( internal_item->plain_text_body_stream ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free plain text body stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Reads plain text message body data from the current offset into a buffer
+ * The body is encoded in UTF-8, the end of string character is not included
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libpff_message_plain_text_body_read_buffer(
+         libpff_item_t *message,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libpff_internal_item_t *internal_item = NULL;
+	static char *function                 = "libpff_message_plain_text_body_read_buffer";
+	ssize_t read_count                    = 0;
+
+	if( message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) message;
+
+	if( internal_item->plain_text_body_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid message - plain text body not opened.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libpff_message_body_stream_read_buffer(
+	              internal_item->plain_text_body_stream,
+	              buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read plain text body data.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Retrieves the compressed RTF body data
+ * The record entry that contains the data is retained by the message
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libpff_message_get_rtf_body_compressed_data(
+     libpff_internal_item_t *internal_item,
+     uint8_t **compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_message_get_rtf_body_compressed_data";
+	int result            = 0;
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->rtf_body_record_entry == NULL )
+	{
+		result = libpff_item_values_get_record_entry_by_type(
+		          internal_item->item_values,
+		          internal_item->name_to_id_map_list,
+		          internal_item->io_handle,
+		          internal_item->file_io_handle,
+		          internal_item->offsets_index,
+		          0,
+		          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_COMPRESSED_RTF,
+		          LIBPFF_VALUE_TYPE_BINARY_DATA,
+		          &( internal_item->rtf_body_record_entry ),
+		          0,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( libpff_record_entry_get_value_data(
+	     internal_item->rtf_body_record_entry,
+	     compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the RTF body data
+ * The RTF body is decompressed in a single pass and cached by the message
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libpff_message_read_rtf_body_data(
+     libpff_internal_item_t *internal_item,
+     libcerror_error_t **error )
+{
+	libpff_lzfu_decoder_t *lzfu_decoder = NULL;
+	uint8_t *compressed_data            = NULL;
+	uint8_t *reallocation               = NULL;
+	static char *function               = "libpff_message_read_rtf_body_data";
+	size_t compressed_data_size         = 0;
+	size_t data_buffer_size             = 0;
+	size_t data_size                    = 0;
+	ssize_t read_count                  = 0;
+	int result                          = 0;
+
+	if( internal_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->rtf_body_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item - RTF body data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_message_get_rtf_body_compressed_data(
+	          internal_item,
+	          &compressed_data,
+	          &compressed_data_size,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed RTF body data.",
+			 function );
+		}
+		return( result );
+	}
+	if( libpff_lzfu_decoder_initialize(
+	     &lzfu_decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create LZFu decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_lzfu_decoder_set_compressed_data(
+	     lzfu_decoder,
+	     compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set compressed data in LZFu decoder.",
+		 function );
+
+		goto on_error;
+	}
+	/* The uncompressed data size in the header is used as an initial estimate
+	 * an additional byte is added so that the end of the data is detected without resizing
+	 */
+	if( lzfu_decoder->uncompressed_data_size >= (uint32_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+	{
+		data_buffer_size = (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 );
+	}
+	else
+	{
+		data_buffer_size = (size_t) lzfu_decoder->uncompressed_data_size + 1;
+	}
+	internal_item->rtf_body_data = (uint8_t *) memory_allocate(
+	                                            sizeof( uint8_t ) * data_buffer_size );
+
+	if( internal_item->rtf_body_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create RTF body data.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		/* The uncompressed data size in the header is not trusted hence the buffer is grown when full
+		 */
+		if( data_size == data_buffer_size )
+		{
+			if( data_buffer_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid RTF body data size value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			data_buffer_size *= 2;
+
+			reallocation = (uint8_t *) memory_reallocate(
+			                            internal_item->rtf_body_data,
+			                            sizeof( uint8_t ) * data_buffer_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize RTF body data.",
+				 function );
+
+				goto on_error;
+			}
+			internal_item->rtf_body_data = reallocation;
+		}
+		read_count = libpff_lzfu_decoder_read(
+		              lzfu_decoder,
+		              &( internal_item->rtf_body_data[ data_size ] ),
+		              data_buffer_size - data_size,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress RTF body data.",
+			 function );
+
+			goto on_error;
+		}
+		data_size += (size_t) read_count;
+	}
+	while( read_count > 0 );
+
+	internal_item->rtf_body_data_size = data_size;
+
+	if( libpff_lzfu_decoder_free(
+	     &lzfu_decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free LZFu decoder.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( lzfu_decoder != NULL )
+	{
+		libpff_lzfu_decoder_free(
+		 &lzfu_decoder,
+		 NULL );
+	}
+	if( internal_item->rtf_body_data != NULL )
+	{
+		memory_free(
+		 internal_item->rtf_body_data );
+
+		internal_item->rtf_body_data = NULL;
+	}
+	internal_item->rtf_body_data_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the RTF message body size
+ * Size includes the end of string character
+ * The RTF body is decompressed once and cached, hence a subsequent call to
+ * libpff_message_get_rtf_body does not decompress the data again
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libpff_message_get_rtf_body_size(
+     libpff_item_t *message,
+     size_t *size,
+     libcerror_error_t **error )
+{
+	libpff_internal_item_t *internal_item = NULL;
+	static char *function                 = "libpff_message_get_rtf_body_size";
+	int result                            = 0;
+
+	if( message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) message;
+
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->rtf_body_data == NULL )
+	{
+		result = libpff_message_read_rtf_body_data(
+		          internal_item,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_READ_FAILED,
+			 "%s: unable to read RTF body data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	*size = internal_item->rtf_body_data_size + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the RTF message body
+ * The body is encoded in UTF-8
+ * Size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libpff_message_get_rtf_body(
+     libpff_item_t *message,
+     uint8_t *message_body,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libpff_internal_item_t *internal_item = NULL;
+	static char *function                 = "libpff_message_get_rtf_body";
+	int result                            = 0;
+
+	if( message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) message;
+
+	if( message_body == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message body.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->rtf_body_data == NULL )
+	{
+		result = libpff_message_read_rtf_body_data(
+		          internal_item,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_READ_FAILED,
+			 "%s: unable to read RTF body data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( size <= internal_item->rtf_body_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid message body size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     message_body,
+	     internal_item->rtf_body_data,
+	     internal_item->rtf_body_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy RTF body data.",
+		 function );
+
+		return( -1 );
+	}
+	message_body[ internal_item->rtf_body_data_size ] = 0;
+
+	return( 1 );
+}
+
+/* Opens the RTF message body for reading
+ * The RTF body is decompressed incrementally by libpff_message_rtf_body_read_buffer
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libpff_message_rtf_body_open(
+     libpff_item_t *message,
+     libcerror_error_t **error )
+{
+	libpff_internal_item_t *internal_item = NULL;
+	uint8_t *compressed_data              = NULL;
+	static char *function                 = "libpff_message_rtf_body_open";
+	size_t compressed_data_size           = 0;
+	int result                            = 0;
+
+	if( message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) message;
+
+	internal_item->rtf_body_offset = 0;
+
+	/* If the RTF body was cached it is read from the cache
+	 */
+	if( internal_item->rtf_body_data != NULL )
+	{
+		return( 1 );
+	}
+	if( internal_item->rtf_body_lzfu_decoder != NULL )
+	{
+		if( libpff_lzfu_decoder_reset(
+		     internal_item->rtf_body_lzfu_decoder,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reset RTF body LZFu decoder.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	result = libpff_message_get_rtf_body_compressed_data(
+	          internal_item,
+	          &compressed_data,
+	          &compressed_data_size,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed RTF body data.",
+			 function );
+		}
+		return( result );
+	}
+	if( libpff_lzfu_decoder_initialize(
+	     &( internal_item->rtf_body_lzfu_decoder ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create RTF body LZFu decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_lzfu_decoder_set_compressed_data(
+	     internal_item->rtf_body_lzfu_decoder,
+	     compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set compressed data in RTF body LZFu decoder.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_item->rtf_body_lzfu_decoder != NULL )
+	{
+		libpff_lzfu_decoder_free(
+		 &( internal_item->rtf_body_lzfu_decoder ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the RTF message body
+ * Returns 0 if successful or -1 on error
+ */
+int libpff_message_rtf_body_close(
+     libpff_item_t *message,
+     libcerror_error_t **error )
+{
+	libpff_internal_item_t *internal_item = NULL;
+	static char *function                 = "libpff_message_rtf_body_close";
+	int result                            = 0;
+
+	if( message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) message;
+
+	if( internal_item->rtf_body_lzfu_decoder != NULL )
+	{
+		if( libpff_lzfu_decoder_free(
+		     &( internal_item->rtf_body_lzfu_decoder ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free RTF body LZFu decoder.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_item->rtf_body_record_entry != NULL )
+	{
+		if( libpff_record_entry_free(
+		     &( internal_item->rtf_body_record_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free RTF body record entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_item->rtf_body_offset = 0;
+
+	return( result );
+}
+
+/* Reads RTF message body data from the current offset into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libpff_message_rtf_body_read_buffer(
+         libpff_item_t *message,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libpff_internal_item_t *internal_item = NULL;
+	static char *function                 = "libpff_message_rtf_body_read_buffer";
+	size_t read_size                      = 0;
+	ssize_t read_count                    = 0;
+
+	if( message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) message;
+
+	if( ( internal_item->rtf_body_data == NULL )
+	 && ( internal_item->rtf_body_lzfu_decoder == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid message - RTF body not opened.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->rtf_body_data != NULL )
+	{
+		if( internal_item->rtf_body_offset >= (off64_t) internal_item->rtf_body_data_size )
+		{
+			return( 0 );
+		}
+		read_size = internal_item->rtf_body_data_size - (size_t) internal_item->rtf_body_offset;
+
+		if( read_size > buffer_size )
+		{
+			read_size = buffer_size;
+		}
+		if( memory_copy(
+		     buffer,
+		     &( internal_item->rtf_body_data[ internal_item->rtf_body_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy RTF body data.",
+			 function );
+
+			return( -1 );
+		}
+		read_count = (ssize_t) read_size;
+	}
+	else
+	{
+		/* The decoder is positioned at the current offset by libpff_message_rtf_body_seek_offset
+		 */
+		if( (off64_t) internal_item->rtf_body_lzfu_decoder->uncompressed_data_offset != internal_item->rtf_body_offset )
+		{
+			return( 0 );
+		}
+		read_count = libpff_lzfu_decoder_read(
+		              internal_item->rtf_body_lzfu_decoder,
+		              buffer,
+		              buffer_size,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress RTF body data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_item->rtf_body_offset += read_count;
+
+	return( read_count );
+}
+
+/* Seeks a certain offset of the RTF message body data
+ * Seeking backwards restarts the decompression of the RTF body, unless it was cached
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libpff_message_rtf_body_seek_offset(
+         libpff_item_t *message,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	uint8_t skip_buffer[ 512 ];
+
+	libpff_internal_item_t *internal_item = NULL;
+	libpff_lzfu_decoder_t *lzfu_decoder   = NULL;
+	static char *function                 = "libpff_message_rtf_body_seek_offset";
+	size64_t data_size                    = 0;
+	size_t skip_size                      = 0;
+	ssize_t read_count                    = 0;
+
+	if( message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) message;
+
+	if( ( internal_item->rtf_body_data == NULL )
+	 && ( internal_item->rtf_body_lzfu_decoder == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid message - RTF body not opened.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid message body.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
 		 function );
 
 		return( -1 );
 	}
-	result = libpff_item_values_get_record_entry_by_type(
-	          internal_item->item_values,
-	          internal_item->name_to_id_map_list,
-	          internal_item->io_handle,
-	          internal_item->file_io_handle,
-	          internal_item->offsets_index,
-	          0,
-		  LIBPFF_ENTRY_TYPE_MESSAGE_BODY_COMPRESSED_RTF,
-	          LIBPFF_VALUE_TYPE_BINARY_DATA,
-	          &record_entry,
-	          0,
-	          error );
+	lzfu_decoder = internal_item->rtf_body_lzfu_decoder;
 
-	if( result == -1 )
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_item->rtf_body_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		if( internal_item->rtf_body_data != NULL )
+		{
+			data_size = (size64_t) internal_item->rtf_body_data_size;
+		}
+		else
+		{
+			/* The size of the RTF body is only known after the data has been decompressed
+			 */
+			do
+			{
+				read_count = libpff_lzfu_decoder_read(
+				              lzfu_decoder,
+				              skip_buffer,
+				              512,
+				              error );
+
+				if( read_count < 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+					 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+					 "%s: unable to decompress RTF body data.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			while( read_count > 0 );
+
+			data_size = lzfu_decoder->uncompressed_data_offset;
+		}
+		offset += (off64_t) data_size;
+	}
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve record entry.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result != 0 )
+	if( internal_item->rtf_body_data == NULL )
 	{
-		if( libpff_record_entry_get_value_data(
-		     record_entry,
-		     &value_data,
-		     &value_data_size,
-		     error ) != 1 )
+		if( offset < (off64_t) lzfu_decoder->uncompressed_data_offset )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value data.",
-			 function );
+			if( libpff_lzfu_decoder_reset(
+			     lzfu_decoder,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to reset RTF body LZFu decoder.",
+				 function );
 
-			goto on_error;
+				return( -1 );
+			}
 		}
-		if( libfmapi_lzfu_decompress(
-		     value_data,
-		     value_data_size,
-		     message_body,
-		     &size,
-		     error ) != 1 )
+		/* Decompress and discard the data up to the offset
+		 */
+		while( (off64_t) lzfu_decoder->uncompressed_data_offset < offset )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-			 "%s: unable to decompress value data.",
-			 function );
+			skip_size = 512;
 
-			goto on_error;
-		}
-		if( libpff_record_entry_free(
-		     &record_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record entry.",
-			 function );
+			if( (off64_t) skip_size > ( offset - (off64_t) lzfu_decoder->uncompressed_data_offset ) )
+			{
+				skip_size = (size_t) ( offset - (off64_t) lzfu_decoder->uncompressed_data_offset );
+			}
+			read_count = libpff_lzfu_decoder_read(
+			              lzfu_decoder,
+			              skip_buffer,
+			              skip_size,
+			              error );
 
-			goto on_error;
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress RTF body data.",
+				 function );
+
+				return( -1 );
+			}
+			else if( read_count == 0 )
+			{
+				break;
+			}
 		}
 	}
-	return( result );
+	internal_item->rtf_body_offset = offset;
 
-on_error:
-	if( record_entry != NULL )
-	{
-		libpff_record_entry_free(
-		 &record_entry,
-		 NULL );
-	}
-	return( -1 );
+	return( offset );
 }
 
 /* Retrieves the HTML message body size
@@ -2895,6 +3869,7 @@ on_error:
 }
 
 /* Retrieves the HTML message body
+ * The body is returned as stored, a string body is not converted to UTF-8
  * Size should include the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -3123,3 +4098,199 @@ on_error:
 	return( -1 );
 }
 
+/* Opens the HTML message body for reading
+ * The body is returned as stored by libpff_message_html_body_read_buffer,
+ * the same as by libpff_message_get_html_body
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libpff_message_html_body_open(
+     libpff_item_t *message,
+     libcerror_error_t **error )
+{
+	libpff_internal_item_t *internal_item = NULL;
+	libpff_record_entry_t *record_entry   = NULL;
+	static char *function                 = "libpff_message_html_body_open";
+	int result                            = 0;
+
+	if( message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) message;
+
+	if( internal_item->html_body_stream != NULL )
+	{
+		if( libpff_message_body_stream_free(
+		     &( internal_item->html_body_stream ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free HTML body stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = libpff_item_values_get_record_entry_by_type(
+	          internal_item->item_values,
+	          internal_item->name_to_id_map_list,
+	          internal_item->io_handle,
+	          internal_item->file_io_handle,
+	          internal_item->offsets_index,
+	          0,
+		  LIBPFF_ENTRY_TYPE_MESSAGE_BODY_HTML,
+	          0,
+	          &record_entry,
+	          LIBPFF_ENTRY_VALUE_FLAG_MATCH_ANY_VALUE_TYPE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libpff_message_body_stream_initialize(
+	     &( internal_item->html_body_stream ),
+	     record_entry,
+	     internal_item->ascii_codepage,
+	     LIBPFF_MESSAGE_BODY_STREAM_FLAG_READ_AS_STORED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create HTML body stream.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record_entry != NULL )
+	{
+		libpff_record_entry_free(
+		 &record_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the HTML message body
+ * Returns 0 if successful or -1 on error
+ */
+int libpff_message_html_body_close(
+     libpff_item_t *message,
+     libcerror_error_t **error )
+{
+	libpff_internal_item_t *internal_item = NULL;
+	static char *function                 = "libpff_message_html_body_close";
+
+	if( message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) message;
+
+	if( libpff_message_body_stream_free(
+	     &( internal_item->html_body_stream ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free HTML body stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Reads HTML message body data from the current offset into a buffer
+ * The body is returned as stored, a string body is not converted to UTF-8
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libpff_message_html_body_read_buffer(
+         libpff_item_t *message,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libpff_internal_item_t *internal_item = NULL;
+	static char *function                 = "libpff_message_html_body_read_buffer";
+	ssize_t read_count                    = 0;
+
+	if( message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) message;
+
+	if( internal_item->html_body_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid message - HTML body not opened.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libpff_message_body_stream_read_buffer(
+	              internal_item->html_body_stream,
+	              buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read HTML body data.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
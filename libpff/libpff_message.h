@@ -151,6 +151,38 @@ int libpff_message_get_plain_text_body(
      size_t size,
      libcerror_error_t **error );
 
+int libpff_message_get_body_stream_codepage(
+     libpff_internal_item_t *internal_item,
+     int *ascii_codepage,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_message_plain_text_body_open(
+     libpff_item_t *message,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_message_plain_text_body_close(
+     libpff_item_t *message,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+ssize_t libpff_message_plain_text_body_read_buffer(
+         libpff_item_t *message,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+int libpff_message_get_rtf_body_compressed_data(
+     libpff_internal_item_t *internal_item,
+     uint8_t **compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+int libpff_message_read_rtf_body_data(
+     libpff_internal_item_t *internal_item,
+     libcerror_error_t **error );
+
 LIBPFF_EXTERN \
 int libpff_message_get_rtf_body_size(
      libpff_item_t *message,
@@ -164,6 +196,30 @@ int libpff_message_get_rtf_body(
      size_t size,
      libcerror_error_t **error );
 
+LIBPFF_EXTERN \
+int libpff_message_rtf_body_open(
+     libpff_item_t *message,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_message_rtf_body_close(
+     libpff_item_t *message,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+ssize_t libpff_message_rtf_body_read_buffer(
+         libpff_item_t *message,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+off64_t libpff_message_rtf_body_seek_offset(
+         libpff_item_t *message,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
 LIBPFF_EXTERN \
 int libpff_message_get_html_body_size(
      libpff_item_t *message,
@@ -177,6 +233,23 @@ int libpff_message_get_html_body(
      size_t size,
      libcerror_error_t **error );
 
+LIBPFF_EXTERN \
+int libpff_message_html_body_open(
+     libpff_item_t *message,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_message_html_body_close(
+     libpff_item_t *message,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+ssize_t libpff_message_html_body_read_buffer(
+         libpff_item_t *message,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,561 @@
+/*
+ * Message body stream functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libpff_definitions.h"
+#include "libpff_libcerror.h"
+#include "libpff_libuna.h"
+#include "libpff_mapi.h"
+#include "libpff_mapi_value.h"
+#include "libpff_message_body_stream.h"
+#include "libpff_record_entry.h"
+
+/* Creates a message body stream
+ * The message body stream holds the reference to the record entry if successful
+ * Make sure the value message_body_stream is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_message_body_stream_initialize(
+     libpff_message_body_stream_t **message_body_stream,
+     libpff_record_entry_t *record_entry,
+     int ascii_codepage,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	uint8_t *value_data    = NULL;
+	static char *function  = "libpff_message_body_stream_initialize";
+	size_t value_data_size = 0;
+	uint32_t value_type    = 0;
+	uint8_t conversion     = LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_NONE;
+	int result             = 0;
+
+	if( message_body_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message body stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_body_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message body stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBPFF_MESSAGE_BODY_STREAM_FLAG_READ_AS_STORED ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	if( libpff_record_entry_get_value_type(
+	     record_entry,
+	     &value_type,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_type != LIBPFF_VALUE_TYPE_STRING_ASCII )
+	 && ( value_type != LIBPFF_VALUE_TYPE_STRING_UNICODE )
+	 && ( value_type != LIBPFF_VALUE_TYPE_BINARY_DATA ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type: 0x%04" PRIx32 ".",
+		 function,
+		 value_type );
+
+		return( -1 );
+	}
+	if( ( flags & LIBPFF_MESSAGE_BODY_STREAM_FLAG_READ_AS_STORED ) != 0 )
+	{
+		conversion = LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_NONE;
+	}
+	else if( value_type == LIBPFF_VALUE_TYPE_STRING_UNICODE )
+	{
+		conversion = LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_UTF16;
+	}
+	else if( value_type == LIBPFF_VALUE_TYPE_STRING_ASCII )
+	{
+		/* Codepage 1200 represents Unicode
+		 * If the codepage is 1200 find out if the string is encoded in UTF-8 or UTF-16 little-endian
+		 */
+		if( ascii_codepage == 1200 )
+		{
+			if( libpff_record_entry_get_value_data(
+			     record_entry,
+			     &value_data,
+			     &value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value data.",
+				 function );
+
+				return( -1 );
+			}
+			result = libpff_mapi_value_data_contains_zero_bytes(
+				  value_data,
+				  value_data_size,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if value data contains zero bytes.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( result != 0 )
+		{
+			conversion = LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_UTF16;
+		}
+		/* Codepage 65000 represents UTF-7
+		 */
+		else if( ascii_codepage == 65000 )
+		{
+			conversion = LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_UTF7;
+		}
+		/* Codepage 1200 or 65001 represents UTF-8
+		 */
+		else if( ( ascii_codepage == 1200 )
+		      || ( ascii_codepage == 65001 ) )
+		{
+			conversion = LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_UTF8;
+		}
+		else
+		{
+			conversion = LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_BYTE_STREAM;
+		}
+	}
+	if( libpff_record_entry_seek_offset(
+	     record_entry,
+	     0,
+	     SEEK_SET,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek start of value data.",
+		 function );
+
+		return( -1 );
+	}
+	*message_body_stream = memory_allocate_structure(
+	                        libpff_message_body_stream_t );
+
+	if( *message_body_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create message body stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *message_body_stream,
+	     0,
+	     sizeof( libpff_message_body_stream_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear message body stream.",
+		 function );
+
+		goto on_error;
+	}
+	( *message_body_stream )->record_entry   = record_entry;
+	( *message_body_stream )->conversion     = conversion;
+	( *message_body_stream )->ascii_codepage = ascii_codepage;
+
+	return( 1 );
+
+on_error:
+	if( *message_body_stream != NULL )
+	{
+		memory_free(
+		 *message_body_stream );
+
+		*message_body_stream = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a message body stream
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_message_body_stream_free(
+     libpff_message_body_stream_t **message_body_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_message_body_stream_free";
+	int result            = 1;
+
+	if( message_body_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message body stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_body_stream != NULL )
+	{
+		if( ( *message_body_stream )->record_entry != NULL )
+		{
+			if( libpff_record_entry_free(
+			     &( ( *message_body_stream )->record_entry ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record entry.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *message_body_stream );
+
+		*message_body_stream = NULL;
+	}
+	return( result );
+}
+
+/* Reads message body data from the current offset into a buffer
+ * Strings are converted to UTF-8 one character at a time, binary data is returned as-is
+ * The end of string character of a converted string is not returned
+ * If LIBPFF_MESSAGE_BODY_STREAM_FLAG_READ_AS_STORED is set all value data is returned as-is
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libpff_message_body_stream_read_buffer(
+         libpff_message_body_stream_t *message_body_stream,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	static char *function                        = "libpff_message_body_stream_read_buffer";
+	size_t buffer_offset                         = 0;
+	size_t copy_size                             = 0;
+	size_t remaining_input_size                  = 0;
+	ssize_t read_count                           = 0;
+	int result                                   = 0;
+
+	if( message_body_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message body stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		/* Return the remainder of the last converted character first
+		 */
+		if( message_body_stream->utf8_character_offset < message_body_stream->utf8_character_size )
+		{
+			copy_size = message_body_stream->utf8_character_size - message_body_stream->utf8_character_offset;
+
+			if( copy_size > ( buffer_size - buffer_offset ) )
+			{
+				copy_size = buffer_size - buffer_offset;
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( message_body_stream->utf8_character[ message_body_stream->utf8_character_offset ] ),
+			     copy_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-8 character.",
+				 function );
+
+				return( -1 );
+			}
+			message_body_stream->utf8_character_offset += copy_size;
+			buffer_offset                              += copy_size;
+
+			continue;
+		}
+		if( message_body_stream->end_of_string != 0 )
+		{
+			break;
+		}
+		if( message_body_stream->conversion == LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_NONE )
+		{
+			read_count = libpff_record_entry_read_buffer(
+			              message_body_stream->record_entry,
+			              &( buffer[ buffer_offset ] ),
+			              buffer_size - buffer_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read value data.",
+				 function );
+
+				return( -1 );
+			}
+			else if( read_count == 0 )
+			{
+				message_body_stream->end_of_string = 1;
+			}
+			buffer_offset += (size_t) read_count;
+
+			continue;
+		}
+		/* Make sure enough input data is available to decode a character
+		 */
+		remaining_input_size = message_body_stream->input_data_size - message_body_stream->input_data_offset;
+
+		if( ( message_body_stream->end_of_input == 0 )
+		 && ( remaining_input_size < LIBPFF_MESSAGE_BODY_STREAM_MINIMUM_INPUT_SIZE ) )
+		{
+			if( remaining_input_size > 0 )
+			{
+				if( memory_copy(
+				     message_body_stream->input_data,
+				     &( message_body_stream->input_data[ message_body_stream->input_data_offset ] ),
+				     remaining_input_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy remaining input data.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			message_body_stream->input_data_offset = 0;
+			message_body_stream->input_data_size   = remaining_input_size;
+
+			while( message_body_stream->input_data_size < LIBPFF_MESSAGE_BODY_STREAM_INPUT_DATA_SIZE )
+			{
+				read_count = libpff_record_entry_read_buffer(
+				              message_body_stream->record_entry,
+				              &( message_body_stream->input_data[ message_body_stream->input_data_size ] ),
+				              LIBPFF_MESSAGE_BODY_STREAM_INPUT_DATA_SIZE - message_body_stream->input_data_size,
+				              error );
+
+				if( read_count < 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read value data.",
+					 function );
+
+					return( -1 );
+				}
+				else if( read_count == 0 )
+				{
+					message_body_stream->end_of_input = 1;
+
+					break;
+				}
+				message_body_stream->input_data_size += (size_t) read_count;
+			}
+			remaining_input_size = message_body_stream->input_data_size;
+		}
+		if( remaining_input_size == 0 )
+		{
+			message_body_stream->end_of_string = 1;
+
+			break;
+		}
+		switch( message_body_stream->conversion )
+		{
+			case LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_BYTE_STREAM:
+				/* TODO currently libuna uses the same numeric values for the codepages as PFF
+				 * add a mapping function if this implementation changes
+				 */
+				result = libuna_unicode_character_copy_from_byte_stream(
+				          &unicode_character,
+				          message_body_stream->input_data,
+				          message_body_stream->input_data_size,
+				          &( message_body_stream->input_data_offset ),
+				          message_body_stream->ascii_codepage,
+				          error );
+				break;
+
+			case LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_UTF7:
+				result = libuna_unicode_character_copy_from_utf7_stream(
+				          &unicode_character,
+				          message_body_stream->input_data,
+				          message_body_stream->input_data_size,
+				          &( message_body_stream->input_data_offset ),
+				          &( message_body_stream->utf7_stream_base64_data ),
+				          error );
+				break;
+
+			case LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_UTF8:
+				result = libuna_unicode_character_copy_from_utf8(
+				          &unicode_character,
+				          message_body_stream->input_data,
+				          message_body_stream->input_data_size,
+				          &( message_body_stream->input_data_offset ),
+				          error );
+				break;
+
+			case LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_UTF16:
+				result = libuna_unicode_character_copy_from_utf16_stream(
+				          &unicode_character,
+				          message_body_stream->input_data,
+				          message_body_stream->input_data_size,
+				          &( message_body_stream->input_data_offset ),
+				          LIBUNA_ENDIAN_LITTLE,
+				          error );
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid message body stream - unsupported conversion.",
+				 function );
+
+				return( -1 );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from value data.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			message_body_stream->end_of_string = 1;
+
+			break;
+		}
+		message_body_stream->utf8_character_offset = 0;
+		message_body_stream->utf8_character_size   = 0;
+
+		if( libuna_unicode_character_copy_to_utf8(
+		     unicode_character,
+		     message_body_stream->utf8_character,
+		     4,
+		     &( message_body_stream->utf8_character_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character to UTF-8.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
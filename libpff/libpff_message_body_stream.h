@@ -0,0 +1,139 @@
+/*
+ * Message body stream functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBPFF_MESSAGE_BODY_STREAM_H )
+#define _LIBPFF_MESSAGE_BODY_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libpff_libcerror.h"
+#include "libpff_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the input data buffer
+ */
+#define LIBPFF_MESSAGE_BODY_STREAM_INPUT_DATA_SIZE	512
+
+/* The minimum number of input bytes that need to be available to decode a character
+ * unless the end of the value data was reached
+ */
+#define LIBPFF_MESSAGE_BODY_STREAM_MINIMUM_INPUT_SIZE	16
+
+/* The conversions
+ */
+enum LIBPFF_MESSAGE_BODY_STREAM_CONVERSIONS
+{
+	LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_NONE		= 0,
+	LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_BYTE_STREAM	= 1,
+	LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_UTF7		= 2,
+	LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_UTF8		= 3,
+	LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_UTF16		= 4
+};
+
+/* The flags
+ */
+enum LIBPFF_MESSAGE_BODY_STREAM_FLAGS
+{
+	/* Return the value data as stored, strings are not converted to UTF-8
+	 */
+	LIBPFF_MESSAGE_BODY_STREAM_FLAG_READ_AS_STORED		= 0x01
+};
+
+typedef struct libpff_message_body_stream libpff_message_body_stream_t;
+
+struct libpff_message_body_stream
+{
+	/* The record entry that contains the body
+	 */
+	libpff_record_entry_t *record_entry;
+
+	/* The conversion
+	 */
+	uint8_t conversion;
+
+	/* The codepage of the extended ASCII strings
+	 */
+	int ascii_codepage;
+
+	/* The input data
+	 */
+	uint8_t input_data[ LIBPFF_MESSAGE_BODY_STREAM_INPUT_DATA_SIZE ];
+
+	/* The input data offset
+	 */
+	size_t input_data_offset;
+
+	/* The input data size
+	 */
+	size_t input_data_size;
+
+	/* Value to indicate all value data was read into the input data
+	 */
+	uint8_t end_of_input;
+
+	/* The UTF-7 stream base64 data
+	 */
+	uint32_t utf7_stream_base64_data;
+
+	/* The UTF-8 encoded character that still needs to be returned
+	 */
+	uint8_t utf8_character[ 4 ];
+
+	/* The UTF-8 encoded character offset
+	 */
+	size_t utf8_character_offset;
+
+	/* The UTF-8 encoded character size
+	 */
+	size_t utf8_character_size;
+
+	/* Value to indicate the end of the string was reached
+	 */
+	uint8_t end_of_string;
+};
+
+int libpff_message_body_stream_initialize(
+     libpff_message_body_stream_t **message_body_stream,
+     libpff_record_entry_t *record_entry,
+     int ascii_codepage,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libpff_message_body_stream_free(
+     libpff_message_body_stream_t **message_body_stream,
+     libcerror_error_t **error );
+
+ssize_t libpff_message_body_stream_read_buffer(
+         libpff_message_body_stream_t *message_body_stream,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBPFF_MESSAGE_BODY_STREAM_H ) */
+
@@ -23,9 +23,11 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libpff_bloom_filter.h"
 #include "libpff_definitions.h"
 #include "libpff_index.h"
 #include "libpff_index_value.h"
+#include "libpff_index_value_set.h"
 #include "libpff_index_values_list.h"
 #include "libpff_libbfio.h"
 #include "libpff_libcdata.h"
@@ -129,6 +131,20 @@ int libpff_offsets_index_initialize(
 
 		goto on_error;
 	}
+	if( libpff_index_value_set_initialize(
+	     &( ( *offsets_index )->recovered_index_value_set ),
+	     LIBPFF_INDEX_TYPE_OFFSET,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovered index value set.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -192,6 +208,35 @@ int libpff_offsets_index_free(
 
 			result = -1;
 		}
+		if( libpff_index_value_set_free(
+		     &( ( *offsets_index )->recovered_index_value_set ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free recovered index value set.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *offsets_index )->allocated_index_values_filter != NULL )
+		{
+			if( libpff_bloom_filter_free(
+			     &( ( *offsets_index )->allocated_index_values_filter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free allocated index values filter.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libpff_index_free(
 		     &( ( *offsets_index )->index ),
 		     error ) != 1 )
@@ -452,6 +497,20 @@ int libpff_offsets_index_insert_recovered_index_value(
 			goto on_error;
 		}
 	}
+	if( libpff_index_value_set_insert_value(
+	     offsets_index->recovered_index_value_set,
+	     index_value,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert index value in recovered index value set.",
+		 function );
+
+		goto on_error;
+	}
 	if( libpff_index_values_list_append_value(
 	     existing_index_values_list,
 	     index_value,
@@ -478,3 +537,80 @@ on_error:
 	return( -1 );
 }
 
+/* Empties the recovered index values of the offsets index
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_offsets_index_empty_recovered_index_values(
+     libpff_offsets_index_t *offsets_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_offsets_index_empty_recovered_index_values";
+
+	if( offsets_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_free(
+	     &( offsets_index->recovered_index_values_tree ),
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libpff_index_values_list_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free recovered index values tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_index_value_set_free(
+	     &( offsets_index->recovered_index_value_set ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free recovered index value set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_initialize(
+	     &( offsets_index->recovered_index_values_tree ),
+	     257,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovered index values B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_index_value_set_initialize(
+	     &( offsets_index->recovered_index_value_set ),
+	     LIBPFF_INDEX_TYPE_OFFSET,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovered index value set.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
@@ -25,8 +25,10 @@
 #include <common.h>
 #include <types.h>
 
+#include "libpff_bloom_filter.h"
 #include "libpff_index.h"
 #include "libpff_index_value.h"
+#include "libpff_index_value_set.h"
 #include "libpff_io_handle.h"
 #include "libpff_libbfio.h"
 #include "libpff_libcdata.h"
@@ -47,6 +49,17 @@ struct libpff_offsets_index
 	/* The recovered index tree
 	 */
 	libcdata_btree_t *recovered_index_values_tree;
+
+	/* The recovered index value set
+	 * Used to determine if an index value was previously recovered
+	 */
+	libpff_index_value_set_t *recovered_index_value_set;
+
+	/* The allocated index values filter
+	 * Used to determine if an index value is not part of the index
+	 * without reading the index, NULL if not available
+	 */
+	libpff_bloom_filter_t *allocated_index_values_filter;
 };
 
 int libpff_offsets_index_initialize(
@@ -74,6 +87,10 @@ int libpff_offsets_index_insert_recovered_index_value(
      libpff_index_value_t *index_value,
      libcerror_error_t **error );
 
+int libpff_offsets_index_empty_recovered_index_values(
+     libpff_offsets_index_t *offsets_index,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,9 +24,12 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libpff_data_block.h"
 #include "libpff_definitions.h"
 #include "libpff_descriptor_data_stream.h"
+#include "libpff_io_handle.h"
 #include "libpff_libcerror.h"
+#include "libpff_libfdata.h"
 #include "libpff_libuna.h"
 #include "libpff_mapi.h"
 #include "libpff_mapi_value.h"
@@ -146,6 +149,7 @@ int libpff_internal_record_entry_free(
      libcerror_error_t **error )
 {
 	static char *function = "libpff_internal_record_entry_free";
+	int result            = 1;
 
 	if( internal_record_entry == NULL )
 	{
@@ -165,12 +169,33 @@ int libpff_internal_record_entry_free(
 			memory_free(
 			 ( *internal_record_entry )->value_data );
 		}
+		if( ( *internal_record_entry )->value_data_list != NULL )
+		{
+			if( libfdata_list_free(
+			     &( ( *internal_record_entry )->value_data_list ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free value data list.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *internal_record_entry )->value_data_extents != NULL )
+		{
+			memory_free(
+			 ( *internal_record_entry )->value_data_extents );
+		}
 		memory_free(
 		 *internal_record_entry );
 
 		*internal_record_entry = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Clones the record entry
@@ -289,6 +314,58 @@ int libpff_record_entry_clone(
 		}
 		internal_destination_record_entry->value_data_size = internal_source_record_entry->value_data_size;
 	}
+	if( internal_source_record_entry->value_data_extents != NULL )
+	{
+		internal_destination_record_entry->value_data_extents = (libpff_descriptor_data_extent_t *) memory_allocate(
+		                                                                                             sizeof( libpff_descriptor_data_extent_t ) * internal_source_record_entry->number_of_value_data_extents );
+
+		if( internal_destination_record_entry->value_data_extents == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value data extents.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_destination_record_entry->value_data_extents,
+		     internal_source_record_entry->value_data_extents,
+		     sizeof( libpff_descriptor_data_extent_t ) * internal_source_record_entry->number_of_value_data_extents ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data extents.",
+			 function );
+
+			goto on_error;
+		}
+		internal_destination_record_entry->number_of_value_data_extents = internal_source_record_entry->number_of_value_data_extents;
+	}
+	if( internal_source_record_entry->value_data_list != NULL )
+	{
+		if( libfdata_list_clone(
+		     &( internal_destination_record_entry->value_data_list ),
+		     internal_source_record_entry->value_data_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create destination value data list.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_destination_record_entry->value_data_block_flags       = internal_source_record_entry->value_data_block_flags;
+	internal_destination_record_entry->value_data_extents_available = internal_source_record_entry->value_data_extents_available;
+	internal_destination_record_entry->io_handle                    = internal_source_record_entry->io_handle;
 	internal_destination_record_entry->name_to_id_map_entry = internal_source_record_entry->name_to_id_map_entry;
 	internal_destination_record_entry->flags                = internal_source_record_entry->flags;
 
@@ -640,6 +717,8 @@ on_error:
 
 /* Sets the value data from the list in the record entry
  * The function makes a local copy
+ * The data blocks are read directly from the list, so that the flags of
+ * the data blocks can be used to determine if the value data is stored as-is
  * Returns 1 if successful or -1 on error
  */
 int libpff_record_entry_set_value_data_from_list(
@@ -649,61 +728,202 @@ int libpff_record_entry_set_value_data_from_list(
      libfcache_cache_t *value_data_cache,
      libcerror_error_t **error )
 {
-	libfdata_stream_t *value_data_stream = NULL;
-	static char *function                = "libpff_record_entry_set_value_data_from_list";
+	libpff_data_block_t *data_block                       = NULL;
+	libpff_internal_record_entry_t *internal_record_entry = NULL;
+	static char *function                                 = "libpff_record_entry_set_value_data_from_list";
+	size64_t element_mapped_size                          = 0;
+	size64_t value_data_size                              = 0;
+	size_t value_data_offset                              = 0;
+	uint8_t value_data_block_flags                        = 0;
+	int element_index                                     = 0;
+	int number_of_elements                                = 0;
 
-	if( libpff_descriptor_data_stream_initialize(
-	     &value_data_stream,
-	     value_data_list,
-	     value_data_cache,
-	     LIBPFF_DESCRIPTOR_DATA_STREAM_DATA_HANDLE_FLAG_NON_MANAGED,
-	     error ) != 1 )
+	if( record_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_entry = (libpff_internal_record_entry_t *) record_entry;
+
+	if( internal_record_entry->value_data != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create descriptor data stream.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record entry - value data already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libpff_record_entry_set_value_data_from_stream(
-	     record_entry,
-	     file_io_handle,
-	     value_data_stream,
+	if( libfdata_list_get_number_of_elements(
+	     value_data_list,
+	     &number_of_elements,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set value data from stream.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of value data list elements.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfdata_stream_free(
-	     &value_data_stream,
-	     error ) != 1 )
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfdata_list_get_mapped_size_by_index(
+		     value_data_list,
+		     element_index,
+		     &element_mapped_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value data list element: %d mapped size.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		value_data_size += element_mapped_size;
+	}
+	if( value_data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( value_data_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free descriptor data stream.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value data size value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_entry->value_data = (uint8_t *) memory_allocate(
+	                                                 (size_t) value_data_size );
+
+	if( internal_record_entry->value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value data.",
 		 function );
 
 		goto on_error;
 	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfdata_list_get_mapped_size_by_index(
+		     value_data_list,
+		     element_index,
+		     &element_mapped_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value data list element: %d mapped size.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		if( element_mapped_size == 0 )
+		{
+			continue;
+		}
+		if( libfdata_list_get_element_value_by_index(
+		     value_data_list,
+		     (intptr_t *) file_io_handle,
+		     (libfdata_cache_t *) value_data_cache,
+		     element_index,
+		     (intptr_t **) &data_block,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data block: %d.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		if( data_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing data block: %d.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		if( element_mapped_size > (size64_t) data_block->uncompressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data block: %d - mapped size value out of bounds.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     &( internal_record_entry->value_data[ value_data_offset ] ),
+		     data_block->data,
+		     (size_t) element_mapped_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data block: %d data.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+		value_data_offset      += (size_t) element_mapped_size;
+		value_data_block_flags |= data_block->flags;
+	}
+	internal_record_entry->value_data_size        = (size_t) value_data_size;
+	internal_record_entry->value_data_block_flags = value_data_block_flags;
+
 	return( 1 );
 
 on_error:
-	if( value_data_stream != NULL )
+	if( internal_record_entry->value_data != NULL )
 	{
-		libfdata_stream_free(
-		 &value_data_stream,
-		 NULL );
+		memory_free(
+		 internal_record_entry->value_data );
+
+		internal_record_entry->value_data = NULL;
 	}
 	return( -1 );
 }
@@ -826,6 +1046,311 @@ on_error:
 	return( -1 );
 }
 
+/* Sets the value data list in the record entry
+ * The value data list is only set when the value data is stored as-is in the file
+ * in which case the record entry takes over management of the value data list
+ * Returns 1 if successful, 0 if not set or -1 on error
+ */
+int libpff_record_entry_set_value_data_list(
+     libpff_record_entry_t *record_entry,
+     libpff_io_handle_t *io_handle,
+     libfdata_list_t *value_data_list,
+     libcerror_error_t **error )
+{
+	libpff_internal_record_entry_t *internal_record_entry = NULL;
+	static char *function                                 = "libpff_record_entry_set_value_data_list";
+
+	if( record_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_entry = (libpff_internal_record_entry_t *) record_entry;
+
+	if( internal_record_entry->value_data_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record entry - value data list already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data list.",
+		 function );
+
+		return( -1 );
+	}
+	/* The value data is not stored as-is if the file is encrypted, decryption was forced
+	 * or one of the data blocks was compressed or could not be validated
+	 */
+	if( ( io_handle->encryption_type != LIBPFF_ENCRYPTION_TYPE_NONE )
+	 || ( io_handle->force_decryption != 0 )
+	 || ( ( internal_record_entry->value_data_block_flags & ( LIBPFF_DATA_BLOCK_FLAG_COMPRESSED | LIBPFF_DATA_BLOCK_FLAG_DECRYPTION_FORCED | LIBPFF_DATA_BLOCK_FLAG_CRC_MISMATCH | LIBPFF_DATA_BLOCK_FLAG_IDENTIFIER_MISMATCH ) ) != 0 ) )
+	{
+		return( 0 );
+	}
+	internal_record_entry->value_data_list = value_data_list;
+	internal_record_entry->io_handle       = io_handle;
+
+	return( 1 );
+}
+
+/* Retrieves the value data extents
+ * The value data extents are determined from the value data list on the first call
+ * after which the value data list is freed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libpff_internal_record_entry_get_value_data_extents(
+     libpff_internal_record_entry_t *internal_record_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_internal_record_entry_get_value_data_extents";
+	int result            = 0;
+
+	if( internal_record_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_entry->io_handle == NULL )
+	{
+		return( 0 );
+	}
+	/* Decryption can be forced after the value data was read
+	 */
+	if( internal_record_entry->io_handle->force_decryption != 0 )
+	{
+		return( 0 );
+	}
+	/* The value data extents are not set for an empty value
+	 */
+	if( internal_record_entry->value_data_extents_available != 0 )
+	{
+		return( 1 );
+	}
+	if( internal_record_entry->value_data_list == NULL )
+	{
+		return( 0 );
+	}
+	result = libpff_descriptor_data_stream_get_extents(
+	          internal_record_entry->value_data_list,
+	          &( internal_record_entry->value_data_extents ),
+	          &( internal_record_entry->number_of_value_data_extents ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data extents.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		internal_record_entry->value_data_extents_available = 1;
+	}
+	if( libfdata_list_free(
+	     &( internal_record_entry->value_data_list ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free value data list.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the number of data extents
+ * The data extents are the ranges of the file that contain the value data as-is,
+ * they are only available for value data that is stored in separate data blocks
+ * of an unencrypted file, that are not compressed, validated without a mismatch
+ * and for which decryption was not forced
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libpff_record_entry_get_number_of_data_extents(
+     libpff_record_entry_t *record_entry,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	libpff_internal_record_entry_t *internal_record_entry = NULL;
+	static char *function                                 = "libpff_record_entry_get_number_of_data_extents";
+	int result                                            = 0;
+
+	if( record_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_entry = (libpff_internal_record_entry_t *) record_entry;
+
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_internal_record_entry_get_value_data_extents(
+	          internal_record_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data extents.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	*number_of_extents = internal_record_entry->number_of_value_data_extents;
+
+	return( 1 );
+}
+
+/* Retrieves a specific data extent
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libpff_record_entry_get_data_extent_by_index(
+     libpff_record_entry_t *record_entry,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libcerror_error_t **error )
+{
+	libpff_internal_record_entry_t *internal_record_entry = NULL;
+	static char *function                                 = "libpff_record_entry_get_data_extent_by_index";
+	int result                                            = 0;
+
+	if( record_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_entry = (libpff_internal_record_entry_t *) record_entry;
+
+	if( extent_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_internal_record_entry_get_value_data_extents(
+	          internal_record_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data extents.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( ( extent_index < 0 )
+	 || ( extent_index >= internal_record_entry->number_of_value_data_extents ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*extent_offset = internal_record_entry->value_data_extents[ extent_index ].file_offset;
+	*extent_size   = internal_record_entry->value_data_extents[ extent_index ].size;
+
+	return( 1 );
+}
+
 /* Retrieves the data
  * Returns 1 if successful or -1 on error
  */
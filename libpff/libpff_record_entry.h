@@ -25,7 +25,9 @@
 #include <common.h>
 #include <types.h>
 
+#include "libpff_descriptor_data_stream.h"
 #include "libpff_extern.h"
+#include "libpff_io_handle.h"
 #include "libpff_libbfio.h"
 #include "libpff_libcerror.h"
 #include "libpff_libfcache.h"
@@ -58,6 +60,32 @@ struct libpff_internal_record_entry
 	 */
 	off64_t value_data_offset;
 
+	/* The value data list
+	 * Only set when the value data is stored as-is in the file,
+	 * it is used to determine the value data extents on demand
+	 */
+	libfdata_list_t *value_data_list;
+
+	/* The flags of the data blocks that contain the value data
+	 */
+	uint8_t value_data_block_flags;
+
+	/* The IO handle
+	 */
+	libpff_io_handle_t *io_handle;
+
+	/* The value data extents
+	 */
+	libpff_descriptor_data_extent_t *value_data_extents;
+
+	/* The number of value data extents
+	 */
+	int number_of_value_data_extents;
+
+	/* Value to indicate the value data extents are available
+	 */
+	uint8_t value_data_extents_available;
+
 	/* The name to id map entry
 	 */
 	libpff_internal_name_to_id_map_entry_t *name_to_id_map_entry;
@@ -139,6 +167,30 @@ int libpff_record_entry_set_value_data_from_stream(
      libfdata_stream_t *value_data_stream,
      libcerror_error_t **error );
 
+int libpff_record_entry_set_value_data_list(
+     libpff_record_entry_t *record_entry,
+     libpff_io_handle_t *io_handle,
+     libfdata_list_t *value_data_list,
+     libcerror_error_t **error );
+
+int libpff_internal_record_entry_get_value_data_extents(
+     libpff_internal_record_entry_t *internal_record_entry,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_record_entry_get_number_of_data_extents(
+     libpff_record_entry_t *record_entry,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+LIBPFF_EXTERN \
+int libpff_record_entry_get_data_extent_by_index(
+     libpff_record_entry_t *record_entry,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libcerror_error_t **error );
+
 LIBPFF_EXTERN \
 int libpff_record_entry_get_data(
      libpff_record_entry_t *record_entry,
@@ -24,6 +24,8 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libpff_allocation_bitmap.h"
+#include "libpff_bloom_filter.h"
 #include "libpff_checksum.h"
 #include "libpff_data_block.h"
 #include "libpff_definitions.h"
@@ -31,6 +33,7 @@
 #include "libpff_index.h"
 #include "libpff_index_node.h"
 #include "libpff_index_value.h"
+#include "libpff_index_value_set.h"
 #include "libpff_index_values_list.h"
 #include "libpff_item_descriptor.h"
 #include "libpff_item_tree.h"
@@ -39,15 +42,28 @@
 #include "libpff_libcdata.h"
 #include "libpff_libcerror.h"
 #include "libpff_libcnotify.h"
+#include "libpff_libcthreads.h"
 #include "libpff_local_descriptors_node.h"
 #include "libpff_offsets_index.h"
 #include "libpff_recover.h"
+#include "libpff_recover_checkpoint.h"
 
 #include "pff_block.h"
 #include "pff_index_node.h"
 
+#if defined( LIBPFF_RECOVER_HAVE_SIMD_FOOTER_FILTER )
+#include <emmintrin.h>
+#endif
+
 /* Scans for recoverable items
  * By default only the unallocated space is checked for recoverable items
+ * If a checkpoint is provided the scan continues from the state stored in the checkpoint
+ * and the checkpoint is updated while scanning
+ * If a recovered item callback is provided the item tree node of each recovered item is passed
+ * to the callback once the item has been validated, instead of being appended to the recovered item array
+ * The items are validated after the unallocated data has been scanned, since the data blocks
+ * of an item can be recovered anywhere in the unallocated data
+ * The item tree node is freed after the callback returns and the recovery is aborted if the callback returns -1
  * Returns 1 if successful or -1 on error
  */
 int libpff_recover_items(
@@ -55,10 +71,16 @@ int libpff_recover_items(
      libbfio_handle_t *file_io_handle,
      libpff_descriptors_index_t *descriptors_index,
      libpff_offsets_index_t *offsets_index,
-     libcdata_range_list_t *unallocated_data_block_list,
-     libcdata_range_list_t *unallocated_page_block_list,
-     libcdata_list_t *recovered_item_list,
+     libpff_allocation_bitmap_t *unallocated_data_block_bitmap,
+     libpff_allocation_bitmap_t *unallocated_page_block_bitmap,
+     libcdata_array_t *recovered_item_array,
+     int (*recovered_item_callback)(
+            libcdata_tree_node_t *item_tree_node,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
      uint8_t recovery_flags,
+     libpff_recover_checkpoint_t *checkpoint,
      libcerror_error_t **error )
 {
 	libcdata_tree_node_t *item_tree_node          = NULL;
@@ -67,6 +89,7 @@ int libpff_recover_items(
 	libpff_item_descriptor_t *item_descriptor     = NULL;
 	static char *function                         = "libpff_recover_items";
 	int data_identifier_value_index               = 0;
+	int entry_index                               = 0;
 	int index_value_iterator                      = 0;
 	int index_values_list_iterator                = 0;
 	int local_descriptors_identifier_value_index  = 0;
@@ -146,13 +169,13 @@ int libpff_recover_items(
 
 		return( -1 );
 	}
-	if( recovered_item_list == NULL )
+	if( recovered_item_array == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid recovered item list.",
+		 "%s: invalid recovered item array.",
 		 function );
 
 		return( -1 );
@@ -212,16 +235,105 @@ int libpff_recover_items(
 	}
 #endif /* TODO */
 
+	if( checkpoint != NULL )
+	{
+		if( libpff_recover_checkpoint_read(
+		     checkpoint,
+		     descriptors_index,
+		     offsets_index,
+		     NULL,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read checkpoint.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The allocated index values filters are used to skip the index lookups
+	 * of deleted index values that cannot match an allocated index value
+	 * If a filter cannot be built the index lookups are not skipped
+	 */
+	if( descriptors_index->allocated_index_values_filter == NULL )
+	{
+		if( libpff_recover_build_allocated_index_values_filter(
+		     descriptors_index->index,
+		     io_handle,
+		     file_io_handle,
+		     &( descriptors_index->allocated_index_values_filter ),
+		     error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
+	if( offsets_index->allocated_index_values_filter == NULL )
+	{
+		if( libpff_recover_build_allocated_index_values_filter(
+		     offsets_index->index,
+		     io_handle,
+		     file_io_handle,
+		     &( offsets_index->allocated_index_values_filter ),
+		     error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
 	if( libpff_recover_data_blocks(
 	     io_handle,
 	     file_io_handle,
 	     descriptors_index,
 	     offsets_index,
-	     unallocated_data_block_list,
-	     unallocated_page_block_list,
+	     unallocated_data_block_bitmap,
+	     unallocated_page_block_bitmap,
 	     recovery_flags,
+	     checkpoint,
 	     error ) != 1 )
 	{
+		/* Preserve the data blocks that were scanned before the abort
+		 */
+		if( ( checkpoint != NULL )
+		 && ( io_handle->abort != 0 )
+		 && ( checkpoint->number_of_scanned_chunks > checkpoint->number_of_written_chunks ) )
+		{
+			if( libpff_recover_checkpoint_write(
+			     checkpoint,
+			     descriptors_index,
+			     offsets_index,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write checkpoint.",
+				 function );
+			}
+		}
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
@@ -486,21 +598,56 @@ int libpff_recover_items(
 			}
 			item_descriptor = NULL;
 
-			if( libcdata_list_append_value(
-			     recovered_item_list,
-			     (intptr_t *) item_tree_node,
-			     error ) != 1 )
+			if( recovered_item_callback != NULL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append tree node to recovered item list.",
-				 function );
+				if( recovered_item_callback(
+				     item_tree_node,
+				     callback_data,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to process recovered item: %" PRIu64 ".",
+					 function,
+					 descriptors_index_value->identifier );
 
-				goto on_error;
+					goto on_error;
+				}
+				if( libpff_item_tree_node_free_recovered(
+				     &item_tree_node,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free item tree node.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				if( libcdata_array_append_entry(
+				     recovered_item_array,
+				     &entry_index,
+				     (intptr_t *) item_tree_node,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append tree node to recovered item array.",
+					 function );
+
+					goto on_error;
+				}
+				item_tree_node = NULL;
 			}
-			item_tree_node = NULL;
 		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -540,466 +687,568 @@ on_error:
 		 &item_descriptor,
 		 NULL );
 	}
-	libcdata_list_empty(
-	 recovered_item_list,
+	libcdata_array_empty(
+	 recovered_item_array,
 	 (int (*)(intptr_t **, libcerror_error_t **)) &libpff_item_tree_node_free_recovered,
 	 NULL );
 
 	return( -1 );
 }
 
-/* Analyze if a specific descriptor data identifier is recoverable
- * Returns 1 if recoverable, 0 if not or -1 on error
+/* Builds a filter of the allocated index values
+ * Returns 1 if successful or -1 on error
  */
-int libpff_recover_analyze_descriptor_data_identifier(
+int libpff_recover_build_allocated_index_values_filter(
+     libpff_index_t *index,
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     libpff_offsets_index_t *offsets_index,
-     libpff_index_value_t *descriptors_index_value,
-     int *data_identifier_value_index,
+     libpff_bloom_filter_t **allocated_index_values_filter,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *upper_node              = NULL;
-	libpff_index_value_t *index_value             = NULL;
-	libpff_index_value_t *lookup_index_value      = NULL;
-	libpff_index_values_list_t *index_values_list = NULL;
-	static char *function                         = "libpff_recover_analyze_descriptor_data_identifier";
-	uint64_t lookup_identifier                    = 0;
-	int index_value_iterator                      = 0;
-	int number_of_index_values                    = 0;
-	int result                                    = 0;
+	libpff_bloom_filter_t *bloom_filter = NULL;
+	uint64_t *hashes                    = NULL;
+	static char *function               = "libpff_recover_build_allocated_index_values_filter";
+	size_t hash_index                   = 0;
+	size_t maximum_number_of_hashes     = 0;
+	size_t number_of_hashes             = 0;
 
-	if( offsets_index == NULL )
+	if( index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offsets index.",
+		 "%s: invalid index.",
 		 function );
 
 		return( -1 );
 	}
-	if( descriptors_index_value == NULL )
+	if( allocated_index_values_filter == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid descriptors index value.",
+		 "%s: invalid allocated index values filter.",
 		 function );
 
 		return( -1 );
 	}
-	if( data_identifier_value_index == NULL )
+	if( *allocated_index_values_filter != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data identifier value index.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid allocated index values filter value already set.",
 		 function );
 
 		return( -1 );
 	}
-	lookup_identifier = descriptors_index_value->data_identifier & (uint64_t) LIBPFF_OFFSET_INDEX_IDENTIFIER_MASK;
-
-	if( libpff_index_value_initialize(
-	     &lookup_index_value,
+	if( libpff_recover_read_allocated_index_value_hashes(
+	     index,
+	     io_handle,
+	     file_io_handle,
+	     index->root_node_offset,
+	     index->root_node_back_pointer,
+	     &hashes,
+	     &maximum_number_of_hashes,
+	     &number_of_hashes,
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create lookup index value.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read allocated index value hashes.",
 		 function );
 
 		goto on_error;
 	}
-	lookup_index_value->identifier = lookup_identifier;
-
-/* TODO have a compare function that directly uses the lookup_identifier not the lookup_index_value */
-	result = libcdata_btree_get_value_by_value(
-	          offsets_index->recovered_index_values_tree,
-	          (intptr_t *) lookup_index_value,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libpff_index_values_list_compare,
-	          &upper_node,
-	          (intptr_t **) &index_values_list,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve recovered offsets index value: %" PRIu64 " list.",
-		 function,
-		 lookup_identifier );
-
-		goto on_error;
-	}
-	if( libpff_index_value_free(
-	     &lookup_index_value,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free lookup index value.",
-		 function,
-		 lookup_identifier );
-
-		goto on_error;
-	}
-	if( result == 0 )
-	{
-		return( 0 );
-	}
-	if( libpff_index_values_list_number_of_values(
-	     index_values_list,
-	     &number_of_index_values,
+	if( libpff_bloom_filter_initialize(
+	     &bloom_filter,
+	     (uint64_t) number_of_hashes,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of recovered offsets index value: %" PRIu64 " list.",
-		 function,
-		 lookup_identifier );
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create Bloom filter.",
+		 function );
 
 		goto on_error;
 	}
-/* TODO handle if more than 1 offsets index value is recoverable */
-
-	result = 0;
-
-	for( index_value_iterator = 0;
-	     index_value_iterator < number_of_index_values;
-	     index_value_iterator++ )
+	for( hash_index = 0;
+	     hash_index < number_of_hashes;
+	     hash_index++ )
 	{
-		if( libpff_index_values_list_get_value_by_index(
-		     index_values_list,
-		     index_value_iterator,
-		     &index_value,
+		if( libpff_bloom_filter_insert_hash(
+		     bloom_filter,
+		     hashes[ hash_index ],
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve recovered offsets index value: %d for data identifier: %" PRIu64 ".",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert hash: %" PRIzd " into Bloom filter.",
 			 function,
-			 index_value_iterator,
-			 lookup_identifier );
+			 hash_index );
 
 			goto on_error;
 		}
-		/* Check if a data block is recoverable
-		 */
-		result = libpff_recover_analyze_data_block(
-			  io_handle,
-			  file_io_handle,
-			  (uint32_t) descriptors_index_value->identifier,
-			  index_value,
-			  error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to recover data block: %" PRIu64 ".",
-			 function,
-			 descriptors_index_value->data_identifier );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( libcnotify_verbose != 0 )
-			 && ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-#endif
-			libcerror_error_free(
-			 error );
-
-/* TODO remove unreadable offset identifier from offsets_index->recovered_index_values_tree ? */
-		}
-		else if( result != 0 )
-		{
-			break;
-		}
-	}
-	if( result != 0 )
-	{
-		*data_identifier_value_index = index_value_iterator;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	else if( libcnotify_verbose != 0 )
+	if( hashes != NULL )
 	{
-		libcnotify_printf(
-		 "%s: recovered offsets index value for data identifier: %" PRIu64 " not available.\n",
-		 function,
-		 lookup_identifier );
+		memory_free(
+		 hashes );
 	}
-#endif
-	return( result );
+	*allocated_index_values_filter = bloom_filter;
+
+	return( 1 );
 
 on_error:
-	if( lookup_index_value != NULL )
+	if( bloom_filter != NULL )
 	{
-		libpff_index_value_free(
-		 &lookup_index_value,
+		libpff_bloom_filter_free(
+		 &bloom_filter,
 		 NULL );
 	}
+	if( hashes != NULL )
+	{
+		memory_free(
+		 hashes );
+	}
 	return( -1 );
 }
 
-/* Analyze if a specific descriptor local descriptors identifier is recoverable
- * Returns 1 if recoverable, 0 if not or -1 on error
+/* Reads the hashes of the allocated index values of an index node and its sub nodes
+ * Returns 1 if successful or -1 on error
  */
-int libpff_recover_analyze_descriptor_local_descriptors_identifier(
+int libpff_recover_read_allocated_index_value_hashes(
+     libpff_index_t *index,
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     libpff_offsets_index_t *offsets_index,
-     libpff_index_value_t *descriptors_index_value,
-     int *local_descriptors_identifier_value_index,
+     off64_t node_offset,
+     uint64_t node_back_pointer,
+     uint64_t **hashes,
+     size_t *maximum_number_of_hashes,
+     size_t *number_of_hashes,
+     int recursion_depth,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *upper_node              = NULL;
-	libpff_index_value_t *index_value             = NULL;
-	libpff_index_value_t *lookup_index_value      = NULL;
-	libpff_index_values_list_t *index_values_list = NULL;
-	static char *function                         = "libpff_recover_analyze_descriptor_local_descriptors_identifier";
-	uint64_t lookup_identifier                    = 0;
-	int index_value_iterator                      = 0;
-	int number_of_index_values                    = 0;
-	int result                                    = 0;
+	libpff_index_node_t *index_node = NULL;
+	libpff_index_value_t index_value;
+
+	uint8_t *node_entry_data        = NULL;
+	uint64_t *reallocation          = NULL;
+	static char *function           = "libpff_recover_read_allocated_index_value_hashes";
+	size_t reallocation_size        = 0;
+	uint64_t identifier             = 0;
+	uint64_t key_value1             = 0;
+	uint64_t key_value2             = 0;
+	uint64_t sub_node_back_pointer  = 0;
+	uint64_t sub_node_offset        = 0;
+	uint16_t entry_index            = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
 
-	if( offsets_index == NULL )
+		return( -1 );
+	}
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offsets index.",
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( descriptors_index_value == NULL )
+	if( hashes == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid descriptors index value.",
+		 "%s: invalid hashes.",
 		 function );
 
 		return( -1 );
 	}
-	if( local_descriptors_identifier_value_index == NULL )
+	if( maximum_number_of_hashes == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid local descriptors identifier value index.",
+		 "%s: invalid maximum number of hashes.",
 		 function );
 
 		return( -1 );
 	}
-	/* The local descriptors identifier is 0 if not set
-	 */
-	if( descriptors_index_value->local_descriptors_identifier == 0 )
+	if( number_of_hashes == NULL )
 	{
-		return( 1 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hashes.",
+		 function );
+
+		return( -1 );
 	}
-	lookup_identifier = descriptors_index_value->local_descriptors_identifier & (uint64_t) LIBPFF_OFFSET_INDEX_IDENTIFIER_MASK;
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBPFF_MAXIMUM_INDEX_TREE_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
 
-	if( libpff_index_value_initialize(
-	     &lookup_index_value,
-	     error ) != 1 )
+		return( -1 );
+	}
+	if( io_handle->abort != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create lookup index value.",
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	lookup_index_value->identifier = lookup_identifier;
-
-/* TODO have a compare function that directly uses the lookup_identifier not the lookup_index_value */
-	result = libcdata_btree_get_value_by_value(
-	          offsets_index->recovered_index_values_tree,
-	          (intptr_t *) lookup_index_value,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libpff_index_values_list_compare,
-	          &upper_node,
-	          (intptr_t **) &index_values_list,
-	          error );
+	if( memory_set(
+	     &index_value,
+	     0,
+	     sizeof( libpff_index_value_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index value.",
+		 function );
 
-	if( result == -1 )
+		return( -1 );
+	}
+	if( libpff_index_node_initialize(
+	     &index_node,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve recovered offsets index value: %" PRIu64 " list.",
-		 function,
-		 lookup_identifier );
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index node.",
+		 function );
 
 		goto on_error;
 	}
-	if( libpff_index_value_free(
-	     &lookup_index_value,
+	if( libpff_index_node_read_file_io_handle(
+	     index_node,
+	     file_io_handle,
+	     node_offset,
+	     io_handle->file_type,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free lookup index value.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index node at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
-		 lookup_identifier );
+		 node_offset,
+		 node_offset );
 
 		goto on_error;
 	}
-	if( result == 0 )
-	{
-		return( 0 );
-	}
-	if( libpff_index_values_list_number_of_values(
-	     index_values_list,
-	     &number_of_index_values,
-	     error ) != 1 )
+	if( index->type != index_node->type )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of recovered offsets index value: %" PRIu64 " list.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: index type mismatch (index: 0x%02" PRIx8 ", node: 0x%02" PRIx8 ").",
 		 function,
-		 lookup_identifier );
+		 index->type,
+		 index_node->type );
 
 		goto on_error;
 	}
-/* TODO handle if more than 1 offsets index value is recoverable */
-
-	result = 0;
+	if( index_node->level != LIBPFF_INDEX_NODE_LEVEL_LEAF )
+	{
+		if( index_node->back_pointer != node_back_pointer )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: back pointer mismatch (index entry: %" PRIu64 ", node: %" PRIu64 ").",
+			 function,
+			 node_back_pointer,
+			 index_node->back_pointer );
 
-	for( index_value_iterator = 0;
-	     index_value_iterator < number_of_index_values;
-	     index_value_iterator++ )
+			goto on_error;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < index_node->number_of_entries;
+	     entry_index++ )
 	{
-		if( libpff_index_values_list_get_value_by_index(
-		     index_values_list,
-		     index_value_iterator,
-		     &index_value,
+		if( libpff_index_node_get_entry_data(
+		     index_node,
+		     entry_index,
+		     &node_entry_data,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve recovered offsets index value: %d for data identifier: %" PRIu64 ".",
+			 "%s: unable to retrieve node entry: %" PRIu16 " data.",
 			 function,
-			 index_value_iterator,
-			 lookup_identifier );
+			 entry_index );
 
 			goto on_error;
 		}
-		/* Check if local descriptors are recoverable
-		 */
-		result = libpff_recover_analyze_local_descriptors(
-		          io_handle,
-		          file_io_handle,
-		          offsets_index,
-		          descriptors_index_value->local_descriptors_identifier,
-		          error );
-
-		if( result == -1 )
+		if( node_entry_data == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to recover local descriptors: %" PRIu64 ".",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing node entry: %" PRIu16 " data.",
 			 function,
-			 descriptors_index_value->local_descriptors_identifier );
+			 entry_index );
 
 			goto on_error;
 		}
-		else if( result != 0 )
+		if( index_node->level == LIBPFF_INDEX_NODE_LEVEL_LEAF )
 		{
-			break;
-		}
-	}
-	if( result != 0 )
-	{
-		*local_descriptors_identifier_value_index = index_value_iterator;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	else if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: recovered offsets index value for local descriptors identifier: %" PRIu64 " not available.\n",
-		 function,
-		 lookup_identifier );
-	}
-#endif
-	return( result );
+			if( libpff_index_value_read_data(
+			     &index_value,
+			     io_handle,
+			     index->type,
+			     node_entry_data,
+			     (size_t) index_node->entry_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read index value: %" PRIu16 ".",
+				 function,
+				 entry_index );
 
-on_error:
-	if( lookup_index_value != NULL )
-	{
-		libpff_index_value_free(
-		 &lookup_index_value,
-		 NULL );
-	}
-	return( -1 );
-}
+				goto on_error;
+			}
+			if( libpff_index_value_set_get_key(
+			     index->type,
+			     &index_value,
+			     &identifier,
+			     &key_value1,
+			     &key_value2,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve index value: %" PRIu16 " key.",
+				 function,
+				 entry_index );
 
-/* Analyze if a specific data block back pointer is recoverable
- * Returns 1 if recoverable, 0 if not or -1 on error
- */
-int libpff_recover_analyze_data_block_back_pointer(
-     libpff_offsets_index_t *offsets_index,
-     uint64_t data_block_back_pointer,
-     off64_t data_block_data_offset,
-     size32_t data_block_data_size,
-     libcerror_error_t **error )
-{
-	libcdata_tree_node_t *upper_node              = NULL;
-	libpff_index_value_t *index_value             = NULL;
-	libpff_index_value_t *lookup_index_value      = NULL;
-	libpff_index_values_list_t *index_values_list = NULL;
-	static char *function                         = "libpff_recover_analyze_data_block_back_pointer";
-	uint64_t lookup_identifier                    = 0;
-	int index_value_iterator                      = 0;
-	int number_of_index_values                    = 0;
-	int result                                    = 0;
+				goto on_error;
+			}
+			if( *number_of_hashes >= *maximum_number_of_hashes )
+			{
+				if( *maximum_number_of_hashes == 0 )
+				{
+					reallocation_size = 1024;
+				}
+				else
+				{
+					reallocation_size = *maximum_number_of_hashes * 2;
+				}
+				if( reallocation_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid maximum number of hashes value exceeds maximum.",
+					 function );
 
-	if( offsets_index == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					goto on_error;
+				}
+				reallocation = (uint64_t *) memory_reallocate(
+				                             *hashes,
+				                             sizeof( uint64_t ) * reallocation_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize hashes.",
+					 function );
+
+					goto on_error;
+				}
+				*hashes                   = reallocation;
+				*maximum_number_of_hashes = reallocation_size;
+			}
+			( *hashes )[ *number_of_hashes ] = libpff_index_value_set_calculate_hash(
+			                                    identifier,
+			                                    key_value1,
+			                                    key_value2 );
+
+			*number_of_hashes += 1;
+		}
+		else
+		{
+			if( io_handle->file_type == LIBPFF_FILE_TYPE_32BIT )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 ( (pff_index_node_branch_entry_32bit_t *) node_entry_data )->file_offset,
+				 sub_node_offset );
+
+				byte_stream_copy_to_uint32_little_endian(
+				 ( (pff_index_node_branch_entry_32bit_t *) node_entry_data )->back_pointer,
+				 sub_node_back_pointer );
+			}
+			else if( ( io_handle->file_type == LIBPFF_FILE_TYPE_64BIT )
+			      || ( io_handle->file_type == LIBPFF_FILE_TYPE_64BIT_4K_PAGE ) )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 ( (pff_index_node_branch_entry_64bit_t *) node_entry_data )->file_offset,
+				 sub_node_offset );
+
+				byte_stream_copy_to_uint64_little_endian(
+				 ( (pff_index_node_branch_entry_64bit_t *) node_entry_data )->back_pointer,
+				 sub_node_back_pointer );
+			}
+			if( libpff_recover_read_allocated_index_value_hashes(
+			     index,
+			     io_handle,
+			     file_io_handle,
+			     (off64_t) sub_node_offset,
+			     sub_node_back_pointer,
+			     hashes,
+			     maximum_number_of_hashes,
+			     number_of_hashes,
+			     recursion_depth + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read allocated index value hashes of index node at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 sub_node_offset,
+				 sub_node_offset );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libpff_index_node_free(
+	     &index_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index node.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_node != NULL )
+	{
+		libpff_index_node_free(
+		 &index_node,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Analyze if a specific descriptor data identifier is recoverable
+ * Returns 1 if recoverable, 0 if not or -1 on error
+ */
+int libpff_recover_analyze_descriptor_data_identifier(
+     libpff_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libpff_offsets_index_t *offsets_index,
+     libpff_index_value_t *descriptors_index_value,
+     int *data_identifier_value_index,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *upper_node              = NULL;
+	libpff_index_value_t *index_value             = NULL;
+	libpff_index_value_t *lookup_index_value      = NULL;
+	libpff_index_values_list_t *index_values_list = NULL;
+	static char *function                         = "libpff_recover_analyze_descriptor_data_identifier";
+	uint64_t lookup_identifier                    = 0;
+	int index_value_iterator                      = 0;
+	int number_of_index_values                    = 0;
+	int result                                    = 0;
+
+	if( offsets_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
 		 "%s: invalid offsets index.",
 		 function );
 
 		return( -1 );
 	}
-	lookup_identifier = data_block_back_pointer;
+	if( descriptors_index_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptors index value.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_identifier_value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data identifier value index.",
+		 function );
+
+		return( -1 );
+	}
+	lookup_identifier = descriptors_index_value->data_identifier & (uint64_t) LIBPFF_OFFSET_INDEX_IDENTIFIER_MASK;
 
 	if( libpff_index_value_initialize(
 	     &lookup_index_value,
@@ -1095,28 +1344,57 @@ int libpff_recover_analyze_data_block_back_pointer(
 
 			goto on_error;
 		}
-		if( ( data_block_data_offset == index_value->file_offset )
-		 && ( data_block_data_size == index_value->data_size ) )
+		/* Check if a data block is recoverable
+		 */
+		result = libpff_recover_analyze_data_block(
+			  io_handle,
+			  file_io_handle,
+			  (uint32_t) descriptors_index_value->identifier,
+			  index_value,
+			  error );
+
+		if( result == -1 )
 		{
-			result = 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to recover data block: %" PRIu64 ".",
+			 function,
+			 descriptors_index_value->data_identifier );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+/* TODO remove unreadable offset identifier from offsets_index->recovered_index_values_tree ? */
 		}
-		if( result != 0 )
+		else if( result != 0 )
 		{
 			break;
 		}
 	}
 	if( result != 0 )
 	{
+		*data_identifier_value_index = index_value_iterator;
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: recovered data block with identifier: %" PRIu64 " matches existing recovered item value.\n",
-			 function,
-			 lookup_identifier );
-		}
-#endif
+	else if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: recovered offsets index value for data identifier: %" PRIu64 " not available.\n",
+		 function,
+		 lookup_identifier );
 	}
+#endif
 	return( result );
 
 on_error:
@@ -1129,27 +1407,34 @@ on_error:
 	return( -1 );
 }
 
-/* Analyze if a specific descriptors index value is recoverable
+/* Analyze if a specific descriptor local descriptors identifier is recoverable
  * Returns 1 if recoverable, 0 if not or -1 on error
  */
-int libpff_recover_analyze_descriptors_index_value(
-     libpff_descriptors_index_t *descriptors_index,
+int libpff_recover_analyze_descriptor_local_descriptors_identifier(
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
+     libpff_offsets_index_t *offsets_index,
      libpff_index_value_t *descriptors_index_value,
+     int *local_descriptors_identifier_value_index,
      libcerror_error_t **error )
 {
-	libpff_index_value_t *existing_index_value = NULL;
-	static char *function                      = "libpff_recover_analyze_descriptors_index_value";
-	int result                                 = 0;
+	libcdata_tree_node_t *upper_node              = NULL;
+	libpff_index_value_t *index_value             = NULL;
+	libpff_index_value_t *lookup_index_value      = NULL;
+	libpff_index_values_list_t *index_values_list = NULL;
+	static char *function                         = "libpff_recover_analyze_descriptor_local_descriptors_identifier";
+	uint64_t lookup_identifier                    = 0;
+	int index_value_iterator                      = 0;
+	int number_of_index_values                    = 0;
+	int result                                    = 0;
 
-	if( descriptors_index == NULL )
+	if( offsets_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid descriptors index.",
+		 "%s: invalid offsets index.",
 		 function );
 
 		return( -1 );
@@ -1165,177 +1450,219 @@ int libpff_recover_analyze_descriptors_index_value(
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( local_descriptors_identifier_value_index == NULL )
 	{
-		libcnotify_printf(
-		 "%s: analyzing identifier: %" PRIu64 ", data: %" PRIu64 ", local descriptors: %" PRIu64 ", parent: %" PRIu32 "\n",
-		 function,
-		 descriptors_index_value->identifier,
-		 descriptors_index_value->data_identifier,
-		 descriptors_index_value->local_descriptors_identifier,
-		 descriptors_index_value->parent_identifier );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid local descriptors identifier value index.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	/* Check if the descriptors index value matches an existing index value
+	/* The local descriptors identifier is 0 if not set
 	 */
-	result = libpff_index_get_value_by_identifier(
-		  descriptors_index->index,
-		  io_handle,
-		  file_io_handle,
-		  descriptors_index_value->identifier,
-		  &existing_index_value,
-		  error );
+	if( descriptors_index_value->local_descriptors_identifier == 0 )
+	{
+		return( 1 );
+	}
+	lookup_identifier = descriptors_index_value->local_descriptors_identifier & (uint64_t) LIBPFF_OFFSET_INDEX_IDENTIFIER_MASK;
 
-	if( result == -1 )
+	if( libpff_index_value_initialize(
+	     &lookup_index_value,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve descriptors index value: %" PRIu64 " from index.",
-		 function,
-		 descriptors_index_value->identifier );
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create lookup index value.",
+		 function );
 
 		goto on_error;
 	}
-	else if( result != 0 )
-	{
-		if( existing_index_value == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing descriptors index value for identifier: %" PRIu64 ".",
-			 function,
-			 descriptors_index_value->identifier );
+	lookup_index_value->identifier = lookup_identifier;
 
-			goto on_error;
-		}
-		result = 0;
+/* TODO have a compare function that directly uses the lookup_identifier not the lookup_index_value */
+	result = libcdata_btree_get_value_by_value(
+	          offsets_index->recovered_index_values_tree,
+	          (intptr_t *) lookup_index_value,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libpff_index_values_list_compare,
+	          &upper_node,
+	          (intptr_t **) &index_values_list,
+	          error );
 
-/* TODO what about parent changes ? */
-		if( ( descriptors_index_value->data_identifier == existing_index_value->data_identifier )
-		 && ( descriptors_index_value->local_descriptors_identifier == existing_index_value->local_descriptors_identifier ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: deleted descriptors index value: %" PRIu64 " matches existing item value.\n",
-				 function,
-				 descriptors_index_value->identifier );
-			}
-#endif
-			result = 1;
-		}
-		if( libpff_index_value_free(
-		     &existing_index_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free index value: %d.",
-			 function,
-			 descriptors_index_value->identifier );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve recovered offsets index value: %" PRIu64 " list.",
+		 function,
+		 lookup_identifier );
 
-			goto on_error;
-		}
-		if( result != 0 )
-		{
-			return( 0 );
-		}
+		goto on_error;
 	}
-	result = libpff_recover_check_descriptors_index_for_recovered_value(
-		  descriptors_index,
-		  descriptors_index_value,
-		  error );
+	if( libpff_index_value_free(
+	     &lookup_index_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free lookup index value.",
+		 function,
+		 lookup_identifier );
 
-	if( result == -1 )
+		goto on_error;
+	}
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libpff_index_values_list_number_of_values(
+	     index_values_list,
+	     &number_of_index_values,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if deleted descriptors index value: %" PRIu64 " was previously recovered.",
+		 "%s: unable to retrieve number of recovered offsets index value: %" PRIu64 " list.",
 		 function,
-		 descriptors_index_value->identifier );
+		 lookup_identifier );
 
 		goto on_error;
 	}
-	else if( result != 0 )
+/* TODO handle if more than 1 offsets index value is recoverable */
+
+	result = 0;
+
+	for( index_value_iterator = 0;
+	     index_value_iterator < number_of_index_values;
+	     index_value_iterator++ )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( libpff_index_values_list_get_value_by_index(
+		     index_values_list,
+		     index_value_iterator,
+		     &index_value,
+		     error ) != 1 )
 		{
-			libcnotify_printf(
-			 "%s: deleted descriptors index value: %" PRIu64 " matches previous recovered index value.\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve recovered offsets index value: %d for data identifier: %" PRIu64 ".",
 			 function,
-			 descriptors_index_value->identifier );
+			 index_value_iterator,
+			 lookup_identifier );
+
+			goto on_error;
+		}
+		/* Check if local descriptors are recoverable
+		 */
+		result = libpff_recover_analyze_local_descriptors(
+		          io_handle,
+		          file_io_handle,
+		          offsets_index,
+		          descriptors_index_value->local_descriptors_identifier,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to recover local descriptors: %" PRIu64 ".",
+			 function,
+			 descriptors_index_value->local_descriptors_identifier );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			break;
 		}
-#endif
-		return( 0 );
 	}
-	return( 1 );
+	if( result != 0 )
+	{
+		*local_descriptors_identifier_value_index = index_value_iterator;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	else if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: recovered offsets index value for local descriptors identifier: %" PRIu64 " not available.\n",
+		 function,
+		 lookup_identifier );
+	}
+#endif
+	return( result );
 
 on_error:
-	if( existing_index_value != NULL )
+	if( lookup_index_value != NULL )
 	{
 		libpff_index_value_free(
-		 &existing_index_value,
+		 &lookup_index_value,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Checks if the specific descriptors index contains a specific recovered index value
- * Returns 1 if exists, 0 if not or -1 on error
+/* Analyze if a specific data block back pointer is recoverable
+ * Returns 1 if recoverable, 0 if not or -1 on error
  */
-int libpff_recover_check_descriptors_index_for_recovered_value(
-     libpff_descriptors_index_t *descriptors_index,
-     libpff_index_value_t *descriptors_index_value,
+int libpff_recover_analyze_data_block_back_pointer(
+     libpff_offsets_index_t *offsets_index,
+     uint64_t data_block_back_pointer,
+     off64_t data_block_data_offset,
+     size32_t data_block_data_size,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *upper_node              = NULL;
-	libpff_index_value_t *index_value             = NULL;
-	libpff_index_values_list_t *index_values_list = NULL;
-	static char *function                         = "libpff_recover_check_descriptors_index_for_recovered_value";
-	int index_value_iterator                      = 0;
-	int number_of_index_values                    = 0;
-	int result                                    = 0;
+	libpff_index_value_t lookup_index_value;
 
-	if( descriptors_index == NULL )
+	static char *function = "libpff_recover_analyze_data_block_back_pointer";
+	int result            = 0;
+
+	if( offsets_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid descriptors index.",
+		 "%s: invalid offsets index.",
 		 function );
 
 		return( -1 );
 	}
-	if( descriptors_index_value == NULL )
+	if( memory_set(
+	     &lookup_index_value,
+	     0,
+	     sizeof( libpff_index_value_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid descriptors index value.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup index value.",
 		 function );
 
 		return( -1 );
 	}
-	result = libcdata_btree_get_value_by_value(
-		  descriptors_index->recovered_index_values_tree,
-		  (intptr_t *) descriptors_index_value,
-		  (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libpff_index_values_list_compare,
-		  &upper_node,
-		  (intptr_t **) &index_values_list,
-		  error );
+	lookup_index_value.identifier  = data_block_back_pointer;
+	lookup_index_value.file_offset = data_block_data_offset;
+	lookup_index_value.data_size   = data_block_data_size;
+
+/* TODO handle if more than 1 offsets index value is recoverable */
+	result = libpff_index_value_set_contains_value(
+	          offsets_index->recovered_index_value_set,
+	          &lookup_index_value,
+	          error );
 
 	if( result == -1 )
 	{
@@ -1343,74 +1670,352 @@ int libpff_recover_check_descriptors_index_for_recovered_value(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve recovered descriptors index value: %" PRIu64 " list.",
+		 "%s: unable to determine if recovered offsets index value: %" PRIu64 " exists.",
 		 function,
-		 descriptors_index_value->identifier );
+		 data_block_back_pointer );
 
 		return( -1 );
 	}
+#if defined( HAVE_DEBUG_OUTPUT )
 	else if( result != 0 )
 	{
-		if( libpff_index_values_list_number_of_values(
-		     index_values_list,
-		     &number_of_index_values,
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: recovered data block with identifier: %" PRIu64 " matches existing recovered item value.\n",
+			 function,
+			 data_block_back_pointer );
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the allocated index value that corresponds with a specific deleted index value
+ * The index is only read if the allocated index values filter indicates the index value
+ * can match an allocated index value
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libpff_recover_get_allocated_index_value(
+     libpff_index_t *index,
+     libpff_bloom_filter_t *allocated_index_values_filter,
+     libpff_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libpff_index_value_t *index_value,
+     libpff_index_value_t **allocated_index_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recover_get_allocated_index_value";
+	uint64_t hash         = 0;
+	uint64_t identifier   = 0;
+	uint64_t key_value1   = 0;
+	uint64_t key_value2   = 0;
+	int result            = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index value.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_index_values_filter != NULL )
+	{
+		if( libpff_index_value_set_get_key(
+		     index->type,
+		     index_value,
+		     &identifier,
+		     &key_value1,
+		     &key_value2,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of recovered descriptors index values for identifier: %" PRIu64 ".",
+			 "%s: unable to retrieve index value: %" PRIu64 " key.",
 			 function,
-			 descriptors_index_value->identifier );
+			 index_value->identifier );
 
 			return( -1 );
 		}
-		result = 0;
+		hash = libpff_index_value_set_calculate_hash(
+		        identifier,
+		        key_value1,
+		        key_value2 );
+
+		result = libpff_bloom_filter_contains_hash(
+		          allocated_index_values_filter,
+		          hash,
+		          error );
 
-		for( index_value_iterator = 0;
-		     index_value_iterator < number_of_index_values;
-		     index_value_iterator++ )
+		if( result == -1 )
 		{
-			if( libpff_index_values_list_get_value_by_index(
-			     index_values_list,
-			     index_value_iterator,
-			     &index_value,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve recovered descriptors index value: %" PRIu64 " list element: %d.",
-				 function,
-				 descriptors_index_value->identifier,
-				 index_value_iterator );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if index value: %" PRIu64 " is in allocated index values filter.",
+			 function,
+			 index_value->identifier );
 
-				return( -1 );
-			}
-			if( index_value == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing recovered descriptors index value: %" PRIu64 " list element: %d.",
-				 function,
-				 descriptors_index_value->identifier,
-				 index_value_iterator );
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	result = libpff_index_get_value_by_identifier(
+	          index,
+	          io_handle,
+	          file_io_handle,
+	          index_value->identifier,
+	          allocated_index_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index value: %" PRIu64 " from index.",
+		 function,
+		 index_value->identifier );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Analyze if a specific descriptors index value is recoverable
+ * Returns 1 if recoverable, 0 if not or -1 on error
+ */
+int libpff_recover_analyze_descriptors_index_value(
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libpff_index_value_t *descriptors_index_value,
+     libcerror_error_t **error )
+{
+	libpff_index_value_t *existing_index_value = NULL;
+	static char *function                      = "libpff_recover_analyze_descriptors_index_value";
+	int result                                 = 0;
+
+	if( descriptors_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptors index.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptors_index_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptors index value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: analyzing identifier: %" PRIu64 ", data: %" PRIu64 ", local descriptors: %" PRIu64 ", parent: %" PRIu32 "\n",
+		 function,
+		 descriptors_index_value->identifier,
+		 descriptors_index_value->data_identifier,
+		 descriptors_index_value->local_descriptors_identifier,
+		 descriptors_index_value->parent_identifier );
+	}
+#endif
+	/* Check if the descriptors index value matches an existing index value
+	 */
+	result = libpff_recover_get_allocated_index_value(
+		  descriptors_index->index,
+		  descriptors_index->allocated_index_values_filter,
+		  io_handle,
+		  file_io_handle,
+		  descriptors_index_value,
+		  &existing_index_value,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve descriptors index value: %" PRIu64 " from index.",
+		 function,
+		 descriptors_index_value->identifier );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( existing_index_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing descriptors index value for identifier: %" PRIu64 ".",
+			 function,
+			 descriptors_index_value->identifier );
+
+			goto on_error;
+		}
+		result = 0;
 
-				return( -1 );
-			}
 /* TODO what about parent changes ? */
-			if( ( descriptors_index_value->data_identifier == index_value->data_identifier )
-			 && ( descriptors_index_value->local_descriptors_identifier == index_value->local_descriptors_identifier ) )
+		if( ( descriptors_index_value->data_identifier == existing_index_value->data_identifier )
+		 && ( descriptors_index_value->local_descriptors_identifier == existing_index_value->local_descriptors_identifier ) )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
 			{
-				result = 1;
-
-				break;
+				libcnotify_printf(
+				 "%s: deleted descriptors index value: %" PRIu64 " matches existing item value.\n",
+				 function,
+				 descriptors_index_value->identifier );
 			}
+#endif
+			result = 1;
+		}
+		if( libpff_index_value_free(
+		     &existing_index_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index value: %d.",
+			 function,
+			 descriptors_index_value->identifier );
+
+			goto on_error;
+		}
+		if( result != 0 )
+		{
+			return( 0 );
+		}
+	}
+	result = libpff_recover_check_descriptors_index_for_recovered_value(
+		  descriptors_index,
+		  descriptors_index_value,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if deleted descriptors index value: %" PRIu64 " was previously recovered.",
+		 function,
+		 descriptors_index_value->identifier );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: deleted descriptors index value: %" PRIu64 " matches previous recovered index value.\n",
+			 function,
+			 descriptors_index_value->identifier );
 		}
+#endif
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( existing_index_value != NULL )
+	{
+		libpff_index_value_free(
+		 &existing_index_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Checks if the specific descriptors index contains a specific recovered index value
+ * Returns 1 if exists, 0 if not or -1 on error
+ */
+int libpff_recover_check_descriptors_index_for_recovered_value(
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_index_value_t *descriptors_index_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recover_check_descriptors_index_for_recovered_value";
+	int result            = 0;
+
+	if( descriptors_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptors index.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptors_index_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptors index value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libpff_index_value_set_contains_value(
+	          descriptors_index->recovered_index_value_set,
+	          descriptors_index_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if recovered descriptors index value: %" PRIu64 " exists.",
+		 function,
+		 descriptors_index_value->identifier );
+
+		return( -1 );
 	}
 	return( result );
 }
@@ -1863,11 +2468,12 @@ int libpff_recover_analyze_offsets_index_value(
 	}
 	/* Check if the offsets index value matches an existing index value
 	 */
-	result = libpff_index_get_value_by_identifier(
+	result = libpff_recover_get_allocated_index_value(
 		  offsets_index->index,
+		  offsets_index->allocated_index_values_filter,
 		  io_handle,
 		  file_io_handle,
-		  offsets_index_value->identifier,
+		  offsets_index_value,
 		  &existing_index_value,
 		  error );
 
@@ -1984,13 +2590,8 @@ int libpff_recover_check_offsets_index_for_recovered_value(
      libpff_index_value_t *offsets_index_value,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *upper_node              = NULL;
-	libpff_index_value_t *index_value             = NULL;
-	libpff_index_values_list_t *index_values_list = NULL;
-	static char *function                         = "libpff_recover_check_offsets_index_for_recovered_value";
-	int index_value_iterator                      = 0;
-	int number_of_index_values                    = 0;
-	int result                                    = 0;
+	static char *function = "libpff_recover_check_offsets_index_for_recovered_value";
+	int result            = 0;
 
 	if( offsets_index == NULL )
 	{
@@ -2014,13 +2615,10 @@ int libpff_recover_check_offsets_index_for_recovered_value(
 
 		return( -1 );
 	}
-	result = libcdata_btree_get_value_by_value(
-		  offsets_index->recovered_index_values_tree,
-		  (intptr_t *) offsets_index_value,
-		  (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libpff_index_values_list_compare,
-		  &upper_node,
-		  (intptr_t **) &index_values_list,
-		  error );
+	result = libpff_index_value_set_contains_value(
+	          offsets_index->recovered_index_value_set,
+	          offsets_index_value,
+	          error );
 
 	if( result == -1 )
 	{
@@ -2028,74 +2626,12 @@ int libpff_recover_check_offsets_index_for_recovered_value(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve recovered offsets index value: %" PRIu64 " list.",
+		 "%s: unable to determine if recovered offsets index value: %" PRIu64 " exists.",
 		 function,
 		 offsets_index_value->identifier );
 
 		return( -1 );
 	}
-	else if( result != 0 )
-	{
-		if( libpff_index_values_list_number_of_values(
-		     index_values_list,
-		     &number_of_index_values,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of recovered offsets index values for identifier: %" PRIu64 ".",
-			 function,
-			 offsets_index_value->identifier );
-
-			return( -1 );
-		}
-		result = 0;
-
-		for( index_value_iterator = 0;
-		     index_value_iterator < number_of_index_values;
-		     index_value_iterator++ )
-		{
-			if( libpff_index_values_list_get_value_by_index(
-			     index_values_list,
-			     index_value_iterator,
-			     &index_value,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve recovered offsets index value: %" PRIu64 " list element: %d.",
-				 function,
-				 offsets_index_value->identifier,
-				 index_value_iterator );
-
-				return( -1 );
-			}
-			if( index_value == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing recovered offsets index value: %" PRIu64 " list element: %d.",
-				 function,
-				 offsets_index_value->identifier,
-				 index_value_iterator );
-
-				return( -1 );
-			}
-			if( ( offsets_index_value->file_offset == index_value->file_offset )
-			 && ( offsets_index_value->data_size == index_value->data_size ) )
-			{
-				result = 1;
-
-				break;
-			}
-		}
-	}
 	return( result );
 }
 
@@ -2431,42 +2967,1562 @@ int libpff_recover_analyze_offsets_index_node(
 				 sub_node_offset,
 				 sub_node_offset );
 
-				goto on_error;
+				goto on_error;
+			}
+		}
+	}
+	if( libpff_index_node_free(
+	     &index_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index node.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_value != NULL )
+	{
+		libpff_index_value_free(
+		 &index_value,
+		 NULL );
+	}
+	if( index_node != NULL )
+	{
+		libpff_index_node_free(
+		 &index_node,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( LIBPFF_RECOVER_HAVE_SIMD_FOOTER_FILTER )
+
+/* Determines if the CPU supports the SSE2 instructions
+ * Returns 1 if supported or 0 if not
+ */
+int libpff_recover_have_sse2(
+     void )
+{
+	if( __builtin_cpu_supports( "sse2" ) != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Filters the 64-bit data block footers of consecutive blocks using SSE2
+ * The footers of 2 blocks are tested per iteration
+ * Returns the footer mask of the blocks that were tested
+ */
+__attribute__((target("sse2"))) \
+uint64_t libpff_recover_filter_data_block_footers_sse2(
+          const uint8_t *data,
+          size_t number_of_blocks,
+          size_t format_data_block_size,
+          size_t footer_offset,
+          uint16_t data_size_mask,
+          size_t *number_of_tested_blocks )
+{
+	__m128i data_size_masks = _mm_setr_epi16( (short) data_size_mask, 0, 0, 0, (short) data_size_mask, 0, 0, 0 );
+	__m128i zero            = _mm_setzero_si128();
+	__m128i back_pointers   = _mm_setzero_si128();
+	__m128i footer1         = _mm_setzero_si128();
+	__m128i footer2         = _mm_setzero_si128();
+	__m128i data_sizes      = _mm_setzero_si128();
+	uint64_t footer_mask    = 0;
+	size_t block_index      = 0;
+	int back_pointer_bits   = 0;
+	int data_size_bits      = 0;
+
+	while( ( block_index + 2 ) <= number_of_blocks )
+	{
+		/* The first 16 bytes of the footer contain: data size, signature, checksum and back pointer
+		 */
+		footer1 = _mm_loadu_si128( (const __m128i *) &( data[ ( block_index * format_data_block_size ) + footer_offset ] ) );
+		footer2 = _mm_loadu_si128( (const __m128i *) &( data[ ( ( block_index + 1 ) * format_data_block_size ) + footer_offset ] ) );
+
+		back_pointers = _mm_unpackhi_epi64( footer1, footer2 );
+		data_sizes    = _mm_unpacklo_epi64( footer1, footer2 );
+
+		/* Bit 0 and 2 are set if the lower 32-bit of a back pointer are 0
+		 * Bit 1 and 3 are set if the upper 32-bit of a back pointer are 0
+		 */
+		back_pointer_bits = _mm_movemask_ps(
+		                     _mm_castsi128_ps(
+		                      _mm_cmpeq_epi32( back_pointers, zero ) ) );
+
+		/* Bit 0 and 8 are set if the data size is smaller than the maximum data block size
+		 */
+		data_size_bits = _mm_movemask_epi8(
+		                  _mm_cmpeq_epi16(
+		                   _mm_and_si128( data_sizes, data_size_masks ),
+		                   zero ) );
+
+		if( ( ( back_pointer_bits & 0x03 ) == 0x02 )
+		 && ( ( data_size_bits & 0x0001 ) != 0 ) )
+		{
+			footer_mask |= (uint64_t) 1 << block_index;
+		}
+		if( ( ( back_pointer_bits & 0x0c ) == 0x08 )
+		 && ( ( data_size_bits & 0x0100 ) != 0 ) )
+		{
+			footer_mask |= (uint64_t) 1 << ( block_index + 1 );
+		}
+		block_index += 2;
+	}
+	*number_of_tested_blocks = block_index;
+
+	return( footer_mask );
+}
+
+#endif /* defined( LIBPFF_RECOVER_HAVE_SIMD_FOOTER_FILTER ) */
+
+/* Filters the data block footers of consecutive blocks without SIMD instructions
+ * The blocks before the first block index are not tested
+ * Returns the footer mask of the blocks that were tested
+ */
+uint64_t libpff_recover_filter_data_block_footers_scalar(
+          const uint8_t *data,
+          size_t first_block_index,
+          size_t number_of_blocks,
+          size_t format_data_block_size,
+          size_t footer_offset,
+          uint8_t file_type,
+          uint32_t maximum_data_block_size )
+{
+	const uint8_t *data_block_footer = NULL;
+	size_t block_index               = 0;
+	uint64_t data_block_back_pointer = 0;
+	uint64_t footer_mask             = 0;
+	uint16_t data_block_data_size    = 0;
+
+	for( block_index = first_block_index;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		data_block_footer = &( data[ ( block_index * format_data_block_size ) + footer_offset ] );
+
+		if( file_type == LIBPFF_FILE_TYPE_32BIT )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 ( (pff_block_footer_32bit_t *) data_block_footer )->data_size,
+			 data_block_data_size );
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (pff_block_footer_32bit_t *) data_block_footer )->back_pointer,
+			 data_block_back_pointer );
+		}
+		else
+		{
+			/* The 64-bit 4k page footer starts with the same values as the 64-bit footer
+			 */
+			byte_stream_copy_to_uint16_little_endian(
+			 ( (pff_block_footer_64bit_t *) data_block_footer )->data_size,
+			 data_block_data_size );
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (pff_block_footer_64bit_t *) data_block_footer )->back_pointer,
+			 data_block_back_pointer );
+		}
+		if( ( data_block_back_pointer != 0 )
+		 && ( ( data_block_back_pointer >> 32 ) == 0 )
+		 && ( (uint32_t) data_block_data_size < maximum_data_block_size ) )
+		{
+			footer_mask |= (uint64_t) 1 << block_index;
+		}
+	}
+	return( footer_mask );
+}
+
+/* Filters the data block footers of consecutive blocks
+ * A bit is set in the footer mask for every block of which the footer has a plausible
+ * data size and a back pointer that is not empty but of which the upper 32-bit are,
+ * only these footers need to be read by the recovery scan
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_filter_data_block_footers(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t file_type,
+     uint64_t *footer_mask,
+     libcerror_error_t **error )
+{
+	static char *function            = "libpff_recover_filter_data_block_footers";
+	size_t block_index               = 0;
+	size_t footer_offset             = 0;
+	size_t format_data_block_size    = 0;
+	size_t number_of_blocks          = 0;
+	uint64_t safe_footer_mask        = 0;
+	uint32_t maximum_data_block_size = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_type != LIBPFF_FILE_TYPE_32BIT )
+	 && ( file_type != LIBPFF_FILE_TYPE_64BIT )
+	 && ( file_type != LIBPFF_FILE_TYPE_64BIT_4K_PAGE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( footer_mask == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid footer mask.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type == LIBPFF_FILE_TYPE_32BIT )
+	{
+		format_data_block_size  = 64;
+		footer_offset           = 64 - sizeof( pff_block_footer_32bit_t );
+		maximum_data_block_size = 8192;
+	}
+	else if( file_type == LIBPFF_FILE_TYPE_64BIT )
+	{
+		format_data_block_size  = 64;
+		footer_offset           = 64 - sizeof( pff_block_footer_64bit_t );
+		maximum_data_block_size = 8192;
+	}
+	else
+	{
+		format_data_block_size  = 512;
+		footer_offset           = 512 - sizeof( pff_block_footer_64bit_4k_page_t );
+		maximum_data_block_size = 65536;
+	}
+	number_of_blocks = data_size / format_data_block_size;
+
+	if( number_of_blocks > 64 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBPFF_RECOVER_HAVE_SIMD_FOOTER_FILTER )
+	if( ( file_type != LIBPFF_FILE_TYPE_32BIT )
+	 && ( number_of_blocks >= 2 )
+	 && ( libpff_recover_have_sse2() != 0 ) )
+	{
+		safe_footer_mask = libpff_recover_filter_data_block_footers_sse2(
+		                    data,
+		                    number_of_blocks,
+		                    format_data_block_size,
+		                    footer_offset,
+		                    (uint16_t) ~( maximum_data_block_size - 1 ),
+		                    &block_index );
+	}
+#endif
+	/* The remaining blocks are tested without SIMD instructions
+	 */
+	safe_footer_mask |= libpff_recover_filter_data_block_footers_scalar(
+	                     data,
+	                     block_index,
+	                     number_of_blocks,
+	                     format_data_block_size,
+	                     footer_offset,
+	                     file_type,
+	                     maximum_data_block_size );
+
+	*footer_mask = safe_footer_mask;
+
+	return( 1 );
+}
+
+/* Appends a candidate to a recovery scan job
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_scan_job_append_candidate(
+     libpff_recover_scan_job_t *scan_job,
+     libpff_recover_scan_candidate_t **candidate,
+     libcerror_error_t **error )
+{
+	libpff_recover_scan_candidate_t *candidates = NULL;
+	static char *function                       = "libpff_recover_scan_job_append_candidate";
+	size_t candidates_size                      = 0;
+	int number_of_allocated_candidates          = 0;
+
+	if( scan_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan job.",
+		 function );
+
+		return( -1 );
+	}
+	if( candidate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid candidate.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_job->number_of_candidates >= scan_job->number_of_allocated_candidates )
+	{
+		if( scan_job->number_of_allocated_candidates == 0 )
+		{
+			number_of_allocated_candidates = 64;
+		}
+		else if( scan_job->number_of_allocated_candidates < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_candidates = scan_job->number_of_allocated_candidates * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid scan job - number of allocated candidates value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		candidates_size = sizeof( libpff_recover_scan_candidate_t ) * number_of_allocated_candidates;
+
+		if( candidates_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid candidates size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		candidates = (libpff_recover_scan_candidate_t *) memory_reallocate(
+		                                                  scan_job->candidates,
+		                                                  candidates_size );
+
+		if( candidates == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize candidates.",
+			 function );
+
+			return( -1 );
+		}
+		scan_job->candidates                     = candidates;
+		scan_job->number_of_allocated_candidates = number_of_allocated_candidates;
+	}
+	*candidate = &( scan_job->candidates[ scan_job->number_of_candidates ] );
+
+	if( memory_set(
+	     *candidate,
+	     0,
+	     sizeof( libpff_recover_scan_candidate_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear candidate.",
+		 function );
+
+		*candidate = NULL;
+
+		return( -1 );
+	}
+	scan_job->number_of_candidates += 1;
+
+	return( 1 );
+}
+
+/* Scans the chunk of a recovery scan job for index nodes and data block footers
+ * The scan only reads the data in the buffer of the scan job and does not
+ * change the indexes, hence the chunks of a scan range can be scanned in parallel
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_scan_job_scan(
+     libpff_recover_scan_job_t *scan_job,
+     libcerror_error_t **error )
+{
+	libpff_index_node_t index_node;
+
+	libpff_recover_scan_candidate_t *candidate = NULL;
+	uint8_t *data_block_footer                 = NULL;
+	static char *function                      = "libpff_recover_scan_job_scan";
+	off64_t data_block_data_offset             = 0;
+	off64_t footer_mask_offset                 = 0;
+	off64_t scan_offset                        = 0;
+	size_t buffer_offset                       = 0;
+	size_t footer_mask_data_size               = 0;
+	uint64_t data_block_back_pointer           = 0;
+	uint64_t footer_mask                       = 0;
+	uint32_t data_block_calculated_checksum    = 0;
+	uint32_t data_block_stored_checksum        = 0;
+	uint32_t maximum_data_block_size           = 0;
+	uint16_t data_block_data_size              = 0;
+	uint16_t format_data_block_size            = 0;
+	uint16_t format_page_block_size            = 0;
+	uint16_t scan_block_size                   = 0;
+	int result                                 = 0;
+
+	if( scan_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan job.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_job->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan job - missing buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_job->file_type != LIBPFF_FILE_TYPE_32BIT )
+	 && ( scan_job->file_type != LIBPFF_FILE_TYPE_64BIT )
+	 && ( scan_job->file_type != LIBPFF_FILE_TYPE_64BIT_4K_PAGE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid scan job - unsupported file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_job->range_offset < 0 )
+	 || ( scan_job->chunk_offset < scan_job->range_offset )
+	 || ( scan_job->chunk_offset < scan_job->buffer_offset )
+	 || ( scan_job->chunk_end_offset < scan_job->chunk_offset )
+	 || ( scan_job->chunk_end_offset > scan_job->range_end_offset )
+	 || ( scan_job->chunk_end_offset > ( scan_job->buffer_offset + (off64_t) scan_job->buffer_data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan job - chunk value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_job->file_type == LIBPFF_FILE_TYPE_32BIT )
+	 || ( scan_job->file_type == LIBPFF_FILE_TYPE_64BIT ) )
+	{
+		format_data_block_size  = 64;
+		format_page_block_size  = 512;
+		maximum_data_block_size = 8192;
+	}
+	else
+	{
+		format_data_block_size  = 512;
+		format_page_block_size  = 4096;
+/* TODO: this value is currently assumed based on the 512 x 8 = 4k page */
+		maximum_data_block_size = 65536;
+	}
+	if( ( scan_job->recovery_flags & LIBPFF_RECOVERY_FLAG_SCAN_FOR_FRAGMENTS ) == 0 )
+	{
+		scan_block_size = format_page_block_size;
+	}
+	else
+	{
+		scan_block_size = format_data_block_size;
+	}
+	scan_job->number_of_candidates = 0;
+
+	scan_offset           = scan_job->chunk_offset;
+	footer_mask_offset    = scan_offset;
+	footer_mask_data_size = 0;
+
+	while( ( scan_offset + scan_block_size ) <= scan_job->chunk_end_offset )
+	{
+		buffer_offset = (size_t) ( scan_offset - scan_job->buffer_offset );
+
+		/* The index nodes have a fixed block size and stored block size aligned
+		 */
+		if( ( ( scan_offset % format_page_block_size ) == 0 )
+		 && ( ( scan_job->range_end_offset - scan_offset ) >= (off64_t) format_page_block_size ) )
+		{
+			if( memory_set(
+			     &index_node,
+			     0,
+			     sizeof( libpff_index_node_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear index node.",
+				 function );
+
+				return( -1 );
+			}
+			/* Most blocks do not contain an index node, hence the index node is read
+			 * without constructing an error
+			 */
+			result = libpff_index_node_try_read_data(
+			          &index_node,
+			          &( scan_job->buffer[ buffer_offset ] ),
+			          (size_t) format_page_block_size,
+			          scan_job->file_type );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read index node at offset: %" PRIi64 ".",
+				 function,
+				 scan_offset );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				if( libpff_recover_scan_job_append_candidate(
+				     scan_job,
+				     &candidate,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append index node candidate at offset: %" PRIi64 ".",
+					 function,
+					 scan_offset );
+
+					return( -1 );
+				}
+				candidate->type   = LIBPFF_RECOVER_SCAN_CANDIDATE_TYPE_INDEX_NODE;
+				candidate->offset = scan_offset;
+
+				scan_offset += format_page_block_size;
+
+				continue;
+			}
+		}
+		if( ( scan_job->recovery_flags & LIBPFF_RECOVERY_FLAG_SCAN_FOR_FRAGMENTS ) == 0 )
+		{
+			scan_offset += scan_block_size;
+
+			continue;
+		}
+		/* Most blocks do not contain a data block footer, hence the footers of up to 64 blocks
+		 * are filtered at once and only the footers that pass the filter are read
+		 */
+		if( ( scan_offset - footer_mask_offset ) >= (off64_t) footer_mask_data_size )
+		{
+			footer_mask_offset    = scan_offset;
+			footer_mask_data_size = (size_t) ( scan_job->chunk_end_offset - scan_offset );
+
+			if( footer_mask_data_size > ( (size_t) format_data_block_size * 64 ) )
+			{
+				footer_mask_data_size = (size_t) format_data_block_size * 64;
+			}
+			if( libpff_recover_filter_data_block_footers(
+			     &( scan_job->buffer[ buffer_offset ] ),
+			     footer_mask_data_size,
+			     scan_job->file_type,
+			     &footer_mask,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to filter data block footers at offset: %" PRIi64 ".",
+				 function,
+				 scan_offset );
+
+				return( -1 );
+			}
+		}
+		if( ( footer_mask & ( (uint64_t) 1 << ( ( scan_offset - footer_mask_offset ) / format_data_block_size ) ) ) == 0 )
+		{
+			scan_offset += scan_block_size;
+
+			continue;
+		}
+		/* Scan the block for a data block footer
+		 */
+		data_block_footer = &( scan_job->buffer[ buffer_offset ] );
+
+		if( scan_job->file_type == LIBPFF_FILE_TYPE_32BIT )
+		{
+			data_block_footer += format_data_block_size - sizeof( pff_block_footer_32bit_t );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 ( (pff_block_footer_32bit_t *) data_block_footer )->data_size,
+			 data_block_data_size );
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (pff_block_footer_32bit_t *) data_block_footer )->back_pointer,
+			 data_block_back_pointer );
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (pff_block_footer_32bit_t *) data_block_footer )->checksum,
+			 data_block_stored_checksum );
+		}
+		else if( scan_job->file_type == LIBPFF_FILE_TYPE_64BIT )
+		{
+			data_block_footer += format_data_block_size - sizeof( pff_block_footer_64bit_t );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 ( (pff_block_footer_64bit_t *) data_block_footer )->data_size,
+			 data_block_data_size );
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (pff_block_footer_64bit_t *) data_block_footer )->checksum,
+			 data_block_stored_checksum );
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (pff_block_footer_64bit_t *) data_block_footer )->back_pointer,
+			 data_block_back_pointer );
+		}
+		else if( scan_job->file_type == LIBPFF_FILE_TYPE_64BIT_4K_PAGE )
+		{
+			data_block_footer += format_data_block_size - sizeof( pff_block_footer_64bit_4k_page_t );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 ( (pff_block_footer_64bit_4k_page_t *) data_block_footer )->data_size,
+			 data_block_data_size );
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (pff_block_footer_64bit_4k_page_t *) data_block_footer )->checksum,
+			 data_block_stored_checksum );
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (pff_block_footer_64bit_4k_page_t *) data_block_footer )->back_pointer,
+			 data_block_back_pointer );
+		}
+		/* Check if back pointer itself is not empty but the upper 32-bit are
+		 */
+		if( ( data_block_back_pointer != 0 )
+		 && ( ( data_block_back_pointer >> 32 ) == 0 )
+		 && ( (uint32_t) data_block_data_size < maximum_data_block_size ) )
+		{
+			data_block_data_offset = scan_offset - ( ( data_block_data_size / format_data_block_size ) * format_data_block_size );
+
+			/* The buffer contains the maximum data block size of data of the scan range
+			 * that precedes the chunk
+			 */
+			if( ( data_block_data_offset >= scan_job->range_offset )
+			 && ( data_block_data_offset >= scan_job->buffer_offset ) )
+			{
+				data_block_calculated_checksum = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				/* The calculated checksum is only used to report a checksum mismatch
+				 */
+				if( ( libcnotify_verbose != 0 )
+				 && ( data_block_stored_checksum != 0 ) )
+				{
+					if( libpff_checksum_calculate_weak_crc32(
+					     &data_block_calculated_checksum,
+					     &( scan_job->buffer[ data_block_data_offset - scan_job->buffer_offset ] ),
+					     (size_t) data_block_data_size,
+					     0,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+						 "%s: unable to calculate weak CRC-32.",
+						 function );
+
+						return( -1 );
+					}
+				}
+#endif
+				if( libpff_recover_scan_job_append_candidate(
+				     scan_job,
+				     &candidate,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append data block candidate at offset: %" PRIi64 ".",
+					 function,
+					 scan_offset );
+
+					return( -1 );
+				}
+				candidate->type                           = LIBPFF_RECOVER_SCAN_CANDIDATE_TYPE_DATA_BLOCK;
+				candidate->offset                         = scan_offset;
+				candidate->data_block_back_pointer        = data_block_back_pointer;
+				candidate->data_block_data_offset         = data_block_data_offset;
+				candidate->data_block_data_size           = data_block_data_size;
+				candidate->data_block_stored_checksum     = data_block_stored_checksum;
+				candidate->data_block_calculated_checksum = data_block_calculated_checksum;
+			}
+		}
+		scan_offset += scan_block_size;
+	}
+	return( 1 );
+}
+
+/* Creates a recovery scan thread pool
+ * Make sure the value scan_thread_pool is referencing, is set to NULL
+ * The thread pool is only created if multi-thread support is available,
+ * otherwise the scan jobs are scanned by the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_scan_thread_pool_initialize(
+     libpff_recover_scan_thread_pool_t **scan_thread_pool,
+     int number_of_threads,
+     int maximum_number_of_scan_jobs,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recover_scan_thread_pool_initialize";
+
+	if( scan_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan thread pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBPFF_MAXIMUM_NUMBER_OF_RECOVER_SCAN_JOBS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_scan_jobs <= 0 )
+	 || ( maximum_number_of_scan_jobs > ( 2 * LIBPFF_MAXIMUM_NUMBER_OF_RECOVER_SCAN_JOBS ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of scan jobs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_thread_pool = memory_allocate_structure(
+	                     libpff_recover_scan_thread_pool_t );
+
+	if( *scan_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scan_thread_pool,
+	     0,
+	     sizeof( libpff_recover_scan_thread_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan thread pool.",
+		 function );
+
+		memory_free(
+		 *scan_thread_pool );
+
+		*scan_thread_pool = NULL;
+
+		return( -1 );
+	}
+	( *scan_thread_pool )->number_of_threads = number_of_threads;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *scan_thread_pool )->scan_jobs_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan jobs mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *scan_thread_pool )->scan_jobs_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan jobs condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( ( *scan_thread_pool )->thread_pool ),
+	     NULL,
+	     number_of_threads,
+	     maximum_number_of_scan_jobs,
+	     (int (*)(intptr_t *, void *)) &libpff_recover_scan_job_callback,
+	     (void *) *scan_thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+
+on_error:
+	if( *scan_thread_pool != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *scan_thread_pool )->scan_jobs_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( ( *scan_thread_pool )->scan_jobs_condition ),
+			 NULL );
+		}
+		if( ( *scan_thread_pool )->scan_jobs_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *scan_thread_pool )->scan_jobs_mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *scan_thread_pool );
+
+		*scan_thread_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a recovery scan thread pool
+ * The scan jobs that were started must have been waited for
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_scan_thread_pool_free(
+     libpff_recover_scan_thread_pool_t **scan_thread_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recover_scan_thread_pool_free";
+	int result            = 1;
+
+	if( scan_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_thread_pool != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *scan_thread_pool )->thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *scan_thread_pool )->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_condition_free(
+		     &( ( *scan_thread_pool )->scan_jobs_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scan jobs condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *scan_thread_pool )->scan_jobs_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scan jobs mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+		memory_free(
+		 *scan_thread_pool );
+
+		*scan_thread_pool = NULL;
+	}
+	return( result );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Scans the chunk of a recovery scan job
+ * Callback function for the recovery scan thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_scan_job_callback(
+     libpff_recover_scan_job_t *scan_job,
+     libpff_recover_scan_thread_pool_t *scan_thread_pool )
+{
+	int result = 0;
+
+	if( scan_job == NULL )
+	{
+		return( -1 );
+	}
+	if( scan_thread_pool == NULL )
+	{
+		return( -1 );
+	}
+	/* The result of the scan is stored in the job and
+	 * handled by the thread that waits for the scan job
+	 */
+	result = libpff_recover_scan_job_scan(
+	          scan_job,
+	          &( scan_job->error ) );
+
+	if( libcthreads_mutex_grab(
+	     scan_thread_pool->scan_jobs_mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	scan_job->result     = result;
+	scan_job->is_pending = 0;
+
+	result = libcthreads_condition_broadcast(
+	          scan_thread_pool->scan_jobs_condition,
+	          NULL );
+
+	if( libcthreads_mutex_release(
+	     scan_thread_pool->scan_jobs_mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Starts scanning the chunks of recovery scan jobs
+ * If a scan thread pool is provided the chunks are scanned in parallel by the thread pool
+ * and the function returns without waiting for the scan jobs to finish, otherwise the
+ * chunks are scanned by the calling thread
+ * Use libpff_recover_scan_jobs_wait to wait for the scan jobs and retrieve their result
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_scan_jobs_start(
+     libpff_recover_scan_thread_pool_t *scan_thread_pool,
+     libpff_recover_scan_job_t *scan_jobs,
+     int number_of_scan_jobs,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recover_scan_jobs_start";
+	int scan_job_index    = 0;
+
+	if( scan_jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan jobs.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_scan_jobs < 0 )
+	 || ( number_of_scan_jobs > LIBPFF_MAXIMUM_NUMBER_OF_RECOVER_SCAN_JOBS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of scan jobs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( scan_thread_pool != NULL )
+	 && ( scan_thread_pool->thread_pool != NULL ) )
+	{
+		/* The scan jobs are marked pending before any of them is pushed,
+		 * only the thread pool clears the pending state of a scan job
+		 */
+		for( scan_job_index = 0;
+		     scan_job_index < number_of_scan_jobs;
+		     scan_job_index++ )
+		{
+			scan_jobs[ scan_job_index ].result     = 1;
+			scan_jobs[ scan_job_index ].is_pending = 1;
+		}
+		for( scan_job_index = 0;
+		     scan_job_index < number_of_scan_jobs;
+		     scan_job_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     scan_thread_pool->thread_pool,
+			     (intptr_t *) &( scan_jobs[ scan_job_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to push scan job: %d onto thread pool.",
+				 function,
+				 scan_job_index );
+
+				goto on_error;
+			}
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( scan_job_index = 0;
+	     scan_job_index < number_of_scan_jobs;
+	     scan_job_index++ )
+	{
+		scan_jobs[ scan_job_index ].is_pending = 0;
+		scan_jobs[ scan_job_index ].result     = libpff_recover_scan_job_scan(
+		                                          &( scan_jobs[ scan_job_index ] ),
+		                                          &( scan_jobs[ scan_job_index ].error ) );
+	}
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	/* The scan jobs that were not pushed are not pending
+	 */
+	if( libcthreads_mutex_grab(
+	     scan_thread_pool->scan_jobs_mutex,
+	     NULL ) == 1 )
+	{
+		while( scan_job_index < number_of_scan_jobs )
+		{
+			scan_jobs[ scan_job_index ].result     = -1;
+			scan_jobs[ scan_job_index ].is_pending = 0;
+
+			scan_job_index++;
+		}
+		libcthreads_mutex_release(
+		 scan_thread_pool->scan_jobs_mutex,
+		 NULL );
+	}
+	return( -1 );
+#endif
+}
+
+/* Waits for the recovery scan jobs that were started to finish
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_scan_jobs_wait(
+     libpff_recover_scan_thread_pool_t *scan_thread_pool,
+     libpff_recover_scan_job_t *scan_jobs,
+     int number_of_scan_jobs,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recover_scan_jobs_wait";
+	int scan_job_index    = 0;
+
+	if( scan_jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan jobs.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_scan_jobs < 0 )
+	 || ( number_of_scan_jobs > LIBPFF_MAXIMUM_NUMBER_OF_RECOVER_SCAN_JOBS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of scan jobs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( scan_thread_pool != NULL )
+	 && ( scan_thread_pool->thread_pool != NULL ) )
+	{
+		if( libcthreads_mutex_grab(
+		     scan_thread_pool->scan_jobs_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab scan jobs mutex.",
+			 function );
+
+			return( -1 );
+		}
+		for( scan_job_index = 0;
+		     scan_job_index < number_of_scan_jobs;
+		     scan_job_index++ )
+		{
+			while( scan_jobs[ scan_job_index ].is_pending != 0 )
+			{
+				if( libcthreads_condition_wait(
+				     scan_thread_pool->scan_jobs_condition,
+				     scan_thread_pool->scan_jobs_mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to wait for scan job: %d.",
+					 function,
+					 scan_job_index );
+
+					libcthreads_mutex_release(
+					 scan_thread_pool->scan_jobs_mutex,
+					 NULL );
+
+					return( -1 );
+				}
+			}
+		}
+		if( libcthreads_mutex_release(
+		     scan_thread_pool->scan_jobs_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release scan jobs mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( scan_job_index = 0;
+	     scan_job_index < number_of_scan_jobs;
+	     scan_job_index++ )
+	{
+		if( scan_jobs[ scan_job_index ].result != 1 )
+		{
+			/* Pass on the error of the scan job so that the cause is not lost
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = scan_jobs[ scan_job_index ].error;
+
+				scan_jobs[ scan_job_index ].error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan chunk at offset: %" PRIi64 ".",
+			 function,
+			 scan_jobs[ scan_job_index ].chunk_offset );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	for( scan_job_index = 0;
+	     scan_job_index < number_of_scan_jobs;
+	     scan_job_index++ )
+	{
+		if( scan_jobs[ scan_job_index ].error != NULL )
+		{
+			libcerror_error_free(
+			 &( scan_jobs[ scan_job_index ].error ) );
+		}
+	}
+	return( -1 );
+}
+
+/* Merges the candidates of recovery scan jobs into the recovered indexes
+ * The candidates are merged in order of the scan jobs and their offsets,
+ * hence the recovered index values do not depend on the number of threads
+ * used to scan the chunks
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_merge_scan_candidates(
+     libpff_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_offsets_index_t *offsets_index,
+     libpff_allocation_bitmap_t *unallocated_data_block_bitmap,
+     libpff_recover_scan_job_t *scan_jobs,
+     int number_of_scan_jobs,
+     uint8_t recovery_flags,
+     libcerror_error_t **error )
+{
+	libpff_recover_scan_candidate_t *candidate = NULL;
+	static char *function                      = "libpff_recover_merge_scan_candidates";
+	int candidate_index                        = 0;
+	int result                                 = 0;
+	int scan_job_index                         = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan jobs.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_scan_jobs < 0 )
+	 || ( number_of_scan_jobs > LIBPFF_MAXIMUM_NUMBER_OF_RECOVER_SCAN_JOBS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of scan jobs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( scan_job_index = 0;
+	     scan_job_index < number_of_scan_jobs;
+	     scan_job_index++ )
+	{
+		if( io_handle->abort != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			return( -1 );
+		}
+		for( candidate_index = 0;
+		     candidate_index < scan_jobs[ scan_job_index ].number_of_candidates;
+		     candidate_index++ )
+		{
+			candidate = &( scan_jobs[ scan_job_index ].candidates[ candidate_index ] );
+
+			if( candidate->type == LIBPFF_RECOVER_SCAN_CANDIDATE_TYPE_INDEX_NODE )
+			{
+				/* Scan for index values in the index node
+				 */
+				result = libpff_recover_index_values(
+					  io_handle,
+					  file_io_handle,
+					  descriptors_index,
+					  offsets_index,
+					  unallocated_data_block_bitmap,
+					  (size64_t) candidate->offset,
+					  recovery_flags,
+					  error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: unable to recover index node at offset: %" PRIi64 ".\n",
+					 function,
+					 candidate->offset );
+
+					return( -1 );
+				}
+			}
+			else if( candidate->type == LIBPFF_RECOVER_SCAN_CANDIDATE_TYPE_DATA_BLOCK )
+			{
+				result = libpff_recover_analyze_data_block_back_pointer(
+				          offsets_index,
+				          candidate->data_block_back_pointer,
+				          candidate->data_block_data_offset,
+				          (size32_t) candidate->data_block_data_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to recovere data block: %" PRIu64 ".",
+					 function,
+					 candidate->data_block_back_pointer );
+
+					return( -1 );
+				}
+#if defined( HAVE_DEBUG_OUTPUT )
+				else if( ( result == 0 )
+				      && ( libcnotify_verbose != 0 ) )
+				{
+					if( ( candidate->data_block_stored_checksum != 0 )
+					 && ( candidate->data_block_stored_checksum != candidate->data_block_calculated_checksum ) )
+					{
+						libcnotify_printf(
+						 "%s: mismatch in data block: %" PRIu64 " checksum ( %" PRIu32 " != %" PRIu32 " ).\n",
+						 function,
+						 candidate->data_block_back_pointer,
+						 candidate->data_block_stored_checksum,
+						 candidate->data_block_calculated_checksum );
+					}
+					else
+					{
+/* TODO consider data block as fragment */
+						libcnotify_printf(
+						 "%s: data block back pointer: 0x%08" PRIx64 "\n",
+						 function,
+						 candidate->data_block_back_pointer );
+
+						libcnotify_printf(
+						 "%s: data block data at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIu16 "\n",
+						 function,
+						 candidate->data_block_data_offset,
+						 candidate->data_block_data_offset,
+						 candidate->data_block_data_size );
+					}
+				}
+#endif
 			}
 		}
 	}
-	if( libpff_index_node_free(
-	     &index_node,
+	return( 1 );
+}
+
+/* Completes a batch of recovery scan jobs
+ * Waits for the scan jobs to finish, merges their candidates into the recovered indexes
+ * and updates the checkpoint, if provided, with the last chunk of the batch
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_complete_scan_jobs(
+     libpff_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_offsets_index_t *offsets_index,
+     libpff_allocation_bitmap_t *unallocated_data_block_bitmap,
+     libpff_recover_scan_thread_pool_t *scan_thread_pool,
+     libpff_recover_scan_job_t *scan_jobs,
+     int number_of_scan_jobs,
+     uint8_t recovery_flags,
+     libpff_recover_checkpoint_t *checkpoint,
+     uint64_t chunk_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recover_complete_scan_jobs";
+
+	if( scan_jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan jobs.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_scan_jobs <= 0 )
+	 || ( number_of_scan_jobs > LIBPFF_MAXIMUM_NUMBER_OF_RECOVER_SCAN_JOBS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of scan jobs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_recover_scan_jobs_wait(
+	     scan_thread_pool,
+	     scan_jobs,
+	     number_of_scan_jobs,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free index node.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan chunks.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
-
-on_error:
-	if( index_value != NULL )
+	if( libpff_recover_merge_scan_candidates(
+	     io_handle,
+	     file_io_handle,
+	     descriptors_index,
+	     offsets_index,
+	     unallocated_data_block_bitmap,
+	     scan_jobs,
+	     number_of_scan_jobs,
+	     recovery_flags,
+	     error ) != 1 )
 	{
-		libpff_index_value_free(
-		 &index_value,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to merge scan candidates.",
+		 function );
+
+		return( -1 );
 	}
-	if( index_node != NULL )
+	if( checkpoint != NULL )
 	{
-		libpff_index_node_free(
-		 &index_node,
-		 NULL );
+		if( libpff_recover_checkpoint_update(
+		     checkpoint,
+		     descriptors_index,
+		     offsets_index,
+		     chunk_index,
+		     scan_jobs[ number_of_scan_jobs - 1 ].chunk_end_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update checkpoint.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	return( -1 );
+	return( 1 );
 }
 
 /* Scans for recoverable data blocks
+ * The unallocated data is read sequentially in chunks that are scanned for index nodes and
+ * data block footers by scan jobs. The candidates found by the scan jobs are merged into the
+ * recovered indexes in order of their offset.
+ * If multiple recovery threads are set the chunks are scanned in batches by a thread pool,
+ * while a batch is scanned the next batch is read and the previous batch is merged
+ * If a checkpoint is provided the chunks that were scanned according to the checkpoint are
+ * skipped and the checkpoint is updated after the candidates of the scan jobs are merged
  * Returns 1 if successful or -1 on error
  */
 int libpff_recover_data_blocks(
@@ -2474,41 +4530,47 @@ int libpff_recover_data_blocks(
      libbfio_handle_t *file_io_handle,
      libpff_descriptors_index_t *descriptors_index,
      libpff_offsets_index_t *offsets_index,
-     libcdata_range_list_t *unallocated_data_block_list,
-     libcdata_range_list_t *unallocated_page_block_list,
+     libpff_allocation_bitmap_t *unallocated_data_block_bitmap,
+     libpff_allocation_bitmap_t *unallocated_page_block_bitmap,
      uint8_t recovery_flags,
+     libpff_recover_checkpoint_t *checkpoint,
      libcerror_error_t **error )
 {
-	uint8_t *block_buffer                   = NULL;
-	uint8_t *data_block_footer              = NULL;
-	intptr_t *value                         = NULL;
-	static char *function                   = "libpff_recover_data_blocks";
-	off64_t block_buffer_data_offset        = 0;
-	off64_t block_offset                    = 0;
-	off64_t data_block_offset               = 0;
-	off64_t page_block_offset               = 0;
-	size64_t block_size                     = 0;
-	size64_t data_block_size                = 0;
-	size64_t page_block_size                = 0;
-	size_t block_buffer_offset              = 0;
-	size_t block_buffer_size_available      = 0;
-	size_t data_block_data_offset           = 0;
-	size_t read_size                        = 0;
-	ssize_t read_count                      = 0;
-	uint64_t data_block_back_pointer        = 0;
-	uint32_t data_block_calculated_checksum = 0;
-	uint32_t data_block_stored_checksum     = 0;
-	uint32_t maximum_data_block_size        = 0;
-	uint16_t data_block_data_size           = 0;
-	uint16_t format_data_block_size         = 0;
-	uint16_t format_page_block_size         = 0;
-	uint16_t scan_block_size                = 0;
-	uint8_t supported_recovery_flags        = 0;
-	int number_of_unallocated_data_blocks   = 0;
-	int number_of_unallocated_page_blocks   = 0;
-	int result                              = 0;
-	int unallocated_data_block_index        = 0;
-	int unallocated_page_block_index        = 0;
+	libpff_recover_scan_job_t *scan_job                 = NULL;
+	libpff_recover_scan_job_t *scan_jobs                = NULL;
+	libpff_recover_scan_thread_pool_t *scan_thread_pool = NULL;
+	static char *function                               = "libpff_recover_data_blocks";
+	off64_t block_offset                                = 0;
+	off64_t chunk_end_offset                            = 0;
+	off64_t chunk_offset                                = 0;
+	off64_t data_block_offset                           = 0;
+	off64_t next_data_block_offset                      = 0;
+	off64_t next_page_block_offset                      = 0;
+	off64_t page_block_offset                           = 0;
+	off64_t range_end_offset                            = 0;
+	size64_t alignment_size                             = 0;
+	size64_t block_size                                 = 0;
+	size64_t data_block_size                            = 0;
+	size64_t page_block_size                            = 0;
+	size_t buffer_size                                  = 0;
+	ssize_t read_count                                  = 0;
+	uint64_t chunk_index                                = 0;
+	uint64_t number_of_scanned_chunks                   = 0;
+	uint64_t pending_chunk_index                        = 0;
+	uint32_t maximum_data_block_size                    = 0;
+	uint16_t format_data_block_size                     = 0;
+	uint16_t format_page_block_size                     = 0;
+	uint16_t scan_block_size                            = 0;
+	uint8_t supported_recovery_flags                    = 0;
+	int batch_index                                     = 0;
+	int number_of_batches                               = 1;
+	int number_of_pending_scan_jobs                     = 0;
+	int number_of_scan_jobs                             = 0;
+	int number_of_unallocated_data_blocks               = 0;
+	int number_of_unallocated_page_blocks               = 0;
+	int pending_batch_index                             = -1;
+	int result                                          = 0;
+	int scan_job_index                                  = 0;
 
 	if( io_handle == NULL )
 	{
@@ -2569,12 +4631,12 @@ int libpff_recover_data_blocks(
 
 		return( -1 );
 	}
-	/* Scan the unallocated page block list or all blocks for index nodes
+	/* Scan the unallocated data and page blocks or all blocks for index nodes
 	 */
 	if( ( recovery_flags & LIBPFF_RECOVERY_FLAG_IGNORE_ALLOCATION_DATA ) == 0 )
 	{
-		if( libcdata_range_list_get_number_of_elements(
-		     unallocated_data_block_list,
+		if( libpff_allocation_bitmap_get_number_of_ranges(
+		     unallocated_data_block_bitmap,
 		     &number_of_unallocated_data_blocks,
 		     error ) != 1 )
 		{
@@ -2590,8 +4652,8 @@ int libpff_recover_data_blocks(
 		if( ( io_handle->file_type == LIBPFF_FILE_TYPE_32BIT )
 		 || ( io_handle->file_type == LIBPFF_FILE_TYPE_64BIT ) )
 		{
-			if( libcdata_range_list_get_number_of_elements(
-			     unallocated_page_block_list,
+			if( libpff_allocation_bitmap_get_number_of_ranges(
+			     unallocated_page_block_bitmap,
 			     &number_of_unallocated_page_blocks,
 			     error ) != 1 )
 			{
@@ -2618,413 +4680,647 @@ int libpff_recover_data_blocks(
 	{
 		scan_block_size = format_data_block_size;
 	}
-	block_buffer = (uint8_t *) memory_allocate(
-	                            sizeof( uint8_t ) * ( maximum_data_block_size * 2 ) );
+	if( checkpoint != NULL )
+	{
+		if( libpff_recover_checkpoint_set_scan_parameters(
+		     checkpoint,
+		     io_handle->file_type,
+		     recovery_flags,
+		     io_handle->file_size,
+		     number_of_unallocated_data_blocks,
+		     number_of_unallocated_page_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set checkpoint scan parameters.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( checkpoint->flags & LIBPFF_RECOVER_CHECKPOINT_FLAG_SCAN_COMPLETED ) != 0 )
+		{
+			return( 1 );
+		}
+		number_of_scanned_chunks = checkpoint->number_of_scanned_chunks;
+	}
+	if( ( number_of_unallocated_data_blocks == 0 )
+	 && ( number_of_unallocated_page_blocks == 0 )
+	 && ( ( recovery_flags & LIBPFF_RECOVERY_FLAG_IGNORE_ALLOCATION_DATA ) == 0 ) )
+	{
+		return( 1 );
+	}
+	number_of_scan_jobs = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( io_handle->number_of_recovery_threads > 1 )
+	{
+		number_of_scan_jobs = io_handle->number_of_recovery_threads;
+
+		if( number_of_scan_jobs > LIBPFF_MAXIMUM_NUMBER_OF_RECOVER_SCAN_JOBS )
+		{
+			number_of_scan_jobs = LIBPFF_MAXIMUM_NUMBER_OF_RECOVER_SCAN_JOBS;
+		}
+		/* The thread pool is created once and reused for all the chunks of the scan.
+		 * While a batch of chunks is scanned by the thread pool the calling thread
+		 * reads the next batch, hence the scan jobs of 2 batches are allocated
+		 */
+		if( libpff_recover_scan_thread_pool_initialize(
+		     &scan_thread_pool,
+		     number_of_scan_jobs,
+		     2 * number_of_scan_jobs,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_batches = 2;
+	}
+#endif
+	scan_jobs = (libpff_recover_scan_job_t *) memory_allocate(
+	                                           sizeof( libpff_recover_scan_job_t ) * number_of_batches * number_of_scan_jobs );
 
-	if( block_buffer == NULL )
+	if( scan_jobs == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create block buffer.",
+		 "%s: unable to create scan jobs.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     scan_jobs,
+	     0,
+	     sizeof( libpff_recover_scan_job_t ) * number_of_batches * number_of_scan_jobs ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan jobs.",
 		 function );
 
-		goto on_error;
-	}
-	if( ( number_of_unallocated_data_blocks > 0 )
-	 || ( number_of_unallocated_page_blocks > 0 )
-	 || ( ( recovery_flags & LIBPFF_RECOVERY_FLAG_IGNORE_ALLOCATION_DATA ) != 0 ) )
-	{
-		block_offset      = 0;
-		data_block_offset = -1;
-		page_block_offset = -1;
+		memory_free(
+		 scan_jobs );
+
+		scan_jobs = NULL;
+
+		goto on_error;
+	}
+	/* The buffer of a scan job contains the data of a chunk preceded by
+	 * up to the maximum data block size of data of the scan range
+	 */
+	buffer_size = (size_t) maximum_data_block_size + LIBPFF_RECOVER_SCAN_CHUNK_SIZE;
+
+	for( scan_job_index = 0;
+	     scan_job_index < ( number_of_batches * number_of_scan_jobs );
+	     scan_job_index++ )
+	{
+		scan_jobs[ scan_job_index ].file_type      = io_handle->file_type;
+		scan_jobs[ scan_job_index ].recovery_flags = recovery_flags;
+
+		scan_jobs[ scan_job_index ].buffer = (uint8_t *) memory_allocate(
+		                                                  sizeof( uint8_t ) * buffer_size );
+
+		if( scan_jobs[ scan_job_index ].buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create scan job: %d buffer.",
+			 function,
+			 scan_job_index );
+
+			goto on_error;
+		}
+	}
+	scan_job_index    = 0;
+	block_offset      = 0;
+	data_block_offset = -1;
+	page_block_offset = -1;
+
+	while( block_offset < (off64_t) io_handle->file_size )
+	{
+		if( io_handle->abort != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( recovery_flags & LIBPFF_RECOVERY_FLAG_IGNORE_ALLOCATION_DATA ) == 0 )
+		{
+			if( data_block_offset < block_offset )
+			{
+				result = 0;
+
+				if( number_of_unallocated_data_blocks > 0 )
+				{
+					/* The next unallocated range is determined from the bitmap words
+					 * using the number of trailing zero bits
+					 */
+					result = libpff_allocation_bitmap_get_next_range(
+					          unallocated_data_block_bitmap,
+					          next_data_block_offset,
+					          &data_block_offset,
+					          &data_block_size,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve unallocated data block at or after offset: %" PRIi64 ".",
+						 function,
+						 next_data_block_offset );
+
+						goto on_error;
+					}
+				}
+				if( result != 0 )
+				{
+					next_data_block_offset = data_block_offset + (off64_t) data_block_size;
+				}
+				else
+				{
+					data_block_offset = (off64_t) io_handle->file_size;
+					data_block_size   = 0;
+				}
+			}
+			if( page_block_offset < block_offset )
+			{
+				result = 0;
+
+				if( number_of_unallocated_page_blocks > 0 )
+				{
+					/* The next unallocated range is determined from the bitmap words
+					 * using the number of trailing zero bits
+					 */
+					result = libpff_allocation_bitmap_get_next_range(
+					          unallocated_page_block_bitmap,
+					          next_page_block_offset,
+					          &page_block_offset,
+					          &page_block_size,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve unallocated page block at or after offset: %" PRIi64 ".",
+						 function,
+						 next_page_block_offset );
+
+						goto on_error;
+					}
+				}
+				if( result != 0 )
+				{
+					next_page_block_offset = page_block_offset + (off64_t) page_block_size;
+				}
+				else
+				{
+					page_block_offset = (off64_t) io_handle->file_size;
+					page_block_size   = 0;
+				}
+			}
+			if( ( data_block_offset >= (off64_t) io_handle->file_size )
+			 && ( page_block_offset >= (off64_t) io_handle->file_size ) )
+			{
+				break;
+			}
+			/* Process the smallest offset
+			 */
+			else if( ( data_block_offset < page_block_offset )
+			      && ( data_block_size > scan_block_size ) )
+			{
+				block_offset = data_block_offset;
+				block_size   = data_block_size;
+			}
+			else if( ( page_block_offset < data_block_offset )
+			      && ( page_block_size > scan_block_size ) )
+			{
+				block_offset = page_block_offset;
+				block_size   = page_block_size;
+			}
+			/* Process the largest range
+			 */
+			else if( data_block_size > page_block_size )
+			{
+				block_offset = data_block_offset;
+				block_size   = data_block_size;
+			}
+			else
+			{
+				block_offset = page_block_offset;
+				block_size   = page_block_size;
+			}
+		}
+		else
+		{
+			block_size = io_handle->file_size - block_offset;
+		}
+		if( ( block_offset % scan_block_size ) != 0 )
+		{
+			alignment_size = scan_block_size - ( block_offset % scan_block_size );
+
+			if( block_size > alignment_size )
+			{
+				block_size -= alignment_size;
+			}
+			else
+			{
+				block_size = 0;
+			}
+			block_offset += alignment_size;
+		}
+		if( block_size > ( io_handle->file_size - block_offset ) )
+		{
+			if( block_offset < (off64_t) io_handle->file_size )
+			{
+				block_size = io_handle->file_size - block_offset;
+			}
+			else
+			{
+				block_size = 0;
+			}
+		}
+		block_size -= block_size % scan_block_size;
+
+		if( block_size < scan_block_size )
+		{
+			block_offset += block_size;
+
+			continue;
+		}
+		/* Split the scan range into chunks that end on a page block boundary,
+		 * so that an index node is never split across chunks
+		 */
+		range_end_offset = block_offset + (off64_t) block_size;
+		chunk_offset     = block_offset;
 
-		while( block_offset < (off64_t) io_handle->file_size )
+		while( chunk_offset < range_end_offset )
 		{
 			if( io_handle->abort != 0 )
 			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+				 "%s: abort requested.",
+				 function );
+
 				goto on_error;
 			}
-			if( ( recovery_flags & LIBPFF_RECOVERY_FLAG_IGNORE_ALLOCATION_DATA ) == 0 )
-			{
-				if( data_block_offset < block_offset )
-				{
-					if( unallocated_data_block_index < number_of_unallocated_data_blocks )
-					{
-						if( libcdata_range_list_get_range_by_index(
-						     unallocated_data_block_list,
-						     unallocated_data_block_index,
-						     (uint64_t *) &data_block_offset,
-						     (uint64_t *) &data_block_size,
-						     &value,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-							 "%s: unable to retrieve unallocated data block: %d.",
-							 function,
-							 unallocated_data_block_index );
+			chunk_end_offset  = chunk_offset + LIBPFF_RECOVER_SCAN_CHUNK_SIZE;
+			chunk_end_offset -= chunk_end_offset % format_page_block_size;
 
-							goto on_error;
-						}
-						unallocated_data_block_index++;
-					}
-					else
-					{
-						data_block_offset = (off64_t) io_handle->file_size;
-						data_block_size   = 0;
-					}
-				}
-				if( page_block_offset < block_offset )
-				{
-					if( unallocated_page_block_index < number_of_unallocated_page_blocks )
-					{
-						if( libcdata_range_list_get_range_by_index(
-						     unallocated_page_block_list,
-						     unallocated_page_block_index,
-						     (uint64_t *) &page_block_offset,
-						     (uint64_t *) &page_block_size,
-						     &value,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-							 "%s: unable to retrieve unallocated page block: %d.",
-							 function,
-							 unallocated_page_block_index );
-
-							goto on_error;
-						}
-						unallocated_page_block_index++;
-					}
-					else
-					{
-						page_block_offset = (off64_t) io_handle->file_size;
-						page_block_size   = 0;
-					}
-				}
+			if( chunk_end_offset > range_end_offset )
+			{
+				chunk_end_offset = range_end_offset;
 			}
-			if( ( recovery_flags & LIBPFF_RECOVERY_FLAG_IGNORE_ALLOCATION_DATA ) == 0 )
+			/* The chunks are enumerated in the same order on every run,
+			 * hence chunks scanned according to the checkpoint can be skipped
+			 */
+			chunk_index++;
+
+			if( chunk_index <= number_of_scanned_chunks )
 			{
-				if( ( data_block_offset >= (off64_t) io_handle->file_size )
-				 && ( page_block_offset >= (off64_t) io_handle->file_size ) )
-				{
-					break;
-				}
-				/* Process the smallest offset
-				 */
-				else if( ( data_block_offset < page_block_offset )
-				      && ( data_block_size > scan_block_size ) )
-				{
-					block_offset = data_block_offset;
-					block_size   = data_block_size;
-				}
-				else if( ( page_block_offset < data_block_offset )
-				      && ( page_block_size > scan_block_size ) )
-				{
-					block_offset = page_block_offset;
-					block_size   = page_block_size;
-				}
-				/* Process the largest range
-				 */
-				else if( data_block_size > page_block_size )
-				{
-					block_offset = data_block_offset;
-					block_size   = data_block_size;
-				}
-				else
-				{
-					block_offset = page_block_offset;
-					block_size   = page_block_size;
-				}
+				chunk_offset = chunk_end_offset;
+
+				continue;
 			}
-			else
+			scan_job = &( scan_jobs[ ( batch_index * number_of_scan_jobs ) + scan_job_index ] );
+
+			scan_job->range_offset     = block_offset;
+			scan_job->range_end_offset = range_end_offset;
+			scan_job->chunk_offset     = chunk_offset;
+			scan_job->chunk_end_offset = chunk_end_offset;
+			scan_job->buffer_offset    = chunk_offset - maximum_data_block_size;
+
+			if( scan_job->buffer_offset < block_offset )
 			{
-				block_size = scan_block_size;
+				scan_job->buffer_offset = block_offset;
 			}
-			if( ( block_offset % scan_block_size ) != 0 )
+			scan_job->buffer_data_size = (size_t) ( chunk_end_offset - scan_job->buffer_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
 			{
-				block_offset  = ( ( block_offset / scan_block_size ) + 1 ) * scan_block_size;
-				block_size   -= block_size % scan_block_size;
+				libcnotify_printf(
+				 "%s: reading chunk at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
+				 function,
+				 scan_job->buffer_offset,
+				 scan_job->buffer_offset,
+				 scan_job->buffer_data_size );
 			}
-			if( block_size < scan_block_size )
+#endif
+			/* The file IO handle cannot be shared between threads hence
+			 * the chunks are read sequentially
+			 */
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              scan_job->buffer,
+			              scan_job->buffer_data_size,
+			              scan_job->buffer_offset,
+			              error );
+
+			if( read_count != (ssize_t) scan_job->buffer_data_size )
 			{
-				block_offset += block_size;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 scan_job->buffer_offset,
+				 scan_job->buffer_offset );
 
-				continue;
+				goto on_error;
 			}
-			while( block_size >= scan_block_size )
+			scan_job_index++;
+
+			if( scan_job_index >= number_of_scan_jobs )
 			{
-				/* The index nodes have a fixed block size and stored block size aligned
-				 */
-				if( ( block_size >= format_page_block_size )
-				 && ( ( block_offset % format_page_block_size ) == 0 ) )
+				if( libpff_recover_scan_jobs_start(
+				     scan_thread_pool,
+				     &( scan_jobs[ batch_index * number_of_scan_jobs ] ),
+				     scan_job_index,
+				     error ) != 1 )
 				{
-					/* Scan for index values in the index node
-					 */
-					result = libpff_recover_index_values(
-						  io_handle,
-						  file_io_handle,
-						  descriptors_index,
-						  offsets_index,
-						  unallocated_data_block_list,
-						  block_offset,
-						  recovery_flags,
-						  error );
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to start scanning chunks.",
+					 function );
 
-					if( result == -1 )
+					goto on_error;
+				}
+				/* The batches are merged in the order they were read
+				 */
+				if( pending_batch_index != -1 )
+				{
+					if( libpff_recover_complete_scan_jobs(
+					     io_handle,
+					     file_io_handle,
+					     descriptors_index,
+					     offsets_index,
+					     unallocated_data_block_bitmap,
+					     scan_thread_pool,
+					     &( scan_jobs[ pending_batch_index * number_of_scan_jobs ] ),
+					     number_of_pending_scan_jobs,
+					     recovery_flags,
+					     checkpoint,
+					     pending_chunk_index,
+					     error ) != 1 )
 					{
 						libcerror_error_set(
 						 error,
 						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: unable to recover index node at offset: %" PRIi64 ".\n",
-						 function,
-						 block_offset );
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to complete scanning chunks.",
+						 function );
 
 						goto on_error;
 					}
-					else if( result == 1 )
-					{
-						block_offset += format_page_block_size;
-						block_size   -= format_page_block_size;
-
-						continue;
-					}
 				}
-				if( ( recovery_flags & LIBPFF_RECOVERY_FLAG_SCAN_FOR_FRAGMENTS ) == 0 )
-				{
-					block_offset += scan_block_size;
-					block_size   -= scan_block_size;
+				pending_batch_index         = batch_index;
+				number_of_pending_scan_jobs = scan_job_index;
+				pending_chunk_index         = chunk_index;
 
-					continue;
-				}
-/* TODO optimize by minimizing amount of reads */
-				if( block_buffer_size_available == 0 )
+				if( number_of_batches == 1 )
 				{
-					block_buffer_data_offset = block_offset;
-
-					if( block_buffer_offset > 0 )
-					{
-/* TODO optimize by copying the needed data to the front of the buffer */
-						block_buffer_data_offset -= format_data_block_size;
-						block_buffer_offset       = maximum_data_block_size - format_data_block_size;
-					}
-					read_size = (size_t) block_size;
-
-					if( read_size > (size_t) maximum_data_block_size )
-					{
-						read_size = (size_t) maximum_data_block_size;
-					}
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: reading data block at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
-						 function,
-						 block_buffer_data_offset,
-						 block_buffer_data_offset,
-						 read_size );
-					}
-#endif
-					read_count = libbfio_handle_read_buffer_at_offset(
-						      file_io_handle,
-						      &( block_buffer[ block_buffer_offset ] ),
-						      read_size,
-						      block_buffer_data_offset,
-						      error );
-
-					if( read_count != (ssize_t) read_size )
+					if( libpff_recover_complete_scan_jobs(
+					     io_handle,
+					     file_io_handle,
+					     descriptors_index,
+					     offsets_index,
+					     unallocated_data_block_bitmap,
+					     scan_thread_pool,
+					     scan_jobs,
+					     number_of_pending_scan_jobs,
+					     recovery_flags,
+					     checkpoint,
+					     pending_chunk_index,
+					     error ) != 1 )
 					{
 						libcerror_error_set(
 						 error,
-						 LIBCERROR_ERROR_DOMAIN_IO,
-						 LIBCERROR_IO_ERROR_READ_FAILED,
-						 "%s: unable to read data block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-						 function,
-						 block_buffer_data_offset,
-						 block_buffer_data_offset );
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to complete scanning chunks.",
+						 function );
 
 						goto on_error;
 					}
-					block_buffer_size_available = read_size;
+					pending_batch_index = -1;
 				}
-				if( block_buffer_size_available >= format_data_block_size )
+				else
 				{
-					/* Scan the block for a data block footer
-					 */
-					data_block_footer = &( block_buffer[ block_buffer_offset ] );
+					batch_index = 1 - batch_index;
+				}
+				scan_job_index = 0;
+			}
+			chunk_offset = chunk_end_offset;
+		}
+		block_offset = range_end_offset;
+	}
+	if( scan_job_index > 0 )
+	{
+		if( libpff_recover_scan_jobs_start(
+		     scan_thread_pool,
+		     &( scan_jobs[ batch_index * number_of_scan_jobs ] ),
+		     scan_job_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to start scanning chunks.",
+			 function );
 
-					if( io_handle->file_type == LIBPFF_FILE_TYPE_32BIT )
-					{
-						data_block_footer += format_data_block_size - sizeof( pff_block_footer_32bit_t );
-
-						byte_stream_copy_to_uint16_little_endian(
-						 ( (pff_block_footer_32bit_t *) data_block_footer )->data_size,
-						 data_block_data_size );
-						byte_stream_copy_to_uint32_little_endian(
-						 ( (pff_block_footer_32bit_t *) data_block_footer )->back_pointer,
-						 data_block_back_pointer );
-						byte_stream_copy_to_uint32_little_endian(
-						 ( (pff_block_footer_32bit_t *) data_block_footer )->checksum,
-						 data_block_stored_checksum );
-					}
-					else if( io_handle->file_type == LIBPFF_FILE_TYPE_64BIT )
-					{
-						data_block_footer += format_data_block_size - sizeof( pff_block_footer_64bit_t );
-
-						byte_stream_copy_to_uint16_little_endian(
-						 ( (pff_block_footer_64bit_t *) data_block_footer )->data_size,
-						 data_block_data_size );
-						byte_stream_copy_to_uint32_little_endian(
-						 ( (pff_block_footer_64bit_t *) data_block_footer )->checksum,
-						 data_block_stored_checksum );
-						byte_stream_copy_to_uint64_little_endian(
-						 ( (pff_block_footer_64bit_t *) data_block_footer )->back_pointer,
-						 data_block_back_pointer );
-					}
-					else if( io_handle->file_type == LIBPFF_FILE_TYPE_64BIT_4K_PAGE )
-					{
-						data_block_footer += format_data_block_size - sizeof( pff_block_footer_64bit_4k_page_t );
-
-						byte_stream_copy_to_uint16_little_endian(
-						 ( (pff_block_footer_64bit_4k_page_t *) data_block_footer )->data_size,
-						 data_block_data_size );
-						byte_stream_copy_to_uint32_little_endian(
-						 ( (pff_block_footer_64bit_4k_page_t *) data_block_footer )->checksum,
-						 data_block_stored_checksum );
-						byte_stream_copy_to_uint64_little_endian(
-						 ( (pff_block_footer_64bit_4k_page_t *) data_block_footer )->back_pointer,
-						 data_block_back_pointer );
-					}
-					/* Check if back pointer itself is not empty but the upper 32-bit are
-					 */
-					if( ( data_block_back_pointer != 0 )
-					 && ( ( data_block_back_pointer >> 32 ) == 0 ) )
-					{
-						data_block_data_offset = block_buffer_offset - ( ( data_block_data_size / format_data_block_size ) * format_data_block_size );
+			goto on_error;
+		}
+	}
+	if( pending_batch_index != -1 )
+	{
+		if( libpff_recover_complete_scan_jobs(
+		     io_handle,
+		     file_io_handle,
+		     descriptors_index,
+		     offsets_index,
+		     unallocated_data_block_bitmap,
+		     scan_thread_pool,
+		     &( scan_jobs[ pending_batch_index * number_of_scan_jobs ] ),
+		     number_of_pending_scan_jobs,
+		     recovery_flags,
+		     checkpoint,
+		     pending_chunk_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to complete scanning chunks.",
+			 function );
 
-						if( (size_t) data_block_data_size < read_size )
-						{
-							result = libpff_recover_analyze_data_block_back_pointer(
-							          offsets_index,
-							          data_block_back_pointer,
-							          (off64_t) block_buffer_data_offset + data_block_data_offset,
-							          (size32_t) data_block_data_size,
-							          error );
-
-							if( result == -1 )
-							{
-								libcerror_error_set(
-								 error,
-								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-								 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-								 "%s: unable to recovere data block: %" PRIu64 ".",
-								 function,
-								 data_block_back_pointer );
-
-								goto on_error;
-							}
-							else if( result != 0 )
-							{
-								block_offset += format_data_block_size;
-								block_size   -= format_data_block_size;
-
-/* TODO reset block_buffer_offset and block_buffer_size_available ? */
-
-								continue;
-							}
-							if( data_block_stored_checksum != 0 )
-							{
-								if( libpff_checksum_calculate_weak_crc32(
-								     &data_block_calculated_checksum,
-								     &( block_buffer[ data_block_data_offset ] ),
-								     data_block_data_size,
-								     0,
-								     error ) != 1 )
-								{
-									libcerror_error_set(
-									 error,
-									 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-									 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-									 "%s: unable to calculate weak CRC-32.",
-									 function );
-
-									goto on_error;
-								}
-								if( data_block_stored_checksum != data_block_calculated_checksum )
-								{
-#if defined( HAVE_DEBUG_OUTPUT )
-									if( libcnotify_verbose != 0 )
-									{
-										libcnotify_printf(
-										 "%s: mismatch in data block: %" PRIu64 " checksum ( %" PRIu32 " != %" PRIu32 " ).\n",
-										 function,
-										 data_block_back_pointer,
-										 data_block_stored_checksum,
-										 data_block_calculated_checksum );
-									}
-#endif
-									block_offset += format_data_block_size;
-									block_size   -= format_data_block_size;
+			goto on_error;
+		}
+		pending_batch_index = -1;
+	}
+	if( scan_job_index > 0 )
+	{
+		/* The checkpoint is written after the scan has completed
+		 */
+		if( libpff_recover_complete_scan_jobs(
+		     io_handle,
+		     file_io_handle,
+		     descriptors_index,
+		     offsets_index,
+		     unallocated_data_block_bitmap,
+		     scan_thread_pool,
+		     &( scan_jobs[ batch_index * number_of_scan_jobs ] ),
+		     scan_job_index,
+		     recovery_flags,
+		     NULL,
+		     chunk_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to complete scanning chunks.",
+			 function );
 
-									continue;
-								}
-							}
-/* TODO consider data block as fragment */
+			goto on_error;
+		}
+	}
+	if( checkpoint != NULL )
+	{
+		checkpoint->number_of_scanned_chunks = chunk_index;
+		checkpoint->scan_offset              = (off64_t) io_handle->file_size;
+		checkpoint->flags                   |= LIBPFF_RECOVER_CHECKPOINT_FLAG_SCAN_COMPLETED;
+
+		if( libpff_recover_checkpoint_write(
+		     checkpoint,
+		     descriptors_index,
+		     offsets_index,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write checkpoint.",
+			 function );
 
-							data_block_data_size = ( ( data_block_data_size / format_data_block_size ) + 1 ) * format_data_block_size;
+			goto on_error;
+		}
+	}
+	if( scan_thread_pool != NULL )
+	{
+		if( libpff_recover_scan_thread_pool_free(
+		     &scan_thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scan thread pool.",
+			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-							if( libcnotify_verbose != 0 )
-							{
-								libcnotify_printf(
-								 "%s: data block back pointer: 0x%08" PRIx64 "\n",
-								 function,
-								 data_block_back_pointer );
-
-								libcnotify_printf(
-								 "%s: data block data at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
-								 function,
-								 block_buffer_data_offset + data_block_data_offset,
-								 block_buffer_data_offset + data_block_data_offset,
-								 data_block_data_size );
-								libcnotify_print_data(
-								 &( block_buffer[ data_block_data_offset ] ),
-								 data_block_data_size,
-								 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-							}
-#endif
-						}
-					}
-					block_buffer_offset         += format_data_block_size;
-					block_buffer_size_available -= format_data_block_size;
-				}
-				else
-				{
-					block_buffer_offset         = 0;
-					block_buffer_size_available = 0;
-				}
-				block_offset += scan_block_size;
-				block_size   -= scan_block_size;
-			}
+			goto on_error;
+		}
+	}
+	for( scan_job_index = 0;
+	     scan_job_index < ( number_of_batches * number_of_scan_jobs );
+	     scan_job_index++ )
+	{
+		if( scan_jobs[ scan_job_index ].candidates != NULL )
+		{
+			memory_free(
+			 scan_jobs[ scan_job_index ].candidates );
 		}
+		memory_free(
+		 scan_jobs[ scan_job_index ].buffer );
 	}
 	memory_free(
-	 block_buffer );
+	 scan_jobs );
 
 	return( 1 );
 
 on_error:
-	if( block_buffer != NULL )
+	if( scan_thread_pool != NULL )
+	{
+		/* Wait for the scan jobs that were started before their buffers are freed
+		 */
+		if( scan_jobs != NULL )
+		{
+			for( batch_index = 0;
+			     batch_index < number_of_batches;
+			     batch_index++ )
+			{
+				libpff_recover_scan_jobs_wait(
+				 scan_thread_pool,
+				 &( scan_jobs[ batch_index * number_of_scan_jobs ] ),
+				 number_of_scan_jobs,
+				 NULL );
+			}
+		}
+		libpff_recover_scan_thread_pool_free(
+		 &scan_thread_pool,
+		 NULL );
+	}
+	if( scan_jobs != NULL )
 	{
+		for( scan_job_index = 0;
+		     scan_job_index < ( number_of_batches * number_of_scan_jobs );
+		     scan_job_index++ )
+		{
+			if( scan_jobs[ scan_job_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( scan_jobs[ scan_job_index ].error ) );
+			}
+			if( scan_jobs[ scan_job_index ].candidates != NULL )
+			{
+				memory_free(
+				 scan_jobs[ scan_job_index ].candidates );
+			}
+			if( scan_jobs[ scan_job_index ].buffer != NULL )
+			{
+				memory_free(
+				 scan_jobs[ scan_job_index ].buffer );
+			}
+		}
 		memory_free(
-		 block_buffer );
+		 scan_jobs );
 	}
 	return( -1 );
 }
@@ -3037,7 +5333,7 @@ int libpff_recover_index_values(
      libbfio_handle_t *file_io_handle,
      libpff_descriptors_index_t *descriptors_index,
      libpff_offsets_index_t *offsets_index,
-     libcdata_range_list_t *unallocated_data_block_list,
+     libpff_allocation_bitmap_t *unallocated_data_block_bitmap,
      size64_t node_offset,
      uint8_t recovery_flags,
      libcerror_error_t **error )
@@ -3127,25 +5423,36 @@ int libpff_recover_index_values(
 
 		goto on_error;
 	}
-	if( libpff_index_node_read_file_io_handle(
-	     index_node,
-	     file_io_handle,
-	     node_offset,
-	     io_handle->file_type,
-	     error ) != 1 )
+	result = libpff_index_node_try_read_file_io_handle(
+	          index_node,
+	          file_io_handle,
+	          node_offset,
+	          io_handle->file_type );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index node at offset: %" PRIu64 ".",
+		 function,
+		 node_offset );
+
+		goto on_error;
+	}
+	else if( result == 0 )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( ( libcnotify_verbose != 0 )
-		 && ( error != NULL )
-		 && ( *error != NULL ) )
+		if( libcnotify_verbose != 0 )
 		{
-			libcnotify_print_error_backtrace(
-			 *error );
+			libcnotify_printf(
+			 "%s: unable to read index node at offset: %" PRIu64 " (0x%08" PRIx64 ").\n",
+			 function,
+			 node_offset,
+			 node_offset );
 		}
 #endif
-		libcerror_error_free(
-		 error );
-
 		libpff_index_node_free(
 		 &index_node,
 		 NULL );
@@ -3309,15 +5616,15 @@ int libpff_recover_index_values(
 			if( recoverable != 0 )
 			{
 				/* Check if the offsets index value is unallocated according to the
-				 * unallocated data block list
+				 * unallocated data block bitmap
 				 */
 				if( ( index_node->type == LIBPFF_INDEX_TYPE_OFFSET )
 				 && ( ( recovery_flags & LIBPFF_RECOVERY_FLAG_IGNORE_ALLOCATION_DATA ) == 0 ) )
 				{
-					result = libcdata_range_list_range_is_present(
-						  unallocated_data_block_list,
-						  (uint64_t) index_value_file_offset,
-						  (uint64_t) index_value_data_size,
+					result = libpff_allocation_bitmap_range_is_unallocated(
+						  unallocated_data_block_bitmap,
+						  (off64_t) index_value_file_offset,
+						  (size64_t) index_value_data_size,
 						  error );
 
 					if( result == -1 )
@@ -3851,15 +6158,14 @@ int libpff_recover_analyze_data_block(
 		 offsets_index_value->file_offset );
 	}
 #endif
-	result = libpff_data_block_read_file_io_handle(
+	result = libpff_data_block_try_read_file_io_handle(
 		  data_block,
 		  file_io_handle,
 		  offsets_index_value->file_offset,
 		  offsets_index_value->data_size,
-		  io_handle->file_type,
-		  error );
+		  io_handle->file_type );
 
-	if( result != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -3867,18 +6173,21 @@ int libpff_recover_analyze_data_block(
 		 LIBCERROR_IO_ERROR_READ_FAILED,
 		 "%s: unable to read data block.",
 		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( ( libcnotify_verbose != 0 )
-		 && ( error != NULL )
-		 && ( *error != NULL ) )
+		if( libcnotify_verbose != 0 )
 		{
-			libcnotify_print_error_backtrace(
-			 *error );
+			libcnotify_printf(
+			 "%s: unable to read data block at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 function,
+			 offsets_index_value->file_offset,
+			 offsets_index_value->file_offset );
 		}
 #endif
-		libcerror_error_free(
-		 error );
-
 /* TODO delete unreadable offset identifier in offsets_index->recovered_index_tree */
 	}
 	if( libpff_data_block_free(
@@ -25,24 +25,181 @@
 #include <common.h>
 #include <types.h>
 
+#include "libpff_allocation_bitmap.h"
+#include "libpff_bloom_filter.h"
 #include "libpff_descriptors_index.h"
+#include "libpff_index.h"
+#include "libpff_index_value.h"
 #include "libpff_libbfio.h"
+#include "libpff_libcerror.h"
+#include "libpff_libcthreads.h"
 #include "libpff_io_handle.h"
 #include "libpff_offsets_index.h"
+#include "libpff_recover_checkpoint.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libpff_recover_scan_candidate libpff_recover_scan_candidate_t;
+
+struct libpff_recover_scan_candidate
+{
+	/* The type
+	 */
+	uint8_t type;
+
+	/* The offset of the index node or data block footer
+	 */
+	off64_t offset;
+
+	/* The data block back pointer
+	 */
+	uint64_t data_block_back_pointer;
+
+	/* The data block data offset
+	 */
+	off64_t data_block_data_offset;
+
+	/* The data block data size
+	 */
+	uint16_t data_block_data_size;
+
+	/* The data block stored checksum
+	 */
+	uint32_t data_block_stored_checksum;
+
+	/* The data block calculated checksum
+	 * This value is only calculated when verbose debug output is enabled
+	 */
+	uint32_t data_block_calculated_checksum;
+};
+
+typedef struct libpff_recover_scan_job libpff_recover_scan_job_t;
+
+struct libpff_recover_scan_job
+{
+	/* The file type
+	 */
+	uint8_t file_type;
+
+	/* The recovery flags
+	 */
+	uint8_t recovery_flags;
+
+	/* The offset of the scan range
+	 */
+	off64_t range_offset;
+
+	/* The end offset of the scan range
+	 */
+	off64_t range_end_offset;
+
+	/* The offset of the chunk of the scan range that is scanned
+	 */
+	off64_t chunk_offset;
+
+	/* The end offset of the chunk of the scan range that is scanned
+	 */
+	off64_t chunk_end_offset;
+
+	/* The buffer
+	 * The buffer contains the data of the chunk preceded by up to the
+	 * maximum data block size of data of the scan range
+	 */
+	uint8_t *buffer;
+
+	/* The file offset of the data in the buffer
+	 */
+	off64_t buffer_offset;
+
+	/* The size of the data in the buffer
+	 */
+	size_t buffer_data_size;
+
+	/* The candidates
+	 */
+	libpff_recover_scan_candidate_t *candidates;
+
+	/* The number of candidates
+	 */
+	int number_of_candidates;
+
+	/* The number of allocated candidates
+	 */
+	int number_of_allocated_candidates;
+
+	/* The result of scanning the chunk
+	 */
+	int result;
+
+	/* The error of scanning the chunk
+	 */
+	libcerror_error_t *error;
+
+	/* Value to indicate the chunk is being scanned by the scan thread pool
+	 */
+	int is_pending;
+};
+
+typedef struct libpff_recover_scan_thread_pool libpff_recover_scan_thread_pool_t;
+
+struct libpff_recover_scan_thread_pool
+{
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The scan jobs mutex
+	 */
+	libcthreads_mutex_t *scan_jobs_mutex;
+
+	/* The scan jobs condition
+	 * Signalled when the thread pool has finished a scan job
+	 */
+	libcthreads_condition_t *scan_jobs_condition;
+#endif
+};
+
 int libpff_recover_items(
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libpff_descriptors_index_t *descriptors_index,
      libpff_offsets_index_t *offsets_index,
-     libcdata_range_list_t *unallocated_data_block_list,
-     libcdata_range_list_t *unallocated_page_block_list,
-     libcdata_list_t *recovered_item_list,
+     libpff_allocation_bitmap_t *unallocated_data_block_bitmap,
+     libpff_allocation_bitmap_t *unallocated_page_block_bitmap,
+     libcdata_array_t *recovered_item_array,
+     int (*recovered_item_callback)(
+            libcdata_tree_node_t *item_tree_node,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
      uint8_t recovery_flags,
+     libpff_recover_checkpoint_t *checkpoint,
+     libcerror_error_t **error );
+
+int libpff_recover_build_allocated_index_values_filter(
+     libpff_index_t *index,
+     libpff_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libpff_bloom_filter_t **allocated_index_values_filter,
+     libcerror_error_t **error );
+
+int libpff_recover_read_allocated_index_value_hashes(
+     libpff_index_t *index,
+     libpff_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t node_offset,
+     uint64_t node_back_pointer,
+     uint64_t **hashes,
+     size_t *maximum_number_of_hashes,
+     size_t *number_of_hashes,
+     int recursion_depth,
      libcerror_error_t **error );
 
 int libpff_recover_analyze_descriptor_data_identifier(
@@ -68,6 +225,15 @@ int libpff_recover_analyze_data_block_back_pointer(
      size32_t data_block_data_size,
      libcerror_error_t **error );
 
+int libpff_recover_get_allocated_index_value(
+     libpff_index_t *index,
+     libpff_bloom_filter_t *allocated_index_values_filter,
+     libpff_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libpff_index_value_t *index_value,
+     libpff_index_value_t **allocated_index_value,
+     libcerror_error_t **error );
+
 int libpff_recover_analyze_descriptors_index_value(
      libpff_descriptors_index_t *descriptors_index,
      libpff_io_handle_t *io_handle,
@@ -112,14 +278,111 @@ int libpff_recover_analyze_offsets_index_node(
      int recursion_depth,
      libcerror_error_t **error );
 
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define LIBPFF_RECOVER_HAVE_SIMD_FOOTER_FILTER
+
+int libpff_recover_have_sse2(
+     void );
+
+uint64_t libpff_recover_filter_data_block_footers_sse2(
+          const uint8_t *data,
+          size_t number_of_blocks,
+          size_t format_data_block_size,
+          size_t footer_offset,
+          uint16_t data_size_mask,
+          size_t *number_of_tested_blocks );
+
+#endif
+
+uint64_t libpff_recover_filter_data_block_footers_scalar(
+          const uint8_t *data,
+          size_t first_block_index,
+          size_t number_of_blocks,
+          size_t format_data_block_size,
+          size_t footer_offset,
+          uint8_t file_type,
+          uint32_t maximum_data_block_size );
+
+int libpff_recover_filter_data_block_footers(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t file_type,
+     uint64_t *footer_mask,
+     libcerror_error_t **error );
+
+int libpff_recover_scan_job_append_candidate(
+     libpff_recover_scan_job_t *scan_job,
+     libpff_recover_scan_candidate_t **candidate,
+     libcerror_error_t **error );
+
+int libpff_recover_scan_job_scan(
+     libpff_recover_scan_job_t *scan_job,
+     libcerror_error_t **error );
+
+int libpff_recover_scan_thread_pool_initialize(
+     libpff_recover_scan_thread_pool_t **scan_thread_pool,
+     int number_of_threads,
+     int maximum_number_of_scan_jobs,
+     libcerror_error_t **error );
+
+int libpff_recover_scan_thread_pool_free(
+     libpff_recover_scan_thread_pool_t **scan_thread_pool,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libpff_recover_scan_job_callback(
+     libpff_recover_scan_job_t *scan_job,
+     libpff_recover_scan_thread_pool_t *scan_thread_pool );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int libpff_recover_scan_jobs_start(
+     libpff_recover_scan_thread_pool_t *scan_thread_pool,
+     libpff_recover_scan_job_t *scan_jobs,
+     int number_of_scan_jobs,
+     libcerror_error_t **error );
+
+int libpff_recover_scan_jobs_wait(
+     libpff_recover_scan_thread_pool_t *scan_thread_pool,
+     libpff_recover_scan_job_t *scan_jobs,
+     int number_of_scan_jobs,
+     libcerror_error_t **error );
+
+int libpff_recover_merge_scan_candidates(
+     libpff_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_offsets_index_t *offsets_index,
+     libpff_allocation_bitmap_t *unallocated_data_block_bitmap,
+     libpff_recover_scan_job_t *scan_jobs,
+     int number_of_scan_jobs,
+     uint8_t recovery_flags,
+     libcerror_error_t **error );
+
+int libpff_recover_complete_scan_jobs(
+     libpff_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_offsets_index_t *offsets_index,
+     libpff_allocation_bitmap_t *unallocated_data_block_bitmap,
+     libpff_recover_scan_thread_pool_t *scan_thread_pool,
+     libpff_recover_scan_job_t *scan_jobs,
+     int number_of_scan_jobs,
+     uint8_t recovery_flags,
+     libpff_recover_checkpoint_t *checkpoint,
+     uint64_t chunk_index,
+     libcerror_error_t **error );
+
 int libpff_recover_data_blocks(
      libpff_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libpff_descriptors_index_t *descriptors_index,
      libpff_offsets_index_t *offsets_index,
-     libcdata_range_list_t *unallocated_data_block_list,
-     libcdata_range_list_t *unallocated_page_block_list,
+     libpff_allocation_bitmap_t *unallocated_data_block_bitmap,
+     libpff_allocation_bitmap_t *unallocated_page_block_bitmap,
      uint8_t recovery_flags,
+     libpff_recover_checkpoint_t *checkpoint,
      libcerror_error_t **error );
 
 int libpff_recover_index_values(
@@ -127,7 +390,7 @@ int libpff_recover_index_values(
      libbfio_handle_t *file_io_handle,
      libpff_descriptors_index_t *descriptors_index,
      libpff_offsets_index_t *offsets_index,
-     libcdata_range_list_t *unallocated_data_block_list,
+     libpff_allocation_bitmap_t *unallocated_data_block_bitmap,
      size64_t node_offset,
      uint8_t recovery_flags,
      libcerror_error_t **error );
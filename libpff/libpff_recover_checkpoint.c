@@ -0,0 +1,2423 @@
+/*
+ * Recovery checkpoint functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libpff_checksum.h"
+#include "libpff_definitions.h"
+#include "libpff_descriptors_index.h"
+#include "libpff_index_value.h"
+#include "libpff_index_values_list.h"
+#include "libpff_item_descriptor.h"
+#include "libpff_item_tree.h"
+#include "libpff_libbfio.h"
+#include "libpff_libcdata.h"
+#include "libpff_libcerror.h"
+#include "libpff_libcnotify.h"
+#include "libpff_offsets_index.h"
+#include "libpff_recover_checkpoint.h"
+
+#include "pff_recover_checkpoint.h"
+
+const uint8_t pff_recover_checkpoint_signature[ 8 ] = { 'P', 'F', 'F', 'R', 'C', 'K', 'P', 'T' };
+
+/* Creates a recovery checkpoint
+ * Make sure the value checkpoint is referencing, is set to NULL
+ * If an alternate file IO handle is provided the checkpoint is written alternately
+ * to both files, hence a failed write does not affect the most recent checkpoint
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_checkpoint_initialize(
+     libpff_recover_checkpoint_t **checkpoint,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *alternate_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recover_checkpoint_initialize";
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *checkpoint != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid checkpoint value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*checkpoint = memory_allocate_structure(
+	               libpff_recover_checkpoint_t );
+
+	if( *checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *checkpoint,
+	     0,
+	     sizeof( libpff_recover_checkpoint_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	( *checkpoint )->file_io_handle           = file_io_handle;
+	( *checkpoint )->alternate_file_io_handle = alternate_file_io_handle;
+	( *checkpoint )->file_io_handle_index     = -1;
+
+	return( 1 );
+
+on_error:
+	if( *checkpoint != NULL )
+	{
+		memory_free(
+		 *checkpoint );
+
+		*checkpoint = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a recovery checkpoint
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_checkpoint_free(
+     libpff_recover_checkpoint_t **checkpoint,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recover_checkpoint_free";
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *checkpoint != NULL )
+	{
+		/* The file_io_handle and alternate_file_io_handle references are freed elsewhere
+		 */
+		memory_free(
+		 *checkpoint );
+
+		*checkpoint = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the file parameters of a recovery checkpoint
+ * When set, the file type and size stored in a checkpoint that is read must match
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_checkpoint_set_file_parameters(
+     libpff_recover_checkpoint_t *checkpoint,
+     uint8_t file_type,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recover_checkpoint_set_file_parameters";
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	checkpoint->file_type           = file_type;
+	checkpoint->file_size           = file_size;
+	checkpoint->has_file_parameters = 1;
+
+	return( 1 );
+}
+
+/* Sets the scan parameters of a recovery checkpoint
+ * If the checkpoint was restored the scan parameters must match those stored in the checkpoint
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_checkpoint_set_scan_parameters(
+     libpff_recover_checkpoint_t *checkpoint,
+     uint8_t file_type,
+     uint8_t recovery_flags,
+     size64_t file_size,
+     int number_of_unallocated_data_blocks,
+     int number_of_unallocated_page_blocks,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recover_checkpoint_set_scan_parameters";
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint->is_restored != 0 )
+	{
+		if( ( checkpoint->file_type != file_type )
+		 || ( checkpoint->recovery_flags != recovery_flags )
+		 || ( checkpoint->file_size != file_size )
+		 || ( checkpoint->number_of_unallocated_data_blocks != number_of_unallocated_data_blocks )
+		 || ( checkpoint->number_of_unallocated_page_blocks != number_of_unallocated_page_blocks ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: checkpoint does not match file or recovery flags.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	checkpoint->file_type                         = file_type;
+	checkpoint->recovery_flags                    = recovery_flags;
+	checkpoint->file_size                         = file_size;
+	checkpoint->number_of_unallocated_data_blocks = number_of_unallocated_data_blocks;
+	checkpoint->number_of_unallocated_page_blocks = number_of_unallocated_page_blocks;
+
+	return( 1 );
+}
+
+/* Updates the scan cursor of a recovery checkpoint
+ * The checkpoint is written when at least LIBPFF_RECOVER_CHECKPOINT_INTERVAL chunks
+ * were scanned since it was last written
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_checkpoint_update(
+     libpff_recover_checkpoint_t *checkpoint,
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_offsets_index_t *offsets_index,
+     uint64_t number_of_scanned_chunks,
+     off64_t scan_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libpff_recover_checkpoint_update";
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_scanned_chunks < checkpoint->number_of_scanned_chunks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of scanned chunks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	checkpoint->number_of_scanned_chunks = number_of_scanned_chunks;
+	checkpoint->scan_offset              = scan_offset;
+
+	if( ( number_of_scanned_chunks - checkpoint->number_of_written_chunks ) >= LIBPFF_RECOVER_CHECKPOINT_INTERVAL )
+	{
+		if( libpff_recover_checkpoint_write(
+		     checkpoint,
+		     descriptors_index,
+		     offsets_index,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write checkpoint.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the data of a checkpoint file
+ * The data is allocated and must be freed by the caller
+ * Returns 1 if successful, 0 if the file does not exist or is empty or -1 on error
+ */
+int libpff_recover_checkpoint_read_file(
+     libbfio_handle_t *file_io_handle,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_data         = NULL;
+	static char *function      = "libpff_recover_checkpoint_read_file";
+	size64_t file_size         = 0;
+	ssize_t read_count         = 0;
+	int file_io_handle_is_open = 0;
+	int result                 = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_exists(
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if checkpoint file exists.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open checkpoint file.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = 1;
+
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve checkpoint file size.",
+		 function );
+
+		goto on_error;
+	}
+	result = 0;
+
+	if( file_size > 0 )
+	{
+		if( file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid checkpoint file size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		safe_data = (uint8_t *) memory_allocate(
+		                         sizeof( uint8_t ) * (size_t) file_size );
+
+		if( safe_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create checkpoint data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              safe_data,
+		              (size_t) file_size,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) file_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read checkpoint data.",
+			 function );
+
+			goto on_error;
+		}
+		result = 1;
+	}
+	file_io_handle_is_open = 0;
+
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close checkpoint file.",
+		 function );
+
+		goto on_error;
+	}
+	*data      = safe_data;
+	*data_size = (size_t) file_size;
+
+	return( result );
+
+on_error:
+	if( safe_data != NULL )
+	{
+		memory_free(
+		 safe_data );
+	}
+	if( file_io_handle_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a recovery checkpoint from the checkpoint file
+ * If an alternate checkpoint file is set the most recent valid checkpoint of both files is read,
+ * hence a checkpoint file that was not completely written is ignored
+ * The recovered index values stored in the checkpoint are inserted into the recovered indexes
+ * and if a recovered item array is provided the recovered items are appended to it
+ * Returns 1 if successful, 0 if no checkpoint was stored or -1 on error
+ */
+int libpff_recover_checkpoint_read(
+     libpff_recover_checkpoint_t *checkpoint,
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_offsets_index_t *offsets_index,
+     libcdata_array_t *recovered_item_array,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handles[ 2 ] = { NULL, NULL };
+	libcerror_error_t *check_error         = NULL;
+	uint8_t *data[ 2 ]                     = { NULL, NULL };
+	static char *function                  = "libpff_recover_checkpoint_read";
+	size_t data_size[ 2 ]                  = { 0, 0 };
+	uint32_t sequence_numbers[ 2 ]         = { 0, 0 };
+	int file_io_handle_index               = 0;
+	int recent_file_io_handle_index        = -1;
+	int result                             = 0;
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handles[ 0 ] = checkpoint->file_io_handle;
+	file_io_handles[ 1 ] = checkpoint->alternate_file_io_handle;
+
+	for( file_io_handle_index = 0;
+	     file_io_handle_index < 2;
+	     file_io_handle_index++ )
+	{
+		if( file_io_handles[ file_io_handle_index ] == NULL )
+		{
+			continue;
+		}
+		result = libpff_recover_checkpoint_read_file(
+		          file_io_handles[ file_io_handle_index ],
+		          &( data[ file_io_handle_index ] ),
+		          &( data_size[ file_io_handle_index ] ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read checkpoint file: %d.",
+			 function,
+			 file_io_handle_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		/* A checkpoint that fails the checks was not completely written
+		 */
+		if( libpff_recover_checkpoint_check_data(
+		     data[ file_io_handle_index ],
+		     data_size[ file_io_handle_index ],
+		     &( sequence_numbers[ file_io_handle_index ] ),
+		     &check_error ) != 1 )
+		{
+			continue;
+		}
+		if( ( recent_file_io_handle_index == -1 )
+		 || ( (int32_t) ( sequence_numbers[ file_io_handle_index ] - sequence_numbers[ recent_file_io_handle_index ] ) > 0 ) )
+		{
+			recent_file_io_handle_index = file_io_handle_index;
+		}
+	}
+	if( recent_file_io_handle_index == -1 )
+	{
+		if( check_error != NULL )
+		{
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error      = check_error;
+				check_error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: invalid checkpoint file.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	if( check_error != NULL )
+	{
+		libcerror_error_free(
+		 &check_error );
+	}
+	if( libpff_recover_checkpoint_read_data(
+	     checkpoint,
+	     descriptors_index,
+	     offsets_index,
+	     recovered_item_array,
+	     data[ recent_file_io_handle_index ],
+	     data_size[ recent_file_io_handle_index ],
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read checkpoint.",
+		 function );
+
+		goto on_error;
+	}
+	checkpoint->file_io_handle_index = recent_file_io_handle_index;
+
+	for( file_io_handle_index = 0;
+	     file_io_handle_index < 2;
+	     file_io_handle_index++ )
+	{
+		if( data[ file_io_handle_index ] != NULL )
+		{
+			memory_free(
+			 data[ file_io_handle_index ] );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( check_error != NULL )
+	{
+		libcerror_error_free(
+		 &check_error );
+	}
+	for( file_io_handle_index = 0;
+	     file_io_handle_index < 2;
+	     file_io_handle_index++ )
+	{
+		if( data[ file_io_handle_index ] != NULL )
+		{
+			memory_free(
+			 data[ file_io_handle_index ] );
+		}
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of recovered index values in a recovered index values tree
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_checkpoint_get_number_of_index_values(
+     libcdata_btree_t *recovered_index_values_tree,
+     uint32_t *number_of_index_values,
+     libcerror_error_t **error )
+{
+	libpff_index_values_list_t *index_values_list = NULL;
+	static char *function                         = "libpff_recover_checkpoint_get_number_of_index_values";
+	uint64_t safe_number_of_index_values          = 0;
+	int index_values_list_index                   = 0;
+	int number_of_index_values_lists              = 0;
+	int number_of_list_values                     = 0;
+
+	if( number_of_index_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of index values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_get_number_of_values(
+	     recovered_index_values_tree,
+	     &number_of_index_values_lists,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered index values lists.",
+		 function );
+
+		return( -1 );
+	}
+	for( index_values_list_index = 0;
+	     index_values_list_index < number_of_index_values_lists;
+	     index_values_list_index++ )
+	{
+		if( libcdata_btree_get_value_by_index(
+		     recovered_index_values_tree,
+		     index_values_list_index,
+		     (intptr_t **) &index_values_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve recovered index values list: %d.",
+			 function,
+			 index_values_list_index );
+
+			return( -1 );
+		}
+		if( libpff_index_values_list_number_of_values(
+		     index_values_list,
+		     &number_of_list_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of values of recovered index values list: %d.",
+			 function,
+			 index_values_list_index );
+
+			return( -1 );
+		}
+		safe_number_of_index_values += (uint64_t) number_of_list_values;
+	}
+	if( safe_number_of_index_values > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of index values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_index_values = (uint32_t) safe_number_of_index_values;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the data of a recovery checkpoint
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_checkpoint_get_data_size(
+     libpff_recover_checkpoint_t *checkpoint,
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_offsets_index_t *offsets_index,
+     libcdata_array_t *recovered_item_array,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function                       = "libpff_recover_checkpoint_get_data_size";
+	uint64_t safe_data_size                     = 0;
+	uint32_t number_of_descriptors_index_values = 0;
+	uint32_t number_of_offsets_index_values     = 0;
+	int number_of_recovered_items               = 0;
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptors_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptors index.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_recover_checkpoint_get_number_of_index_values(
+	     descriptors_index->recovered_index_values_tree,
+	     &number_of_descriptors_index_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered descriptors index values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_recover_checkpoint_get_number_of_index_values(
+	     offsets_index->recovered_index_values_tree,
+	     &number_of_offsets_index_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered offsets index values.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_item_array != NULL )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     recovered_item_array,
+		     &number_of_recovered_items,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of recovered items.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	safe_data_size = sizeof( pff_recover_checkpoint_header_t )
+	               + ( (uint64_t) number_of_descriptors_index_values * sizeof( pff_recover_checkpoint_descriptors_index_value_t ) )
+	               + ( (uint64_t) number_of_offsets_index_values * sizeof( pff_recover_checkpoint_offsets_index_value_t ) )
+	               + ( (uint64_t) number_of_recovered_items * sizeof( pff_recover_checkpoint_recovered_item_t ) );
+
+	if( safe_data_size > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = (size_t) safe_data_size;
+
+	return( 1 );
+}
+
+/* Checks the data of a recovery checkpoint
+ * Validates the signature, format version, data size and checksum
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_checkpoint_check_data(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *sequence_number,
+     libcerror_error_t **error )
+{
+	static char *function                       = "libpff_recover_checkpoint_check_data";
+	uint64_t safe_data_size                     = 0;
+	uint32_t calculated_checksum                = 0;
+	uint32_t format_version                     = 0;
+	uint32_t number_of_descriptors_index_values = 0;
+	uint32_t number_of_offsets_index_values     = 0;
+	uint32_t number_of_recovered_items          = 0;
+	uint32_t stored_checksum                    = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( sequence_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequence number.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( pff_recover_checkpoint_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: checkpoint header data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 sizeof( pff_recover_checkpoint_header_t ),
+		 0 );
+	}
+#endif
+	if( memory_compare(
+	     ( (pff_recover_checkpoint_header_t *) data )->signature,
+	     pff_recover_checkpoint_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checkpoint signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->format_version,
+	 format_version );
+
+	if( format_version != LIBPFF_RECOVER_CHECKPOINT_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checkpoint format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->number_of_descriptors_index_values,
+	 number_of_descriptors_index_values );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->number_of_offsets_index_values,
+	 number_of_offsets_index_values );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->number_of_recovered_items,
+	 number_of_recovered_items );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->checksum,
+	 stored_checksum );
+
+	safe_data_size = sizeof( pff_recover_checkpoint_header_t )
+	               + ( (uint64_t) number_of_descriptors_index_values * sizeof( pff_recover_checkpoint_descriptors_index_value_t ) )
+	               + ( (uint64_t) number_of_offsets_index_values * sizeof( pff_recover_checkpoint_offsets_index_value_t ) )
+	               + ( (uint64_t) number_of_recovered_items * sizeof( pff_recover_checkpoint_recovered_item_t ) );
+
+	if( safe_data_size != (uint64_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid checkpoint data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_checksum_calculate_crc32(
+	     &calculated_checksum,
+	     data,
+	     sizeof( pff_recover_checkpoint_header_t ) - 4,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_checksum_calculate_crc32(
+	     &calculated_checksum,
+	     &( data[ sizeof( pff_recover_checkpoint_header_t ) ] ),
+	     data_size - sizeof( pff_recover_checkpoint_header_t ),
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in checkpoint checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->sequence_number,
+	 *sequence_number );
+
+	return( 1 );
+}
+
+/* Reads a recovery checkpoint
+ * The recovered indexes must not contain recovered index values
+ * The recovered items are only read if a recovered item array is provided
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_checkpoint_read_data(
+     libpff_recover_checkpoint_t *checkpoint,
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_offsets_index_t *offsets_index,
+     libcdata_array_t *recovered_item_array,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *item_tree_node              = NULL;
+	libpff_index_value_t *index_value                 = NULL;
+	libpff_item_descriptor_t *item_descriptor         = NULL;
+	const uint8_t *index_value_data                   = NULL;
+	static char *function                             = "libpff_recover_checkpoint_read_data";
+	size64_t file_size                                = 0;
+	uint64_t data_identifier                          = 0;
+	uint64_t descriptors_index_root_node_back_pointer = 0;
+	uint64_t descriptors_index_root_node_offset       = 0;
+	uint64_t local_descriptors_identifier             = 0;
+	uint64_t offsets_index_root_node_back_pointer     = 0;
+	uint64_t offsets_index_root_node_offset           = 0;
+	uint32_t descriptor_identifier                    = 0;
+	uint32_t number_of_descriptors_index_values       = 0;
+	uint32_t number_of_offsets_index_values           = 0;
+	uint32_t number_of_recovered_items                = 0;
+	uint32_t sequence_number                          = 0;
+	uint32_t value_32bit                              = 0;
+	uint32_t value_index                              = 0;
+	uint16_t value_16bit                              = 0;
+	int entry_index                                   = 0;
+	int number_of_index_values_lists                  = 0;
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptors_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptors index.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptors_index->index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid descriptors index - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets index.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets_index->index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid offsets index - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_recover_checkpoint_check_data(
+	     data,
+	     data_size,
+	     &sequence_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid checkpoint data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->number_of_descriptors_index_values,
+	 number_of_descriptors_index_values );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->number_of_offsets_index_values,
+	 number_of_offsets_index_values );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->number_of_recovered_items,
+	 number_of_recovered_items );
+
+	if( checkpoint->has_file_parameters != 0 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (pff_recover_checkpoint_header_t *) data )->file_size,
+		 file_size );
+
+		if( ( checkpoint->file_type != ( (pff_recover_checkpoint_header_t *) data )->file_type )
+		 || ( checkpoint->file_size != file_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: checkpoint does not match file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The index root nodes identify the state of the file the checkpoint was created for
+	 */
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->descriptors_index_root_node_offset,
+	 descriptors_index_root_node_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->descriptors_index_root_node_back_pointer,
+	 descriptors_index_root_node_back_pointer );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->offsets_index_root_node_offset,
+	 offsets_index_root_node_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->offsets_index_root_node_back_pointer,
+	 offsets_index_root_node_back_pointer );
+
+	if( ( descriptors_index->index->root_node_offset != (off64_t) descriptors_index_root_node_offset )
+	 || ( descriptors_index->index->root_node_back_pointer != descriptors_index_root_node_back_pointer )
+	 || ( offsets_index->index->root_node_offset != (off64_t) offsets_index_root_node_offset )
+	 || ( offsets_index->index->root_node_back_pointer != offsets_index_root_node_back_pointer ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: checkpoint does not match file indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recovered_item_array != NULL )
+	 && ( ( ( (pff_recover_checkpoint_header_t *) data )->flags & LIBPFF_RECOVER_CHECKPOINT_FLAG_ITEMS_ANALYZED ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: checkpoint does not contain recovered items.",
+		 function );
+
+		return( -1 );
+	}
+	/* The index values are inserted in the order they were stored, hence the
+	 * index of a value in its recovered index values list is preserved
+	 */
+	if( libcdata_btree_get_number_of_values(
+	     descriptors_index->recovered_index_values_tree,
+	     &number_of_index_values_lists,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered descriptors index values lists.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_index_values_lists != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid descriptors index - recovered index values already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_btree_get_number_of_values(
+	     offsets_index->recovered_index_values_tree,
+	     &number_of_index_values_lists,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered offsets index values lists.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_index_values_lists != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid offsets index - recovered index values already set.",
+		 function );
+
+		return( -1 );
+	}
+	index_value_data = &( data[ sizeof( pff_recover_checkpoint_header_t ) ] );
+
+	for( value_index = 0;
+	     value_index < number_of_descriptors_index_values;
+	     value_index++ )
+	{
+		if( libpff_index_value_initialize(
+		     &index_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create descriptors index value: %" PRIu32 ".",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (pff_recover_checkpoint_descriptors_index_value_t *) index_value_data )->identifier,
+		 index_value->identifier );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (pff_recover_checkpoint_descriptors_index_value_t *) index_value_data )->data_identifier,
+		 index_value->data_identifier );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (pff_recover_checkpoint_descriptors_index_value_t *) index_value_data )->local_descriptors_identifier,
+		 index_value->local_descriptors_identifier );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (pff_recover_checkpoint_descriptors_index_value_t *) index_value_data )->parent_identifier,
+		 index_value->parent_identifier );
+
+		index_value_data += sizeof( pff_recover_checkpoint_descriptors_index_value_t );
+
+		if( libpff_descriptors_index_insert_recovered_index_value(
+		     descriptors_index,
+		     index_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert recovered descriptors index value: %" PRIu32 ".",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		index_value = NULL;
+	}
+	for( value_index = 0;
+	     value_index < number_of_offsets_index_values;
+	     value_index++ )
+	{
+		if( libpff_index_value_initialize(
+		     &index_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create offsets index value: %" PRIu32 ".",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (pff_recover_checkpoint_offsets_index_value_t *) index_value_data )->identifier,
+		 index_value->identifier );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (pff_recover_checkpoint_offsets_index_value_t *) index_value_data )->file_offset,
+		 index_value->file_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (pff_recover_checkpoint_offsets_index_value_t *) index_value_data )->data_size,
+		 value_32bit );
+
+		index_value->data_size = (size32_t) value_32bit;
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (pff_recover_checkpoint_offsets_index_value_t *) index_value_data )->reference_count,
+		 value_16bit );
+
+		index_value->reference_count = value_16bit;
+
+		index_value_data += sizeof( pff_recover_checkpoint_offsets_index_value_t );
+
+		if( libpff_offsets_index_insert_recovered_index_value(
+		     offsets_index,
+		     index_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert recovered offsets index value: %" PRIu32 ".",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		index_value = NULL;
+	}
+	if( recovered_item_array != NULL )
+	{
+		for( value_index = 0;
+		     value_index < number_of_recovered_items;
+		     value_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (pff_recover_checkpoint_recovered_item_t *) index_value_data )->descriptor_identifier,
+			 descriptor_identifier );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (pff_recover_checkpoint_recovered_item_t *) index_value_data )->data_identifier,
+			 data_identifier );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (pff_recover_checkpoint_recovered_item_t *) index_value_data )->local_descriptors_identifier,
+			 local_descriptors_identifier );
+
+			if( libpff_item_descriptor_initialize(
+			     &item_descriptor,
+			     descriptor_identifier,
+			     data_identifier,
+			     local_descriptors_identifier,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create item descriptor: %" PRIu32 ".",
+				 function,
+				 descriptor_identifier );
+
+				goto on_error;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (pff_recover_checkpoint_recovered_item_t *) index_value_data )->recovered_data_identifier_value_index,
+			 value_32bit );
+
+			item_descriptor->recovered_data_identifier_value_index = (int) value_32bit;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (pff_recover_checkpoint_recovered_item_t *) index_value_data )->recovered_local_descriptors_identifier_value_index,
+			 value_32bit );
+
+			item_descriptor->recovered_local_descriptors_identifier_value_index = (int) value_32bit;
+
+			index_value_data += sizeof( pff_recover_checkpoint_recovered_item_t );
+
+			if( libcdata_tree_node_initialize(
+			     &item_tree_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create item tree node.",
+				 function );
+
+				goto on_error;
+			}
+			if( libcdata_tree_node_set_value(
+			     item_tree_node,
+			     (intptr_t *) item_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set item descriptor in item tree node.",
+				 function );
+
+				goto on_error;
+			}
+			item_descriptor = NULL;
+
+			if( libcdata_array_append_entry(
+			     recovered_item_array,
+			     &entry_index,
+			     (intptr_t *) item_tree_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append tree node to recovered item array.",
+				 function );
+
+				goto on_error;
+			}
+			item_tree_node = NULL;
+		}
+	}
+	checkpoint->file_type      = ( (pff_recover_checkpoint_header_t *) data )->file_type;
+	checkpoint->recovery_flags = ( (pff_recover_checkpoint_header_t *) data )->recovery_flags;
+	checkpoint->flags          = ( (pff_recover_checkpoint_header_t *) data )->flags;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->file_size,
+	 checkpoint->file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->number_of_unallocated_data_blocks,
+	 value_32bit );
+
+	checkpoint->number_of_unallocated_data_blocks = (int) value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->number_of_unallocated_page_blocks,
+	 value_32bit );
+
+	checkpoint->number_of_unallocated_page_blocks = (int) value_32bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->number_of_scanned_chunks,
+	 checkpoint->number_of_scanned_chunks );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->scan_offset,
+	 checkpoint->scan_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of scanned chunks\t\t: %" PRIu64 "\n",
+		 function,
+		 checkpoint->number_of_scanned_chunks );
+
+		libcnotify_printf(
+		 "%s: scan offset\t\t\t\t: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 checkpoint->scan_offset,
+		 checkpoint->scan_offset );
+
+		libcnotify_printf(
+		 "%s: descriptors index root node offset\t: %" PRIu64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 descriptors_index_root_node_offset,
+		 descriptors_index_root_node_offset );
+
+		libcnotify_printf(
+		 "%s: descriptors index root node back pointer\t: 0x%08" PRIx64 "\n",
+		 function,
+		 descriptors_index_root_node_back_pointer );
+
+		libcnotify_printf(
+		 "%s: offsets index root node offset\t\t: %" PRIu64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 offsets_index_root_node_offset,
+		 offsets_index_root_node_offset );
+
+		libcnotify_printf(
+		 "%s: offsets index root node back pointer\t: 0x%08" PRIx64 "\n",
+		 function,
+		 offsets_index_root_node_back_pointer );
+
+		libcnotify_printf(
+		 "%s: number of descriptors index values\t: %" PRIu32 "\n",
+		 function,
+		 number_of_descriptors_index_values );
+
+		libcnotify_printf(
+		 "%s: number of offsets index values\t: %" PRIu32 "\n",
+		 function,
+		 number_of_offsets_index_values );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	checkpoint->sequence_number          = sequence_number;
+	checkpoint->number_of_written_chunks = checkpoint->number_of_scanned_chunks;
+	checkpoint->is_restored              = 1;
+
+	return( 1 );
+
+on_error:
+	if( item_tree_node != NULL )
+	{
+		libcdata_tree_node_free(
+		 &item_tree_node,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libpff_item_descriptor_free,
+		 NULL );
+	}
+	if( item_descriptor != NULL )
+	{
+		libpff_item_descriptor_free(
+		 &item_descriptor,
+		 NULL );
+	}
+	if( index_value != NULL )
+	{
+		libpff_index_value_free(
+		 &index_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the recovered index values of a recovered index values tree
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_checkpoint_write_index_values(
+     libcdata_btree_t *recovered_index_values_tree,
+     uint8_t index_type,
+     uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error )
+{
+	libpff_index_value_t *index_value             = NULL;
+	libpff_index_values_list_t *index_values_list = NULL;
+	static char *function                         = "libpff_recover_checkpoint_write_index_values";
+	size_t entry_size                             = 0;
+	size_t safe_data_offset                       = 0;
+	int index_value_index                         = 0;
+	int index_values_list_index                   = 0;
+	int number_of_index_values                    = 0;
+	int number_of_index_values_lists              = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_type == LIBPFF_INDEX_TYPE_DESCRIPTOR )
+	{
+		entry_size = sizeof( pff_recover_checkpoint_descriptors_index_value_t );
+	}
+	else
+	{
+		entry_size = sizeof( pff_recover_checkpoint_offsets_index_value_t );
+	}
+	safe_data_offset = *data_offset;
+
+	if( libcdata_btree_get_number_of_values(
+	     recovered_index_values_tree,
+	     &number_of_index_values_lists,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered index values lists.",
+		 function );
+
+		return( -1 );
+	}
+	for( index_values_list_index = 0;
+	     index_values_list_index < number_of_index_values_lists;
+	     index_values_list_index++ )
+	{
+		if( libcdata_btree_get_value_by_index(
+		     recovered_index_values_tree,
+		     index_values_list_index,
+		     (intptr_t **) &index_values_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve recovered index values list: %d.",
+			 function,
+			 index_values_list_index );
+
+			return( -1 );
+		}
+		if( libpff_index_values_list_number_of_values(
+		     index_values_list,
+		     &number_of_index_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of values of recovered index values list: %d.",
+			 function,
+			 index_values_list_index );
+
+			return( -1 );
+		}
+		for( index_value_index = 0;
+		     index_value_index < number_of_index_values;
+		     index_value_index++ )
+		{
+			if( libpff_index_values_list_get_value_by_index(
+			     index_values_list,
+			     index_value_index,
+			     &index_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve recovered index value: %" PRIu64 " list element: %d.",
+				 function,
+				 index_values_list->identifier,
+				 index_value_index );
+
+				return( -1 );
+			}
+			if( index_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing recovered index value: %" PRIu64 " list element: %d.",
+				 function,
+				 index_values_list->identifier,
+				 index_value_index );
+
+				return( -1 );
+			}
+			if( ( safe_data_offset > data_size )
+			 || ( entry_size > ( data_size - safe_data_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( index_type == LIBPFF_INDEX_TYPE_DESCRIPTOR )
+			{
+				byte_stream_copy_from_uint64_little_endian(
+				 ( (pff_recover_checkpoint_descriptors_index_value_t *) &( data[ safe_data_offset ] ) )->identifier,
+				 index_value->identifier );
+
+				byte_stream_copy_from_uint64_little_endian(
+				 ( (pff_recover_checkpoint_descriptors_index_value_t *) &( data[ safe_data_offset ] ) )->data_identifier,
+				 index_value->data_identifier );
+
+				byte_stream_copy_from_uint64_little_endian(
+				 ( (pff_recover_checkpoint_descriptors_index_value_t *) &( data[ safe_data_offset ] ) )->local_descriptors_identifier,
+				 index_value->local_descriptors_identifier );
+
+				byte_stream_copy_from_uint32_little_endian(
+				 ( (pff_recover_checkpoint_descriptors_index_value_t *) &( data[ safe_data_offset ] ) )->parent_identifier,
+				 index_value->parent_identifier );
+			}
+			else
+			{
+				byte_stream_copy_from_uint64_little_endian(
+				 ( (pff_recover_checkpoint_offsets_index_value_t *) &( data[ safe_data_offset ] ) )->identifier,
+				 index_value->identifier );
+
+				byte_stream_copy_from_uint64_little_endian(
+				 ( (pff_recover_checkpoint_offsets_index_value_t *) &( data[ safe_data_offset ] ) )->file_offset,
+				 index_value->file_offset );
+
+				byte_stream_copy_from_uint32_little_endian(
+				 ( (pff_recover_checkpoint_offsets_index_value_t *) &( data[ safe_data_offset ] ) )->data_size,
+				 index_value->data_size );
+
+				byte_stream_copy_from_uint16_little_endian(
+				 ( (pff_recover_checkpoint_offsets_index_value_t *) &( data[ safe_data_offset ] ) )->reference_count,
+				 index_value->reference_count );
+			}
+			safe_data_offset += entry_size;
+		}
+	}
+	*data_offset = safe_data_offset;
+
+	return( 1 );
+}
+
+/* Writes the recovered items of a recovered item array
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_checkpoint_write_recovered_items(
+     libcdata_array_t *recovered_item_array,
+     uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *item_tree_node      = NULL;
+	libpff_item_descriptor_t *item_descriptor = NULL;
+	static char *function                     = "libpff_recover_checkpoint_write_recovered_items";
+	size_t safe_data_offset                   = 0;
+	int item_index                            = 0;
+	int number_of_items                       = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_offset = *data_offset;
+
+	if( libcdata_array_get_number_of_entries(
+	     recovered_item_array,
+	     &number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered items.",
+		 function );
+
+		return( -1 );
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     recovered_item_array,
+		     item_index,
+		     (intptr_t **) &item_tree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve recovered item tree node: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		if( libcdata_tree_node_get_value(
+		     item_tree_node,
+		     (intptr_t **) &item_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve recovered item descriptor.",
+			 function );
+
+			return( -1 );
+		}
+		if( item_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing recovered item descriptor.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( safe_data_offset > data_size )
+		 || ( sizeof( pff_recover_checkpoint_recovered_item_t ) > ( data_size - safe_data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (pff_recover_checkpoint_recovered_item_t *) &( data[ safe_data_offset ] ) )->descriptor_identifier,
+		 item_descriptor->descriptor_identifier );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (pff_recover_checkpoint_recovered_item_t *) &( data[ safe_data_offset ] ) )->recovered_data_identifier_value_index,
+		 item_descriptor->recovered_data_identifier_value_index );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (pff_recover_checkpoint_recovered_item_t *) &( data[ safe_data_offset ] ) )->recovered_local_descriptors_identifier_value_index,
+		 item_descriptor->recovered_local_descriptors_identifier_value_index );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (pff_recover_checkpoint_recovered_item_t *) &( data[ safe_data_offset ] ) )->data_identifier,
+		 item_descriptor->data_identifier );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (pff_recover_checkpoint_recovered_item_t *) &( data[ safe_data_offset ] ) )->local_descriptors_identifier,
+		 item_descriptor->local_descriptors_identifier );
+
+		safe_data_offset += sizeof( pff_recover_checkpoint_recovered_item_t );
+	}
+	*data_offset = safe_data_offset;
+
+	return( 1 );
+}
+
+/* Writes a recovery checkpoint
+ * Use libpff_recover_checkpoint_get_data_size to determine the size of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_checkpoint_write_data(
+     libpff_recover_checkpoint_t *checkpoint,
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_offsets_index_t *offsets_index,
+     libcdata_array_t *recovered_item_array,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function                       = "libpff_recover_checkpoint_write_data";
+	size_t data_offset                          = 0;
+	size_t descriptors_index_values_data_offset = 0;
+	size_t offsets_index_values_data_offset     = 0;
+	uint32_t calculated_checksum                = 0;
+	uint32_t number_of_descriptors_index_values = 0;
+	uint32_t number_of_offsets_index_values     = 0;
+	uint32_t number_of_recovered_items          = 0;
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptors_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptors index.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptors_index->index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid descriptors index - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets index.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets_index->index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid offsets index - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( pff_recover_checkpoint_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear checkpoint data.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = sizeof( pff_recover_checkpoint_header_t );
+
+	if( libpff_recover_checkpoint_write_index_values(
+	     descriptors_index->recovered_index_values_tree,
+	     LIBPFF_INDEX_TYPE_DESCRIPTOR,
+	     data,
+	     data_size,
+	     &data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write recovered descriptors index values.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_descriptors_index_values = (uint32_t) ( ( data_offset - sizeof( pff_recover_checkpoint_header_t ) ) / sizeof( pff_recover_checkpoint_descriptors_index_value_t ) );
+
+	descriptors_index_values_data_offset = data_offset;
+
+	if( libpff_recover_checkpoint_write_index_values(
+	     offsets_index->recovered_index_values_tree,
+	     LIBPFF_INDEX_TYPE_OFFSET,
+	     data,
+	     data_size,
+	     &data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write recovered offsets index values.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_offsets_index_values = (uint32_t) ( ( data_offset - descriptors_index_values_data_offset ) / sizeof( pff_recover_checkpoint_offsets_index_value_t ) );
+
+	offsets_index_values_data_offset = data_offset;
+
+	if( recovered_item_array != NULL )
+	{
+		if( libpff_recover_checkpoint_write_recovered_items(
+		     recovered_item_array,
+		     data,
+		     data_size,
+		     &data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write recovered items.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_recovered_items = (uint32_t) ( ( data_offset - offsets_index_values_data_offset ) / sizeof( pff_recover_checkpoint_recovered_item_t ) );
+	}
+
+	if( data_offset != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( (pff_recover_checkpoint_header_t *) data )->signature,
+	     pff_recover_checkpoint_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->format_version,
+	 LIBPFF_RECOVER_CHECKPOINT_FORMAT_VERSION );
+
+	( (pff_recover_checkpoint_header_t *) data )->file_type      = checkpoint->file_type;
+	( (pff_recover_checkpoint_header_t *) data )->recovery_flags = checkpoint->recovery_flags;
+	( (pff_recover_checkpoint_header_t *) data )->flags          = checkpoint->flags;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->file_size,
+	 checkpoint->file_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->number_of_unallocated_data_blocks,
+	 checkpoint->number_of_unallocated_data_blocks );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->number_of_unallocated_page_blocks,
+	 checkpoint->number_of_unallocated_page_blocks );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->number_of_scanned_chunks,
+	 checkpoint->number_of_scanned_chunks );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->scan_offset,
+	 checkpoint->scan_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->descriptors_index_root_node_offset,
+	 descriptors_index->index->root_node_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->descriptors_index_root_node_back_pointer,
+	 descriptors_index->index->root_node_back_pointer );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->offsets_index_root_node_offset,
+	 offsets_index->index->root_node_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->offsets_index_root_node_back_pointer,
+	 offsets_index->index->root_node_back_pointer );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->number_of_descriptors_index_values,
+	 number_of_descriptors_index_values );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->number_of_offsets_index_values,
+	 number_of_offsets_index_values );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->number_of_recovered_items,
+	 number_of_recovered_items );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->sequence_number,
+	 checkpoint->sequence_number );
+
+	if( libpff_checksum_calculate_crc32(
+	     &calculated_checksum,
+	     data,
+	     sizeof( pff_recover_checkpoint_header_t ) - 4,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libpff_checksum_calculate_crc32(
+	     &calculated_checksum,
+	     &( data[ sizeof( pff_recover_checkpoint_header_t ) ] ),
+	     data_size - sizeof( pff_recover_checkpoint_header_t ),
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->checksum,
+	 calculated_checksum );
+
+	return( 1 );
+}
+
+/* Writes a recovery checkpoint to the checkpoint file
+ * If an alternate checkpoint file is set the checkpoint is written to the file
+ * that does not contain the most recent checkpoint, otherwise the checkpoint file
+ * is truncated and rewritten as a whole
+ * Returns 1 if successful or -1 on error
+ */
+int libpff_recover_checkpoint_write(
+     libpff_recover_checkpoint_t *checkpoint,
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_offsets_index_t *offsets_index,
+     libcdata_array_t *recovered_item_array,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	uint8_t *data                    = NULL;
+	static char *function            = "libpff_recover_checkpoint_write";
+	size_t data_size                 = 0;
+	ssize_t write_count              = 0;
+	uint32_t sequence_number         = 0;
+	int file_io_handle_index         = 0;
+	int file_io_handle_is_open       = 0;
+
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( checkpoint->alternate_file_io_handle != NULL )
+	 && ( checkpoint->file_io_handle_index == 0 ) )
+	{
+		file_io_handle       = checkpoint->alternate_file_io_handle;
+		file_io_handle_index = 1;
+	}
+	else
+	{
+		file_io_handle       = checkpoint->file_io_handle;
+		file_io_handle_index = 0;
+	}
+	sequence_number = checkpoint->sequence_number;
+
+	checkpoint->sequence_number += 1;
+
+	if( libpff_recover_checkpoint_get_data_size(
+	     checkpoint,
+	     descriptors_index,
+	     offsets_index,
+	     recovered_item_array,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve checkpoint data size.",
+		 function );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create checkpoint data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libpff_recover_checkpoint_write_data(
+	     checkpoint,
+	     descriptors_index,
+	     offsets_index,
+	     recovered_item_array,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: writing checkpoint after: %" PRIu64 " scanned chunks of size: %" PRIzd "\n",
+		 function,
+		 checkpoint->number_of_scanned_chunks,
+		 data_size );
+	}
+#endif
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open checkpoint file.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = 1;
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               data,
+	               data_size,
+	               0,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint data.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = 0;
+
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close checkpoint file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	checkpoint->file_io_handle_index     = file_io_handle_index;
+	checkpoint->number_of_written_chunks = checkpoint->number_of_scanned_chunks;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	checkpoint->sequence_number = sequence_number;
+
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,222 @@
+/*
+ * Recovery checkpoint functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBPFF_RECOVER_CHECKPOINT_H )
+#define _LIBPFF_RECOVER_CHECKPOINT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libpff_descriptors_index.h"
+#include "libpff_libbfio.h"
+#include "libpff_libcdata.h"
+#include "libpff_libcerror.h"
+#include "libpff_offsets_index.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define LIBPFF_RECOVER_CHECKPOINT_FORMAT_VERSION	3
+
+extern const uint8_t pff_recover_checkpoint_signature[ 8 ];
+
+typedef struct libpff_recover_checkpoint libpff_recover_checkpoint_t;
+
+struct libpff_recover_checkpoint
+{
+	/* The checkpoint file IO handle
+	 * This is a reference to the file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The alternate checkpoint file IO handle
+	 * This is a reference to the file IO handle, NULL if not set
+	 */
+	libbfio_handle_t *alternate_file_io_handle;
+
+	/* The index of the file IO handle that contains the most recent checkpoint
+	 * 0 for the checkpoint file, 1 for the alternate checkpoint file or -1 if not set
+	 */
+	int file_io_handle_index;
+
+	/* The sequence number of the most recent checkpoint
+	 */
+	uint32_t sequence_number;
+
+	/* Value to indicate the checkpoint was restored from the file
+	 */
+	uint8_t is_restored;
+
+	/* Value to indicate the file type and size of the checkpoint must match
+	 */
+	uint8_t has_file_parameters;
+
+	/* The file type
+	 */
+	uint8_t file_type;
+
+	/* The recovery flags
+	 */
+	uint8_t recovery_flags;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The size of the file
+	 */
+	size64_t file_size;
+
+	/* The number of unallocated data blocks
+	 */
+	int number_of_unallocated_data_blocks;
+
+	/* The number of unallocated page blocks
+	 */
+	int number_of_unallocated_page_blocks;
+
+	/* The number of scanned chunks
+	 * The chunks before this number were scanned and merged into the recovered indexes
+	 */
+	uint64_t number_of_scanned_chunks;
+
+	/* The number of scanned chunks when the checkpoint was last written
+	 */
+	uint64_t number_of_written_chunks;
+
+	/* The scan offset
+	 * This is the end offset of the last scanned chunk
+	 */
+	off64_t scan_offset;
+};
+
+int libpff_recover_checkpoint_initialize(
+     libpff_recover_checkpoint_t **checkpoint,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *alternate_file_io_handle,
+     libcerror_error_t **error );
+
+int libpff_recover_checkpoint_free(
+     libpff_recover_checkpoint_t **checkpoint,
+     libcerror_error_t **error );
+
+int libpff_recover_checkpoint_set_file_parameters(
+     libpff_recover_checkpoint_t *checkpoint,
+     uint8_t file_type,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+int libpff_recover_checkpoint_set_scan_parameters(
+     libpff_recover_checkpoint_t *checkpoint,
+     uint8_t file_type,
+     uint8_t recovery_flags,
+     size64_t file_size,
+     int number_of_unallocated_data_blocks,
+     int number_of_unallocated_page_blocks,
+     libcerror_error_t **error );
+
+int libpff_recover_checkpoint_update(
+     libpff_recover_checkpoint_t *checkpoint,
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_offsets_index_t *offsets_index,
+     uint64_t number_of_scanned_chunks,
+     off64_t scan_offset,
+     libcerror_error_t **error );
+
+int libpff_recover_checkpoint_read_file(
+     libbfio_handle_t *file_io_handle,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libpff_recover_checkpoint_read(
+     libpff_recover_checkpoint_t *checkpoint,
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_offsets_index_t *offsets_index,
+     libcdata_array_t *recovered_item_array,
+     libcerror_error_t **error );
+
+int libpff_recover_checkpoint_get_data_size(
+     libpff_recover_checkpoint_t *checkpoint,
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_offsets_index_t *offsets_index,
+     libcdata_array_t *recovered_item_array,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libpff_recover_checkpoint_check_data(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *sequence_number,
+     libcerror_error_t **error );
+
+int libpff_recover_checkpoint_read_data(
+     libpff_recover_checkpoint_t *checkpoint,
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_offsets_index_t *offsets_index,
+     libcdata_array_t *recovered_item_array,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libpff_recover_checkpoint_write_index_values(
+     libcdata_btree_t *recovered_index_values_tree,
+     uint8_t index_type,
+     uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error );
+
+int libpff_recover_checkpoint_write_recovered_items(
+     libcdata_array_t *recovered_item_array,
+     uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error );
+
+int libpff_recover_checkpoint_write_data(
+     libpff_recover_checkpoint_t *checkpoint,
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_offsets_index_t *offsets_index,
+     libcdata_array_t *recovered_item_array,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libpff_recover_checkpoint_write(
+     libpff_recover_checkpoint_t *checkpoint,
+     libpff_descriptors_index_t *descriptors_index,
+     libpff_offsets_index_t *offsets_index,
+     libcdata_array_t *recovered_item_array,
+     libcerror_error_t **error );
+
+int libpff_recover_checkpoint_get_number_of_index_values(
+     libcdata_btree_t *recovered_index_values_tree,
+     uint32_t *number_of_index_values,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBPFF_RECOVER_CHECKPOINT_H ) */
+
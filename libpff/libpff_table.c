@@ -9755,6 +9755,29 @@ int libpff_table_read_entry_value(
 			          value_data_list,
 			          value_data_cache,
 			          error );
+
+			/* The value data list is kept by the record entry when the value data
+			 * is stored as-is, so its extents can be determined on demand
+			 */
+			if( result == 1 )
+			{
+				result = libpff_record_entry_set_value_data_list(
+				          (libpff_record_entry_t *) record_entry,
+				          io_handle,
+				          value_data_list,
+				          error );
+
+				if( result == 1 )
+				{
+					/* The value data list is now managed by the record entry
+					 */
+					value_data_list = NULL;
+				}
+				else if( result == 0 )
+				{
+					result = 1;
+				}
+			}
 		}
 		else
 		{
@@ -0,0 +1,239 @@
+/*
+ * The recovery checkpoint definition of libpff
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PFF_RECOVER_CHECKPOINT_H )
+#define _PFF_RECOVER_CHECKPOINT_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pff_recover_checkpoint_header pff_recover_checkpoint_header_t;
+
+struct pff_recover_checkpoint_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "PFFRCKPT"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The file type
+	 * Consists of 1 byte
+	 */
+	uint8_t file_type;
+
+	/* The recovery flags
+	 * Consists of 1 byte
+	 */
+	uint8_t recovery_flags;
+
+	/* The flags
+	 * Consists of 1 byte
+	 */
+	uint8_t flags;
+
+	/* Padding
+	 * Consists of 1 byte
+	 */
+	uint8_t padding1;
+
+	/* The size of the file
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* The number of unallocated data blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_unallocated_data_blocks[ 4 ];
+
+	/* The number of unallocated page blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_unallocated_page_blocks[ 4 ];
+
+	/* The number of scanned chunks
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_scanned_chunks[ 8 ];
+
+	/* The scan offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t scan_offset[ 8 ];
+
+	/* The descriptors index root node offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t descriptors_index_root_node_offset[ 8 ];
+
+	/* The descriptors index root node back pointer
+	 * Consists of 8 bytes
+	 */
+	uint8_t descriptors_index_root_node_back_pointer[ 8 ];
+
+	/* The offsets index root node offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t offsets_index_root_node_offset[ 8 ];
+
+	/* The offsets index root node back pointer
+	 * Consists of 8 bytes
+	 */
+	uint8_t offsets_index_root_node_back_pointer[ 8 ];
+
+	/* The number of recovered descriptors index values
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_descriptors_index_values[ 4 ];
+
+	/* The number of recovered offsets index values
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_offsets_index_values[ 4 ];
+
+	/* The number of recovered items
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_recovered_items[ 4 ];
+
+	/* The sequence number
+	 * Consists of 4 bytes
+	 */
+	uint8_t sequence_number[ 4 ];
+
+	/* A CRC-32 checksum of the header data before the checksum
+	 * and of the index values and recovered items data
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+typedef struct pff_recover_checkpoint_descriptors_index_value pff_recover_checkpoint_descriptors_index_value_t;
+
+struct pff_recover_checkpoint_descriptors_index_value
+{
+	/* The identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t identifier[ 8 ];
+
+	/* The data identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_identifier[ 8 ];
+
+	/* The local descriptors identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t local_descriptors_identifier[ 8 ];
+
+	/* The parent identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t parent_identifier[ 4 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding1[ 4 ];
+};
+
+typedef struct pff_recover_checkpoint_offsets_index_value pff_recover_checkpoint_offsets_index_value_t;
+
+struct pff_recover_checkpoint_offsets_index_value
+{
+	/* The identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t identifier[ 8 ];
+
+	/* The file offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_offset[ 8 ];
+
+	/* The data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_size[ 4 ];
+
+	/* The reference count
+	 * Consists of 2 bytes
+	 */
+	uint8_t reference_count[ 2 ];
+
+	/* Padding
+	 * Consists of 2 bytes
+	 */
+	uint8_t padding1[ 2 ];
+};
+
+typedef struct pff_recover_checkpoint_recovered_item pff_recover_checkpoint_recovered_item_t;
+
+struct pff_recover_checkpoint_recovered_item
+{
+	/* The descriptor identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t descriptor_identifier[ 4 ];
+
+	/* The value index of the recovered data identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t recovered_data_identifier_value_index[ 4 ];
+
+	/* The value index of the recovered local descriptors identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t recovered_local_descriptors_identifier_value_index[ 4 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding1[ 4 ];
+
+	/* The data identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_identifier[ 8 ];
+
+	/* The local descriptors identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t local_descriptors_identifier[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PFF_RECOVER_CHECKPOINT_H ) */
+
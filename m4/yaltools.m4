@@ -84,6 +84,9 @@ AC_DEFUN([AX_PFFTOOLS_CHECK_LOCAL],
      [1])
   ])
 
+  dnl Functions used in pfftools/export_handle.c
+  AC_CHECK_FUNCS([copy_file_range])
+
   dnl Headers included in pfftools/log_handle.c
   AC_CHECK_HEADERS([stdarg.h varargs.h])
 
@@ -19,6 +19,12 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#if defined( __linux__ ) && !defined( _GNU_SOURCE )
+/* Required for the declaration of copy_file_range
+ */
+#define _GNU_SOURCE
+#endif
+
 #include <common.h>
 #include <byte_stream.h>
 #include <file_stream.h>
@@ -28,6 +34,12 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_COPY_FILE_RANGE )
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 #include "export_handle.h"
 #include "item_file.h"
 #include "mapi_property_definition.h"
@@ -44,6 +56,7 @@
 #include "pfftools_libpff.h"
 
 #define EXPORT_HANDLE_BUFFER_SIZE		8192
+#define EXPORT_HANDLE_WRITE_BUFFER_SIZE		( 1024 * 1024 )
 #define EXPORT_HANDLE_NOTIFY_STREAM		stdout
 
 /* Creates an export handle
@@ -112,6 +125,10 @@ int export_handle_initialize(
 	( *export_handle )->print_status_information = 1;
 	( *export_handle )->notify_stream            = EXPORT_HANDLE_NOTIFY_STREAM;
 
+#if defined( HAVE_COPY_FILE_RANGE )
+	( *export_handle )->source_file_descriptor = -1;
+#endif
+
 	return( 1 );
 
 on_error:
@@ -167,6 +184,13 @@ int export_handle_free(
 			memory_free(
 			 ( *export_handle )->recovered_export_path );
 		}
+#if defined( HAVE_COPY_FILE_RANGE )
+		if( ( *export_handle )->source_file_descriptor != -1 )
+		{
+			close(
+			 ( *export_handle )->source_file_descriptor );
+		}
+#endif
 		memory_free(
 		 *export_handle );
 
@@ -200,6 +224,65 @@ int export_handle_signal_abort(
 	return( 1 );
 }
 
+/* Opens the source file to copy attachment data directly from
+ * This is optional, if the source file cannot be opened the attachment data is read using libpff
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int export_handle_open_source_file(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_source_file";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_COPY_FILE_RANGE ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( export_handle->source_file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - source file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->source_file_descriptor = open(
+	                                         filename,
+	                                         O_RDONLY );
+
+	if( export_handle->source_file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
 /* Sets the export mode
  * Returns 1 if successful, 0 if unsupported values or -1 on error
  */
@@ -7906,6 +7989,272 @@ on_error:
 	return( -1 );
 }
 
+/* Writes attachment data to a file stream
+ * Callback function for libpff_attachment_data_write_to_callback
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t export_handle_write_attachment_data(
+         intptr_t *file_stream,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function = "export_handle_write_attachment_data";
+	size_t write_count    = 0;
+
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = file_stream_write(
+	               (FILE *) file_stream,
+	               buffer,
+	               buffer_size );
+
+	if( write_count != buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data to file stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) write_count );
+}
+
+/* Copies the attachment data extents from the source file to a file stream
+ * The data is copied within the kernel, without passing it through user space buffers
+ * The extents are only available if the attachment data is stored as-is in the source file,
+ * that is not encrypted or compressed, and the data blocks were read and validated by libpff
+ * If the extents do not cover the attachment data size the data is not copied
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int export_handle_copy_attachment_data_extents(
+     export_handle_t *export_handle,
+     libpff_item_t *attachment,
+     FILE *file_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_copy_attachment_data_extents";
+
+#if defined( HAVE_COPY_FILE_RANGE )
+	size64_t data_size    = 0;
+	size64_t extents_size = 0;
+	size64_t extent_size  = 0;
+	off64_t extent_offset = 0;
+	loff_t source_offset  = 0;
+	ssize_t copy_count    = 0;
+	size_t copy_size      = 0;
+	int extent_index      = 0;
+	int number_of_extents = 0;
+	int result            = 0;
+#endif
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file stream.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_COPY_FILE_RANGE )
+	if( export_handle->source_file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	result = libpff_attachment_get_number_of_data_extents(
+	          attachment,
+	          &number_of_extents,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attachment data extents.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libpff_attachment_get_data_size(
+	     attachment,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attachment data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the extents cover exactly the attachment data before anything is written
+	 * otherwise the attachment data is read using libpff
+	 */
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libpff_attachment_get_data_extent_by_index(
+		     attachment,
+		     extent_index,
+		     &extent_offset,
+		     &extent_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attachment data extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( ( extent_offset < 0 )
+		 || ( extent_size > ( data_size - extents_size ) ) )
+		{
+			return( 0 );
+		}
+		extents_size += extent_size;
+	}
+	if( extents_size != data_size )
+	{
+		return( 0 );
+	}
+	if( fflush(
+	     file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush file stream.",
+		 function );
+
+		return( -1 );
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libpff_attachment_get_data_extent_by_index(
+		     attachment,
+		     extent_index,
+		     &extent_offset,
+		     &extent_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attachment data extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		source_offset = (loff_t) extent_offset;
+
+		while( extent_size > 0 )
+		{
+			if( extent_size > (size64_t) SSIZE_MAX )
+			{
+				copy_size = (size_t) SSIZE_MAX;
+			}
+			else
+			{
+				copy_size = (size_t) extent_size;
+			}
+			copy_count = copy_file_range(
+			              export_handle->source_file_descriptor,
+			              &source_offset,
+			              fileno(
+			               file_stream ),
+			              NULL,
+			              copy_size,
+			              0 );
+
+			if( copy_count <= 0 )
+			{
+				/* Fall back to reading the data using libpff if the kernel or file system
+				 * does not support copy_file_range and nothing has been written yet
+				 */
+				if( ( copy_count == -1 )
+				 && ( extent_index == 0 )
+				 && ( source_offset == (loff_t) extent_offset )
+				 && ( ( errno == EXDEV )
+				  ||  ( errno == ENOSYS )
+				  ||  ( errno == EINVAL )
+				  ||  ( errno == EOPNOTSUPP ) ) )
+				{
+					return( 0 );
+				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to copy attachment data extent: %d.",
+				 function,
+				 extent_index );
+
+				return( -1 );
+			}
+			extent_size -= (size64_t) copy_count;
+		}
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
 /* Exports the attachment data
  * Returns 1 if successful or -1 on error
  */
@@ -7922,14 +8271,9 @@ int export_handle_export_attachment_data(
 	system_character_t *attachment_filename = NULL;
 	system_character_t *target_path         = NULL;
 	FILE *attachment_file_stream            = NULL;
-	uint8_t *attachment_data                = NULL;
 	static char *function                   = "export_handle_export_attachment_data";
-	size64_t attachment_data_size           = 0;
 	size_t attachment_filename_size         = 0;
-	size_t read_size                        = 0;
 	size_t target_path_size                 = 0;
-	size_t write_count                      = 0;
-	ssize_t read_count                      = 0;
 	int result                              = 0;
 
 	if( export_handle == NULL )
@@ -8073,109 +8417,64 @@ int export_handle_export_attachment_data(
 
 	target_path = NULL;
 
-	result = libpff_attachment_get_data_size(
-		  attachment,
-		  &attachment_data_size,
-		  error );
-
-	if( result == -1 )
+#if !defined( __BORLANDC__ )
+	/* Use a large file stream buffer so that the data blocks are written in batches
+	 */
+	if( setvbuf(
+	     attachment_file_stream,
+	     NULL,
+	     _IOFBF,
+	     EXPORT_HANDLE_WRITE_BUFFER_SIZE ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve attachment data size.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set attachment file stream buffer.",
 		 function );
 
 		goto on_error;
 	}
-	/* If there is no attachment data an empty file is written
+#endif /* !defined( __BORLANDC__ ) */
+
+	/* If the attachment data is stored as-is in the source file
+	 * it is copied directly, otherwise it is read using libpff
+	 * If there is no attachment data an empty file is written
 	 */
-	if( ( result != 0 )
-	 && ( attachment_data_size > 0 ) )
+	result = export_handle_copy_attachment_data_extents(
+	          export_handle,
+	          attachment,
+	          attachment_file_stream,
+	          error );
+
+	if( result == -1 )
 	{
-		/* This function in not necessary for normal use
-		 * but it was added for testing
-		 */
-		if( libpff_attachment_data_seek_offset(
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to copy attachment data.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libpff_attachment_data_write_to_callback(
 		     attachment,
-		     0,
-		     SEEK_SET,
-		     error ) != 0 )
+		     &export_handle_write_attachment_data,
+		     (intptr_t *) attachment_file_stream,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to seek the start of the attachment data.",
-			 function );
-
-			goto on_error;
-		}
-		attachment_data = (uint8_t *) memory_allocate(
-					       sizeof( uint8_t ) * EXPORT_HANDLE_BUFFER_SIZE );
-
-		if( attachment_data == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create attachment data.",
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write attachment data.",
 			 function );
 
 			goto on_error;
 		}
-		while( attachment_data_size > 0 )
-		{
-			if( attachment_data_size >= EXPORT_HANDLE_BUFFER_SIZE )
-			{
-				read_size = EXPORT_HANDLE_BUFFER_SIZE;
-			}
-			else
-			{
-				read_size = (size_t) attachment_data_size;
-			}
-			attachment_data_size -= read_size;
-
-			read_count = libpff_attachment_data_read_buffer(
-				      attachment,
-				      attachment_data,
-				      read_size,
-				      error );
-
-			if( read_count != (ssize_t) read_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read attachment data.",
-				 function );
-
-				goto on_error;
-			}
-			write_count = file_stream_write(
-				       attachment_file_stream,
-				       attachment_data,
-				       read_size );
-
-			if( write_count != read_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_WRITE_FAILED,
-				 "%s: unable to write attachment data.",
-				 function );
-
-				goto on_error;
-			}
-		}
-		memory_free(
-		 attachment_data );
-
-		attachment_data = NULL;
 	}
 	if( file_stream_close(
 	     attachment_file_stream ) != 0 )
@@ -8196,11 +8495,6 @@ int export_handle_export_attachment_data(
 	return( 1 );
 
 on_error:
-	if( attachment_data != NULL )
-	{
-		memory_free(
-		 attachment_data );
-	}
 	if( attachment_file_stream != NULL )
 	{
 		file_stream_close(
@@ -15210,6 +15504,7 @@ int export_handle_export_file(
      libcerror_error_t **error )
 {
 	static char *function = "export_handle_export_file";
+	int result            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -15237,24 +15532,87 @@ int export_handle_export_file(
 	 && ( export_handle->export_mode != EXPORT_MODE_ITEMS )
 	 && ( export_handle->export_mode != EXPORT_MODE_ITEMS_NO_ATTACHMENTS ) )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "Recovering items.\n" );
+		if( export_handle->recovered_items_filename != NULL )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Importing recovered items.\n" );
 
-/* TODO set recovery flags somewhere */
-		if( libpff_file_recover_items(
-		     file,
-		     0,
-		     error ) != 1 )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libpff_file_import_recovered_items_wide(
+			          file,
+			          export_handle->recovered_items_filename,
+			          error );
+#else
+			result = libpff_file_import_recovered_items(
+			          file,
+			          export_handle->recovered_items_filename,
+			          error );
+#endif
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to import recovered items from file: %" PRIs_SYSTEM ".",
+				 function,
+				 export_handle->recovered_items_filename );
+
+				return( -1 );
+			}
+		}
+		if( result == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to recover items.",
-			 function );
+			fprintf(
+			 export_handle->notify_stream,
+			 "Recovering items.\n" );
 
-			return( -1 );
+/* TODO set recovery flags somewhere */
+			if( libpff_file_recover_items(
+			     file,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to recover items.",
+				 function );
+
+				return( -1 );
+			}
+			if( export_handle->recovered_items_filename != NULL )
+			{
+				fprintf(
+				 export_handle->notify_stream,
+				 "Exporting recovered items.\n" );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				result = libpff_file_export_recovered_items_wide(
+				          file,
+				          export_handle->recovered_items_filename,
+				          error );
+#else
+				result = libpff_file_export_recovered_items(
+				          file,
+				          export_handle->recovered_items_filename,
+				          error );
+#endif
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to export recovered items to file: %" PRIs_SYSTEM ".",
+					 function,
+					 export_handle->recovered_items_filename );
+
+					return( -1 );
+				}
+			}
 		}
 	}
 	if( export_handle->export_mode != EXPORT_MODE_RECOVERED )
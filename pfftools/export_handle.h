@@ -107,6 +107,12 @@ struct export_handle
 	 */
 	size_t recovered_export_path_size;
 
+	/* The recovered items filename
+	 * The recovered items are imported from this file if it exists
+	 * otherwise they are exported to it after recovery
+	 */
+	const system_character_t *recovered_items_filename;
+
 	/* The number of items
 	 */
 	int number_of_items;
@@ -143,6 +149,13 @@ struct export_handle
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+#if defined( HAVE_COPY_FILE_RANGE )
+	/* The source file descriptor
+	 * Used to copy attachment data that is stored as-is in the source file
+	 */
+	int source_file_descriptor;
+#endif
 };
 
 int export_handle_initialize(
@@ -157,6 +170,11 @@ int export_handle_signal_abort(
      export_handle_t *export_handle,
      libcerror_error_t **error );
 
+int export_handle_open_source_file(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 int export_handle_set_export_mode(
      export_handle_t *export_handle,
      const system_character_t *string,
@@ -517,6 +535,18 @@ int export_handle_get_attachment_filename(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+ssize_t export_handle_write_attachment_data(
+         intptr_t *file_stream,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+int export_handle_copy_attachment_data_extents(
+     export_handle_t *export_handle,
+     libpff_item_t *attachment,
+     FILE *file_stream,
+     libcerror_error_t **error );
+
 int export_handle_export_attachment_data(
      export_handle_t *export_handle,
      libpff_item_t *attachment,
@@ -138,6 +138,7 @@ int main( int argc, char * const argv[] )
 		{ 'l', "log_file", "logs information about the exported items" },
 		{ 'm', "mode", "export mode, option: all, debug, items (default), recovered. 'all' exports the (allocated) items, orphan and recovered items. 'debug' exports all the (allocated) items, also those outside the the root folder. 'items' exports the (allocated) items. 'recovered' exports the orphan and recovered items." },
 		{ 'q', NULL, "quiet shows minimal status information" },
+		{ 'r', "recovered_file", "specify the file to store the recovered items in. If the file exists the recovered items are imported from it instead of scanning the source file for recoverable items" },
 		{ 't', "target", "specify the basename of the target directory to export to (default is the source filename) pffexport will add the following suffixes to the basename: .export, .orphans, .recovered" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
@@ -151,6 +152,7 @@ int main( int argc, char * const argv[] )
 	system_character_t *option_codepage                = NULL;
 	system_character_t *option_export_mode             = NULL;
 	system_character_t *option_preferred_export_format = NULL;
+	system_character_t *option_recovered_items_file    = NULL;
 	system_character_t *option_target_path             = NULL;
 	system_character_t *path_separator                 = NULL;
 	system_character_t *source                         = NULL;
@@ -273,6 +275,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'r':
+				option_recovered_items_file = optarg;
+
+				break;
+
 			case (system_integer_t) 't':
 				option_target_path = optarg;
 
@@ -372,7 +379,8 @@ int main( int argc, char * const argv[] )
 			 "Unsupported export mode defaulting to: items.\n" );
 		}
 	}
-	pffexport_export_handle->dump_item_values = dump_item_values;
+	pffexport_export_handle->dump_item_values         = dump_item_values;
+	pffexport_export_handle->recovered_items_filename = option_recovered_items_file;
 
 	if( option_preferred_export_format != NULL )
 	{
@@ -570,6 +578,18 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( export_handle_open_source_file(
+	     pffexport_export_handle,
+	     source,
+	     &error ) == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
 	if( export_handle_export_file(
 	     pffexport_export_handle,
 	     pffexport_file,
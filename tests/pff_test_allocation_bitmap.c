@@ -0,0 +1,1815 @@
+/*
+ * Allocation bitmap testing program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pff_test_libcerror.h"
+#include "pff_test_macros.h"
+#include "pff_test_memory.h"
+#include "pff_test_unused.h"
+
+#include "../libpff/libpff_allocation_bitmap.h"
+
+/* Allocation table data where a clear bit marks an unallocated unit
+ * Units 4 - 7, 60 - 71 and 127 are unallocated
+ */
+uint8_t pff_test_allocation_bitmap_data1[ 16 ] = {
+	0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe };
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+/* Tests the libpff_allocation_bitmap_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_allocation_bitmap_initialize(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libpff_allocation_bitmap_t *allocation_bitmap = NULL;
+	int result                                    = 0;
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+	int number_of_malloc_fail_tests               = 2;
+	int number_of_memset_fail_tests               = 2;
+	int test_number                               = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libpff_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          16384,
+	          64,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_free(
+	          &allocation_bitmap,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_allocation_bitmap_initialize(
+	          NULL,
+	          16384,
+	          64,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	allocation_bitmap = (libpff_allocation_bitmap_t *) 0x12345678UL;
+
+	result = libpff_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          16384,
+	          64,
+	          &error );
+
+	allocation_bitmap = NULL;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          16384,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          (size64_t) UINT64_MAX,
+	          1,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libpff_allocation_bitmap_initialize with malloc failing
+		 */
+		pff_test_malloc_attempts_before_fail = test_number;
+
+		result = libpff_allocation_bitmap_initialize(
+		          &allocation_bitmap,
+		          16384,
+		          64,
+		          &error );
+
+		if( pff_test_malloc_attempts_before_fail != -1 )
+		{
+			pff_test_malloc_attempts_before_fail = -1;
+
+			if( allocation_bitmap != NULL )
+			{
+				libpff_allocation_bitmap_free(
+				 &allocation_bitmap,
+				 NULL );
+			}
+		}
+		else
+		{
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "allocation_bitmap",
+			 allocation_bitmap );
+
+			PFF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libpff_allocation_bitmap_initialize with memset failing
+		 */
+		pff_test_memset_attempts_before_fail = test_number;
+
+		result = libpff_allocation_bitmap_initialize(
+		          &allocation_bitmap,
+		          16384,
+		          64,
+		          &error );
+
+		if( pff_test_memset_attempts_before_fail != -1 )
+		{
+			pff_test_memset_attempts_before_fail = -1;
+
+			if( allocation_bitmap != NULL )
+			{
+				libpff_allocation_bitmap_free(
+				 &allocation_bitmap,
+				 NULL );
+			}
+		}
+		else
+		{
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "allocation_bitmap",
+			 allocation_bitmap );
+
+			PFF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_PFF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_bitmap != NULL )
+	{
+		libpff_allocation_bitmap_free(
+		 &allocation_bitmap,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_allocation_bitmap_free function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_allocation_bitmap_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libpff_allocation_bitmap_free(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_allocation_bitmap_get_number_of_trailing_zero_bits function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_allocation_bitmap_get_number_of_trailing_zero_bits(
+     void )
+{
+	uint8_t number_of_bits = 0;
+
+	/* Test regular cases
+	 */
+	number_of_bits = libpff_allocation_bitmap_get_number_of_trailing_zero_bits(
+	                  0x0000000000000000ULL );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_bits",
+	 number_of_bits,
+	 64 );
+
+	number_of_bits = libpff_allocation_bitmap_get_number_of_trailing_zero_bits(
+	                  0x0000000000000001ULL );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_bits",
+	 number_of_bits,
+	 0 );
+
+	number_of_bits = libpff_allocation_bitmap_get_number_of_trailing_zero_bits(
+	                  0x0000000000000110ULL );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_bits",
+	 number_of_bits,
+	 4 );
+
+	number_of_bits = libpff_allocation_bitmap_get_number_of_trailing_zero_bits(
+	                  0x8000000000000000ULL );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_bits",
+	 number_of_bits,
+	 63 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libpff_allocation_bitmap_get_number_of_set_bits function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_allocation_bitmap_get_number_of_set_bits(
+     void )
+{
+	uint8_t number_of_bits = 0;
+
+	/* Test regular cases
+	 */
+	number_of_bits = libpff_allocation_bitmap_get_number_of_set_bits(
+	                  0x0000000000000000ULL );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_bits",
+	 number_of_bits,
+	 0 );
+
+	number_of_bits = libpff_allocation_bitmap_get_number_of_set_bits(
+	                  0x0101010101010101ULL );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_bits",
+	 number_of_bits,
+	 8 );
+
+	number_of_bits = libpff_allocation_bitmap_get_number_of_set_bits(
+	                  0x8000000000000001ULL );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_bits",
+	 number_of_bits,
+	 2 );
+
+	number_of_bits = libpff_allocation_bitmap_get_number_of_set_bits(
+	                  0xffffffffffffffffULL );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_bits",
+	 number_of_bits,
+	 64 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libpff_allocation_bitmap_read_allocation_table_data function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_allocation_bitmap_read_allocation_table_data(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libpff_allocation_bitmap_t *allocation_bitmap = NULL;
+	int number_of_ranges                          = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          16384,
+	          64,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_allocation_bitmap_read_allocation_table_data(
+	          allocation_bitmap,
+	          0,
+	          pff_test_allocation_bitmap_data1,
+	          16,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_get_number_of_ranges(
+	          allocation_bitmap,
+	          &number_of_ranges,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 3 );
+
+	/* Test reading data at an offset that is not aligned with a word
+	 * where the units beyond the end of the bitmap are ignored
+	 */
+	result = libpff_allocation_bitmap_read_allocation_table_data(
+	          allocation_bitmap,
+	          200 * 64,
+	          pff_test_allocation_bitmap_data1,
+	          16,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_get_number_of_ranges(
+	          allocation_bitmap,
+	          &number_of_ranges,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 4 );
+
+	/* Test error cases
+	 */
+	result = libpff_allocation_bitmap_read_allocation_table_data(
+	          NULL,
+	          0,
+	          pff_test_allocation_bitmap_data1,
+	          16,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_read_allocation_table_data(
+	          allocation_bitmap,
+	          -1,
+	          pff_test_allocation_bitmap_data1,
+	          16,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_read_allocation_table_data(
+	          allocation_bitmap,
+	          1,
+	          pff_test_allocation_bitmap_data1,
+	          16,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_read_allocation_table_data(
+	          allocation_bitmap,
+	          0,
+	          NULL,
+	          16,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_read_allocation_table_data(
+	          allocation_bitmap,
+	          0,
+	          pff_test_allocation_bitmap_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_read_allocation_table_data(
+	          allocation_bitmap,
+	          0,
+	          pff_test_allocation_bitmap_data1,
+	          15,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_allocation_bitmap_free(
+	          &allocation_bitmap,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_bitmap != NULL )
+	{
+		libpff_allocation_bitmap_free(
+		 &allocation_bitmap,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_allocation_bitmap_get_next_range function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_allocation_bitmap_get_next_range(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libpff_allocation_bitmap_t *allocation_bitmap = NULL;
+	size64_t range_size                           = 0;
+	off64_t range_offset                          = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          16384,
+	          64,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_read_allocation_table_data(
+	          allocation_bitmap,
+	          0,
+	          pff_test_allocation_bitmap_data1,
+	          16,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_read_allocation_table_data(
+	          allocation_bitmap,
+	          200 * 64,
+	          pff_test_allocation_bitmap_data1,
+	          16,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_allocation_bitmap_get_next_range(
+	          allocation_bitmap,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 256 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 256 );
+
+	result = libpff_allocation_bitmap_get_next_range(
+	          allocation_bitmap,
+	          6 * 64,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 384 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 128 );
+
+	result = libpff_allocation_bitmap_get_next_range(
+	          allocation_bitmap,
+	          512,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 3840 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 768 );
+
+	result = libpff_allocation_bitmap_get_next_range(
+	          allocation_bitmap,
+	          4608,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 8128 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 64 );
+
+	result = libpff_allocation_bitmap_get_next_range(
+	          allocation_bitmap,
+	          8192,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 13056 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 256 );
+
+	result = libpff_allocation_bitmap_get_next_range(
+	          allocation_bitmap,
+	          208 * 64,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_get_next_range(
+	          allocation_bitmap,
+	          16384,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_allocation_bitmap_get_next_range(
+	          NULL,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_get_next_range(
+	          allocation_bitmap,
+	          -1,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_get_next_range(
+	          allocation_bitmap,
+	          0,
+	          NULL,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_get_next_range(
+	          allocation_bitmap,
+	          0,
+	          &range_offset,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_allocation_bitmap_free(
+	          &allocation_bitmap,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_bitmap != NULL )
+	{
+		libpff_allocation_bitmap_free(
+		 &allocation_bitmap,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_allocation_bitmap_get_number_of_ranges and libpff_allocation_bitmap_get_range_by_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_allocation_bitmap_get_range_by_index(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libpff_allocation_bitmap_t *allocation_bitmap = NULL;
+	size64_t range_size                           = 0;
+	off64_t range_offset                          = 0;
+	int number_of_ranges                          = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          16384,
+	          64,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_read_allocation_table_data(
+	          allocation_bitmap,
+	          0,
+	          pff_test_allocation_bitmap_data1,
+	          16,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_read_allocation_table_data(
+	          allocation_bitmap,
+	          200 * 64,
+	          pff_test_allocation_bitmap_data1,
+	          16,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_allocation_bitmap_get_number_of_ranges(
+	          allocation_bitmap,
+	          &number_of_ranges,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 4 );
+
+	result = libpff_allocation_bitmap_get_range_by_index(
+	          allocation_bitmap,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 256 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 256 );
+
+	result = libpff_allocation_bitmap_get_range_by_index(
+	          allocation_bitmap,
+	          1,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 3840 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 768 );
+
+	result = libpff_allocation_bitmap_get_range_by_index(
+	          allocation_bitmap,
+	          2,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 8128 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 64 );
+
+	result = libpff_allocation_bitmap_get_range_by_index(
+	          allocation_bitmap,
+	          3,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 13056 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 256 );
+
+	/* Test retrieving the ranges out of order
+	 */
+	result = libpff_allocation_bitmap_get_range_by_index(
+	          allocation_bitmap,
+	          2,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 8128 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 64 );
+
+	result = libpff_allocation_bitmap_get_range_by_index(
+	          allocation_bitmap,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 256 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 256 );
+
+	result = libpff_allocation_bitmap_get_range_by_index(
+	          allocation_bitmap,
+	          3,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 13056 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 256 );
+
+	/* Test error cases
+	 */
+	result = libpff_allocation_bitmap_get_number_of_ranges(
+	          NULL,
+	          &number_of_ranges,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_get_number_of_ranges(
+	          allocation_bitmap,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_get_range_by_index(
+	          NULL,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_get_range_by_index(
+	          allocation_bitmap,
+	          -1,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_get_range_by_index(
+	          allocation_bitmap,
+	          4,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_get_range_by_index(
+	          allocation_bitmap,
+	          0,
+	          NULL,
+	          &range_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_get_range_by_index(
+	          allocation_bitmap,
+	          0,
+	          &range_offset,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_allocation_bitmap_free(
+	          &allocation_bitmap,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_bitmap != NULL )
+	{
+		libpff_allocation_bitmap_free(
+		 &allocation_bitmap,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_allocation_bitmap_range_is_unallocated function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_allocation_bitmap_range_is_unallocated(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libpff_allocation_bitmap_t *allocation_bitmap = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          16384,
+	          64,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_read_allocation_table_data(
+	          allocation_bitmap,
+	          0,
+	          pff_test_allocation_bitmap_data1,
+	          16,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_read_allocation_table_data(
+	          allocation_bitmap,
+	          200 * 64,
+	          pff_test_allocation_bitmap_data1,
+	          16,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_allocation_bitmap_range_is_unallocated(
+	          allocation_bitmap,
+	          0,
+	          256,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_range_is_unallocated(
+	          allocation_bitmap,
+	          0,
+	          257,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_range_is_unallocated(
+	          allocation_bitmap,
+	          300,
+	          10,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_range_is_unallocated(
+	          allocation_bitmap,
+	          3000,
+	          4000,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_range_is_unallocated(
+	          allocation_bitmap,
+	          8128,
+	          1,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_range_is_unallocated(
+	          allocation_bitmap,
+	          8192,
+	          4864,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_range_is_unallocated(
+	          allocation_bitmap,
+	          8192,
+	          4865,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_range_is_unallocated(
+	          allocation_bitmap,
+	          512,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_range_is_unallocated(
+	          allocation_bitmap,
+	          16384,
+	          64,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_allocation_bitmap_range_is_unallocated(
+	          NULL,
+	          0,
+	          256,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_range_is_unallocated(
+	          allocation_bitmap,
+	          -1,
+	          256,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_bitmap_range_is_unallocated(
+	          allocation_bitmap,
+	          1,
+	          (size64_t) INT64_MAX,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_allocation_bitmap_free(
+	          &allocation_bitmap,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_bitmap != NULL )
+	{
+		libpff_allocation_bitmap_free(
+		 &allocation_bitmap,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc PFF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] PFF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc PFF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] PFF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	PFF_TEST_UNREFERENCED_PARAMETER( argc )
+	PFF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+	PFF_TEST_RUN(
+	 "libpff_allocation_bitmap_initialize",
+	 pff_test_allocation_bitmap_initialize );
+
+	PFF_TEST_RUN(
+	 "libpff_allocation_bitmap_free",
+	 pff_test_allocation_bitmap_free );
+
+	PFF_TEST_RUN(
+	 "libpff_allocation_bitmap_get_number_of_trailing_zero_bits",
+	 pff_test_allocation_bitmap_get_number_of_trailing_zero_bits );
+
+	PFF_TEST_RUN(
+	 "libpff_allocation_bitmap_get_number_of_set_bits",
+	 pff_test_allocation_bitmap_get_number_of_set_bits );
+
+	PFF_TEST_RUN(
+	 "libpff_allocation_bitmap_read_allocation_table_data",
+	 pff_test_allocation_bitmap_read_allocation_table_data );
+
+	PFF_TEST_RUN(
+	 "libpff_allocation_bitmap_get_next_range",
+	 pff_test_allocation_bitmap_get_next_range );
+
+	PFF_TEST_RUN(
+	 "libpff_allocation_bitmap_get_range_by_index",
+	 pff_test_allocation_bitmap_get_range_by_index );
+
+	PFF_TEST_RUN(
+	 "libpff_allocation_bitmap_range_is_unallocated",
+	 pff_test_allocation_bitmap_range_is_unallocated );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+}
+
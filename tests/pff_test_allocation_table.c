@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -29,13 +30,13 @@
 
 #include "pff_test_functions.h"
 #include "pff_test_libbfio.h"
-#include "pff_test_libcdata.h"
 #include "pff_test_libcerror.h"
 #include "pff_test_libpff.h"
 #include "pff_test_macros.h"
 #include "pff_test_memory.h"
 #include "pff_test_unused.h"
 
+#include "../libpff/libpff_allocation_bitmap.h"
 #include "../libpff/libpff_allocation_table.h"
 
 uint8_t pff_test_allocation_table_data_32bit[ 512 ] = {
@@ -369,58 +370,845 @@ uint8_t pff_test_allocation_table_data_64bit_4k_page[ 4096 ] = {
 
 #if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
 
+/* Tests the libpff_allocation_table_check_data function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_allocation_table_check_data(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	size_t table_data_offset       = 0;
+	size_t table_data_size         = 0;
+	off64_t back_pointer_offset    = 0;
+	size32_t allocation_block_size = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libpff_allocation_table_check_data(
+	          pff_test_allocation_table_data_32bit,
+	          512,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &back_pointer_offset,
+	          &allocation_block_size,
+	          &table_data_offset,
+	          &table_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "back_pointer_offset",
+	 (int64_t) back_pointer_offset,
+	 (int64_t) 0x4400 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT32(
+	 "allocation_block_size",
+	 (uint32_t) allocation_block_size,
+	 (uint32_t) 64 );
+
+	PFF_TEST_ASSERT_EQUAL_SIZE(
+	 "table_data_offset",
+	 table_data_offset,
+	 (size_t) 4 );
+
+	PFF_TEST_ASSERT_EQUAL_SIZE(
+	 "table_data_size",
+	 table_data_size,
+	 (size_t) 496 );
+
+	result = libpff_allocation_table_check_data(
+	          pff_test_allocation_table_data_64bit,
+	          512,
+	          LIBPFF_FILE_TYPE_64BIT,
+	          &back_pointer_offset,
+	          &allocation_block_size,
+	          &table_data_offset,
+	          &table_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "back_pointer_offset",
+	 (int64_t) back_pointer_offset,
+	 (int64_t) 0x4400 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT32(
+	 "allocation_block_size",
+	 (uint32_t) allocation_block_size,
+	 (uint32_t) 64 );
+
+	PFF_TEST_ASSERT_EQUAL_SIZE(
+	 "table_data_offset",
+	 table_data_offset,
+	 (size_t) 0 );
+
+	PFF_TEST_ASSERT_EQUAL_SIZE(
+	 "table_data_size",
+	 table_data_size,
+	 (size_t) 496 );
+
+	result = libpff_allocation_table_check_data(
+	          pff_test_allocation_table_data_64bit_4k_page,
+	          4096,
+	          LIBPFF_FILE_TYPE_64BIT_4K_PAGE,
+	          &back_pointer_offset,
+	          &allocation_block_size,
+	          &table_data_offset,
+	          &table_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "back_pointer_offset",
+	 (int64_t) back_pointer_offset,
+	 (int64_t) 0x22000 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT32(
+	 "allocation_block_size",
+	 (uint32_t) allocation_block_size,
+	 (uint32_t) 512 );
+
+	PFF_TEST_ASSERT_EQUAL_SIZE(
+	 "table_data_offset",
+	 table_data_offset,
+	 (size_t) 0 );
+
+	PFF_TEST_ASSERT_EQUAL_SIZE(
+	 "table_data_size",
+	 table_data_size,
+	 (size_t) 4072 );
+
+	/* Test error cases
+	 */
+	result = libpff_allocation_table_check_data(
+	          NULL,
+	          512,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &back_pointer_offset,
+	          &allocation_block_size,
+	          &table_data_offset,
+	          &table_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_table_check_data(
+	          pff_test_allocation_table_data_32bit,
+	          512,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          NULL,
+	          &allocation_block_size,
+	          &table_data_offset,
+	          &table_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_table_check_data(
+	          pff_test_allocation_table_data_32bit,
+	          512,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &back_pointer_offset,
+	          NULL,
+	          &table_data_offset,
+	          &table_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_table_check_data(
+	          pff_test_allocation_table_data_32bit,
+	          512,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &back_pointer_offset,
+	          &allocation_block_size,
+	          NULL,
+	          &table_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_table_check_data(
+	          pff_test_allocation_table_data_32bit,
+	          512,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &back_pointer_offset,
+	          &allocation_block_size,
+	          &table_data_offset,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_table_check_data(
+	          pff_test_allocation_table_data_32bit,
+	          511,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &back_pointer_offset,
+	          &allocation_block_size,
+	          &table_data_offset,
+	          &table_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_table_check_data(
+	          pff_test_allocation_table_data_32bit,
+	          512,
+	          0xff,
+	          &back_pointer_offset,
+	          &allocation_block_size,
+	          &table_data_offset,
+	          &table_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_table_check_data(
+	          pff_test_allocation_table_data_64bit,
+	          512,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &back_pointer_offset,
+	          &allocation_block_size,
+	          &table_data_offset,
+	          &table_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libpff_allocation_table_read_data function
  * Returns 1 if successful or 0 if not
  */
-int pff_test_allocation_table_read_data(
+int pff_test_allocation_table_read_data(
+     void )
+{
+	libcerror_error_t *error                              = NULL;
+	libpff_allocation_bitmap_t *allocation_bitmap         = NULL;
+	libpff_allocation_bitmap_t *allocation_bitmap_4k_page = NULL;
+	int number_of_ranges                                  = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          1048576,
+	          64,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_initialize(
+	          &allocation_bitmap_4k_page,
+	          33554432,
+	          512,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_bitmap_4k_page",
+	 allocation_bitmap_4k_page );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_allocation_table_read_data(
+	          allocation_bitmap,
+	          pff_test_allocation_table_data_32bit,
+	          512,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_get_number_of_ranges(
+	          allocation_bitmap,
+	          &number_of_ranges,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 14 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_table_read_data(
+	          allocation_bitmap,
+	          pff_test_allocation_table_data_64bit,
+	          512,
+	          LIBPFF_FILE_TYPE_64BIT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_table_read_data(
+	          allocation_bitmap_4k_page,
+	          pff_test_allocation_table_data_64bit_4k_page,
+	          4096,
+	          LIBPFF_FILE_TYPE_64BIT_4K_PAGE,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_get_number_of_ranges(
+	          allocation_bitmap_4k_page,
+	          &number_of_ranges,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 39 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_allocation_table_read_data(
+	          NULL,
+	          pff_test_allocation_table_data_32bit,
+	          512,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_table_read_data(
+	          allocation_bitmap,
+	          NULL,
+	          512,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_table_read_data(
+	          allocation_bitmap,
+	          pff_test_allocation_table_data_32bit,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_table_read_data(
+	          allocation_bitmap,
+	          pff_test_allocation_table_data_32bit,
+	          512,
+	          0xff,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_table_read_data(
+	          allocation_bitmap,
+	          pff_test_allocation_table_data_32bit,
+	          0,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the allocation bitmap unit size does not match the block size
+	 */
+	result = libpff_allocation_table_read_data(
+	          allocation_bitmap_4k_page,
+	          pff_test_allocation_table_data_32bit,
+	          512,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_allocation_bitmap_free(
+	          &allocation_bitmap_4k_page,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "allocation_bitmap_4k_page",
+	 allocation_bitmap_4k_page );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_free(
+	          &allocation_bitmap,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_bitmap_4k_page != NULL )
+	{
+		libpff_allocation_bitmap_free(
+		 &allocation_bitmap_4k_page,
+		 NULL );
+	}
+	if( allocation_bitmap != NULL )
+	{
+		libpff_allocation_bitmap_free(
+		 &allocation_bitmap,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_allocation_table_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_allocation_table_read_file_io_handle(
      void )
 {
-	libcdata_range_list_t *unallocated_block_list = NULL;
+	libbfio_handle_t *file_io_handle              = NULL;
 	libcerror_error_t *error                      = NULL;
+	libpff_allocation_bitmap_t *allocation_bitmap = NULL;
 	int result                                    = 0;
 
 	/* Initialize test
 	 */
-	result = libcdata_range_list_initialize(
-	          &unallocated_block_list,
+	result = libpff_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          1048576,
+	          64,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = pff_test_open_file_io_handle(
+	          &file_io_handle,
+	          pff_test_allocation_table_data_32bit,
+	          512,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_allocation_table_read_file_io_handle(
+	          allocation_bitmap,
+	          file_io_handle,
+	          0,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_allocation_table_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_table_read_file_io_handle(
+	          allocation_bitmap,
+	          NULL,
+	          0,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_table_read_file_io_handle(
+	          allocation_bitmap,
+	          file_io_handle,
+	          -1,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_table_read_file_io_handle(
+	          allocation_bitmap,
+	          file_io_handle,
+	          0,
+	          0xff,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+
+	/* Test libpff_allocation_table_read_file_io_handle with malloc failing
+	 */
+	pff_test_malloc_attempts_before_fail = 0;
+
+	result = libpff_allocation_table_read_file_io_handle(
+	          allocation_bitmap,
+	          file_io_handle,
+	          0,
+	          LIBPFF_FILE_TYPE_32BIT,
 	          &error );
 
-	PFF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	if( pff_test_malloc_attempts_before_fail != -1 )
+	{
+		pff_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	PFF_TEST_ASSERT_IS_NOT_NULL(
-	 "unallocated_block_list",
-	 unallocated_block_list );
+		PFF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	PFF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_PFF_TEST_MEMORY ) */
 
-	/* Test regular cases
+	/* Clean up file IO handle
 	 */
-	result = libpff_allocation_table_read_data(
-	          unallocated_block_list,
-	          pff_test_allocation_table_data_32bit,
-	          512,
-	          LIBPFF_FILE_TYPE_32BIT,
+	result = pff_test_close_file_io_handle(
+	          &file_io_handle,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libpff_allocation_table_read_data(
-	          unallocated_block_list,
-	          pff_test_allocation_table_data_64bit,
-	          512,
-	          LIBPFF_FILE_TYPE_64BIT,
+	/* Clean up
+	 */
+	result = libpff_allocation_bitmap_free(
+	          &allocation_bitmap,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -428,15 +1216,54 @@ int pff_test_allocation_table_read_data(
 	 result,
 	 1 );
 
+	PFF_TEST_ASSERT_IS_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
 	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libpff_allocation_table_read_data(
-	          unallocated_block_list,
-	          pff_test_allocation_table_data_64bit_4k_page,
-	          4096,
-	          LIBPFF_FILE_TYPE_64BIT_4K_PAGE,
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( allocation_bitmap != NULL )
+	{
+		libpff_allocation_bitmap_free(
+		 &allocation_bitmap,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_allocation_table_set_allocation_bitmap function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_allocation_table_set_allocation_bitmap(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libpff_allocation_bitmap_t *allocation_bitmap = NULL;
+	int number_of_ranges                          = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          1048576,
+	          64,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -444,55 +1271,60 @@ int pff_test_allocation_table_read_data(
 	 result,
 	 1 );
 
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_bitmap",
+	 allocation_bitmap );
+
 	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test regular cases
 	 */
-	result = libpff_allocation_table_read_data(
-	          NULL,
-	          pff_test_allocation_table_data_32bit,
-	          512,
-	          LIBPFF_FILE_TYPE_32BIT,
+	result = libpff_allocation_table_set_allocation_bitmap(
+	          allocation_bitmap,
+	          0x4400,
+	          64,
+	          &( pff_test_allocation_table_data_32bit[ 4 ] ),
+	          496,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	PFF_TEST_ASSERT_IS_NOT_NULL(
+	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libpff_allocation_table_read_data(
-	          unallocated_block_list,
-	          NULL,
-	          512,
-	          LIBPFF_FILE_TYPE_32BIT,
+	result = libpff_allocation_bitmap_get_number_of_ranges(
+	          allocation_bitmap,
+	          &number_of_ranges,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	PFF_TEST_ASSERT_IS_NOT_NULL(
+	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 14 );
 
-	result = libpff_allocation_table_read_data(
-	          unallocated_block_list,
-	          pff_test_allocation_table_data_32bit,
-	          (size_t) SSIZE_MAX + 1,
-	          LIBPFF_FILE_TYPE_32BIT,
+	/* Test error cases
+	 */
+	result = libpff_allocation_table_set_allocation_bitmap(
+	          NULL,
+	          0x4400,
+	          64,
+	          &( pff_test_allocation_table_data_32bit[ 4 ] ),
+	          496,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -507,11 +1339,12 @@ int pff_test_allocation_table_read_data(
 	libcerror_error_free(
 	 &error );
 
-	result = libpff_allocation_table_read_data(
-	          unallocated_block_list,
-	          pff_test_allocation_table_data_32bit,
+	result = libpff_allocation_table_set_allocation_bitmap(
+	          allocation_bitmap,
+	          0x4400,
 	          512,
-	          0xff,
+	          &( pff_test_allocation_table_data_32bit[ 4 ] ),
+	          496,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -526,11 +1359,12 @@ int pff_test_allocation_table_read_data(
 	libcerror_error_free(
 	 &error );
 
-	result = libpff_allocation_table_read_data(
-	          unallocated_block_list,
-	          pff_test_allocation_table_data_32bit,
-	          0,
-	          LIBPFF_FILE_TYPE_32BIT,
+	result = libpff_allocation_table_set_allocation_bitmap(
+	          allocation_bitmap,
+	          0x4400,
+	          64,
+	          NULL,
+	          496,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -547,9 +1381,8 @@ int pff_test_allocation_table_read_data(
 
 	/* Clean up
 	 */
-	result = libcdata_range_list_free(
-	          &unallocated_block_list,
-	          NULL,
+	result = libpff_allocation_bitmap_free(
+	          &allocation_bitmap,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -558,8 +1391,8 @@ int pff_test_allocation_table_read_data(
 	 1 );
 
 	PFF_TEST_ASSERT_IS_NULL(
-	 "unallocated_block_list",
-	 unallocated_block_list );
+	 "allocation_bitmap",
+	 allocation_bitmap );
 
 	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -573,31 +1406,36 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( unallocated_block_list != NULL )
+	if( allocation_bitmap != NULL )
 	{
-		libcdata_range_list_free(
-		 &unallocated_block_list,
-		 NULL,
+		libpff_allocation_bitmap_free(
+		 &allocation_bitmap,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libpff_allocation_table_read_file_io_handle function
+/* Tests the libpff_allocation_table_read_tables_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
-int pff_test_allocation_table_read_file_io_handle(
+int pff_test_allocation_table_read_tables_file_io_handle(
      void )
 {
+	uint8_t allocation_tables_data[ 1024 ];
+
 	libbfio_handle_t *file_io_handle              = NULL;
-	libcdata_range_list_t *unallocated_block_list = NULL;
 	libcerror_error_t *error                      = NULL;
+	libpff_allocation_bitmap_t *allocation_bitmap = NULL;
+	void *memcpy_result                           = NULL;
+	int number_of_ranges                          = 0;
 	int result                                    = 0;
 
 	/* Initialize test
 	 */
-	result = libcdata_range_list_initialize(
-	          &unallocated_block_list,
+	result = libpff_allocation_bitmap_initialize(
+	          &allocation_bitmap,
+	          1048576,
+	          64,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -606,19 +1444,37 @@ int pff_test_allocation_table_read_file_io_handle(
 	 1 );
 
 	PFF_TEST_ASSERT_IS_NOT_NULL(
-	 "unallocated_block_list",
-	 unallocated_block_list );
+	 "allocation_bitmap",
+	 allocation_bitmap );
 
 	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Initialize file IO handle
+	/* Initialize file IO handle with 2 allocation tables that are stored 512 bytes apart
 	 */
+	memcpy_result = memory_copy(
+	                 allocation_tables_data,
+	                 pff_test_allocation_table_data_32bit,
+	                 512 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	memcpy_result = memory_copy(
+	                 &( allocation_tables_data[ 512 ] ),
+	                 pff_test_allocation_table_data_32bit,
+	                 512 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
 	result = pff_test_open_file_io_handle(
 	          &file_io_handle,
-	          pff_test_allocation_table_data_32bit,
-	          512,
+	          allocation_tables_data,
+	          1024,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -636,10 +1492,51 @@ int pff_test_allocation_table_read_file_io_handle(
 
 	/* Test regular cases
 	 */
-	result = libpff_allocation_table_read_file_io_handle(
-	          unallocated_block_list,
+	result = libpff_allocation_table_read_tables_file_io_handle(
+	          allocation_bitmap,
 	          file_io_handle,
 	          0,
+	          512,
+	          1024,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_allocation_bitmap_get_number_of_ranges(
+	          allocation_bitmap,
+	          &number_of_ranges,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 14 );
+
+	/* Test an allocation table offset beyond the file size
+	 */
+	result = libpff_allocation_table_read_tables_file_io_handle(
+	          allocation_bitmap,
+	          file_io_handle,
+	          1024,
+	          512,
+	          1024,
 	          LIBPFF_FILE_TYPE_32BIT,
 	          &error );
 
@@ -654,10 +1551,12 @@ int pff_test_allocation_table_read_file_io_handle(
 
 	/* Test error cases
 	 */
-	result = libpff_allocation_table_read_file_io_handle(
+	result = libpff_allocation_table_read_tables_file_io_handle(
 	          NULL,
 	          file_io_handle,
 	          0,
+	          512,
+	          1024,
 	          LIBPFF_FILE_TYPE_32BIT,
 	          &error );
 
@@ -673,10 +1572,12 @@ int pff_test_allocation_table_read_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libpff_allocation_table_read_file_io_handle(
-	          unallocated_block_list,
+	result = libpff_allocation_table_read_tables_file_io_handle(
+	          allocation_bitmap,
 	          NULL,
 	          0,
+	          512,
+	          1024,
 	          LIBPFF_FILE_TYPE_32BIT,
 	          &error );
 
@@ -692,10 +1593,12 @@ int pff_test_allocation_table_read_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libpff_allocation_table_read_file_io_handle(
-	          unallocated_block_list,
+	result = libpff_allocation_table_read_tables_file_io_handle(
+	          allocation_bitmap,
 	          file_io_handle,
 	          -1,
+	          512,
+	          1024,
 	          LIBPFF_FILE_TYPE_32BIT,
 	          &error );
 
@@ -711,10 +1614,54 @@ int pff_test_allocation_table_read_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libpff_allocation_table_read_file_io_handle(
-	          unallocated_block_list,
+	result = libpff_allocation_table_read_tables_file_io_handle(
+	          allocation_bitmap,
+	          file_io_handle,
+	          0,
+	          0,
+	          1024,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_table_read_tables_file_io_handle(
+	          allocation_bitmap,
+	          file_io_handle,
+	          0,
+	          512,
+	          (size64_t) INT64_MAX + 1,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_allocation_table_read_tables_file_io_handle(
+	          allocation_bitmap,
 	          file_io_handle,
 	          0,
+	          512,
+	          1024,
 	          0xff,
 	          &error );
 
@@ -730,16 +1677,64 @@ int pff_test_allocation_table_read_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
+	/* Test error case where the allocation table data cannot be read
+	 */
+	result = libpff_allocation_table_read_tables_file_io_handle(
+	          allocation_bitmap,
+	          file_io_handle,
+	          0,
+	          512,
+	          2048,
+	          LIBPFF_FILE_TYPE_32BIT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the allocation table data is invalid
+	 */
+	result = libpff_allocation_table_read_tables_file_io_handle(
+	          allocation_bitmap,
+	          file_io_handle,
+	          0,
+	          512,
+	          1024,
+	          LIBPFF_FILE_TYPE_64BIT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 #if defined( HAVE_PFF_TEST_MEMORY )
 
-	/* Test libpff_allocation_table_read_file_io_handle with malloc failing
+	/* Test libpff_allocation_table_read_tables_file_io_handle with malloc failing
 	 */
 	pff_test_malloc_attempts_before_fail = 0;
 
-	result = libpff_allocation_table_read_file_io_handle(
-	          unallocated_block_list,
+	result = libpff_allocation_table_read_tables_file_io_handle(
+	          allocation_bitmap,
 	          file_io_handle,
 	          0,
+	          512,
+	          1024,
 	          LIBPFF_FILE_TYPE_32BIT,
 	          &error );
 
@@ -780,9 +1775,8 @@ int pff_test_allocation_table_read_file_io_handle(
 
 	/* Clean up
 	 */
-	result = libcdata_range_list_free(
-	          &unallocated_block_list,
-	          NULL,
+	result = libpff_allocation_bitmap_free(
+	          &allocation_bitmap,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -791,8 +1785,8 @@ int pff_test_allocation_table_read_file_io_handle(
 	 1 );
 
 	PFF_TEST_ASSERT_IS_NULL(
-	 "unallocated_block_list",
-	 unallocated_block_list );
+	 "allocation_bitmap",
+	 allocation_bitmap );
 
 	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -812,11 +1806,10 @@ on_error:
 		 &file_io_handle,
 		 NULL );
 	}
-	if( unallocated_block_list != NULL )
+	if( allocation_bitmap != NULL )
 	{
-		libcdata_range_list_free(
-		 &unallocated_block_list,
-		 NULL,
+		libpff_allocation_bitmap_free(
+		 &allocation_bitmap,
 		 NULL );
 	}
 	return( 0 );
@@ -841,6 +1834,10 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
 
+	PFF_TEST_RUN(
+	 "libpff_allocation_table_check_data",
+	 pff_test_allocation_table_check_data );
+
 	PFF_TEST_RUN(
 	 "libpff_allocation_table_read_data",
 	 pff_test_allocation_table_read_data );
@@ -849,6 +1846,14 @@ int main(
 	 "libpff_allocation_table_read_file_io_handle",
 	 pff_test_allocation_table_read_file_io_handle );
 
+	PFF_TEST_RUN(
+	 "libpff_allocation_table_set_allocation_bitmap",
+	 pff_test_allocation_table_set_allocation_bitmap );
+
+	PFF_TEST_RUN(
+	 "libpff_allocation_table_read_tables_file_io_handle",
+	 pff_test_allocation_table_read_tables_file_io_handle );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
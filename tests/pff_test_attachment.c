@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -34,45 +35,609 @@
 #include "pff_test_unused.h"
 
 #include "../libpff/libpff_attachment.h"
+#include "../libpff/libpff_data_block.h"
+#include "../libpff/libpff_definitions.h"
 #include "../libpff/libpff_io_handle.h"
 #include "../libpff/libpff_item.h"
 #include "../libpff/libpff_item_descriptor.h"
+#include "../libpff/libpff_item_values.h"
+#include "../libpff/libpff_record_entry.h"
+#include "../libpff/libpff_table.h"
+
+uint8_t pff_test_attachment_data1[ 32 ] = {
+	0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6e, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63,
+	0x68, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x0a };
 
 #if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
 
-/* Tests the libpff_attachment_get_type function
- * Returns 1 if successful or 0 if not
- */
-int pff_test_attachment_get_type(
-     libpff_item_t *attachment )
-{
-	libcerror_error_t *error = NULL;
-	int attachment_type      = 0;
-	int result               = 0;
+typedef struct pff_test_attachment_write_buffer pff_test_attachment_write_buffer_t;
+
+struct pff_test_attachment_write_buffer
+{
+	/* The data
+	 */
+	uint8_t data[ 64 ];
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+/* Write callback that appends the data to a write buffer
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t pff_test_attachment_write_to_buffer(
+         intptr_t *callback_data,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	pff_test_attachment_write_buffer_t *write_buffer = NULL;
+	static char *function                            = "pff_test_attachment_write_to_buffer";
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	write_buffer = (pff_test_attachment_write_buffer_t *) callback_data;
+
+	if( buffer_size > ( 64 - write_buffer->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( write_buffer->data[ write_buffer->data_size ] ),
+	     buffer,
+	     buffer_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy buffer to write buffer.",
+		 function );
+
+		return( -1 );
+	}
+	write_buffer->data_size += buffer_size;
+
+	return( (ssize_t) buffer_size );
+}
+
+/* Write callback that fails
+ * Returns -1
+ */
+ssize_t pff_test_attachment_write_failure(
+         intptr_t *callback_data PFF_TEST_ATTRIBUTE_UNUSED,
+         const uint8_t *buffer PFF_TEST_ATTRIBUTE_UNUSED,
+         size_t buffer_size PFF_TEST_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function = "pff_test_attachment_write_failure";
+
+	PFF_TEST_UNREFERENCED_PARAMETER( callback_data )
+	PFF_TEST_UNREFERENCED_PARAMETER( buffer )
+	PFF_TEST_UNREFERENCED_PARAMETER( buffer_size )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write data.",
+	 function );
+
+	return( -1 );
+}
+
+/* Write callback that writes less data than requested without setting an error
+ * Returns the number of bytes written
+ */
+ssize_t pff_test_attachment_write_short(
+         intptr_t *callback_data PFF_TEST_ATTRIBUTE_UNUSED,
+         const uint8_t *buffer PFF_TEST_ATTRIBUTE_UNUSED,
+         size_t buffer_size,
+         libcerror_error_t **error PFF_TEST_ATTRIBUTE_UNUSED )
+{
+	PFF_TEST_UNREFERENCED_PARAMETER( callback_data )
+	PFF_TEST_UNREFERENCED_PARAMETER( buffer )
+	PFF_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( buffer_size == 0 )
+	{
+		return( 0 );
+	}
+	return( (ssize_t) buffer_size - 1 );
+}
+
+/* Tests the libpff_attachment_get_type function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_attachment_get_type(
+     libpff_item_t *attachment )
+{
+	libcerror_error_t *error = NULL;
+	int attachment_type      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+/* TODO implement
+	result = libpff_attachment_get_type(
+	          attachment,
+	          &attachment_type,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+*/
+
+	/* Test error cases
+	 */
+	result = libpff_attachment_get_type(
+	          NULL,
+	          &attachment_type,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_attachment_get_type(
+	          attachment,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_attachment_get_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_attachment_get_data_size(
+     libpff_item_t *attachment )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+/* TODO implement
+	result = libpff_attachment_get_data_size(
+	          attachment,
+	          &size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+*/
+
+	/* Test error cases
+	 */
+	result = libpff_attachment_get_data_size(
+	          NULL,
+	          &size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_attachment_get_data_size(
+	          attachment,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_attachment_data_write_to_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_attachment_data_write_to_callback(
+     libpff_item_t *attachment )
+{
+	pff_test_attachment_write_buffer_t write_buffer;
+
+	libcerror_error_t *error = NULL;
+	int compare_result       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	write_buffer.data_size = 0;
+
+	result = libpff_attachment_data_write_to_callback(
+	          attachment,
+	          &pff_test_attachment_write_to_buffer,
+	          (intptr_t *) &write_buffer,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_SIZE(
+	 "write_buffer.data_size",
+	 write_buffer.data_size,
+	 (size_t) 32 );
+
+	compare_result = memory_compare(
+	                  write_buffer.data,
+	                  pff_test_attachment_data1,
+	                  32 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "compare_result",
+	 compare_result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libpff_attachment_data_write_to_callback(
+	          NULL,
+	          &pff_test_attachment_write_to_buffer,
+	          (intptr_t *) &write_buffer,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_attachment_data_write_to_callback(
+	          attachment,
+	          NULL,
+	          (intptr_t *) &write_buffer,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test write callback failure
+	 */
+	result = libpff_attachment_data_write_to_callback(
+	          attachment,
+	          &pff_test_attachment_write_failure,
+	          (intptr_t *) &write_buffer,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test write callback that writes less data than requested
+	 */
+	result = libpff_attachment_data_write_to_callback(
+	          attachment,
+	          &pff_test_attachment_write_short,
+	          (intptr_t *) &write_buffer,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_attachment_get_number_of_data_extents function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_attachment_get_number_of_data_extents(
+     libpff_item_t *attachment )
+{
+	libpff_descriptor_data_extent_t value_data_extents[ 2 ];
+	uint8_t value_data_list_data[ 16 ];
+
+	libcerror_error_t *error                              = NULL;
+	libpff_internal_item_t *internal_item                 = NULL;
+	libpff_internal_record_entry_t *internal_record_entry = NULL;
+	libpff_record_entry_t *record_entry                   = NULL;
+	int number_of_extents                                 = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	internal_item = (libpff_internal_item_t *) attachment;
+
+	result = libpff_table_get_record_entry_by_index(
+	          internal_item->item_values->table,
+	          0,
+	          0,
+	          &record_entry,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_entry",
+	 record_entry );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record_entry = (libpff_internal_record_entry_t *) record_entry;
+
+	/* Test regular cases
+	 */
+	result = libpff_attachment_get_number_of_data_extents(
+	          attachment,
+	          &number_of_extents,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with value data that is stored as-is
+	 */
+	value_data_extents[ 0 ].file_offset = 0x4400;
+	value_data_extents[ 0 ].size        = 16;
+	value_data_extents[ 1 ].file_offset = 0x8800;
+	value_data_extents[ 1 ].size        = 16;
+
+	internal_record_entry->io_handle                    = internal_item->io_handle;
+	internal_record_entry->value_data_extents           = value_data_extents;
+	internal_record_entry->number_of_value_data_extents = 2;
+
+	result = libpff_attachment_get_number_of_data_extents(
+	          attachment,
+	          &number_of_extents,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 2 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with decryption forced after the value data was read
+	 */
+	internal_item->io_handle->force_decryption = 1;
+
+	result = libpff_attachment_get_number_of_data_extents(
+	          attachment,
+	          &number_of_extents,
+	          &error );
 
-	/* Test regular cases
+	internal_item->io_handle->force_decryption = 0;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The value data extents are not allocated and should not be freed
 	 */
-/* TODO implement
-	result = libpff_attachment_get_type(
+	internal_record_entry->io_handle                    = NULL;
+	internal_record_entry->value_data_extents           = NULL;
+	internal_record_entry->number_of_value_data_extents = 0;
+
+	/* Test with value data of an encrypted file
+	 * The value data list is not used since the record entry does not take it over
+	 */
+	internal_item->io_handle->encryption_type = LIBPFF_ENCRYPTION_TYPE_COMPRESSIBLE;
+
+	result = libpff_record_entry_set_value_data_list(
+	          record_entry,
+	          internal_item->io_handle,
+	          (libfdata_list_t *) value_data_list_data,
+	          &error );
+
+	internal_item->io_handle->encryption_type = LIBPFF_ENCRYPTION_TYPE_NONE;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_attachment_get_number_of_data_extents(
 	          attachment,
-	          &attachment_type,
+	          &number_of_extents,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with value data that was stored in a compressed data block
+	 */
+	internal_record_entry->value_data_block_flags = LIBPFF_DATA_BLOCK_FLAG_VALIDATED | LIBPFF_DATA_BLOCK_FLAG_COMPRESSED;
+
+	result = libpff_record_entry_set_value_data_list(
+	          record_entry,
+	          internal_item->io_handle,
+	          (libfdata_list_t *) value_data_list_data,
+	          &error );
+
+	internal_record_entry->value_data_block_flags = 0;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_attachment_get_number_of_data_extents(
+	          attachment,
+	          &number_of_extents,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
-*/
 
 	/* Test error cases
 	 */
-	result = libpff_attachment_get_type(
+	result = libpff_attachment_get_number_of_data_extents(
 	          NULL,
-	          &attachment_type,
+	          &number_of_extents,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -87,7 +652,7 @@ int pff_test_attachment_get_type(
 	libcerror_error_free(
 	 &error );
 
-	result = libpff_attachment_get_type(
+	result = libpff_attachment_get_number_of_data_extents(
 	          attachment,
 	          NULL,
 	          &error );
@@ -112,25 +677,89 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( internal_record_entry != NULL )
+	{
+		internal_record_entry->io_handle                    = NULL;
+		internal_record_entry->value_data_extents           = NULL;
+		internal_record_entry->number_of_value_data_extents = 0;
+	}
 	return( 0 );
 }
 
-/* Tests the libpff_attachment_get_data_size function
+/* Tests the libpff_attachment_get_data_extent_by_index function
  * Returns 1 if successful or 0 if not
  */
-int pff_test_attachment_get_data_size(
+int pff_test_attachment_get_data_extent_by_index(
      libpff_item_t *attachment )
 {
-	libcerror_error_t *error = NULL;
-	size64_t size            = 0;
-	int result               = 0;
+	libpff_descriptor_data_extent_t value_data_extents[ 2 ];
+
+	libcerror_error_t *error                              = NULL;
+	libpff_internal_item_t *internal_item                 = NULL;
+	libpff_internal_record_entry_t *internal_record_entry = NULL;
+	libpff_record_entry_t *record_entry                   = NULL;
+	size64_t extent_size                                  = 0;
+	off64_t extent_offset                                 = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	internal_item = (libpff_internal_item_t *) attachment;
+
+	result = libpff_table_get_record_entry_by_index(
+	          internal_item->item_values->table,
+	          0,
+	          0,
+	          &record_entry,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_entry",
+	 record_entry );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record_entry = (libpff_internal_record_entry_t *) record_entry;
 
 	/* Test regular cases
 	 */
-/* TODO implement
-	result = libpff_attachment_get_data_size(
+	result = libpff_attachment_get_data_extent_by_index(
 	          attachment,
-	          &size,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value_data_extents[ 0 ].file_offset = 0x4400;
+	value_data_extents[ 0 ].size        = 16;
+	value_data_extents[ 1 ].file_offset = 0x8800;
+	value_data_extents[ 1 ].size        = 16;
+
+	internal_record_entry->io_handle                    = internal_item->io_handle;
+	internal_record_entry->value_data_extents           = value_data_extents;
+	internal_record_entry->number_of_value_data_extents = 2;
+
+	result = libpff_attachment_get_data_extent_by_index(
+	          attachment,
+	          1,
+	          &extent_offset,
+	          &extent_size,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -138,16 +767,49 @@ int pff_test_attachment_get_data_size(
 	 result,
 	 1 );
 
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "extent_offset",
+	 (int64_t) extent_offset,
+	 (int64_t) 0x8800 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_size",
+	 (uint64_t) extent_size,
+	 (uint64_t) 16 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with decryption forced after the value data was read
+	 */
+	internal_item->io_handle->force_decryption = 1;
+
+	result = libpff_attachment_get_data_extent_by_index(
+	          attachment,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &error );
+
+	internal_item->io_handle->force_decryption = 0;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
-*/
 
 	/* Test error cases
 	 */
-	result = libpff_attachment_get_data_size(
+	result = libpff_attachment_get_data_extent_by_index(
 	          NULL,
-	          &size,
+	          0,
+	          &extent_offset,
+	          &extent_size,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -162,8 +824,67 @@ int pff_test_attachment_get_data_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libpff_attachment_get_data_size(
+	result = libpff_attachment_get_data_extent_by_index(
+	          attachment,
+	          -1,
+	          &extent_offset,
+	          &extent_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_attachment_get_data_extent_by_index(
+	          attachment,
+	          2,
+	          &extent_offset,
+	          &extent_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_attachment_get_data_extent_by_index(
+	          attachment,
+	          0,
+	          NULL,
+	          &extent_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_attachment_get_data_extent_by_index(
 	          attachment,
+	          0,
+	          &extent_offset,
 	          NULL,
 	          &error );
 
@@ -179,6 +900,12 @@ int pff_test_attachment_get_data_size(
 	libcerror_error_free(
 	 &error );
 
+	/* The value data extents are not allocated and should not be freed
+	 */
+	internal_record_entry->io_handle                    = NULL;
+	internal_record_entry->value_data_extents           = NULL;
+	internal_record_entry->number_of_value_data_extents = 0;
+
 	return( 1 );
 
 on_error:
@@ -187,6 +914,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( internal_record_entry != NULL )
+	{
+		internal_record_entry->io_handle                    = NULL;
+		internal_record_entry->value_data_extents           = NULL;
+		internal_record_entry->number_of_value_data_extents = 0;
+	}
 	return( 0 );
 }
 
@@ -207,12 +940,15 @@ int main(
 #if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
-	libcdata_tree_node_t *item_tree_node      = NULL;
-	libcerror_error_t *error                  = NULL;
-	libpff_io_handle_t *io_handle             = NULL;
-	libpff_item_t *item                       = NULL;
-	libpff_item_descriptor_t *item_descriptor = NULL;
-	int result                                = 0;
+	libcdata_tree_node_t *item_tree_node                  = NULL;
+	libcerror_error_t *error                              = NULL;
+	libpff_internal_record_entry_t *internal_record_entry = NULL;
+	libpff_io_handle_t *io_handle                         = NULL;
+	libpff_item_t *item                                   = NULL;
+	libpff_item_descriptor_t *item_descriptor             = NULL;
+	libpff_record_entry_t *record_entry                   = NULL;
+	libpff_table_t *table                                 = NULL;
+	int result                                            = 0;
 
 #endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
 #endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
@@ -321,6 +1057,90 @@ int main(
 	 "error",
 	 error );
 
+	/* Create an item table that contains the attachment data
+	 */
+	result = libpff_table_initialize(
+	          &table,
+	          0,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "table",
+	 table );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_table_resize_record_entries(
+	          table,
+	          1,
+	          1,
+	          LIBPFF_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_table_get_record_entry_by_index(
+	          table,
+	          0,
+	          0,
+	          &record_entry,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_entry",
+	 record_entry );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record_entry = (libpff_internal_record_entry_t *) record_entry;
+
+	internal_record_entry->identifier.format     = LIBPFF_RECORD_ENTRY_IDENTIFIER_FORMAT_MAPI_PROPERTY;
+	internal_record_entry->identifier.entry_type = LIBPFF_ENTRY_TYPE_ATTACHMENT_DATA_OBJECT;
+	internal_record_entry->identifier.value_type = LIBPFF_VALUE_TYPE_BINARY_DATA;
+
+	result = libpff_record_entry_set_value_data(
+	          record_entry,
+	          pff_test_attachment_data1,
+	          32,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libpff_internal_item_t *) item )->item_values->table = table;
+
+	table = NULL;
+
 	PFF_TEST_RUN_WITH_ARGS(
 	 "libpff_attachment_get_type",
 	 pff_test_attachment_get_type,
@@ -337,6 +1157,21 @@ int main(
 
 	/* TODO: add tests for libpff_attachment_data_seek_offset */
 
+	PFF_TEST_RUN_WITH_ARGS(
+	 "libpff_attachment_data_write_to_callback",
+	 pff_test_attachment_data_write_to_callback,
+	 item );
+
+	PFF_TEST_RUN_WITH_ARGS(
+	 "libpff_attachment_get_number_of_data_extents",
+	 pff_test_attachment_get_number_of_data_extents,
+	 item );
+
+	PFF_TEST_RUN_WITH_ARGS(
+	 "libpff_attachment_get_data_extent_by_index",
+	 pff_test_attachment_get_data_extent_by_index,
+	 item );
+
 	/* TODO: add tests for libpff_attachment_get_data_file_io_handle */
 
 	/* TODO: add tests for libpff_attachment_get_item */
@@ -409,6 +1244,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( table != NULL )
+	{
+		libpff_table_free(
+		 &table,
+		 NULL );
+	}
 	if( item != NULL )
 	{
 		libpff_item_free(
@@ -378,6 +378,354 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libpff_bit_stream_set_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_bit_stream_set_byte_stream(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libpff_bit_stream_t *bit_stream = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_bit_stream_initialize(
+	          &bit_stream,
+	          pff_test_bit_stream_data,
+	          16,
+	          0,
+	          LIBPFF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_bit_stream_read(
+	          bit_stream,
+	          8,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_bit_stream_set_byte_stream(
+	          bit_stream,
+	          pff_test_bit_stream_data,
+	          8,
+	          2,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_size",
+	 bit_stream->byte_stream_size,
+	 (size_t) 8 );
+
+	PFF_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 2 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0x0000000000000000ULL );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libpff_bit_stream_set_byte_stream(
+	          NULL,
+	          pff_test_bit_stream_data,
+	          16,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_bit_stream_set_byte_stream(
+	          bit_stream,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_bit_stream_set_byte_stream(
+	          bit_stream,
+	          pff_test_bit_stream_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bit_stream != NULL )
+	{
+		libpff_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_bit_stream_read function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_bit_stream_read(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libpff_bit_stream_t *bit_stream = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_bit_stream_initialize(
+	          &bit_stream,
+	          pff_test_bit_stream_data,
+	          16,
+	          0,
+	          LIBPFF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_bit_stream_read(
+	          bit_stream,
+	          12,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 7 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0xb8db8f6d59bdda78ULL );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 56 );
+
+	/* Test if bits already in the bit buffer are kept
+	 */
+	result = libpff_bit_stream_read(
+	          bit_stream,
+	          4,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 7 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 56 );
+
+	/* Test reading beyond the end of the byte stream
+	 */
+	bit_stream->byte_stream_offset = 16;
+	bit_stream->bit_buffer         = 0;
+	bit_stream->bit_buffer_size    = 0;
+
+	result = libpff_bit_stream_read(
+	          bit_stream,
+	          8,
+	          &error );
+
+	bit_stream->byte_stream_offset = 0;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_bit_stream_read(
+	          NULL,
+	          8,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_bit_stream_read(
+	          bit_stream,
+	          64,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bit_stream != NULL )
+	{
+		libpff_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libpff_bit_stream_get_value function
  * Returns 1 if successful or 0 if not
  */
@@ -435,10 +783,10 @@ int pff_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 0 );
 
-	PFF_TEST_ASSERT_EQUAL_UINT32(
+	PFF_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x0000000000000000ULL );
 
 	PFF_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -470,10 +818,10 @@ int pff_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 1 );
 
-	PFF_TEST_ASSERT_EQUAL_UINT32(
+	PFF_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000007UL );
+	 (uint64_t) 0x0000000000000007ULL );
 
 	PFF_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -505,10 +853,10 @@ int pff_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 2 );
 
-	PFF_TEST_ASSERT_EQUAL_UINT32(
+	PFF_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x0000000000000000ULL );
 
 	PFF_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -540,10 +888,10 @@ int pff_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 6 );
 
-	PFF_TEST_ASSERT_EQUAL_UINT32(
+	PFF_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x0000000000000000ULL );
 
 	PFF_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -691,6 +1039,14 @@ int main(
 	 "libpff_bit_stream_free",
 	 pff_test_bit_stream_free );
 
+	PFF_TEST_RUN(
+	 "libpff_bit_stream_set_byte_stream",
+	 pff_test_bit_stream_set_byte_stream );
+
+	PFF_TEST_RUN(
+	 "libpff_bit_stream_read",
+	 pff_test_bit_stream_read );
+
 	PFF_TEST_RUN(
 	 "libpff_bit_stream_get_value",
 	 pff_test_bit_stream_get_value );
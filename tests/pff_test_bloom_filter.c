@@ -0,0 +1,509 @@
+/*
+ * Bloom filter testing program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pff_test_libcerror.h"
+#include "pff_test_libcnotify.h"
+#include "pff_test_macros.h"
+#include "pff_test_memory.h"
+#include "pff_test_unused.h"
+
+#include "../libpff/libpff_bloom_filter.h"
+#include "../libpff/libpff_index_value_set.h"
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+/* Tests the libpff_bloom_filter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_bloom_filter_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libpff_bloom_filter_t *bloom_filter = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 2;
+	int number_of_memset_fail_tests     = 2;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libpff_bloom_filter_initialize(
+	          &bloom_filter,
+	          1000,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "bloom_filter",
+	 bloom_filter );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_bloom_filter_free(
+	          &bloom_filter,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "bloom_filter",
+	 bloom_filter );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_bloom_filter_initialize(
+	          NULL,
+	          1000,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	bloom_filter = (libpff_bloom_filter_t *) 0x12345678UL;
+
+	result = libpff_bloom_filter_initialize(
+	          &bloom_filter,
+	          1000,
+	          &error );
+
+	bloom_filter = NULL;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libpff_bloom_filter_initialize with malloc failing
+		 */
+		pff_test_malloc_attempts_before_fail = test_number;
+
+		result = libpff_bloom_filter_initialize(
+		          &bloom_filter,
+		          1000,
+		          &error );
+
+		if( pff_test_malloc_attempts_before_fail != -1 )
+		{
+			pff_test_malloc_attempts_before_fail = -1;
+
+			if( bloom_filter != NULL )
+			{
+				libpff_bloom_filter_free(
+				 &bloom_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "bloom_filter",
+			 bloom_filter );
+
+			PFF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libpff_bloom_filter_initialize with memset failing
+		 */
+		pff_test_memset_attempts_before_fail = test_number;
+
+		result = libpff_bloom_filter_initialize(
+		          &bloom_filter,
+		          1000,
+		          &error );
+
+		if( pff_test_memset_attempts_before_fail != -1 )
+		{
+			pff_test_memset_attempts_before_fail = -1;
+
+			if( bloom_filter != NULL )
+			{
+				libpff_bloom_filter_free(
+				 &bloom_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "bloom_filter",
+			 bloom_filter );
+
+			PFF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_PFF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bloom_filter != NULL )
+	{
+		libpff_bloom_filter_free(
+		 &bloom_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_bloom_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_bloom_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libpff_bloom_filter_free(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_bloom_filter_insert_hash and libpff_bloom_filter_contains_hash functions
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_bloom_filter_insert_hash(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libpff_bloom_filter_t *bloom_filter = NULL;
+	uint64_t hash                       = 0;
+	int number_of_false_positives       = 0;
+	int result                          = 0;
+	int value_index                     = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_bloom_filter_initialize(
+	          &bloom_filter,
+	          1000,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "bloom_filter",
+	 bloom_filter );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 1000;
+	     value_index++ )
+	{
+		hash = libpff_index_value_set_calculate_hash(
+		        (uint64_t) value_index,
+		        0,
+		        0 );
+
+		result = libpff_bloom_filter_insert_hash(
+		          bloom_filter,
+		          hash,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* A Bloom filter has no false negatives
+	 */
+	for( value_index = 0;
+	     value_index < 1000;
+	     value_index++ )
+	{
+		hash = libpff_index_value_set_calculate_hash(
+		        (uint64_t) value_index,
+		        0,
+		        0 );
+
+		result = libpff_bloom_filter_contains_hash(
+		          bloom_filter,
+		          hash,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The false positive rate should be approximately 1%
+	 */
+	for( value_index = 1000;
+	     value_index < 11000;
+	     value_index++ )
+	{
+		hash = libpff_index_value_set_calculate_hash(
+		        (uint64_t) value_index,
+		        0,
+		        0 );
+
+		result = libpff_bloom_filter_contains_hash(
+		          bloom_filter,
+		          hash,
+		          &error );
+
+		PFF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		number_of_false_positives += result;
+	}
+	PFF_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_false_positives",
+	 number_of_false_positives,
+	 500 );
+
+	/* Test error cases
+	 */
+	result = libpff_bloom_filter_insert_hash(
+	          NULL,
+	          hash,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_bloom_filter_contains_hash(
+	          NULL,
+	          hash,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_bloom_filter_free(
+	          &bloom_filter,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "bloom_filter",
+	 bloom_filter );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bloom_filter != NULL )
+	{
+		libpff_bloom_filter_free(
+		 &bloom_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc PFF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] PFF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc PFF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] PFF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	PFF_TEST_UNREFERENCED_PARAMETER( argc )
+	PFF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+	PFF_TEST_RUN(
+	 "libpff_bloom_filter_initialize",
+	 pff_test_bloom_filter_initialize );
+
+	PFF_TEST_RUN(
+	 "libpff_bloom_filter_free",
+	 pff_test_bloom_filter_free );
+
+	PFF_TEST_RUN(
+	 "libpff_bloom_filter_insert_hash",
+	 pff_test_bloom_filter_insert_hash );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+}
+
@@ -36,18 +36,69 @@
 
 #if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
 
-/* Tests the libpff_checksum_initialize_crc32_table function
+/* Tests the libpff_checksum_update_crc32 function
  * Returns 1 if successful or 0 if not
  */
-int pff_test_checksum_initialize_crc32_table(
+int pff_test_checksum_update_crc32(
      void )
 {
-	/* Test invocation of function only
+	uint8_t data[ 4109 ];
+
+	uint32_t checksum          = 0;
+	uint32_t expected_checksum = 0;
+	size_t data_offset         = 0;
+	size_t data_size           = 0;
+
+	for( data_offset = 0;
+	     data_offset < 4109;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 7 ) ^ ( data_offset >> 3 ) );
+	}
+	/* Test regular cases
 	 */
-	libpff_checksum_initialize_crc32_table(
-	 0xedb88320UL );
+	checksum = libpff_checksum_update_crc32(
+	            0,
+	            data,
+	            0 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0 );
 
+	/* Compare the results of the word-sized and carry-less multiplication paths
+	 * with the results of processing a single byte at a time
+	 */
+	for( data_size = 1;
+	     data_size <= 4109;
+	     data_size += 67 )
+	{
+		expected_checksum = 0x12345678UL;
+
+		for( data_offset = 0;
+		     data_offset < data_size;
+		     data_offset++ )
+		{
+			expected_checksum = libpff_checksum_update_crc32(
+			                     expected_checksum,
+			                     &( data[ data_offset ] ),
+			                     1 );
+		}
+		checksum = libpff_checksum_update_crc32(
+		            0x12345678UL,
+		            data,
+		            data_size );
+
+		PFF_TEST_ASSERT_EQUAL_UINT32(
+		 "checksum",
+		 checksum,
+		 expected_checksum );
+	}
 	return( 1 );
+
+on_error:
+	return( 0 );
 }
 
 /* Tests the libpff_checksum_calculate_crc32 function
@@ -63,8 +114,6 @@ int pff_test_checksum_calculate_crc32(
 	uint32_t checksum        = 0;
 	int result               = 0;
 
-	libpff_checksum_crc32_table_computed = 0;
-
 	/* Test regular cases
 	 */
 	result = libpff_checksum_calculate_crc32(
@@ -171,8 +220,6 @@ int pff_test_checksum_calculate_weak_crc32(
 	uint32_t checksum        = 0;
 	int result               = 0;
 
-	libpff_checksum_crc32_table_computed = 0;
-
 	/* Test regular cases
 	 */
 	result = libpff_checksum_calculate_weak_crc32(
@@ -286,8 +333,8 @@ int main(
 #if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
 
 	PFF_TEST_RUN(
-	 "libpff_checksum_initialize_crc32_table",
-	 pff_test_checksum_initialize_crc32_table );
+	 "libpff_checksum_update_crc32",
+	 pff_test_checksum_update_crc32 );
 
 	PFF_TEST_RUN(
 	 "libpff_checksum_calculate_crc32",
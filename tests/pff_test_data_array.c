@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -34,6 +35,7 @@
 #include "pff_test_unused.h"
 
 #include "../libpff/libpff_data_array.h"
+#include "../libpff/libpff_data_block.h"
 #include "../libpff/libpff_io_handle.h"
 
 #if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
@@ -522,6 +524,571 @@ on_error:
 	return( 0 );
 }
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Tests the libpff_data_array_read_ahead_job_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_data_array_read_ahead_job_callback(
+     void )
+{
+	libpff_data_array_read_ahead_job_t read_ahead_job;
+
+	libcerror_error_t *error        = NULL;
+	libpff_data_array_t *data_array = NULL;
+	libpff_io_handle_t *io_handle   = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_data_array_initialize(
+	          &data_array,
+	          io_handle,
+	          0,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "data_array",
+	 data_array );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_mutex_initialize(
+	          &( data_array->read_ahead_jobs_mutex ),
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_condition_initialize(
+	          &( data_array->read_ahead_jobs_condition ),
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 &read_ahead_job,
+	 0,
+	 sizeof( libpff_data_array_read_ahead_job_t ) );
+
+	result = libpff_data_block_initialize(
+	          &( read_ahead_job.data_block ),
+	          io_handle,
+	          0,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_ahead_job.is_pending = 1;
+
+	result = libpff_data_array_read_ahead_job_callback(
+	          &read_ahead_job,
+	          data_array );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "read_ahead_job.is_pending",
+	 read_ahead_job.is_pending,
+	 (uint8_t) 0 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead_job.result",
+	 read_ahead_job.result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libpff_data_array_read_ahead_job_callback(
+	          NULL,
+	          data_array );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libpff_data_array_read_ahead_job_callback(
+	          &read_ahead_job,
+	          NULL );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Clean up
+	 */
+	result = libpff_data_block_free(
+	          &( read_ahead_job.data_block ),
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_data_array_free(
+	          &data_array,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "data_array",
+	 data_array );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead_job.data_block != NULL )
+	{
+		libpff_data_block_free(
+		 &( read_ahead_job.data_block ),
+		 NULL );
+	}
+	if( data_array != NULL )
+	{
+		libpff_data_array_free(
+		 &data_array,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libpff_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_data_array_get_read_ahead_data_block function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_data_array_get_read_ahead_data_block(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libpff_data_array_t *data_array = NULL;
+	libpff_data_block_t *data_block = NULL;
+	libpff_io_handle_t *io_handle   = NULL;
+	int job_index                   = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_data_array_initialize(
+	          &data_array,
+	          io_handle,
+	          0,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "data_array",
+	 data_array );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test without a read-ahead thread pool
+	 */
+	result = libpff_data_array_get_read_ahead_data_block(
+	          data_array,
+	          0,
+	          &data_block,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "data_block",
+	 data_block );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Set up the read-ahead jobs of elements: 2, 3 and 20 where
+	 * the read-ahead job of element: 3 failed to decompress
+	 */
+	result = libcthreads_mutex_initialize(
+	          &( data_array->read_ahead_jobs_mutex ),
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_condition_initialize(
+	          &( data_array->read_ahead_jobs_condition ),
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_pool_create(
+	          &( data_array->read_ahead_thread_pool ),
+	          NULL,
+	          1,
+	          LIBPFF_MAXIMUM_NUMBER_OF_READ_AHEAD_SEGMENTS,
+	          (int (*)(intptr_t *, void *)) &libpff_data_array_read_ahead_job_callback,
+	          (void *) data_array,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( job_index = 0;
+	     job_index < 3;
+	     job_index++ )
+	{
+		result = libpff_data_block_initialize(
+		          &( data_array->read_ahead_jobs[ job_index ].data_block ),
+		          io_handle,
+		          0,
+		          0,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		data_array->read_ahead_jobs[ job_index ].result = 1;
+	}
+	data_array->read_ahead_jobs[ 0 ].element_index = 20;
+	data_array->read_ahead_jobs[ 1 ].element_index = 3;
+	data_array->read_ahead_jobs[ 1 ].result        = -1;
+	data_array->read_ahead_jobs[ 2 ].element_index = 2;
+
+	/* Test regular cases
+	 */
+	result = libpff_data_array_get_read_ahead_data_block(
+	          data_array,
+	          2,
+	          &data_block,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "data_block",
+	 data_block );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The read-ahead job of element: 20 is outside the read-ahead window and is released
+	 */
+	PFF_TEST_ASSERT_IS_NULL(
+	 "data_array->read_ahead_jobs[ 0 ].data_block",
+	 data_array->read_ahead_jobs[ 0 ].data_block );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "data_array->read_ahead_jobs[ 1 ].data_block",
+	 data_array->read_ahead_jobs[ 1 ].data_block );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "data_array->read_ahead_jobs[ 2 ].data_block",
+	 data_array->read_ahead_jobs[ 2 ].data_block );
+
+	/* Test error cases
+	 */
+	result = libpff_data_array_get_read_ahead_data_block(
+	          NULL,
+	          3,
+	          &data_block,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_data_array_get_read_ahead_data_block(
+	          data_array,
+	          3,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_data_array_get_read_ahead_data_block(
+	          data_array,
+	          3,
+	          &data_block,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_data_block_free(
+	          &data_block,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read-ahead job that failed to decompress
+	 */
+	result = libpff_data_array_get_read_ahead_data_block(
+	          data_array,
+	          3,
+	          &data_block,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "data_block",
+	 data_block );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "data_array->read_ahead_jobs[ 1 ].data_block",
+	 data_array->read_ahead_jobs[ 1 ].data_block );
+
+	/* Clean up
+	 */
+	result = libpff_data_array_free(
+	          &data_array,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "data_array",
+	 data_array );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_block != NULL )
+	{
+		libpff_data_block_free(
+		 &data_block,
+		 NULL );
+	}
+	if( data_array != NULL )
+	{
+		libpff_data_array_free(
+		 &data_array,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libpff_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
 
 /* The main program
@@ -557,6 +1124,22 @@ int main(
 
 	/* TODO: add tests for libpff_data_array_read_element_data */
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	PFF_TEST_RUN(
+	 "libpff_data_array_read_ahead_job_callback",
+	 pff_test_data_array_read_ahead_job_callback );
+
+	PFF_TEST_RUN(
+	 "libpff_data_array_get_read_ahead_data_block",
+	 pff_test_data_array_get_read_ahead_data_block );
+
+	/* TODO: add tests for libpff_data_array_element_is_cached */
+
+	/* TODO: add tests for libpff_data_array_read_ahead */
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 	/* TODO: add tests for libpff_data_array_decrypt_entry_data */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
@@ -36,6 +36,7 @@
 
 #include "../libpff/libpff_bit_stream.h"
 #include "../libpff/libpff_deflate.h"
+#include "../libpff/libpff_deflate_context.h"
 #include "../libpff/libpff_huffman_tree.h"
 
 /* Define to make pff_test_deflate generate verbose output
@@ -1769,6 +1770,109 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libpff_deflate_calculate_adler32 function with varying sizes and alignments
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_deflate_calculate_adler32_blocks(
+     void )
+{
+	size_t test_sizes[ 17 ] = {
+		0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 1000, 5536, 5537, 5552, 5553, 12000 };
+
+	uint8_t *data              = NULL;
+	libcerror_error_t *error   = NULL;
+	size_t data_index          = 0;
+	size_t data_offset         = 0;
+	size_t test_index          = 0;
+	uint32_t checksum          = 0;
+	uint32_t expected_checksum = 0;
+	uint32_t lower_word        = 0;
+	uint32_t upper_word        = 0;
+	int result                 = 0;
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * 12004 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	/* Use data with all byte values including 0xff to test the worst case sums
+	 */
+	for( data_index = 0;
+	     data_index < 12004;
+	     data_index++ )
+	{
+		if( ( data_index % 3 ) == 0 )
+		{
+			data[ data_index ] = 0xff;
+		}
+		else
+		{
+			data[ data_index ] = (uint8_t) ( ( data_index * 7 ) ^ ( data_index >> 8 ) );
+		}
+	}
+	for( data_offset = 0;
+	     data_offset < 4;
+	     data_offset++ )
+	{
+		for( test_index = 0;
+		     test_index < 17;
+		     test_index++ )
+		{
+			lower_word = 0x0abc;
+			upper_word = 0xfff0;
+
+			for( data_index = 0;
+			     data_index < test_sizes[ test_index ];
+			     data_index++ )
+			{
+				lower_word = ( lower_word + data[ data_offset + data_index ] ) % 65521;
+				upper_word = ( upper_word + lower_word ) % 65521;
+			}
+			expected_checksum = ( upper_word << 16 ) | lower_word;
+
+			result = libpff_deflate_calculate_adler32(
+			          &checksum,
+			          &( data[ data_offset ] ),
+			          test_sizes[ test_index ],
+			          0xfff00abcUL,
+			          &error );
+
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			PFF_TEST_ASSERT_EQUAL_UINT32(
+			 "checksum",
+			 checksum,
+			 expected_checksum );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
 /* Tests the libpff_deflate_read_data_header function
  * Returns 1 if successful or 0 if not
  */
@@ -2087,15 +2191,17 @@ int pff_test_deflate_read_block(
 {
 	uint8_t uncompressed_data[ 8192 ];
 
-	libpff_bit_stream_t *bit_stream             = NULL;
-	libpff_huffman_tree_t *fixed_distances_tree = NULL;
-	libpff_huffman_tree_t *fixed_literals_tree  = NULL;
-	libcerror_error_t *error                     = NULL;
-	size_t uncompressed_data_offset              = 0;
-	size_t uncompressed_data_size                = 7640;
-	uint8_t block_type                           = 0;
-	uint8_t last_block_flag                      = 0;
-	int result                                   = 0;
+	libpff_bit_stream_t *bit_stream               = NULL;
+	libpff_huffman_tree_t *dynamic_distances_tree = NULL;
+	libpff_huffman_tree_t *dynamic_literals_tree  = NULL;
+	libpff_huffman_tree_t *fixed_distances_tree   = NULL;
+	libpff_huffman_tree_t *fixed_literals_tree    = NULL;
+	libcerror_error_t *error                      = NULL;
+	size_t uncompressed_data_offset               = 0;
+	size_t uncompressed_data_size                 = 7640;
+	uint8_t block_type                            = 0;
+	uint8_t last_block_flag                       = 0;
+	int result                                    = 0;
 
 	/* Initialize test
 	 */
@@ -2158,6 +2264,44 @@ int pff_test_deflate_read_block(
 	 "error",
 	 error );
 
+	result = libpff_huffman_tree_initialize(
+	          &dynamic_literals_tree,
+	          288,
+	          15,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "dynamic_literals_tree",
+	 dynamic_literals_tree );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_huffman_tree_initialize(
+	          &dynamic_distances_tree,
+	          30,
+	          15,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "dynamic_distances_tree",
+	 dynamic_distances_tree );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libpff_deflate_build_fixed_huffman_trees(
 	          fixed_literals_tree,
 	          fixed_distances_tree,
@@ -2194,6 +2338,8 @@ int pff_test_deflate_read_block(
 	          block_type,
 	          fixed_literals_tree,
 	          fixed_distances_tree,
+	          dynamic_literals_tree,
+	          dynamic_distances_tree,
 	          uncompressed_data,
 	          uncompressed_data_size,
 	          &uncompressed_data_offset,
@@ -2264,6 +2410,8 @@ int pff_test_deflate_read_block(
 	          block_type,
 	          fixed_literals_tree,
 	          fixed_distances_tree,
+	          dynamic_literals_tree,
+	          dynamic_distances_tree,
 	          uncompressed_data,
 	          uncompressed_data_size,
 	          &uncompressed_data_offset,
@@ -2286,6 +2434,8 @@ int pff_test_deflate_read_block(
 	          block_type,
 	          fixed_literals_tree,
 	          fixed_distances_tree,
+	          dynamic_literals_tree,
+	          dynamic_distances_tree,
 	          NULL,
 	          uncompressed_data_size,
 	          &uncompressed_data_offset,
@@ -2308,6 +2458,8 @@ int pff_test_deflate_read_block(
 	          block_type,
 	          fixed_literals_tree,
 	          fixed_distances_tree,
+	          dynamic_literals_tree,
+	          dynamic_distances_tree,
 	          uncompressed_data,
 	          (size_t) SSIZE_MAX + 1,
 	          &uncompressed_data_offset,
@@ -2330,6 +2482,8 @@ int pff_test_deflate_read_block(
 	          block_type,
 	          fixed_literals_tree,
 	          fixed_distances_tree,
+	          dynamic_literals_tree,
+	          dynamic_distances_tree,
 	          uncompressed_data,
 	          uncompressed_data_size,
 	          NULL,
@@ -2349,6 +2503,40 @@ int pff_test_deflate_read_block(
 
 	/* Clean up
 	 */
+	result = libpff_huffman_tree_free(
+	          &dynamic_distances_tree,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "dynamic_distances_tree",
+	 dynamic_distances_tree );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_huffman_tree_free(
+	          &dynamic_literals_tree,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "dynamic_literals_tree",
+	 dynamic_literals_tree );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libpff_huffman_tree_free(
 	          &fixed_distances_tree,
 	          &error );
@@ -2403,6 +2591,18 @@ int pff_test_deflate_read_block(
 	return( 1 );
 
 on_error:
+	if( dynamic_distances_tree != NULL )
+	{
+		libpff_huffman_tree_free(
+		 &dynamic_distances_tree,
+		 NULL );
+	}
+	if( dynamic_literals_tree != NULL )
+	{
+		libpff_huffman_tree_free(
+		 &dynamic_literals_tree,
+		 NULL );
+	}
 	if( fixed_distances_tree != NULL )
 	{
 		libpff_huffman_tree_free(
@@ -2681,6 +2881,147 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libpff_deflate_decompress_zlib_with_context function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_deflate_decompress_zlib_with_context(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	libcerror_error_t *error                  = NULL;
+	libpff_deflate_context_t *deflate_context = NULL;
+	size_t uncompressed_data_size             = 0;
+	int iterator                              = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_deflate_context_initialize(
+	          &deflate_context,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "deflate_context",
+	 deflate_context );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, the second iteration reuses the deflate context
+	 */
+	for( iterator = 0;
+	     iterator < 2;
+	     iterator++ )
+	{
+		uncompressed_data_size = 7640;
+
+		result = libpff_deflate_decompress_zlib_with_context(
+		          deflate_context,
+		          pff_test_deflate_compressed_data,
+		          2627,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		PFF_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 7640 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libpff_deflate_decompress_zlib_with_context(
+	          NULL,
+	          pff_test_deflate_compressed_data,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_deflate_decompress_zlib_with_context(
+	          deflate_context,
+	          NULL,
+	          2627,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_deflate_context_free(
+	          &deflate_context,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "deflate_context",
+	 deflate_context );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( deflate_context != NULL )
+	{
+		libpff_deflate_context_free(
+		 &deflate_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
 
 /* The main program
@@ -2724,6 +3065,10 @@ int main(
 	 "libpff_deflate_calculate_adler32",
 	 pff_test_deflate_calculate_adler32 );
 
+	PFF_TEST_RUN(
+	 "libpff_deflate_calculate_adler32_blocks",
+	 pff_test_deflate_calculate_adler32_blocks );
+
 	PFF_TEST_RUN(
 	 "libpff_deflate_read_data_header",
 	 pff_test_deflate_read_data_header );
@@ -2740,6 +3085,10 @@ int main(
 	 "libpff_deflate_decompress_zlib",
 	 pff_test_deflate_decompress_zlib );
 
+	PFF_TEST_RUN(
+	 "libpff_deflate_decompress_zlib_with_context",
+	 pff_test_deflate_decompress_zlib_with_context );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
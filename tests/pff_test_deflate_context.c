@@ -0,0 +1,485 @@
+/*
+ * Deflate context testing program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pff_test_libcerror.h"
+#include "pff_test_libcnotify.h"
+#include "pff_test_macros.h"
+#include "pff_test_memory.h"
+#include "pff_test_unused.h"
+
+#include "../libpff/libpff_deflate_context.h"
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+/* Tests the libpff_deflate_context_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_deflate_context_initialize(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libpff_deflate_context_t *deflate_context = NULL;
+	int result                                = 0;
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+	int number_of_malloc_fail_tests           = 1;
+	int number_of_memset_fail_tests           = 1;
+	int test_number                           = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libpff_deflate_context_initialize(
+	          &deflate_context,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "deflate_context",
+	 deflate_context );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_deflate_context_free(
+	          &deflate_context,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "deflate_context",
+	 deflate_context );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_deflate_context_initialize(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	deflate_context = (libpff_deflate_context_t *) 0x12345678UL;
+
+	result = libpff_deflate_context_initialize(
+	          &deflate_context,
+	          &error );
+
+	deflate_context = NULL;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libpff_deflate_context_initialize with malloc failing
+		 */
+		pff_test_malloc_attempts_before_fail = test_number;
+
+		result = libpff_deflate_context_initialize(
+		          &deflate_context,
+		          &error );
+
+		if( pff_test_malloc_attempts_before_fail != -1 )
+		{
+			pff_test_malloc_attempts_before_fail = -1;
+
+			if( deflate_context != NULL )
+			{
+				libpff_deflate_context_free(
+				 &deflate_context,
+				 NULL );
+			}
+		}
+		else
+		{
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "deflate_context",
+			 deflate_context );
+
+			PFF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libpff_deflate_context_initialize with memset failing
+		 */
+		pff_test_memset_attempts_before_fail = test_number;
+
+		result = libpff_deflate_context_initialize(
+		          &deflate_context,
+		          &error );
+
+		if( pff_test_memset_attempts_before_fail != -1 )
+		{
+			pff_test_memset_attempts_before_fail = -1;
+
+			if( deflate_context != NULL )
+			{
+				libpff_deflate_context_free(
+				 &deflate_context,
+				 NULL );
+			}
+		}
+		else
+		{
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "deflate_context",
+			 deflate_context );
+
+			PFF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_PFF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( deflate_context != NULL )
+	{
+		libpff_deflate_context_free(
+		 &deflate_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_deflate_context_free function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_deflate_context_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libpff_deflate_context_free(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_deflate_context_set_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_deflate_context_set_byte_stream(
+     void )
+{
+	uint8_t byte_stream[ 16 ];
+
+	libcerror_error_t *error                  = NULL;
+	libpff_deflate_context_t *deflate_context = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_deflate_context_initialize(
+	          &deflate_context,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "deflate_context",
+	 deflate_context );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_deflate_context_set_byte_stream(
+	          deflate_context,
+	          byte_stream,
+	          16,
+	          2,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "deflate_context->bit_stream",
+	 deflate_context->bit_stream );
+
+	PFF_TEST_ASSERT_EQUAL_SIZE(
+	 "deflate_context->bit_stream->byte_stream_offset",
+	 deflate_context->bit_stream->byte_stream_offset,
+	 (size_t) 2 );
+
+	/* Test if the bit stream is reused
+	 */
+	deflate_context->bit_stream->bit_buffer_size = 8;
+
+	result = libpff_deflate_context_set_byte_stream(
+	          deflate_context,
+	          byte_stream,
+	          8,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_SIZE(
+	 "deflate_context->bit_stream->byte_stream_size",
+	 deflate_context->bit_stream->byte_stream_size,
+	 (size_t) 8 );
+
+	PFF_TEST_ASSERT_EQUAL_SIZE(
+	 "deflate_context->bit_stream->byte_stream_offset",
+	 deflate_context->bit_stream->byte_stream_offset,
+	 (size_t) 0 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "deflate_context->bit_stream->bit_buffer_size",
+	 deflate_context->bit_stream->bit_buffer_size,
+	 (uint8_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libpff_deflate_context_set_byte_stream(
+	          NULL,
+	          byte_stream,
+	          16,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_deflate_context_set_byte_stream(
+	          deflate_context,
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_deflate_context_free(
+	          &deflate_context,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "deflate_context",
+	 deflate_context );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( deflate_context != NULL )
+	{
+		libpff_deflate_context_free(
+		 &deflate_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc PFF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] PFF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc PFF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] PFF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	PFF_TEST_UNREFERENCED_PARAMETER( argc )
+	PFF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+	PFF_TEST_RUN(
+	 "libpff_deflate_context_initialize",
+	 pff_test_deflate_context_initialize );
+
+	PFF_TEST_RUN(
+	 "libpff_deflate_context_free",
+	 pff_test_deflate_context_free );
+
+	PFF_TEST_RUN(
+	 "libpff_deflate_context_set_byte_stream",
+	 pff_test_deflate_context_set_byte_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+}
+
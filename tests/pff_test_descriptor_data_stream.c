@@ -0,0 +1,962 @@
+/*
+ * Descriptor data stream testing program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pff_test_libcerror.h"
+#include "pff_test_macros.h"
+#include "pff_test_memory.h"
+#include "pff_test_unused.h"
+
+#include "../libpff/libpff_descriptor_data_stream.h"
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+/* The segment offsets of 4 segments of 8192, 8192, 100 and 8192 bytes
+ * followed by the size of the data
+ */
+off64_t pff_test_descriptor_data_stream_segment_offsets[ 5 ] = {
+	0, 8192, 16384, 16484, 24676 };
+
+/* Offsets at the segment boundaries and the index of the segment that contains them
+ */
+off64_t pff_test_descriptor_data_stream_boundary_offsets[ 8 ] = {
+	0, 8191, 8192, 16383, 16384, 16483, 16484, 24675 };
+
+int pff_test_descriptor_data_stream_boundary_segment_indexes[ 8 ] = {
+	0, 0, 1, 1, 2, 2, 3, 3 };
+
+/* Creates a data handle with segment offsets for testing
+ * Returns 1 if successful or -1 on error
+ */
+int pff_test_descriptor_data_stream_data_handle_initialize_with_segments(
+     libpff_descriptor_data_stream_data_handle_t **data_handle,
+     libcerror_error_t **error )
+{
+	if( libpff_descriptor_data_stream_data_handle_initialize(
+	     data_handle,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	( *data_handle )->segment_offsets = (off64_t *) memory_allocate(
+	                                                 sizeof( off64_t ) * 5 );
+
+	if( ( *data_handle )->segment_offsets == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( *data_handle )->segment_offsets,
+	     pff_test_descriptor_data_stream_segment_offsets,
+	     sizeof( off64_t ) * 5 ) == NULL )
+	{
+		goto on_error;
+	}
+	( *data_handle )->number_of_segments = 4;
+
+	return( 1 );
+
+on_error:
+	libpff_descriptor_data_stream_data_handle_free(
+	 data_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libpff_descriptor_data_stream_data_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_descriptor_data_stream_data_handle_initialize(
+     void )
+{
+	libcerror_error_t *error                                 = NULL;
+	libpff_descriptor_data_stream_data_handle_t *data_handle = NULL;
+	int result                                               = 0;
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+	int number_of_malloc_fail_tests                          = 1;
+	int number_of_memset_fail_tests                          = 1;
+	int test_number                                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libpff_descriptor_data_stream_data_handle_initialize(
+	          &data_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "data_handle",
+	 data_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_descriptor_data_stream_data_handle_free(
+	          &data_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "data_handle",
+	 data_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_descriptor_data_stream_data_handle_initialize(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_handle = (libpff_descriptor_data_stream_data_handle_t *) 0x12345678UL;
+
+	result = libpff_descriptor_data_stream_data_handle_initialize(
+	          &data_handle,
+	          &error );
+
+	data_handle = NULL;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libpff_descriptor_data_stream_data_handle_initialize with malloc failing
+		 */
+		pff_test_malloc_attempts_before_fail = test_number;
+
+		result = libpff_descriptor_data_stream_data_handle_initialize(
+		          &data_handle,
+		          &error );
+
+		if( pff_test_malloc_attempts_before_fail != -1 )
+		{
+			pff_test_malloc_attempts_before_fail = -1;
+
+			if( data_handle != NULL )
+			{
+				libpff_descriptor_data_stream_data_handle_free(
+				 &data_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "data_handle",
+			 data_handle );
+
+			PFF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libpff_descriptor_data_stream_data_handle_initialize with memset failing
+		 */
+		pff_test_memset_attempts_before_fail = test_number;
+
+		result = libpff_descriptor_data_stream_data_handle_initialize(
+		          &data_handle,
+		          &error );
+
+		if( pff_test_memset_attempts_before_fail != -1 )
+		{
+			pff_test_memset_attempts_before_fail = -1;
+
+			if( data_handle != NULL )
+			{
+				libpff_descriptor_data_stream_data_handle_free(
+				 &data_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "data_handle",
+			 data_handle );
+
+			PFF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_PFF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_handle != NULL )
+	{
+		libpff_descriptor_data_stream_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_descriptor_data_stream_data_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_descriptor_data_stream_data_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libpff_descriptor_data_stream_data_handle_free(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_descriptor_data_stream_data_handle_get_segment_index_at_offset(
+     void )
+{
+	libcerror_error_t *error                                 = NULL;
+	libpff_descriptor_data_stream_data_handle_t *data_handle = NULL;
+	off64_t *segment_offsets                                 = NULL;
+	int offset_index                                         = 0;
+	int segment_index                                        = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = pff_test_descriptor_data_stream_data_handle_initialize_with_segments(
+	          &data_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "data_handle",
+	 data_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test offsets at the segment boundaries using a binary search
+	 */
+	for( offset_index = 0;
+	     offset_index < 8;
+	     offset_index++ )
+	{
+		segment_index = -1;
+
+		result = libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset(
+		          data_handle,
+		          pff_test_descriptor_data_stream_boundary_offsets[ offset_index ],
+		          -1,
+		          &segment_index,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "segment_index",
+		 segment_index,
+		 pff_test_descriptor_data_stream_boundary_segment_indexes[ offset_index ] );
+	}
+	/* Test a sequential read where the segment index hint contains the offset
+	 */
+	result = libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset(
+	          data_handle,
+	          8200,
+	          1,
+	          &segment_index,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "segment_index",
+	 segment_index,
+	 1 );
+
+	/* Test a random access read where the segment index hint does not contain the offset
+	 */
+	result = libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset(
+	          data_handle,
+	          16400,
+	          0,
+	          &segment_index,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "segment_index",
+	 segment_index,
+	 2 );
+
+	result = libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset(
+	          data_handle,
+	          0,
+	          3,
+	          &segment_index,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "segment_index",
+	 segment_index,
+	 0 );
+
+	/* Test a segment index hint that is out of bounds
+	 */
+	result = libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset(
+	          data_handle,
+	          24000,
+	          4,
+	          &segment_index,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "segment_index",
+	 segment_index,
+	 3 );
+
+	result = libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset(
+	          data_handle,
+	          8191,
+	          -2,
+	          &segment_index,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "segment_index",
+	 segment_index,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset(
+	          NULL,
+	          0,
+	          0,
+	          &segment_index,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset(
+	          data_handle,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an offset equal to the size of the data
+	 */
+	result = libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset(
+	          data_handle,
+	          24676,
+	          3,
+	          &segment_index,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an offset beyond the size of the data
+	 */
+	result = libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset(
+	          data_handle,
+	          30000,
+	          -1,
+	          &segment_index,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset(
+	          data_handle,
+	          -1,
+	          -1,
+	          &segment_index,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	segment_offsets              = data_handle->segment_offsets;
+	data_handle->segment_offsets = NULL;
+
+	result = libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset(
+	          data_handle,
+	          0,
+	          0,
+	          &segment_index,
+	          &error );
+
+	data_handle->segment_offsets = segment_offsets;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_descriptor_data_stream_data_handle_free(
+	          &data_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "data_handle",
+	 data_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_handle != NULL )
+	{
+		libpff_descriptor_data_stream_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_descriptor_data_stream_data_handle_seek_segment_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_descriptor_data_stream_data_handle_seek_segment_offset(
+     void )
+{
+	libcerror_error_t *error                                 = NULL;
+	libpff_descriptor_data_stream_data_handle_t *data_handle = NULL;
+	off64_t offset                                           = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = pff_test_descriptor_data_stream_data_handle_initialize_with_segments(
+	          &data_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "data_handle",
+	 data_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	offset = libpff_descriptor_data_stream_data_handle_seek_segment_offset(
+	          data_handle,
+	          NULL,
+	          0,
+	          0,
+	          16400,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 16400 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "data_handle->current_segment_index",
+	 data_handle->current_segment_index,
+	 2 );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "data_handle->current_segment_data_offset",
+	 (int64_t) data_handle->current_segment_data_offset,
+	 (int64_t) 16 );
+
+	offset = libpff_descriptor_data_stream_data_handle_seek_segment_offset(
+	          data_handle,
+	          NULL,
+	          2,
+	          0,
+	          16484,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 16484 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "data_handle->current_segment_index",
+	 data_handle->current_segment_index,
+	 3 );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "data_handle->current_segment_data_offset",
+	 (int64_t) data_handle->current_segment_data_offset,
+	 (int64_t) 0 );
+
+	offset = libpff_descriptor_data_stream_data_handle_seek_segment_offset(
+	          data_handle,
+	          NULL,
+	          3,
+	          0,
+	          8191,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 8191 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "data_handle->current_segment_index",
+	 data_handle->current_segment_index,
+	 0 );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "data_handle->current_segment_data_offset",
+	 (int64_t) data_handle->current_segment_data_offset,
+	 (int64_t) 8191 );
+
+	/* Test seeking to the end of the data
+	 */
+	offset = libpff_descriptor_data_stream_data_handle_seek_segment_offset(
+	          data_handle,
+	          NULL,
+	          3,
+	          0,
+	          24676,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 24676 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "data_handle->current_segment_index",
+	 data_handle->current_segment_index,
+	 4 );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "data_handle->current_segment_data_offset",
+	 (int64_t) data_handle->current_segment_data_offset,
+	 (int64_t) 0 );
+
+	/* Test seeking beyond the end of the data
+	 */
+	offset = libpff_descriptor_data_stream_data_handle_seek_segment_offset(
+	          data_handle,
+	          NULL,
+	          0,
+	          0,
+	          30000,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 30000 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "data_handle->current_segment_index",
+	 data_handle->current_segment_index,
+	 4 );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "data_handle->current_segment_data_offset",
+	 (int64_t) data_handle->current_segment_data_offset,
+	 (int64_t) 0 );
+
+	/* Test error cases
+	 */
+	offset = libpff_descriptor_data_stream_data_handle_seek_segment_offset(
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libpff_descriptor_data_stream_data_handle_seek_segment_offset(
+	          data_handle,
+	          NULL,
+	          0,
+	          0,
+	          -1,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_descriptor_data_stream_data_handle_free(
+	          &data_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "data_handle",
+	 data_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_handle != NULL )
+	{
+		libpff_descriptor_data_stream_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc PFF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] PFF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc PFF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] PFF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	PFF_TEST_UNREFERENCED_PARAMETER( argc )
+	PFF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+	PFF_TEST_RUN(
+	 "libpff_descriptor_data_stream_data_handle_initialize",
+	 pff_test_descriptor_data_stream_data_handle_initialize );
+
+	PFF_TEST_RUN(
+	 "libpff_descriptor_data_stream_data_handle_free",
+	 pff_test_descriptor_data_stream_data_handle_free );
+
+	/* TODO: add tests for libpff_descriptor_data_stream_data_handle_clone */
+
+	/* TODO: add tests for libpff_descriptor_data_stream_data_handle_read_segment_data */
+
+	PFF_TEST_RUN(
+	 "libpff_descriptor_data_stream_data_handle_get_segment_index_at_offset",
+	 pff_test_descriptor_data_stream_data_handle_get_segment_index_at_offset );
+
+	PFF_TEST_RUN(
+	 "libpff_descriptor_data_stream_data_handle_seek_segment_offset",
+	 pff_test_descriptor_data_stream_data_handle_seek_segment_offset );
+
+	/* TODO: add tests for libpff_descriptor_data_stream_initialize */
+
+	/* TODO: add tests for libpff_descriptor_data_stream_get_extents */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+}
+
@@ -33,6 +33,7 @@
 #include "pff_test_macros.h"
 #include "pff_test_unused.h"
 
+#include "../libpff/libpff_checksum.h"
 #include "../libpff/libpff_encryption.h"
 #include "../libpff/libpff_definitions.h"
 
@@ -413,6 +414,211 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libpff_encryption_decrypt_with_weak_crc32 function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_encryption_decrypt_with_weak_crc32(
+     void )
+{
+	uint8_t data[ 4096 ];
+	uint8_t expected_data[ 4096 ];
+
+	libcerror_error_t *error   = NULL;
+	void *memcpy_result        = NULL;
+	ssize_t result             = 0;
+	uint32_t checksum          = 0;
+	uint32_t expected_checksum = 0;
+	uint8_t encryption_type    = 0;
+	int compare_result         = 0;
+
+	for( encryption_type = LIBPFF_ENCRYPTION_TYPE_NONE;
+	     encryption_type <= LIBPFF_ENCRYPTION_TYPE_HIGH;
+	     encryption_type++ )
+	{
+		/* Initialize test
+		 */
+		memcpy_result = memory_copy(
+		                 expected_data,
+		                 pff_test_encryption_compressible_encrypted_data1,
+		                 2984 );
+
+		PFF_TEST_ASSERT_IS_NOT_NULL(
+		 "memcpy_result",
+		 memcpy_result );
+
+		memcpy_result = memory_copy(
+		                 data,
+		                 pff_test_encryption_compressible_encrypted_data1,
+		                 2984 );
+
+		PFF_TEST_ASSERT_IS_NOT_NULL(
+		 "memcpy_result",
+		 memcpy_result );
+
+		result = libpff_checksum_calculate_weak_crc32(
+		          &expected_checksum,
+		          expected_data,
+		          2984,
+		          0,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libpff_encryption_decrypt(
+		          encryption_type,
+		          0x12345678UL,
+		          expected_data,
+		          2984,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_SSIZE(
+		 "result",
+		 result,
+		 (ssize_t) 2984 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libpff_encryption_decrypt_with_weak_crc32(
+		          encryption_type,
+		          0x12345678UL,
+		          data,
+		          2984,
+		          &checksum,
+		          0,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_SSIZE(
+		 "result",
+		 result,
+		 (ssize_t) 2984 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		PFF_TEST_ASSERT_EQUAL_UINT32(
+		 "checksum",
+		 checksum,
+		 expected_checksum );
+
+		compare_result = memory_compare(
+		                  data,
+		                  expected_data,
+		                  2984 );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "compare_result",
+		 compare_result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libpff_encryption_decrypt_with_weak_crc32(
+	          -1,
+	          0,
+	          data,
+	          2984,
+	          &checksum,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "result",
+	 result,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_encryption_decrypt_with_weak_crc32(
+	          LIBPFF_ENCRYPTION_TYPE_COMPRESSIBLE,
+	          0,
+	          NULL,
+	          2984,
+	          &checksum,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "result",
+	 result,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_encryption_decrypt_with_weak_crc32(
+	          LIBPFF_ENCRYPTION_TYPE_COMPRESSIBLE,
+	          0,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &checksum,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "result",
+	 result,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_encryption_decrypt_with_weak_crc32(
+	          LIBPFF_ENCRYPTION_TYPE_COMPRESSIBLE,
+	          0,
+	          data,
+	          2984,
+	          NULL,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "result",
+	 result,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
 
 /* The main program
@@ -436,6 +642,10 @@ int main(
 	 "libpff_encryption_decrypt",
 	 pff_test_encryption_decrypt );
 
+	PFF_TEST_RUN(
+	 "libpff_encryption_decrypt_with_weak_crc32",
+	 pff_test_encryption_decrypt_with_weak_crc32 );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -33,12 +33,20 @@
 #include "pff_test_functions.h"
 #include "pff_test_getopt.h"
 #include "pff_test_libbfio.h"
+#include "pff_test_libcdata.h"
 #include "pff_test_libcerror.h"
 #include "pff_test_libpff.h"
 #include "pff_test_macros.h"
 #include "pff_test_memory.h"
 
+#include "../libpff/libpff_descriptors_index.h"
 #include "../libpff/libpff_file.h"
+#include "../libpff/libpff_index_value.h"
+#include "../libpff/libpff_item_descriptor.h"
+#include "../libpff/libpff_item_tree.h"
+#include "../libpff/libpff_offsets_index.h"
+
+#include "../libpff/pff_recover_checkpoint.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
 #error Unsupported size of wchar_t
@@ -1286,40 +1294,37 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libpff_file_get_size function
+/* Tests the libpff_file_get_number_of_checksum_mismatches function
  * Returns 1 if successful or 0 if not
  */
-int pff_test_file_get_size(
+int pff_test_file_get_number_of_checksum_mismatches(
      libpff_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	size64_t size            = 0;
-	int result               = 0;
-	int size_is_set          = 0;
+	libcerror_error_t *error               = NULL;
+	uint32_t number_of_checksum_mismatches = 0;
+	int result                             = 0;
 
 	/* Test regular cases
 	 */
-	result = libpff_file_get_size(
+	result = libpff_file_get_number_of_checksum_mismatches(
 	          file,
-	          &size,
+	          &number_of_checksum_mismatches,
 	          &error );
 
-	PFF_TEST_ASSERT_NOT_EQUAL_INT(
+	PFF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	size_is_set = result;
-
 	/* Test error cases
 	 */
-	result = libpff_file_get_size(
+	result = libpff_file_get_number_of_checksum_mismatches(
 	          NULL,
-	          &size,
+	          &number_of_checksum_mismatches,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -1334,25 +1339,23 @@ int pff_test_file_get_size(
 	libcerror_error_free(
 	 &error );
 
-	if( size_is_set != 0 )
-	{
-		result = libpff_file_get_size(
-		          file,
-		          NULL,
-		          &error );
+	result = libpff_file_get_number_of_checksum_mismatches(
+	          file,
+	          NULL,
+	          &error );
 
-		PFF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		PFF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1364,40 +1367,50 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libpff_file_get_content_type function
+/* Tests the libpff_file_set_checksum_verification_sample_interval function
  * Returns 1 if successful or 0 if not
  */
-int pff_test_file_get_content_type(
+int pff_test_file_set_checksum_verification_sample_interval(
      libpff_file_t *file )
 {
 	libcerror_error_t *error = NULL;
-	uint8_t content_type     = 0;
-	int content_type_is_set  = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libpff_file_get_content_type(
+	result = libpff_file_set_checksum_verification_sample_interval(
 	          file,
-	          &content_type,
+	          16,
 	          &error );
 
-	PFF_TEST_ASSERT_NOT_EQUAL_INT(
+	PFF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	content_type_is_set = result;
+	result = libpff_file_set_checksum_verification_sample_interval(
+	          file,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libpff_file_get_content_type(
+	result = libpff_file_set_checksum_verification_sample_interval(
 	          NULL,
-	          &content_type,
+	          16,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -1412,25 +1425,6 @@ int pff_test_file_get_content_type(
 	libcerror_error_free(
 	 &error );
 
-	if( content_type_is_set != 0 )
-	{
-		result = libpff_file_get_content_type(
-		          file,
-		          NULL,
-		          &error );
-
-		PFF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		PFF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1442,40 +1436,53 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libpff_file_get_type function
+/* Tests the libpff_file_set_number_of_read_ahead_threads function
  * Returns 1 if successful or 0 if not
  */
-int pff_test_file_get_type(
+int pff_test_file_set_number_of_read_ahead_threads(
      libpff_file_t *file )
 {
 	libcerror_error_t *error = NULL;
-	uint8_t type             = 0;
 	int result               = 0;
-	int type_is_set          = 0;
 
 	/* Test regular cases
 	 */
-	result = libpff_file_get_type(
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	result = libpff_file_set_number_of_read_ahead_threads(
 	          file,
-	          &type,
+	          4,
 	          &error );
 
-	PFF_TEST_ASSERT_NOT_EQUAL_INT(
+	PFF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	type_is_set = result;
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	result = libpff_file_set_number_of_read_ahead_threads(
+	          file,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libpff_file_get_type(
+	result = libpff_file_set_number_of_read_ahead_threads(
 	          NULL,
-	          &type,
+	          4,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -1490,25 +1497,23 @@ int pff_test_file_get_type(
 	libcerror_error_free(
 	 &error );
 
-	if( type_is_set != 0 )
-	{
-		result = libpff_file_get_type(
-		          file,
-		          NULL,
-		          &error );
+	result = libpff_file_set_number_of_read_ahead_threads(
+	          file,
+	          -1,
+	          &error );
 
-		PFF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		PFF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1520,40 +1525,53 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libpff_file_get_encryption_type function
+/* Tests the libpff_file_set_number_of_recovery_threads function
  * Returns 1 if successful or 0 if not
  */
-int pff_test_file_get_encryption_type(
+int pff_test_file_set_number_of_recovery_threads(
      libpff_file_t *file )
 {
-	libcerror_error_t *error   = NULL;
-	uint8_t encryption_type    = 0;
-	int encryption_type_is_set = 0;
-	int result                 = 0;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libpff_file_get_encryption_type(
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	result = libpff_file_set_number_of_recovery_threads(
 	          file,
-	          &encryption_type,
+	          4,
 	          &error );
 
-	PFF_TEST_ASSERT_NOT_EQUAL_INT(
+	PFF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	encryption_type_is_set = result;
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	result = libpff_file_set_number_of_recovery_threads(
+	          file,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libpff_file_get_encryption_type(
+	result = libpff_file_set_number_of_recovery_threads(
 	          NULL,
-	          &encryption_type,
+	          4,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -1568,25 +1586,23 @@ int pff_test_file_get_encryption_type(
 	libcerror_error_free(
 	 &error );
 
-	if( encryption_type_is_set != 0 )
-	{
-		result = libpff_file_get_encryption_type(
-		          file,
-		          NULL,
-		          &error );
+	result = libpff_file_set_number_of_recovery_threads(
+	          file,
+	          -1,
+	          &error );
 
-		PFF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		PFF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1598,22 +1614,22 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libpff_file_get_ascii_codepage function
+/* Tests the libpff_file_get_size function
  * Returns 1 if successful or 0 if not
  */
-int pff_test_file_get_ascii_codepage(
+int pff_test_file_get_size(
      libpff_file_t *file )
 {
-	libcerror_error_t *error  = NULL;
-	int ascii_codepage        = 0;
-	int ascii_codepage_is_set = 0;
-	int result                = 0;
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	int result               = 0;
+	int size_is_set          = 0;
 
 	/* Test regular cases
 	 */
-	result = libpff_file_get_ascii_codepage(
+	result = libpff_file_get_size(
 	          file,
-	          &ascii_codepage,
+	          &size,
 	          &error );
 
 	PFF_TEST_ASSERT_NOT_EQUAL_INT(
@@ -1625,13 +1641,13 @@ int pff_test_file_get_ascii_codepage(
 	 "error",
 	 error );
 
-	ascii_codepage_is_set = result;
+	size_is_set = result;
 
 	/* Test error cases
 	 */
-	result = libpff_file_get_ascii_codepage(
+	result = libpff_file_get_size(
 	          NULL,
-	          &ascii_codepage,
+	          &size,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -1646,9 +1662,9 @@ int pff_test_file_get_ascii_codepage(
 	libcerror_error_free(
 	 &error );
 
-	if( ascii_codepage_is_set != 0 )
+	if( size_is_set != 0 )
 	{
-		result = libpff_file_get_ascii_codepage(
+		result = libpff_file_get_size(
 		          file,
 		          NULL,
 		          &error );
@@ -1676,80 +1692,40 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libpff_file_set_ascii_codepage function
+/* Tests the libpff_file_get_content_type function
  * Returns 1 if successful or 0 if not
  */
-int pff_test_file_set_ascii_codepage(
+int pff_test_file_get_content_type(
      libpff_file_t *file )
 {
-	int supported_codepages[ 15 ] = {
-		LIBPFF_CODEPAGE_ASCII,
-		LIBPFF_CODEPAGE_WINDOWS_874,
-		LIBPFF_CODEPAGE_WINDOWS_932,
-		LIBPFF_CODEPAGE_WINDOWS_936,
-		LIBPFF_CODEPAGE_WINDOWS_949,
-		LIBPFF_CODEPAGE_WINDOWS_950,
-		LIBPFF_CODEPAGE_WINDOWS_1250,
-		LIBPFF_CODEPAGE_WINDOWS_1251,
-		LIBPFF_CODEPAGE_WINDOWS_1252,
-		LIBPFF_CODEPAGE_WINDOWS_1253,
-		LIBPFF_CODEPAGE_WINDOWS_1254,
-		LIBPFF_CODEPAGE_WINDOWS_1255,
-		LIBPFF_CODEPAGE_WINDOWS_1256,
-		LIBPFF_CODEPAGE_WINDOWS_1257,
-		LIBPFF_CODEPAGE_WINDOWS_1258 };
+	libcerror_error_t *error = NULL;
+	uint8_t content_type     = 0;
+	int content_type_is_set  = 0;
+	int result               = 0;
 
-	int unsupported_codepages[ 17 ] = {
-		LIBPFF_CODEPAGE_ISO_8859_1,
-		LIBPFF_CODEPAGE_ISO_8859_2,
-		LIBPFF_CODEPAGE_ISO_8859_3,
-		LIBPFF_CODEPAGE_ISO_8859_4,
-		LIBPFF_CODEPAGE_ISO_8859_5,
-		LIBPFF_CODEPAGE_ISO_8859_6,
-		LIBPFF_CODEPAGE_ISO_8859_7,
-		LIBPFF_CODEPAGE_ISO_8859_8,
-		LIBPFF_CODEPAGE_ISO_8859_9,
-		LIBPFF_CODEPAGE_ISO_8859_10,
-		LIBPFF_CODEPAGE_ISO_8859_11,
-		LIBPFF_CODEPAGE_ISO_8859_13,
-		LIBPFF_CODEPAGE_ISO_8859_14,
-		LIBPFF_CODEPAGE_ISO_8859_15,
-		LIBPFF_CODEPAGE_ISO_8859_16,
-		LIBPFF_CODEPAGE_KOI8_R,
-		LIBPFF_CODEPAGE_KOI8_U };
-
-	libcerror_error_t *error = NULL;
-	int codepage             = 0;
-	int index                = 0;
-	int result               = 0;
-
-	/* Test set ASCII codepage
+	/* Test regular cases
 	 */
-	for( index = 0;
-	     index < 15;
-	     index++ )
-	{
-		codepage = supported_codepages[ index ];
+	result = libpff_file_get_content_type(
+	          file,
+	          &content_type,
+	          &error );
 
-		result = libpff_file_set_ascii_codepage(
-		          file,
-		          codepage,
-		          &error );
+	PFF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		PFF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	content_type_is_set = result;
 
-		PFF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
 	/* Test error cases
 	 */
-	result = libpff_file_set_ascii_codepage(
+	result = libpff_file_get_content_type(
 	          NULL,
-	          LIBPFF_CODEPAGE_ASCII,
+	          &content_type,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -1764,15 +1740,11 @@ int pff_test_file_set_ascii_codepage(
 	libcerror_error_free(
 	 &error );
 
-	for( index = 0;
-	     index < 17;
-	     index++ )
+	if( content_type_is_set != 0 )
 	{
-		codepage = unsupported_codepages[ index ];
-
-		result = libpff_file_set_ascii_codepage(
+		result = libpff_file_get_content_type(
 		          file,
-		          codepage,
+		          NULL,
 		          &error );
 
 		PFF_TEST_ASSERT_EQUAL_INT(
@@ -1787,22 +1759,6 @@ int pff_test_file_set_ascii_codepage(
 		libcerror_error_free(
 		 &error );
 	}
-	/* Clean up
-	 */
-	result = libpff_file_set_ascii_codepage(
-	          file,
-	          LIBPFF_CODEPAGE_WINDOWS_1252,
-	          &error );
-
-	PFF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	PFF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	return( 1 );
 
 on_error:
@@ -1814,54 +1770,40 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libpff_file_get_root_item function
+/* Tests the libpff_file_get_type function
  * Returns 1 if successful or 0 if not
  */
-int pff_test_file_get_root_item(
+int pff_test_file_get_type(
      libpff_file_t *file )
 {
 	libcerror_error_t *error = NULL;
-	libpff_item_t *root_item = NULL;
+	uint8_t type             = 0;
 	int result               = 0;
+	int type_is_set          = 0;
 
 	/* Test regular cases
 	 */
-	result = libpff_file_get_root_item(
+	result = libpff_file_get_type(
 	          file,
-	          &root_item,
+	          &type,
 	          &error );
 
-	PFF_TEST_ASSERT_EQUAL_INT(
+	PFF_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	PFF_TEST_ASSERT_IS_NOT_NULL(
-	 "root_item",
-	 root_item );
-
-	result = libpff_item_free(
-	          &root_item,
-	          &error );
-
-	PFF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	PFF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	type_is_set = result;
 
 	/* Test error cases
 	 */
-	result = libpff_file_get_root_item(
+	result = libpff_file_get_type(
 	          NULL,
-	          &root_item,
+	          &type,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -1869,10 +1811,6 @@ int pff_test_file_get_root_item(
 	 result,
 	 -1 );
 
-	PFF_TEST_ASSERT_IS_NULL(
-	 "root_item",
-	 root_item );
-
 	PFF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1880,27 +1818,25 @@ int pff_test_file_get_root_item(
 	libcerror_error_free(
 	 &error );
 
-	result = libpff_file_get_root_item(
-	          file,
-	          NULL,
-	          &error );
-
-	PFF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	PFF_TEST_ASSERT_IS_NULL(
-	 "root_item",
-	 root_item );
+	if( type_is_set != 0 )
+	{
+		result = libpff_file_get_type(
+		          file,
+		          NULL,
+		          &error );
 
-	PFF_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	libcerror_error_free(
-	 &error );
+		PFF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
+		libcerror_error_free(
+		 &error );
+	}
 	return( 1 );
 
 on_error:
@@ -1909,31 +1845,25 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( root_item != NULL )
-	{
-		libpff_item_free(
-		 &root_item,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libpff_file_get_message_store function
+/* Tests the libpff_file_get_encryption_type function
  * Returns 1 if successful or 0 if not
  */
-int pff_test_file_get_message_store(
+int pff_test_file_get_encryption_type(
      libpff_file_t *file )
 {
-	libcerror_error_t *error     = NULL;
-	libpff_item_t *message_store = NULL;
-	int message_store_is_set     = 0;
-	int result                   = 0;
+	libcerror_error_t *error   = NULL;
+	uint8_t encryption_type    = 0;
+	int encryption_type_is_set = 0;
+	int result                 = 0;
 
 	/* Test regular cases
 	 */
-	result = libpff_file_get_message_store(
+	result = libpff_file_get_encryption_type(
 	          file,
-	          &message_store,
+	          &encryption_type,
 	          &error );
 
 	PFF_TEST_ASSERT_NOT_EQUAL_INT(
@@ -1945,32 +1875,13 @@ int pff_test_file_get_message_store(
 	 "error",
 	 error );
 
-	message_store_is_set = result;
-
-	if( message_store_is_set != 0 )
-	{
-		PFF_TEST_ASSERT_IS_NOT_NULL(
-		 "message_store",
-		 message_store );
-
-		result = libpff_item_free(
-		          &message_store,
-		          &error );
-
-		PFF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	encryption_type_is_set = result;
 
-		PFF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
 	/* Test error cases
 	 */
-	result = libpff_file_get_message_store(
+	result = libpff_file_get_encryption_type(
 	          NULL,
-	          &message_store,
+	          &encryption_type,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -1978,10 +1889,6 @@ int pff_test_file_get_message_store(
 	 result,
 	 -1 );
 
-	PFF_TEST_ASSERT_IS_NULL(
-	 "message_store",
-	 message_store );
-
 	PFF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1989,9 +1896,9 @@ int pff_test_file_get_message_store(
 	libcerror_error_free(
 	 &error );
 
-	if( message_store_is_set != 0 )
+	if( encryption_type_is_set != 0 )
 	{
-		result = libpff_file_get_message_store(
+		result = libpff_file_get_encryption_type(
 		          file,
 		          NULL,
 		          &error );
@@ -2001,10 +1908,6 @@ int pff_test_file_get_message_store(
 		 result,
 		 -1 );
 
-		PFF_TEST_ASSERT_IS_NULL(
-		 "message_store",
-		 message_store );
-
 		PFF_TEST_ASSERT_IS_NOT_NULL(
 		 "error",
 		 error );
@@ -2020,31 +1923,25 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( message_store != NULL )
-	{
-		libpff_item_free(
-		 &message_store,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libpff_file_get_name_to_id_map function
+/* Tests the libpff_file_get_ascii_codepage function
  * Returns 1 if successful or 0 if not
  */
-int pff_test_file_get_name_to_id_map(
+int pff_test_file_get_ascii_codepage(
      libpff_file_t *file )
 {
-	libcerror_error_t *error      = NULL;
-	libpff_item_t *name_to_id_map = NULL;
-	int name_to_id_map_is_set     = 0;
-	int result                    = 0;
+	libcerror_error_t *error  = NULL;
+	int ascii_codepage        = 0;
+	int ascii_codepage_is_set = 0;
+	int result                = 0;
 
 	/* Test regular cases
 	 */
-	result = libpff_file_get_name_to_id_map(
+	result = libpff_file_get_ascii_codepage(
 	          file,
-	          &name_to_id_map,
+	          &ascii_codepage,
 	          &error );
 
 	PFF_TEST_ASSERT_NOT_EQUAL_INT(
@@ -2056,43 +1953,20 @@ int pff_test_file_get_name_to_id_map(
 	 "error",
 	 error );
 
-	name_to_id_map_is_set = result;
-
-	if( name_to_id_map_is_set != 0 )
-	{
-		PFF_TEST_ASSERT_IS_NOT_NULL(
-		 "name_to_id_map",
-		 name_to_id_map );
+	ascii_codepage_is_set = result;
 
-		result = libpff_item_free(
-		          &name_to_id_map,
-		          &error );
-
-		PFF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		PFF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Test error cases
-	 */
-	result = libpff_file_get_name_to_id_map(
-	          NULL,
-	          &name_to_id_map,
-	          &error );
+	/* Test error cases
+	 */
+	result = libpff_file_get_ascii_codepage(
+	          NULL,
+	          &ascii_codepage,
+	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	PFF_TEST_ASSERT_IS_NULL(
-	 "name_to_id_map",
-	 name_to_id_map );
-
 	PFF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2100,9 +1974,9 @@ int pff_test_file_get_name_to_id_map(
 	libcerror_error_free(
 	 &error );
 
-	if( name_to_id_map_is_set != 0 )
+	if( ascii_codepage_is_set != 0 )
 	{
-		result = libpff_file_get_name_to_id_map(
+		result = libpff_file_get_ascii_codepage(
 		          file,
 		          NULL,
 		          &error );
@@ -2112,10 +1986,6 @@ int pff_test_file_get_name_to_id_map(
 		 result,
 		 -1 );
 
-		PFF_TEST_ASSERT_IS_NULL(
-		 "name_to_id_map",
-		 name_to_id_map );
-
 		PFF_TEST_ASSERT_IS_NOT_NULL(
 		 "error",
 		 error );
@@ -2131,52 +2001,67 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( name_to_id_map != NULL )
-	{
-		libpff_item_free(
-		 &name_to_id_map,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libpff_file_get_root_folder function
+/* Tests the libpff_file_set_ascii_codepage function
  * Returns 1 if successful or 0 if not
  */
-int pff_test_file_get_root_folder(
+int pff_test_file_set_ascii_codepage(
      libpff_file_t *file )
 {
-	libcerror_error_t *error   = NULL;
-	libpff_item_t *root_folder = NULL;
-	int result                 = 0;
-	int root_folder_is_set     = 0;
-
-	/* Test regular cases
-	 */
-	result = libpff_file_get_root_folder(
-	          file,
-	          &root_folder,
-	          &error );
-
-	PFF_TEST_ASSERT_NOT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	int supported_codepages[ 15 ] = {
+		LIBPFF_CODEPAGE_ASCII,
+		LIBPFF_CODEPAGE_WINDOWS_874,
+		LIBPFF_CODEPAGE_WINDOWS_932,
+		LIBPFF_CODEPAGE_WINDOWS_936,
+		LIBPFF_CODEPAGE_WINDOWS_949,
+		LIBPFF_CODEPAGE_WINDOWS_950,
+		LIBPFF_CODEPAGE_WINDOWS_1250,
+		LIBPFF_CODEPAGE_WINDOWS_1251,
+		LIBPFF_CODEPAGE_WINDOWS_1252,
+		LIBPFF_CODEPAGE_WINDOWS_1253,
+		LIBPFF_CODEPAGE_WINDOWS_1254,
+		LIBPFF_CODEPAGE_WINDOWS_1255,
+		LIBPFF_CODEPAGE_WINDOWS_1256,
+		LIBPFF_CODEPAGE_WINDOWS_1257,
+		LIBPFF_CODEPAGE_WINDOWS_1258 };
 
-	PFF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	int unsupported_codepages[ 17 ] = {
+		LIBPFF_CODEPAGE_ISO_8859_1,
+		LIBPFF_CODEPAGE_ISO_8859_2,
+		LIBPFF_CODEPAGE_ISO_8859_3,
+		LIBPFF_CODEPAGE_ISO_8859_4,
+		LIBPFF_CODEPAGE_ISO_8859_5,
+		LIBPFF_CODEPAGE_ISO_8859_6,
+		LIBPFF_CODEPAGE_ISO_8859_7,
+		LIBPFF_CODEPAGE_ISO_8859_8,
+		LIBPFF_CODEPAGE_ISO_8859_9,
+		LIBPFF_CODEPAGE_ISO_8859_10,
+		LIBPFF_CODEPAGE_ISO_8859_11,
+		LIBPFF_CODEPAGE_ISO_8859_13,
+		LIBPFF_CODEPAGE_ISO_8859_14,
+		LIBPFF_CODEPAGE_ISO_8859_15,
+		LIBPFF_CODEPAGE_ISO_8859_16,
+		LIBPFF_CODEPAGE_KOI8_R,
+		LIBPFF_CODEPAGE_KOI8_U };
 
-	root_folder_is_set = result;
+	libcerror_error_t *error = NULL;
+	int codepage             = 0;
+	int index                = 0;
+	int result               = 0;
 
-	if( root_folder_is_set != 0 )
+	/* Test set ASCII codepage
+	 */
+	for( index = 0;
+	     index < 15;
+	     index++ )
 	{
-		PFF_TEST_ASSERT_IS_NOT_NULL(
-		 "root_folder",
-		 root_folder );
+		codepage = supported_codepages[ index ];
 
-		result = libpff_item_free(
-		          &root_folder,
+		result = libpff_file_set_ascii_codepage(
+		          file,
+		          codepage,
 		          &error );
 
 		PFF_TEST_ASSERT_EQUAL_INT(
@@ -2190,9 +2075,9 @@ int pff_test_file_get_root_folder(
 	}
 	/* Test error cases
 	 */
-	result = libpff_file_get_root_folder(
+	result = libpff_file_set_ascii_codepage(
 	          NULL,
-	          &root_folder,
+	          LIBPFF_CODEPAGE_ASCII,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -2200,10 +2085,6 @@ int pff_test_file_get_root_folder(
 	 result,
 	 -1 );
 
-	PFF_TEST_ASSERT_IS_NULL(
-	 "root_folder",
-	 root_folder );
-
 	PFF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2211,11 +2092,15 @@ int pff_test_file_get_root_folder(
 	libcerror_error_free(
 	 &error );
 
-	if( root_folder_is_set != 0 )
+	for( index = 0;
+	     index < 17;
+	     index++ )
 	{
-		result = libpff_file_get_root_folder(
+		codepage = unsupported_codepages[ index ];
+
+		result = libpff_file_set_ascii_codepage(
 		          file,
-		          NULL,
+		          codepage,
 		          &error );
 
 		PFF_TEST_ASSERT_EQUAL_INT(
@@ -2223,10 +2108,6 @@ int pff_test_file_get_root_folder(
 		 result,
 		 -1 );
 
-		PFF_TEST_ASSERT_IS_NULL(
-		 "root_folder",
-		 root_folder );
-
 		PFF_TEST_ASSERT_IS_NOT_NULL(
 		 "error",
 		 error );
@@ -2234,6 +2115,22 @@ int pff_test_file_get_root_folder(
 		libcerror_error_free(
 		 &error );
 	}
+	/* Clean up
+	 */
+	result = libpff_file_set_ascii_codepage(
+	          file,
+	          LIBPFF_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -2242,30 +2139,41 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( root_folder != NULL )
-	{
-		libpff_item_free(
-		 &root_folder,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libpff_file_get_number_of_orphan_items function
+/* Tests the libpff_file_get_root_item function
  * Returns 1 if successful or 0 if not
  */
-int pff_test_file_get_number_of_orphan_items(
+int pff_test_file_get_root_item(
      libpff_file_t *file )
 {
-	libcerror_error_t *error   = NULL;
-	int number_of_orphan_items = 0;
-	int result                 = 0;
+	libcerror_error_t *error = NULL;
+	libpff_item_t *root_item = NULL;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libpff_file_get_number_of_orphan_items(
+	result = libpff_file_get_root_item(
 	          file,
-	          &number_of_orphan_items,
+	          &root_item,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "root_item",
+	 root_item );
+
+	result = libpff_item_free(
+	          &root_item,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -2279,9 +2187,9 @@ int pff_test_file_get_number_of_orphan_items(
 
 	/* Test error cases
 	 */
-	result = libpff_file_get_number_of_orphan_items(
+	result = libpff_file_get_root_item(
 	          NULL,
-	          &number_of_orphan_items,
+	          &root_item,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -2289,6 +2197,10 @@ int pff_test_file_get_number_of_orphan_items(
 	 result,
 	 -1 );
 
+	PFF_TEST_ASSERT_IS_NULL(
+	 "root_item",
+	 root_item );
+
 	PFF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2296,7 +2208,7 @@ int pff_test_file_get_number_of_orphan_items(
 	libcerror_error_free(
 	 &error );
 
-	result = libpff_file_get_number_of_orphan_items(
+	result = libpff_file_get_root_item(
 	          file,
 	          NULL,
 	          &error );
@@ -2306,6 +2218,10 @@ int pff_test_file_get_number_of_orphan_items(
 	 result,
 	 -1 );
 
+	PFF_TEST_ASSERT_IS_NULL(
+	 "root_item",
+	 root_item );
+
 	PFF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2321,61 +2237,52 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( root_item != NULL )
+	{
+		libpff_item_free(
+		 &root_item,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libpff_file_get_orphan_item_by_index function
+/* Tests the libpff_file_get_message_store function
  * Returns 1 if successful or 0 if not
  */
-int pff_test_file_get_orphan_item_by_index(
+int pff_test_file_get_message_store(
      libpff_file_t *file )
 {
-	libcerror_error_t *error   = NULL;
-	libpff_item_t *orphan_item = NULL;
-	int number_of_orphan_items = 0;
-	int result                 = 0;
+	libcerror_error_t *error     = NULL;
+	libpff_item_t *message_store = NULL;
+	int message_store_is_set     = 0;
+	int result                   = 0;
 
-	/* Initialize test
+	/* Test regular cases
 	 */
-	result = libpff_file_get_number_of_orphan_items(
+	result = libpff_file_get_message_store(
 	          file,
-	          &number_of_orphan_items,
+	          &message_store,
 	          &error );
 
-	PFF_TEST_ASSERT_EQUAL_INT(
+	PFF_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	if( number_of_orphan_items > 0 )
-	{
-		result = libpff_file_get_orphan_item_by_index(
-		          file,
-		          0,
-		          &orphan_item,
-		          &error );
-
-		PFF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		PFF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	message_store_is_set = result;
 
+	if( message_store_is_set != 0 )
+	{
 		PFF_TEST_ASSERT_IS_NOT_NULL(
-		 "orphan_item",
-		 orphan_item );
+		 "message_store",
+		 message_store );
 
 		result = libpff_item_free(
-		          &orphan_item,
+		          &message_store,
 		          &error );
 
 		PFF_TEST_ASSERT_EQUAL_INT(
@@ -2389,104 +2296,1856 @@ int pff_test_file_get_orphan_item_by_index(
 	}
 	/* Test error cases
 	 */
-	result = libpff_file_get_orphan_item_by_index(
-	          NULL,
-	          0,
-	          &orphan_item,
+	result = libpff_file_get_message_store(
+	          NULL,
+	          &message_store,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message_store",
+	 message_store );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( message_store_is_set != 0 )
+	{
+		result = libpff_file_get_message_store(
+		          file,
+		          NULL,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "message_store",
+		 message_store );
+
+		PFF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message_store != NULL )
+	{
+		libpff_item_free(
+		 &message_store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_file_get_name_to_id_map function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_file_get_name_to_id_map(
+     libpff_file_t *file )
+{
+	libcerror_error_t *error      = NULL;
+	libpff_item_t *name_to_id_map = NULL;
+	int name_to_id_map_is_set     = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libpff_file_get_name_to_id_map(
+	          file,
+	          &name_to_id_map,
+	          &error );
+
+	PFF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	name_to_id_map_is_set = result;
+
+	if( name_to_id_map_is_set != 0 )
+	{
+		PFF_TEST_ASSERT_IS_NOT_NULL(
+		 "name_to_id_map",
+		 name_to_id_map );
+
+		result = libpff_item_free(
+		          &name_to_id_map,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libpff_file_get_name_to_id_map(
+	          NULL,
+	          &name_to_id_map,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "name_to_id_map",
+	 name_to_id_map );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( name_to_id_map_is_set != 0 )
+	{
+		result = libpff_file_get_name_to_id_map(
+		          file,
+		          NULL,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "name_to_id_map",
+		 name_to_id_map );
+
+		PFF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_to_id_map != NULL )
+	{
+		libpff_item_free(
+		 &name_to_id_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_file_get_root_folder function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_file_get_root_folder(
+     libpff_file_t *file )
+{
+	libcerror_error_t *error   = NULL;
+	libpff_item_t *root_folder = NULL;
+	int result                 = 0;
+	int root_folder_is_set     = 0;
+
+	/* Test regular cases
+	 */
+	result = libpff_file_get_root_folder(
+	          file,
+	          &root_folder,
+	          &error );
+
+	PFF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	root_folder_is_set = result;
+
+	if( root_folder_is_set != 0 )
+	{
+		PFF_TEST_ASSERT_IS_NOT_NULL(
+		 "root_folder",
+		 root_folder );
+
+		result = libpff_item_free(
+		          &root_folder,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libpff_file_get_root_folder(
+	          NULL,
+	          &root_folder,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "root_folder",
+	 root_folder );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( root_folder_is_set != 0 )
+	{
+		result = libpff_file_get_root_folder(
+		          file,
+		          NULL,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "root_folder",
+		 root_folder );
+
+		PFF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( root_folder != NULL )
+	{
+		libpff_item_free(
+		 &root_folder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_file_get_number_of_orphan_items function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_file_get_number_of_orphan_items(
+     libpff_file_t *file )
+{
+	libcerror_error_t *error   = NULL;
+	int number_of_orphan_items = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libpff_file_get_number_of_orphan_items(
+	          file,
+	          &number_of_orphan_items,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_file_get_number_of_orphan_items(
+	          NULL,
+	          &number_of_orphan_items,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_file_get_number_of_orphan_items(
+	          file,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_file_get_orphan_item_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_file_get_orphan_item_by_index(
+     libpff_file_t *file )
+{
+	libcerror_error_t *error   = NULL;
+	libpff_item_t *orphan_item = NULL;
+	int number_of_orphan_items = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_file_get_number_of_orphan_items(
+	          file,
+	          &number_of_orphan_items,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	if( number_of_orphan_items > 0 )
+	{
+		result = libpff_file_get_orphan_item_by_index(
+		          file,
+		          0,
+		          &orphan_item,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		PFF_TEST_ASSERT_IS_NOT_NULL(
+		 "orphan_item",
+		 orphan_item );
+
+		result = libpff_item_free(
+		          &orphan_item,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libpff_file_get_orphan_item_by_index(
+	          NULL,
+	          0,
+	          &orphan_item,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "orphan_item",
+	 orphan_item );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_file_get_orphan_item_by_index(
+	          file,
+	          -1,
+	          &orphan_item,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "orphan_item",
+	 orphan_item );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_file_get_orphan_item_by_index(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "orphan_item",
+	 orphan_item );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( orphan_item != NULL )
+	{
+		libpff_item_free(
+		 &orphan_item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_file_get_number_of_recovered_items function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_file_get_number_of_recovered_items(
+     libpff_file_t *file )
+{
+	libcerror_error_t *error      = NULL;
+	int number_of_recovered_items = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libpff_file_get_number_of_recovered_items(
+	          file,
+	          &number_of_recovered_items,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_file_get_number_of_recovered_items(
+	          NULL,
+	          &number_of_recovered_items,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_file_get_number_of_recovered_items(
+	          file,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_file_get_recovered_item_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_file_get_recovered_item_by_index(
+     libpff_file_t *file )
+{
+	libcerror_error_t *error      = NULL;
+	libpff_item_t *recovered_item = NULL;
+	int number_of_recovered_items = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_file_get_number_of_recovered_items(
+	          file,
+	          &number_of_recovered_items,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	if( number_of_recovered_items > 0 )
+	{
+		result = libpff_file_get_recovered_item_by_index(
+		          file,
+		          0,
+		          &recovered_item,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		PFF_TEST_ASSERT_IS_NOT_NULL(
+		 "recovered_item",
+		 recovered_item );
+
+		result = libpff_item_free(
+		          &recovered_item,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libpff_file_get_recovered_item_by_index(
+	          NULL,
+	          0,
+	          &recovered_item,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "recovered_item",
+	 recovered_item );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_file_get_recovered_item_by_index(
+	          file,
+	          -1,
+	          &recovered_item,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "recovered_item",
+	 recovered_item );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_file_get_recovered_item_by_index(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "recovered_item",
+	 recovered_item );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( recovered_item != NULL )
+	{
+		libpff_item_free(
+		 &recovered_item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+/* Sets the recovered state of a file that was not opened
+ * Returns 1 if successful or -1 on error
+ */
+int pff_test_file_initialize_recovered_state(
+     libpff_file_t *file,
+     off64_t descriptors_index_root_node_offset,
+     int number_of_recovered_items,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *item_tree_node      = NULL;
+	libpff_index_value_t *index_value         = NULL;
+	libpff_internal_file_t *internal_file     = NULL;
+	libpff_item_descriptor_t *item_descriptor = NULL;
+	int entry_index                           = 0;
+	int item_index                            = 0;
+
+	internal_file = (libpff_internal_file_t *) file;
+
+	internal_file->io_handle->file_type = LIBPFF_FILE_TYPE_64BIT;
+	internal_file->io_handle->file_size = 0x00100000UL;
+
+	if( libpff_descriptors_index_initialize(
+	     &( internal_file->descriptors_index ),
+	     descriptors_index_root_node_offset,
+	     0x00001234UL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libpff_offsets_index_initialize(
+	     &( internal_file->offsets_index ),
+	     0x00008800L,
+	     0x00005678UL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( number_of_recovered_items == 0 )
+	{
+		return( 1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_file->recovered_item_array ),
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( item_index = 0;
+	     item_index < number_of_recovered_items;
+	     item_index++ )
+	{
+		if( libpff_index_value_initialize(
+		     &index_value,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		index_value->identifier                   = 0x00200021UL + ( (uint64_t) item_index * 0x20 );
+		index_value->data_identifier              = 0x00000040UL + ( (uint64_t) item_index * 4 );
+		index_value->local_descriptors_identifier = 0;
+		index_value->parent_identifier            = 0x00008082UL;
+
+		if( libpff_descriptors_index_insert_recovered_index_value(
+		     internal_file->descriptors_index,
+		     index_value,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		index_value = NULL;
+
+		if( libpff_index_value_initialize(
+		     &index_value,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		index_value->identifier      = 0x00000040UL + ( (uint64_t) item_index * 4 );
+		index_value->file_offset     = 0x00004400L + ( (off64_t) item_index * 512 );
+		index_value->data_size       = 128;
+		index_value->reference_count = 2;
+
+		if( libpff_offsets_index_insert_recovered_index_value(
+		     internal_file->offsets_index,
+		     index_value,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		index_value = NULL;
+
+		if( libpff_item_descriptor_initialize(
+		     &item_descriptor,
+		     0x00200021UL + ( (uint32_t) item_index * 0x20 ),
+		     0x00000040UL + ( (uint64_t) item_index * 4 ),
+		     0,
+		     1,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libcdata_tree_node_initialize(
+		     &item_tree_node,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libcdata_tree_node_set_value(
+		     item_tree_node,
+		     (intptr_t *) item_descriptor,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		item_descriptor = NULL;
+
+		if( libcdata_array_append_entry(
+		     internal_file->recovered_item_array,
+		     &entry_index,
+		     (intptr_t *) item_tree_node,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		item_tree_node = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( item_tree_node != NULL )
+	{
+		libpff_item_tree_node_free_recovered(
+		 &item_tree_node,
+		 NULL );
+	}
+	if( item_descriptor != NULL )
+	{
+		libpff_item_descriptor_free(
+		 &item_descriptor,
+		 NULL );
+	}
+	if( index_value != NULL )
+	{
+		libpff_index_value_free(
+		 &index_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees the recovered state of a file that was not opened
+ * Returns 1 if successful or -1 on error
+ */
+int pff_test_file_free_recovered_state(
+     libpff_file_t *file,
+     libcerror_error_t **error )
+{
+	libpff_internal_file_t *internal_file = NULL;
+	int result                            = 1;
+
+	internal_file = (libpff_internal_file_t *) file;
+
+	if( internal_file->recovered_item_array != NULL )
+	{
+		if( libcdata_array_free(
+		     &( internal_file->recovered_item_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libpff_item_tree_node_free_recovered,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( internal_file->offsets_index != NULL )
+	{
+		if( libpff_offsets_index_free(
+		     &( internal_file->offsets_index ),
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( internal_file->descriptors_index != NULL )
+	{
+		if( libpff_descriptors_index_free(
+		     &( internal_file->descriptors_index ),
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Tests the libpff_file_export_recovered_items_file_io_handle and
+ * libpff_file_import_recovered_items_file_io_handle functions
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_file_export_import_recovered_items_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle          = NULL;
+	libcdata_tree_node_t *item_tree_node      = NULL;
+	libcerror_error_t *error                  = NULL;
+	libpff_file_t *file                       = NULL;
+	libpff_file_t *imported_file              = NULL;
+	libpff_internal_file_t *internal_file     = NULL;
+	libpff_item_descriptor_t *item_descriptor = NULL;
+	uint8_t *data                             = NULL;
+	size_t data_size                          = 0;
+	int number_of_entries                     = 0;
+	int number_of_values                      = 0;
+	int result                                = 0;
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+	int number_of_malloc_fail_tests           = 256;
+	int test_number                           = 0;
+#endif
+
+	/* Initialize test
+	 */
+	data_size = sizeof( pff_recover_checkpoint_header_t )
+	          + ( 2 * sizeof( pff_recover_checkpoint_descriptors_index_value_t ) )
+	          + ( 2 * sizeof( pff_recover_checkpoint_offsets_index_value_t ) )
+	          + ( 2 * sizeof( pff_recover_checkpoint_recovered_item_t ) );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          data,
+	          data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_file_initialize(
+	          &file,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_file_initialize_recovered_state(
+	          file,
+	          0x00004000L,
+	          2,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_file_initialize(
+	          &imported_file,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_file_initialize_recovered_state(
+	          imported_file,
+	          0x00004000L,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_file = (libpff_internal_file_t *) imported_file;
+
+	/* Test regular cases
+	 */
+	result = libpff_file_export_recovered_items_file_io_handle(
+	          file,
+	          file_io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_file_import_recovered_items_file_io_handle(
+	          imported_file,
+	          file_io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          internal_file->recovered_item_array,
+	          &number_of_entries,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_entry_by_index(
+	          internal_file->recovered_item_array,
+	          1,
+	          (intptr_t **) &item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_node_get_value(
+	          item_tree_node,
+	          (intptr_t **) &item_descriptor,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_descriptor",
+	 item_descriptor );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_UINT32(
+	 "item_descriptor->descriptor_identifier",
+	 item_descriptor->descriptor_identifier,
+	 (uint32_t) 0x00200041UL );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "item_descriptor->data_identifier",
+	 item_descriptor->data_identifier,
+	 (uint64_t) 0x00000044UL );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "item_descriptor->recovered",
+	 item_descriptor->recovered,
+	 (uint8_t) 1 );
+
+	result = libcdata_btree_get_number_of_values(
+	          internal_file->descriptors_index->recovered_index_values_tree,
+	          &number_of_values,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 2 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_get_number_of_values(
+	          internal_file->offsets_index->recovered_index_values_tree,
+	          &number_of_values,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 2 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test import with recovered items already set
+	 */
+	result = libpff_file_import_recovered_items_file_io_handle(
+	          imported_file,
+	          file_io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = pff_test_file_free_recovered_state(
+	          imported_file,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test import into a file with different index root nodes
+	 */
+	result = pff_test_file_initialize_recovered_state(
+	          imported_file,
+	          0x00004200L,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_file_import_recovered_items_file_io_handle(
+	          imported_file,
+	          file_io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_INPUT,
+	          LIBCERROR_INPUT_ERROR_VALUE_MISMATCH );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "internal_file->recovered_item_array",
+	 internal_file->recovered_item_array );
+
+	result = pff_test_file_free_recovered_state(
+	          imported_file,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+
+	/* Test import with malloc failing, which must not leave recovered items or index values behind
+	 */
+	result = pff_test_file_initialize_recovered_state(
+	          imported_file,
+	          0x00004000L,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		pff_test_malloc_attempts_before_fail = test_number;
+
+		result = libpff_file_import_recovered_items_file_io_handle(
+		          imported_file,
+		          file_io_handle,
+		          &error );
+
+		if( pff_test_malloc_attempts_before_fail != -1 )
+		{
+			pff_test_malloc_attempts_before_fail = -1;
+
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			break;
+		}
+		if( result == 1 )
+		{
+			/* The failed allocation did not cause the import to fail
+			 */
+			result = pff_test_file_free_recovered_state(
+			          imported_file,
+			          &error );
+
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = pff_test_file_initialize_recovered_state(
+			          imported_file,
+			          0x00004000L,
+			          0,
+			          &error );
+
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			continue;
+		}
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		PFF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "internal_file->recovered_item_array",
+		 internal_file->recovered_item_array );
+
+		result = libcdata_btree_get_number_of_values(
+		          internal_file->descriptors_index->recovered_index_values_tree,
+		          &number_of_values,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "number_of_values",
+		 number_of_values,
+		 0 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcdata_btree_get_number_of_values(
+		          internal_file->offsets_index->recovered_index_values_tree,
+		          &number_of_values,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "number_of_values",
+		 number_of_values,
+		 0 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = pff_test_file_free_recovered_state(
+	          imported_file,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( HAVE_PFF_TEST_MEMORY ) */
+
+	/* Test error cases
+	 */
+	result = libpff_file_export_recovered_items_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_file_export_recovered_items_file_io_handle(
+	          imported_file,
+	          file_io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_file_import_recovered_items_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_file_free(
+	          &imported_file,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_file_free_recovered_state(
+	          file,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_file_free(
+	          &file,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( imported_file != NULL )
+	{
+		pff_test_file_free_recovered_state(
+		 imported_file,
+		 NULL );
+		libpff_file_free(
+		 &imported_file,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		pff_test_file_free_recovered_state(
+		 file,
+		 NULL );
+		libpff_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Counts the recovered items passed to the recovered item callback function
+ * The first callback value contains the value to return and the second the number of recovered items
+ * Returns the first callback value
+ */
+int pff_test_file_recovered_item_callback(
+     libpff_item_t *recovered_item,
+     int *callback_values,
+     libcerror_error_t **error )
+{
+	static char *function = "pff_test_file_recovered_item_callback";
+
+	if( recovered_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered item.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback values.",
+		 function );
+
+		return( -1 );
+	}
+	callback_values[ 1 ] += 1;
+
+	if( callback_values[ 0 ] == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process recovered item.",
+		 function );
+	}
+	return( callback_values[ 0 ] );
+}
+
+/* Tests the libpff_file_recover_items_with_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_file_recover_items_with_callback(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libpff_file_t *file                   = NULL;
+	libpff_internal_file_t *internal_file = NULL;
+	int callback_values[ 2 ]              = { 1, 0 };
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_file_initialize(
+	          &file,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_file = (libpff_internal_file_t *) file;
+
+	/* Test error cases
+	 */
+	result = libpff_file_recover_items_with_callback(
+	          NULL,
+	          0,
+	          (int (*)(libpff_item_t *, void *, libcerror_error_t **)) &pff_test_file_recovered_item_callback,
+	          (void *) callback_values,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_file_recover_items_with_callback(
+	          file,
+	          0,
+	          NULL,
+	          (void *) callback_values,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test recover items with callback on a file that was not opened
+	 */
+	result = libpff_file_recover_items_with_callback(
+	          file,
+	          0,
+	          (int (*)(libpff_item_t *, void *, libcerror_error_t **)) &pff_test_file_recovered_item_callback,
+	          (void *) callback_values,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "callback_values[ 1 ]",
+	 callback_values[ 1 ],
+	 0 );
+
+	/* Test if the recovered item array is freed so that the recovery can be restarted
+	 */
+	PFF_TEST_ASSERT_IS_NULL(
+	 "internal_file->recovered_item_array",
+	 internal_file->recovered_item_array );
+
+	/* Clean up
+	 */
+	result = libpff_file_free(
+	          &file,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libpff_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_internal_file_recovered_item_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_internal_file_recovered_item_callback(
+     void )
+{
+	libpff_file_recovered_item_callback_data_t recovered_item_callback_data;
+
+	libcdata_tree_node_t *item_tree_node  = NULL;
+	libcerror_error_t *error              = NULL;
+	libpff_file_t *file                   = NULL;
+	libpff_internal_file_t *internal_file = NULL;
+	int callback_values[ 2 ]              = { 1, 0 };
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_file_initialize(
+	          &file,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	PFF_TEST_ASSERT_IS_NULL(
-	 "orphan_item",
-	 orphan_item );
-
-	PFF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libpff_file_get_orphan_item_by_index(
+	result = pff_test_file_initialize_recovered_state(
 	          file,
-	          -1,
-	          &orphan_item,
+	          0x00004000L,
+	          1,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	PFF_TEST_ASSERT_IS_NULL(
-	 "orphan_item",
-	 orphan_item );
-
-	PFF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	internal_file = (libpff_internal_file_t *) file;
 
-	result = libpff_file_get_orphan_item_by_index(
-	          file,
+	result = libcdata_array_get_entry_by_index(
+	          internal_file->recovered_item_array,
 	          0,
-	          NULL,
+	          (intptr_t **) &item_tree_node,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	PFF_TEST_ASSERT_IS_NULL(
-	 "orphan_item",
-	 orphan_item );
+	 1 );
 
 	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_tree_node",
+	 item_tree_node );
+
+	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	recovered_item_callback_data.internal_file           = internal_file;
+	recovered_item_callback_data.recovered_item_callback = (int (*)(libpff_item_t *, void *, libcerror_error_t **)) &pff_test_file_recovered_item_callback;
+	recovered_item_callback_data.callback_data           = (void *) callback_values;
 
-	return( 1 );
+	/* Test regular cases
+	 */
+	result = libpff_internal_file_recovered_item_callback(
+	          item_tree_node,
+	          &recovered_item_callback_data,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( orphan_item != NULL )
-	{
-		libpff_item_free(
-		 &orphan_item,
-		 NULL );
-	}
-	return( 0 );
-}
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-/* Tests the libpff_file_get_number_of_recovered_items function
- * Returns 1 if successful or 0 if not
- */
-int pff_test_file_get_number_of_recovered_items(
-     libpff_file_t *file )
-{
-	libcerror_error_t *error      = NULL;
-	int number_of_recovered_items = 0;
-	int result                    = 0;
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "callback_values[ 1 ]",
+	 callback_values[ 1 ],
+	 1 );
+
+	/* Test if only a callback return value of -1 is considered an error
 	 */
-	result = libpff_file_get_number_of_recovered_items(
-	          file,
-	          &number_of_recovered_items,
+	callback_values[ 0 ] = 0;
+
+	result = libpff_internal_file_recovered_item_callback(
+	          item_tree_node,
+	          &recovered_item_callback_data,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -2498,11 +4157,18 @@ int pff_test_file_get_number_of_recovered_items(
 	 "error",
 	 error );
 
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "callback_values[ 1 ]",
+	 callback_values[ 1 ],
+	 2 );
+
 	/* Test error cases
 	 */
-	result = libpff_file_get_number_of_recovered_items(
-	          NULL,
-	          &number_of_recovered_items,
+	callback_values[ 0 ] = -1;
+
+	result = libpff_internal_file_recovered_item_callback(
+	          item_tree_node,
+	          &recovered_item_callback_data,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -2517,8 +4183,15 @@ int pff_test_file_get_number_of_recovered_items(
 	libcerror_error_free(
 	 &error );
 
-	result = libpff_file_get_number_of_recovered_items(
-	          file,
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "callback_values[ 1 ]",
+	 callback_values[ 1 ],
+	 3 );
+
+	callback_values[ 0 ] = 1;
+
+	result = libpff_internal_file_recovered_item_callback(
+	          item_tree_node,
 	          NULL,
 	          &error );
 
@@ -2534,97 +4207,41 @@ int pff_test_file_get_number_of_recovered_items(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libpff_file_get_recovered_item_by_index function
- * Returns 1 if successful or 0 if not
- */
-int pff_test_file_get_recovered_item_by_index(
-     libpff_file_t *file )
-{
-	libcerror_error_t *error      = NULL;
-	libpff_item_t *recovered_item = NULL;
-	int number_of_recovered_items = 0;
-	int result                    = 0;
+	recovered_item_callback_data.recovered_item_callback = NULL;
 
-	/* Initialize test
-	 */
-	result = libpff_file_get_number_of_recovered_items(
-	          file,
-	          &number_of_recovered_items,
+	result = libpff_internal_file_recovered_item_callback(
+	          item_tree_node,
+	          &recovered_item_callback_data,
 	          &error );
 
+	recovered_item_callback_data.recovered_item_callback = (int (*)(libpff_item_t *, void *, libcerror_error_t **)) &pff_test_file_recovered_item_callback;
+
 	PFF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	PFF_TEST_ASSERT_IS_NULL(
+	PFF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	if( number_of_recovered_items > 0 )
-	{
-		result = libpff_file_get_recovered_item_by_index(
-		          file,
-		          0,
-		          &recovered_item,
-		          &error );
-
-		PFF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		PFF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		PFF_TEST_ASSERT_IS_NOT_NULL(
-		 "recovered_item",
-		 recovered_item );
-
-		result = libpff_item_free(
-		          &recovered_item,
-		          &error );
+	libcerror_error_free(
+	 &error );
 
-		PFF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	recovered_item_callback_data.internal_file = NULL;
 
-		PFF_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Test error cases
-	 */
-	result = libpff_file_get_recovered_item_by_index(
-	          NULL,
-	          0,
-	          &recovered_item,
+	result = libpff_internal_file_recovered_item_callback(
+	          item_tree_node,
+	          &recovered_item_callback_data,
 	          &error );
 
+	recovered_item_callback_data.internal_file = internal_file;
+
 	PFF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	PFF_TEST_ASSERT_IS_NULL(
-	 "recovered_item",
-	 recovered_item );
-
 	PFF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2632,50 +4249,43 @@ int pff_test_file_get_recovered_item_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libpff_file_get_recovered_item_by_index(
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "callback_values[ 1 ]",
+	 callback_values[ 1 ],
+	 3 );
+
+	/* Clean up
+	 */
+	result = pff_test_file_free_recovered_state(
 	          file,
-	          -1,
-	          &recovered_item,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	PFF_TEST_ASSERT_IS_NULL(
-	 "recovered_item",
-	 recovered_item );
-
-	PFF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libpff_file_get_recovered_item_by_index(
-	          file,
-	          0,
-	          NULL,
+	result = libpff_file_free(
+	          &file,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	PFF_TEST_ASSERT_IS_NULL(
-	 "recovered_item",
-	 recovered_item );
+	 "file",
+	 file );
 
-	PFF_TEST_ASSERT_IS_NOT_NULL(
+	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -2684,15 +4294,20 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( recovered_item != NULL )
+	if( file != NULL )
 	{
-		libpff_item_free(
-		 &recovered_item,
+		pff_test_file_free_recovered_state(
+		 file,
+		 NULL );
+		libpff_file_free(
+		 &file,
 		 NULL );
 	}
 	return( 0 );
 }
 
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -2750,6 +4365,22 @@ int main(
 	 "libpff_file_free",
 	 pff_test_file_free );
 
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+	PFF_TEST_RUN(
+	 "libpff_file_export_recovered_items_file_io_handle",
+	 pff_test_file_export_import_recovered_items_file_io_handle );
+
+	PFF_TEST_RUN(
+	 "libpff_file_recover_items_with_callback",
+	 pff_test_file_recover_items_with_callback );
+
+	PFF_TEST_RUN(
+	 "libpff_internal_file_recovered_item_callback",
+	 pff_test_internal_file_recovered_item_callback );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -2876,8 +4507,52 @@ int main(
 		 pff_test_file_is_corrupted,
 		 file );
 
+		PFF_TEST_RUN_WITH_ARGS(
+		 "libpff_file_get_number_of_checksum_mismatches",
+		 pff_test_file_get_number_of_checksum_mismatches,
+		 file );
+
+		PFF_TEST_RUN_WITH_ARGS(
+		 "libpff_file_set_checksum_verification_sample_interval",
+		 pff_test_file_set_checksum_verification_sample_interval,
+		 file );
+
+		PFF_TEST_RUN_WITH_ARGS(
+		 "libpff_file_set_number_of_read_ahead_threads",
+		 pff_test_file_set_number_of_read_ahead_threads,
+		 file );
+
+		PFF_TEST_RUN_WITH_ARGS(
+		 "libpff_file_set_number_of_recovery_threads",
+		 pff_test_file_set_number_of_recovery_threads,
+		 file );
+
 		/* TODO: add tests for libpff_file_recover_items */
 
+		/* TODO: add tests for libpff_file_recover_items_with_checkpoint */
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+		/* TODO: add tests for libpff_file_recover_items_with_checkpoint_wide */
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+		/* TODO: add tests for libpff_file_export_recovered_items */
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+		/* TODO: add tests for libpff_file_export_recovered_items_wide */
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+		/* TODO: add tests for libpff_file_import_recovered_items */
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+		/* TODO: add tests for libpff_file_import_recovered_items_wide */
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 		PFF_TEST_RUN_WITH_ARGS(
 		 "libpff_file_get_size",
 		 pff_test_file_get_size,
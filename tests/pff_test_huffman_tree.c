@@ -204,6 +204,11 @@ uint8_t pff_test_huffman_tree_data[ 2627 ] = {
 	0x7d, 0x8a, 0x87, 0xf9, 0x9d, 0x74, 0x33, 0x0e, 0x79, 0xc5, 0xf8, 0x73, 0xcd, 0xff, 0x00, 0x30,
 	0x4a, 0x56, 0xa4 };
 
+uint8_t pff_test_huffman_tree_long_codes_data[ 34 ] = {
+	0xda, 0xbd, 0xef, 0xf7, 0xf7, 0xef, 0xbf, 0xff, 0xfd, 0xdf, 0xff, 0xfb, 0xff, 0xfe, 0x7f, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xfb, 0x7f, 0xff, 0xf7, 0xbf, 0xff, 0xfe, 0xfd, 0xfd, 0xbe,
+	0x77, 0x0b };
+
 #if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
 
 /* Tests the libpff_huffman_tree_initialize function
@@ -933,6 +938,190 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libpff_huffman_tree_get_symbol_from_bit_stream function with codes larger than the primary lookup table
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_huffman_tree_get_symbol_from_bit_stream_long_codes(
+     void )
+{
+	uint8_t code_size_array[ 16 ];
+
+	libpff_bit_stream_t *bit_stream     = NULL;
+	libpff_huffman_tree_t *huffman_tree = NULL;
+	libcerror_error_t *error             = NULL;
+	uint16_t expected_symbol             = 0;
+	uint16_t symbol                      = 0;
+	int result                           = 0;
+	int symbol_index                     = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_bit_stream_initialize(
+	          &bit_stream,
+	          pff_test_huffman_tree_long_codes_data,
+	          34,
+	          0,
+	          LIBPFF_BIT_STREAM_STORAGE_TYPE_BYTE_BACK_TO_FRONT,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Symbol 0 to 14 have a code size of 1 to 15, symbol 15 has a code size of 15
+	 */
+	for( symbol = 0;
+	     symbol < 16;
+	     symbol++ )
+	{
+		if( symbol < 15 )
+		{
+			code_size_array[ symbol ] = (uint8_t) ( symbol + 1 );
+		}
+		else
+		{
+			code_size_array[ symbol ] = 15;
+		}
+	}
+	result = libpff_huffman_tree_initialize(
+	          &huffman_tree,
+	          16,
+	          15,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_huffman_tree_build(
+	          huffman_tree,
+	          code_size_array,
+	          16,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The data contains the symbols 0 to 15 followed by the symbols 15 to 0
+	 */
+	for( symbol_index = 0;
+	     symbol_index < 32;
+	     symbol_index++ )
+	{
+		if( symbol_index < 16 )
+		{
+			expected_symbol = (uint16_t) symbol_index;
+		}
+		else
+		{
+			expected_symbol = (uint16_t) ( 31 - symbol_index );
+		}
+		symbol = 0xffff;
+
+		result = libpff_huffman_tree_get_symbol_from_bit_stream(
+		          huffman_tree,
+		          bit_stream,
+		          &symbol,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		PFF_TEST_ASSERT_EQUAL_UINT16(
+		 "symbol",
+		 symbol,
+		 expected_symbol );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libpff_huffman_tree_free(
+	          &huffman_tree,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( huffman_tree != NULL )
+	{
+		libpff_huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	if( bit_stream != NULL )
+	{
+		libpff_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
 
 /* The main program
@@ -968,6 +1157,10 @@ int main(
 	 "libpff_huffman_tree_get_symbol_from_bit_stream",
 	 pff_test_huffman_tree_get_symbol_from_bit_stream );
 
+	PFF_TEST_RUN(
+	 "libpff_huffman_tree_get_symbol_from_bit_stream (long codes)",
+	 pff_test_huffman_tree_get_symbol_from_bit_stream_long_codes );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -1010,6 +1010,199 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libpff_index_node_try_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_index_node_try_read_data(
+     void )
+{
+	uint8_t empty_data[ 512 ];
+
+	libcerror_error_t *error        = NULL;
+	libpff_index_node_t *index_node = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_index_node_initialize(
+	          &index_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "index_node",
+	 index_node );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          empty_data,
+	          0,
+	          512 ) != NULL;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libpff_index_node_try_read_data(
+	          index_node,
+	          pff_test_index_node_data_32bit,
+	          512,
+	          LIBPFF_FILE_TYPE_32BIT );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libpff_index_node_try_read_data(
+	          index_node,
+	          pff_test_index_node_data_64bit,
+	          512,
+	          LIBPFF_FILE_TYPE_64BIT );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libpff_index_node_try_read_data(
+	          index_node,
+	          pff_test_index_node_data_64bit_4k_page,
+	          4096,
+	          LIBPFF_FILE_TYPE_64BIT_4K_PAGE );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test data that does not contain an index node
+	 */
+	result = libpff_index_node_try_read_data(
+	          index_node,
+	          empty_data,
+	          512,
+	          LIBPFF_FILE_TYPE_32BIT );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libpff_index_node_try_read_data(
+	          index_node,
+	          empty_data,
+	          512,
+	          LIBPFF_FILE_TYPE_64BIT );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libpff_index_node_try_read_data(
+	          NULL,
+	          pff_test_index_node_data_32bit,
+	          512,
+	          LIBPFF_FILE_TYPE_32BIT );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libpff_index_node_try_read_data(
+	          index_node,
+	          NULL,
+	          512,
+	          LIBPFF_FILE_TYPE_32BIT );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libpff_index_node_try_read_data(
+	          index_node,
+	          pff_test_index_node_data_32bit,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBPFF_FILE_TYPE_32BIT );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libpff_index_node_try_read_data(
+	          index_node,
+	          pff_test_index_node_data_32bit,
+	          0,
+	          LIBPFF_FILE_TYPE_32BIT );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libpff_index_node_try_read_data(
+	          index_node,
+	          pff_test_index_node_data_32bit,
+	          512,
+	          0xff );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Clean up
+	 */
+	result = libpff_index_node_free(
+	          &index_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "index_node",
+	 index_node );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_node != NULL )
+	{
+		libpff_index_node_free(
+		 &index_node,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libpff_index_node_read_footer_data function
  * Returns 1 if successful or 0 if not
  */
@@ -1645,6 +1838,248 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libpff_index_node_try_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_index_node_try_read_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libpff_index_node_t *index_node  = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_index_node_initialize(
+	          &index_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "index_node",
+	 index_node );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = pff_test_open_file_io_handle(
+	          &file_io_handle,
+	          pff_test_index_node_data_32bit,
+	          512,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data that does not contain an index node
+	 */
+	result = libpff_index_node_try_read_file_io_handle(
+	          index_node,
+	          file_io_handle,
+	          256,
+	          LIBPFF_FILE_TYPE_32BIT );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "index_node->data",
+	 index_node->data );
+
+	/* Test regular cases
+	 */
+	result = libpff_index_node_try_read_file_io_handle(
+	          index_node,
+	          file_io_handle,
+	          0,
+	          LIBPFF_FILE_TYPE_32BIT );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "index_node->data",
+	 index_node->data );
+
+	/* Test error cases
+	 */
+	result = libpff_index_node_try_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          LIBPFF_FILE_TYPE_32BIT );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Test try read with data already set
+	 */
+	result = libpff_index_node_try_read_file_io_handle(
+	          index_node,
+	          file_io_handle,
+	          0,
+	          LIBPFF_FILE_TYPE_32BIT );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Clean up
+	 */
+	result = libpff_index_node_free(
+	          &index_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "index_node",
+	 index_node );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libpff_index_node_initialize(
+	          &index_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "index_node",
+	 index_node );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_index_node_try_read_file_io_handle(
+	          index_node,
+	          file_io_handle,
+	          0,
+	          0xff );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+
+	/* Test libpff_index_node_try_read_file_io_handle with malloc failing
+	 */
+	pff_test_malloc_attempts_before_fail = 0;
+
+	result = libpff_index_node_try_read_file_io_handle(
+	          index_node,
+	          file_io_handle,
+	          0,
+	          LIBPFF_FILE_TYPE_32BIT );
+
+	if( pff_test_malloc_attempts_before_fail != -1 )
+	{
+		pff_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+	}
+#endif /* defined( HAVE_PFF_TEST_MEMORY ) */
+
+	/* Clean up file IO handle
+	 */
+	result = pff_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libpff_index_node_free(
+	          &index_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "index_node",
+	 index_node );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( index_node != NULL )
+	{
+		libpff_index_node_free(
+		 &index_node,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libpff_index_node_check_for_empty_block function
  * Returns 1 if successful or 0 if not
  */
@@ -1794,6 +2229,10 @@ int main(
 	 "libpff_index_node_read_data",
 	 pff_test_index_node_read_data );
 
+	PFF_TEST_RUN(
+	 "libpff_index_node_try_read_data",
+	 pff_test_index_node_try_read_data );
+
 	PFF_TEST_RUN(
 	 "libpff_index_node_read_footer_data",
 	 pff_test_index_node_read_footer_data );
@@ -1802,6 +2241,10 @@ int main(
 	 "libpff_index_node_read_file_io_handle",
 	 pff_test_index_node_read_file_io_handle );
 
+	PFF_TEST_RUN(
+	 "libpff_index_node_try_read_file_io_handle",
+	 pff_test_index_node_try_read_file_io_handle );
+
 	PFF_TEST_RUN(
 	 "libpff_index_node_check_for_empty_block",
 	 pff_test_index_node_check_for_empty_block );
@@ -33,6 +33,7 @@
 #include "pff_test_memory.h"
 #include "pff_test_unused.h"
 
+#include "../libpff/libpff_definitions.h"
 #include "../libpff/libpff_io_handle.h"
 
 #if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
@@ -301,6 +302,8 @@ int pff_test_io_handle_clear(
 
 	/* Test regular cases
 	 */
+	io_handle->checksum_verification_sample_interval = 16;
+
 	result = libpff_io_handle_clear(
 	          io_handle,
 	          &error );
@@ -314,6 +317,11 @@ int pff_test_io_handle_clear(
 	 "error",
 	 error );
 
+	PFF_TEST_ASSERT_EQUAL_UINT32(
+	 "io_handle->checksum_verification_sample_interval",
+	 io_handle->checksum_verification_sample_interval,
+	 (uint32_t) 16 );
+
 	/* Test error cases
 	 */
 	result = libpff_io_handle_clear(
@@ -398,6 +406,149 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libpff_io_handle_check_if_checksum_should_be_verified function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_io_handle_check_if_checksum_should_be_verified(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libpff_io_handle_t *io_handle = NULL;
+	int iterator                  = 0;
+	int number_of_verified_blocks = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_io_handle_check_if_checksum_should_be_verified(
+	          io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->flags |= LIBPFF_IO_HANDLE_FLAG_SKIP_CHECKSUM_VERIFICATION;
+
+	result = libpff_io_handle_check_if_checksum_should_be_verified(
+	          io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that only every 4th block is verified
+	 */
+	io_handle->checksum_verification_sample_interval = 4;
+
+	for( iterator = 0;
+	     iterator < 16;
+	     iterator++ )
+	{
+		result = libpff_io_handle_check_if_checksum_should_be_verified(
+		          io_handle,
+		          &error );
+
+		PFF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		number_of_verified_blocks += result;
+	}
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_verified_blocks",
+	 number_of_verified_blocks,
+	 4 );
+
+	/* Test error cases
+	 */
+	result = libpff_io_handle_check_if_checksum_should_be_verified(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libpff_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +580,10 @@ int main(
 	 "libpff_io_handle_clear",
 	 pff_test_io_handle_clear );
 
+	PFF_TEST_RUN(
+	 "libpff_io_handle_check_if_checksum_should_be_verified",
+	 pff_test_io_handle_check_if_checksum_should_be_verified );
+
 	/* TODO: add tests for libpff_io_handle_read_unallocated_data_blocks */
 
 	/* TODO: add tests for libpff_io_handle_read_unallocated_page_blocks */
@@ -0,0 +1,820 @@
+/*
+ * LZFu (compressed RTF) decompression testing program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pff_test_libcerror.h"
+#include "pff_test_libcnotify.h"
+#include "pff_test_macros.h"
+#include "pff_test_memory.h"
+#include "pff_test_unused.h"
+
+#include "../libpff/libpff_lzfu.h"
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+/* Compressed RTF examples from [MS-OXRTFCP]
+ */
+uint8_t pff_test_lzfu_compressed_data1[ 49 ] = {
+	0x2d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x4c, 0x5a, 0x46, 0x75, 0xf1, 0xc5, 0xc7, 0xa7,
+	0x03, 0x00, 0x0a, 0x00, 0x72, 0x63, 0x70, 0x67, 0x31, 0x32, 0x35, 0x42, 0x32, 0x0a, 0xf3, 0x20,
+	0x68, 0x65, 0x6c, 0x09, 0x00, 0x20, 0x62, 0x77, 0x05, 0xb0, 0x6c, 0x64, 0x7d, 0x0a, 0x80, 0x0f,
+	0xa0 };
+
+uint8_t pff_test_lzfu_uncompressed_data1[ 43 ] = {
+	'{', '\\', 'r', 't', 'f', '1', '\\', 'a', 'n', 's', 'i', '\\', 'a', 'n', 's', 'i',
+	'c', 'p', 'g', '1', '2', '5', '2', '\\', 'p', 'a', 'r', 'd', ' ', 'h', 'e', 'l',
+	'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd', '}', '\r', '\n' };
+
+uint8_t pff_test_lzfu_compressed_data2[ 30 ] = {
+	0x1a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4c, 0x5a, 0x46, 0x75, 0xe2, 0xd4, 0x4b, 0x51,
+	0x41, 0x00, 0x04, 0x20, 0x57, 0x58, 0x59, 0x5a, 0x0d, 0x6e, 0x7d, 0x01, 0x0e, 0xb0 };
+
+uint8_t pff_test_lzfu_uncompressed_data2[ 28 ] = {
+	'{', '\\', 'r', 't', 'f', '1', ' ', 'W', 'X', 'Y', 'Z', 'W', 'X', 'Y', 'Z', 'W',
+	'X', 'Y', 'Z', 'W', 'X', 'Y', 'Z', 'W', 'X', 'Y', 'Z', '}' };
+
+uint8_t pff_test_lzfu_compressed_data3[ 20 ] = {
+	0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x4d, 0x45, 0x4c, 0x41, 0x00, 0x00, 0x00, 0x00,
+	'{', '\\', 'r', 't' };
+
+/* Tests the libpff_lzfu_decoder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_lzfu_decoder_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libpff_lzfu_decoder_t *lzfu_decoder = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 1;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libpff_lzfu_decoder_initialize(
+	          &lzfu_decoder,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "lzfu_decoder",
+	 lzfu_decoder );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_lzfu_decoder_free(
+	          &lzfu_decoder,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "lzfu_decoder",
+	 lzfu_decoder );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_lzfu_decoder_initialize(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	lzfu_decoder = (libpff_lzfu_decoder_t *) 0x12345678UL;
+
+	result = libpff_lzfu_decoder_initialize(
+	          &lzfu_decoder,
+	          &error );
+
+	lzfu_decoder = NULL;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libpff_lzfu_decoder_initialize with malloc failing
+		 */
+		pff_test_malloc_attempts_before_fail = test_number;
+
+		result = libpff_lzfu_decoder_initialize(
+		          &lzfu_decoder,
+		          &error );
+
+		if( pff_test_malloc_attempts_before_fail != -1 )
+		{
+			pff_test_malloc_attempts_before_fail = -1;
+
+			if( lzfu_decoder != NULL )
+			{
+				libpff_lzfu_decoder_free(
+				 &lzfu_decoder,
+				 NULL );
+			}
+		}
+		else
+		{
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "lzfu_decoder",
+			 lzfu_decoder );
+
+			PFF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libpff_lzfu_decoder_initialize with memset failing
+		 */
+		pff_test_memset_attempts_before_fail = test_number;
+
+		result = libpff_lzfu_decoder_initialize(
+		          &lzfu_decoder,
+		          &error );
+
+		if( pff_test_memset_attempts_before_fail != -1 )
+		{
+			pff_test_memset_attempts_before_fail = -1;
+
+			if( lzfu_decoder != NULL )
+			{
+				libpff_lzfu_decoder_free(
+				 &lzfu_decoder,
+				 NULL );
+			}
+		}
+		else
+		{
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "lzfu_decoder",
+			 lzfu_decoder );
+
+			PFF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_PFF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lzfu_decoder != NULL )
+	{
+		libpff_lzfu_decoder_free(
+		 &lzfu_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_lzfu_decoder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_lzfu_decoder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libpff_lzfu_decoder_free(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_lzfu_decoder_set_compressed_data function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_lzfu_decoder_set_compressed_data(
+     void )
+{
+	uint8_t invalid_data[ 16 ] = {
+		0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x42, 0x43, 0x44, 0x00, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error            = NULL;
+	libpff_lzfu_decoder_t *lzfu_decoder = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_lzfu_decoder_initialize(
+	          &lzfu_decoder,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "lzfu_decoder",
+	 lzfu_decoder );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_lzfu_decoder_set_compressed_data(
+	          lzfu_decoder,
+	          pff_test_lzfu_compressed_data1,
+	          49,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_UINT32(
+	 "lzfu_decoder->uncompressed_data_size",
+	 lzfu_decoder->uncompressed_data_size,
+	 (uint32_t) 43 );
+
+	/* Test error cases
+	 */
+	result = libpff_lzfu_decoder_set_compressed_data(
+	          NULL,
+	          pff_test_lzfu_compressed_data1,
+	          49,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_lzfu_decoder_set_compressed_data(
+	          lzfu_decoder,
+	          NULL,
+	          49,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_lzfu_decoder_set_compressed_data(
+	          lzfu_decoder,
+	          pff_test_lzfu_compressed_data1,
+	          8,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the compressed size exceeds the data size
+	 */
+	result = libpff_lzfu_decoder_set_compressed_data(
+	          lzfu_decoder,
+	          pff_test_lzfu_compressed_data1,
+	          48,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the signature is not supported
+	 */
+	result = libpff_lzfu_decoder_set_compressed_data(
+	          lzfu_decoder,
+	          invalid_data,
+	          16,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_lzfu_decoder_free(
+	          &lzfu_decoder,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "lzfu_decoder",
+	 lzfu_decoder );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lzfu_decoder != NULL )
+	{
+		libpff_lzfu_decoder_free(
+		 &lzfu_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_lzfu_decoder_read function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_lzfu_decoder_read(
+     void )
+{
+	size_t read_sizes[ 4 ] = { 1, 3, 7, 64 };
+
+	uint8_t uncompressed_data[ 64 ];
+
+	libcerror_error_t *error            = NULL;
+	libpff_lzfu_decoder_t *lzfu_decoder = NULL;
+	size_t uncompressed_data_offset     = 0;
+	ssize_t read_count                  = 0;
+	int read_size_index                 = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_lzfu_decoder_initialize(
+	          &lzfu_decoder,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "lzfu_decoder",
+	 lzfu_decoder );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test decompressing the data incrementally with different read sizes
+	 */
+	for( read_size_index = 0;
+	     read_size_index < 4;
+	     read_size_index++ )
+	{
+		result = libpff_lzfu_decoder_set_compressed_data(
+		          lzfu_decoder,
+		          pff_test_lzfu_compressed_data1,
+		          49,
+		          &error );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		uncompressed_data_offset = 0;
+
+		do
+		{
+			read_count = libpff_lzfu_decoder_read(
+			              lzfu_decoder,
+			              &( uncompressed_data[ uncompressed_data_offset ] ),
+			              read_sizes[ read_size_index ] < ( 64 - uncompressed_data_offset ) ? read_sizes[ read_size_index ] : ( 64 - uncompressed_data_offset ),
+			              &error );
+
+			PFF_TEST_ASSERT_NOT_EQUAL_SSIZE(
+			 "read_count",
+			 read_count,
+			 (ssize_t) -1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			uncompressed_data_offset += (size_t) read_count;
+		}
+		while( ( read_count > 0 )
+		    && ( uncompressed_data_offset < 64 ) );
+
+		PFF_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_offset",
+		 uncompressed_data_offset,
+		 (size_t) 43 );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          pff_test_lzfu_uncompressed_data1,
+		          43 );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test decompressing data that contains a reference that overlaps the dictionary write offset
+	 */
+	result = libpff_lzfu_decoder_set_compressed_data(
+	          lzfu_decoder,
+	          pff_test_lzfu_compressed_data2,
+	          30,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_lzfu_decoder_read(
+	              lzfu_decoder,
+	              uncompressed_data,
+	              64,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 28 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          pff_test_lzfu_uncompressed_data2,
+	          28 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libpff_lzfu_decoder_read(
+	              lzfu_decoder,
+	              uncompressed_data,
+	              64,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading uncompressed data
+	 */
+	result = libpff_lzfu_decoder_set_compressed_data(
+	          lzfu_decoder,
+	          pff_test_lzfu_compressed_data3,
+	          20,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_lzfu_decoder_read(
+	              lzfu_decoder,
+	              uncompressed_data,
+	              64,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          "{\\rt",
+	          4 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	read_count = libpff_lzfu_decoder_read(
+	              NULL,
+	              uncompressed_data,
+	              64,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libpff_lzfu_decoder_read(
+	              lzfu_decoder,
+	              NULL,
+	              64,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libpff_lzfu_decoder_read(
+	              lzfu_decoder,
+	              uncompressed_data,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_lzfu_decoder_free(
+	          &lzfu_decoder,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "lzfu_decoder",
+	 lzfu_decoder );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lzfu_decoder != NULL )
+	{
+		libpff_lzfu_decoder_free(
+		 &lzfu_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc PFF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] PFF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc PFF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] PFF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	PFF_TEST_UNREFERENCED_PARAMETER( argc )
+	PFF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+	PFF_TEST_RUN(
+	 "libpff_lzfu_decoder_initialize",
+	 pff_test_lzfu_decoder_initialize );
+
+	PFF_TEST_RUN(
+	 "libpff_lzfu_decoder_free",
+	 pff_test_lzfu_decoder_free );
+
+	PFF_TEST_RUN(
+	 "libpff_lzfu_decoder_set_compressed_data",
+	 pff_test_lzfu_decoder_set_compressed_data );
+
+	/* TODO: add tests for libpff_lzfu_decoder_reset */
+
+	PFF_TEST_RUN(
+	 "libpff_lzfu_decoder_read",
+	 pff_test_lzfu_decoder_read );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+}
+
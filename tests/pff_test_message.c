@@ -21,19 +21,3078 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "pff_test_libcdata.h"
 #include "pff_test_libcerror.h"
 #include "pff_test_libpff.h"
 #include "pff_test_macros.h"
 #include "pff_test_memory.h"
 #include "pff_test_unused.h"
 
+#include "../libpff/libpff_io_handle.h"
+#include "../libpff/libpff_item.h"
+#include "../libpff/libpff_item_descriptor.h"
+#include "../libpff/libpff_mapi.h"
 #include "../libpff/libpff_message.h"
+#include "../libpff/libpff_record_entry.h"
+#include "../libpff/libpff_record_set.h"
+#include "../libpff/libpff_table.h"
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+/* Compressed RTF example from [MS-OXRTFCP]
+ */
+uint8_t pff_test_message_rtf_compressed_data[ 49 ] = {
+	0x2d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x4c, 0x5a, 0x46, 0x75, 0xf1, 0xc5, 0xc7, 0xa7,
+	0x03, 0x00, 0x0a, 0x00, 0x72, 0x63, 0x70, 0x67, 0x31, 0x32, 0x35, 0x42, 0x32, 0x0a, 0xf3, 0x20,
+	0x68, 0x65, 0x6c, 0x09, 0x00, 0x20, 0x62, 0x77, 0x05, 0xb0, 0x6c, 0x64, 0x7d, 0x0a, 0x80, 0x0f,
+	0xa0 };
+
+uint8_t pff_test_message_rtf_uncompressed_data[ 43 ] = {
+	'{', '\\', 'r', 't', 'f', '1', '\\', 'a', 'n', 's', 'i', '\\', 'a', 'n', 's', 'i',
+	'c', 'p', 'g', '1', '2', '5', '2', '\\', 'p', 'a', 'r', 'd', ' ', 'h', 'e', 'l',
+	'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd', '}', '\r', '\n' };
+
+/* ASCII string: "Hé" in Windows 1252 with end of string character
+ */
+uint8_t pff_test_message_ascii_body_data[ 3 ] = {
+	0x48, 0xe9, 0x00 };
+
+/* UTF-8 string: "Hé" without end of string character
+ */
+uint8_t pff_test_message_ascii_body_utf8_data[ 3 ] = {
+	0x48, 0xc3, 0xa9 };
+
+/* UTF-16 little-endian string: "Hé€" with end of string character
+ */
+uint8_t pff_test_message_utf16_body_data[ 8 ] = {
+	0x48, 0x00, 0xe9, 0x00, 0xac, 0x20, 0x00, 0x00 };
+
+/* UTF-8 string: "Hé€" without end of string character
+ */
+uint8_t pff_test_message_utf16_body_utf8_data[ 6 ] = {
+	0x48, 0xc3, 0xa9, 0xe2, 0x82, 0xac };
+
+/* ASCII string: "<p>Hé</p>" in Windows 1252 with end of string character
+ */
+uint8_t pff_test_message_html_body_data[ 10 ] = {
+	'<', 'p', '>', 'H', 0xe9, '<', '/', 'p', '>', 0x00 };
+
+/* 32-bit message codepage: 65001 (UTF-8)
+ */
+uint8_t pff_test_message_utf8_codepage_data[ 4 ] = {
+	0xe9, 0xfd, 0x00, 0x00 };
+
+/* 32-bit message codepage: 12345 (unsupported)
+ */
+uint8_t pff_test_message_unsupported_codepage_data[ 4 ] = {
+	0x39, 0x30, 0x00, 0x00 };
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+/* Creates a message with an empty record set for testing
+ * The record entries are stored in the table instead of being read from a file
+ * Returns 1 if successful or -1 on error
+ */
+int pff_test_message_initialize(
+     libpff_item_t **message,
+     libpff_io_handle_t *io_handle,
+     libcdata_tree_node_t *item_tree_node,
+     libcerror_error_t **error )
+{
+	libpff_internal_item_t *internal_item = NULL;
+
+	if( libpff_item_initialize(
+	     message,
+	     io_handle,
+	     NULL,
+	     NULL,
+	     NULL,
+	     NULL,
+	     NULL,
+	     item_tree_node,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	internal_item = (libpff_internal_item_t *) *message;
+
+	if( libpff_table_initialize(
+	     &( internal_item->item_values->table ),
+	     0,
+	     0,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libpff_table_resize_record_entries(
+	     internal_item->item_values->table,
+	     1,
+	     0,
+	     internal_item->ascii_codepage,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libpff_item_free(
+	 message,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Appends a record entry with value data to the message for testing
+ * Returns 1 if successful or -1 on error
+ */
+int pff_test_message_append_record_entry(
+     libpff_item_t *message,
+     uint32_t entry_type,
+     uint32_t value_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	libpff_internal_item_t *internal_item = NULL;
+	libpff_record_entry_t *record_entry   = NULL;
+	libpff_record_set_t *record_set       = NULL;
+	int number_of_entries                 = 0;
+
+	internal_item = (libpff_internal_item_t *) message;
+
+	if( libpff_table_get_record_set_by_index(
+	     internal_item->item_values->table,
+	     0,
+	     &record_set,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libpff_record_set_get_number_of_entries(
+	     record_set,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libpff_table_resize_record_entries(
+	     internal_item->item_values->table,
+	     1,
+	     number_of_entries + 1,
+	     internal_item->ascii_codepage,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libpff_record_set_get_entry_by_index(
+	     record_set,
+	     number_of_entries,
+	     &record_entry,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libpff_record_entry_set_value_data(
+	     record_entry,
+	     value_data,
+	     value_data_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	( (libpff_internal_record_entry_t *) record_entry )->identifier.format     = LIBPFF_RECORD_ENTRY_IDENTIFIER_FORMAT_MAPI_PROPERTY;
+	( (libpff_internal_record_entry_t *) record_entry )->identifier.entry_type = entry_type;
+	( (libpff_internal_record_entry_t *) record_entry )->identifier.value_type = value_type;
+
+	return( 1 );
+}
+
+/* Tests the libpff_message_get_body_stream_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_message_get_body_stream_codepage(
+     libpff_io_handle_t *io_handle,
+     libcdata_tree_node_t *item_tree_node )
+{
+	libcerror_error_t *error = NULL;
+	libpff_item_t *message   = NULL;
+	int ascii_codepage       = 0;
+	int result               = 0;
+
+	/* Test a message without a message codepage
+	 */
+	result = pff_test_message_initialize(
+	          &message,
+	          io_handle,
+	          item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_get_body_stream_codepage(
+	          (libpff_internal_item_t *) message,
+	          &ascii_codepage,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "ascii_codepage",
+	 ascii_codepage,
+	 LIBPFF_CODEPAGE_WINDOWS_1252 );
+
+	result = libpff_item_free(
+	          &message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a message with a supported message codepage
+	 */
+	result = pff_test_message_initialize(
+	          &message,
+	          io_handle,
+	          item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_message_append_record_entry(
+	          message,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_CODEPAGE,
+	          LIBPFF_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	          pff_test_message_utf8_codepage_data,
+	          4,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_get_body_stream_codepage(
+	          (libpff_internal_item_t *) message,
+	          &ascii_codepage,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "ascii_codepage",
+	 ascii_codepage,
+	 65001 );
+
+	result = libpff_item_free(
+	          &message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a message with an unsupported message codepage falls back to the ASCII codepage
+	 */
+	result = pff_test_message_initialize(
+	          &message,
+	          io_handle,
+	          item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_message_append_record_entry(
+	          message,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_CODEPAGE,
+	          LIBPFF_VALUE_TYPE_INTEGER_32BIT_SIGNED,
+	          pff_test_message_unsupported_codepage_data,
+	          4,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_get_body_stream_codepage(
+	          (libpff_internal_item_t *) message,
+	          &ascii_codepage,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "ascii_codepage",
+	 ascii_codepage,
+	 LIBPFF_CODEPAGE_WINDOWS_1252 );
+
+	/* Test error cases
+	 */
+	result = libpff_message_get_body_stream_codepage(
+	          NULL,
+	          &ascii_codepage,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_message_get_body_stream_codepage(
+	          (libpff_internal_item_t *) message,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_item_free(
+	          &message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message != NULL )
+	{
+		libpff_item_free(
+		 &message,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_message_plain_text_body_open function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_message_plain_text_body_open(
+     libpff_io_handle_t *io_handle,
+     libcdata_tree_node_t *item_tree_node )
+{
+	libcerror_error_t *error = NULL;
+	libpff_item_t *message   = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = pff_test_message_initialize(
+	          &message,
+	          io_handle,
+	          item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open without a plain text body
+	 */
+	result = libpff_message_plain_text_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = pff_test_message_append_record_entry(
+	          message,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_PLAIN_TEXT,
+	          LIBPFF_VALUE_TYPE_STRING_ASCII,
+	          pff_test_message_ascii_body_data,
+	          3,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_plain_text_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open of a message body that already was opened
+	 */
+	result = libpff_message_plain_text_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_plain_text_body_close(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_message_plain_text_body_open(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_item_free(
+	          &message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message != NULL )
+	{
+		libpff_item_free(
+		 &message,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_message_plain_text_body_close function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_message_plain_text_body_close(
+     libpff_io_handle_t *io_handle,
+     libcdata_tree_node_t *item_tree_node )
+{
+	libcerror_error_t *error = NULL;
+	libpff_item_t *message   = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = pff_test_message_initialize(
+	          &message,
+	          io_handle,
+	          item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_message_append_record_entry(
+	          message,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_PLAIN_TEXT,
+	          LIBPFF_VALUE_TYPE_STRING_ASCII,
+	          pff_test_message_ascii_body_data,
+	          3,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_plain_text_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_message_plain_text_body_close(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "internal_item->plain_text_body_stream",
+	 ( (libpff_internal_item_t *) message )->plain_text_body_stream );
+
+	/* Test close of a message body that was not opened
+	 */
+	result = libpff_message_plain_text_body_close(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_message_plain_text_body_close(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_item_free(
+	          &message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message != NULL )
+	{
+		libpff_item_free(
+		 &message,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_message_plain_text_body_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_message_plain_text_body_read_buffer(
+     libpff_io_handle_t *io_handle,
+     libcdata_tree_node_t *item_tree_node )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	libpff_item_t *message   = NULL;
+	ssize_t read_count       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = pff_test_message_initialize(
+	          &message,
+	          io_handle,
+	          item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_message_append_record_entry(
+	          message,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_PLAIN_TEXT,
+	          LIBPFF_VALUE_TYPE_STRING_ASCII,
+	          pff_test_message_ascii_body_data,
+	          3,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libpff_message_plain_text_body_read_buffer(
+	              message,
+	              buffer,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_message_plain_text_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_message_plain_text_body_read_buffer(
+	              NULL,
+	              buffer,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libpff_message_plain_text_body_read_buffer(
+	              message,
+	              NULL,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libpff_message_plain_text_body_read_buffer(
+	              message,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an ASCII string body is converted to UTF-8 using the message codepage
+	 */
+	read_count = libpff_message_plain_text_body_read_buffer(
+	              message,
+	              buffer,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 3 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          pff_test_message_ascii_body_utf8_data,
+	          3 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libpff_message_plain_text_body_read_buffer(
+	              message,
+	              buffer,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_plain_text_body_close(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_item_free(
+	          &message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a Unicode string body is converted to UTF-8
+	 */
+	result = pff_test_message_initialize(
+	          &message,
+	          io_handle,
+	          item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_message_append_record_entry(
+	          message,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_PLAIN_TEXT,
+	          LIBPFF_VALUE_TYPE_STRING_UNICODE,
+	          pff_test_message_utf16_body_data,
+	          8,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_plain_text_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_message_plain_text_body_read_buffer(
+	              message,
+	              buffer,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 6 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          pff_test_message_utf16_body_utf8_data,
+	          6 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libpff_message_plain_text_body_read_buffer(
+	              message,
+	              buffer,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_plain_text_body_close(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libpff_item_free(
+	          &message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message != NULL )
+	{
+		libpff_item_free(
+		 &message,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_message_rtf_body_open function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_message_rtf_body_open(
+     libpff_io_handle_t *io_handle,
+     libcdata_tree_node_t *item_tree_node )
+{
+	libcerror_error_t *error = NULL;
+	libpff_item_t *message   = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = pff_test_message_initialize(
+	          &message,
+	          io_handle,
+	          item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open without a RTF body
+	 */
+	result = libpff_message_rtf_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = pff_test_message_append_record_entry(
+	          message,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_COMPRESSED_RTF,
+	          LIBPFF_VALUE_TYPE_BINARY_DATA,
+	          pff_test_message_rtf_compressed_data,
+	          49,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_rtf_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open of a message body that already was opened
+	 */
+	result = libpff_message_rtf_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_rtf_body_close(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_message_rtf_body_open(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_item_free(
+	          &message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message != NULL )
+	{
+		libpff_item_free(
+		 &message,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_message_rtf_body_close function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_message_rtf_body_close(
+     libpff_io_handle_t *io_handle,
+     libcdata_tree_node_t *item_tree_node )
+{
+	libcerror_error_t *error = NULL;
+	libpff_item_t *message   = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = pff_test_message_initialize(
+	          &message,
+	          io_handle,
+	          item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_message_append_record_entry(
+	          message,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_COMPRESSED_RTF,
+	          LIBPFF_VALUE_TYPE_BINARY_DATA,
+	          pff_test_message_rtf_compressed_data,
+	          49,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_rtf_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_message_rtf_body_close(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "internal_item->rtf_body_lzfu_decoder",
+	 ( (libpff_internal_item_t *) message )->rtf_body_lzfu_decoder );
+
+	/* Test close of a message body that was not opened
+	 */
+	result = libpff_message_rtf_body_close(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_message_rtf_body_close(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_item_free(
+	          &message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message != NULL )
+	{
+		libpff_item_free(
+		 &message,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_message_rtf_body_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_message_rtf_body_read_buffer(
+     libpff_io_handle_t *io_handle,
+     libcdata_tree_node_t *item_tree_node )
+{
+	uint8_t buffer[ 64 ];
+	uint8_t rtf_body[ 64 ];
+
+	size_t read_sizes[ 4 ]   = { 1, 2, 5, 11 };
+	libcerror_error_t *error = NULL;
+	libpff_item_t *message   = NULL;
+	size_t expected_size     = 0;
+	size_t rtf_body_offset   = 0;
+	size_t rtf_body_size     = 0;
+	ssize_t read_count       = 0;
+	int read_size_index      = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = pff_test_message_initialize(
+	          &message,
+	          io_handle,
+	          item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_message_append_record_entry(
+	          message,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_COMPRESSED_RTF,
+	          LIBPFF_VALUE_TYPE_BINARY_DATA,
+	          pff_test_message_rtf_compressed_data,
+	          49,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libpff_message_rtf_body_read_buffer(
+	              message,
+	              buffer,
+	              64,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_message_rtf_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_message_rtf_body_read_buffer(
+	              NULL,
+	              buffer,
+	              64,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libpff_message_rtf_body_read_buffer(
+	              message,
+	              NULL,
+	              64,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libpff_message_rtf_body_read_buffer(
+	              message,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reading the RTF body incrementally with different read sizes
+	 */
+	while( rtf_body_offset < 43 )
+	{
+		expected_size = read_sizes[ read_size_index ];
+
+		if( expected_size > ( 43 - rtf_body_offset ) )
+		{
+			expected_size = 43 - rtf_body_offset;
+		}
+		read_count = libpff_message_rtf_body_read_buffer(
+		              message,
+		              buffer,
+		              read_sizes[ read_size_index ],
+		              &error );
+
+		PFF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) expected_size );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffer,
+		          &( pff_test_message_rtf_uncompressed_data[ rtf_body_offset ] ),
+		          expected_size );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		rtf_body_offset += expected_size;
+		read_size_index  = ( read_size_index + 1 ) % 4;
+	}
+	/* Test reading beyond the end of the RTF body
+	 */
+	read_count = libpff_message_rtf_body_read_buffer(
+	              message,
+	              buffer,
+	              64,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_message_rtf_body_read_buffer(
+	              message,
+	              buffer,
+	              64,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the RTF body matches the body returned by libpff_message_get_rtf_body
+	 */
+	result = libpff_message_get_rtf_body_size(
+	          message,
+	          &rtf_body_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_SIZE(
+	 "rtf_body_size",
+	 rtf_body_size,
+	 (size_t) 44 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_get_rtf_body(
+	          message,
+	          rtf_body,
+	          rtf_body_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          rtf_body,
+	          pff_test_message_rtf_uncompressed_data,
+	          43 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "rtf_body[ 43 ]",
+	 rtf_body[ 43 ],
+	 0 );
+
+	/* Test reading the RTF body after it was cached by libpff_message_get_rtf_body_size
+	 */
+	result = libpff_message_rtf_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	rtf_body_offset = 0;
+	read_size_index = 0;
+
+	while( rtf_body_offset < 43 )
+	{
+		expected_size = read_sizes[ read_size_index ];
+
+		if( expected_size > ( 43 - rtf_body_offset ) )
+		{
+			expected_size = 43 - rtf_body_offset;
+		}
+		read_count = libpff_message_rtf_body_read_buffer(
+		              message,
+		              buffer,
+		              read_sizes[ read_size_index ],
+		              &error );
+
+		PFF_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) expected_size );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          buffer,
+		          &( rtf_body[ rtf_body_offset ] ),
+		          expected_size );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		rtf_body_offset += expected_size;
+		read_size_index  = ( read_size_index + 1 ) % 4;
+	}
+	read_count = libpff_message_rtf_body_read_buffer(
+	              message,
+	              buffer,
+	              64,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_rtf_body_close(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libpff_item_free(
+	          &message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message != NULL )
+	{
+		libpff_item_free(
+		 &message,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_message_rtf_body_seek_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_message_rtf_body_seek_offset(
+     libpff_io_handle_t *io_handle,
+     libcdata_tree_node_t *item_tree_node )
+{
+	uint8_t buffer[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	libpff_item_t *message   = NULL;
+	off64_t offset           = 0;
+	size_t rtf_body_size     = 0;
+	ssize_t read_count       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = pff_test_message_initialize(
+	          &message,
+	          io_handle,
+	          item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_message_append_record_entry(
+	          message,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_COMPRESSED_RTF,
+	          LIBPFF_VALUE_TYPE_BINARY_DATA,
+	          pff_test_message_rtf_compressed_data,
+	          49,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libpff_message_rtf_body_seek_offset(
+	          message,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_message_rtf_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libpff_message_rtf_body_seek_offset(
+	          NULL,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libpff_message_rtf_body_seek_offset(
+	          message,
+	          -1,
+	          SEEK_SET,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libpff_message_rtf_body_seek_offset(
+	          message,
+	          0,
+	          -1,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test seeking forward with SEEK_SET
+	 */
+	offset = libpff_message_rtf_body_seek_offset(
+	          message,
+	          10,
+	          SEEK_SET,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 10 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_message_rtf_body_read_buffer(
+	              message,
+	              buffer,
+	              5,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 5 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( pff_test_message_rtf_uncompressed_data[ 10 ] ),
+	          5 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test seeking forward with SEEK_CUR
+	 */
+	offset = libpff_message_rtf_body_seek_offset(
+	          message,
+	          3,
+	          SEEK_CUR,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 18 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_message_rtf_body_read_buffer(
+	              message,
+	              buffer,
+	              4,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( pff_test_message_rtf_uncompressed_data[ 18 ] ),
+	          4 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test seeking backward with SEEK_CUR, which restarts the decompression
+	 */
+	offset = libpff_message_rtf_body_seek_offset(
+	          message,
+	          -12,
+	          SEEK_CUR,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 10 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "internal_item->rtf_body_lzfu_decoder->uncompressed_data_offset",
+	 (uint64_t) ( (libpff_internal_item_t *) message )->rtf_body_lzfu_decoder->uncompressed_data_offset,
+	 (uint64_t) 10 );
+
+	read_count = libpff_message_rtf_body_read_buffer(
+	              message,
+	              buffer,
+	              5,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 5 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( pff_test_message_rtf_uncompressed_data[ 10 ] ),
+	          5 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test seeking with SEEK_END
+	 */
+	offset = libpff_message_rtf_body_seek_offset(
+	          message,
+	          -2,
+	          SEEK_END,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 41 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_message_rtf_body_read_buffer(
+	              message,
+	              buffer,
+	              64,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 2 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( pff_test_message_rtf_uncompressed_data[ 41 ] ),
+	          2 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	offset = libpff_message_rtf_body_seek_offset(
+	          message,
+	          0,
+	          SEEK_END,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 43 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_message_rtf_body_read_buffer(
+	              message,
+	              buffer,
+	              64,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seeking beyond the end of the RTF body
+	 */
+	offset = libpff_message_rtf_body_seek_offset(
+	          message,
+	          100,
+	          SEEK_SET,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 100 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_message_rtf_body_read_buffer(
+	              message,
+	              buffer,
+	              64,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test seeking back to the start of the RTF body
+	 */
+	offset = libpff_message_rtf_body_seek_offset(
+	          message,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_message_rtf_body_read_buffer(
+	              message,
+	              buffer,
+	              64,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 43 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          pff_test_message_rtf_uncompressed_data,
+	          43 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test seeking after the RTF body was cached by libpff_message_get_rtf_body_size
+	 */
+	result = libpff_message_get_rtf_body_size(
+	          message,
+	          &rtf_body_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libpff_message_rtf_body_seek_offset(
+	          message,
+	          -5,
+	          SEEK_END,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 38 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_message_rtf_body_read_buffer(
+	              message,
+	              buffer,
+	              64,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 5 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( pff_test_message_rtf_uncompressed_data[ 38 ] ),
+	          5 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	offset = libpff_message_rtf_body_seek_offset(
+	          message,
+	          100,
+	          SEEK_SET,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 100 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_message_rtf_body_read_buffer(
+	              message,
+	              buffer,
+	              64,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_rtf_body_close(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libpff_item_free(
+	          &message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message != NULL )
+	{
+		libpff_item_free(
+		 &message,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_message_html_body_open function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_message_html_body_open(
+     libpff_io_handle_t *io_handle,
+     libcdata_tree_node_t *item_tree_node )
+{
+	libcerror_error_t *error = NULL;
+	libpff_item_t *message   = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = pff_test_message_initialize(
+	          &message,
+	          io_handle,
+	          item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open without a HTML body
+	 */
+	result = libpff_message_html_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = pff_test_message_append_record_entry(
+	          message,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_HTML,
+	          LIBPFF_VALUE_TYPE_STRING_ASCII,
+	          pff_test_message_html_body_data,
+	          10,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_html_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open of a message body that already was opened
+	 */
+	result = libpff_message_html_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_html_body_close(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_message_html_body_open(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_item_free(
+	          &message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message != NULL )
+	{
+		libpff_item_free(
+		 &message,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_message_html_body_close function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_message_html_body_close(
+     libpff_io_handle_t *io_handle,
+     libcdata_tree_node_t *item_tree_node )
+{
+	libcerror_error_t *error = NULL;
+	libpff_item_t *message   = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = pff_test_message_initialize(
+	          &message,
+	          io_handle,
+	          item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_message_append_record_entry(
+	          message,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_HTML,
+	          LIBPFF_VALUE_TYPE_STRING_ASCII,
+	          pff_test_message_html_body_data,
+	          10,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_html_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_message_html_body_close(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "internal_item->html_body_stream",
+	 ( (libpff_internal_item_t *) message )->html_body_stream );
+
+	/* Test close of a message body that was not opened
+	 */
+	result = libpff_message_html_body_close(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_message_html_body_close(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_item_free(
+	          &message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message != NULL )
+	{
+		libpff_item_free(
+		 &message,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_message_html_body_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_message_html_body_read_buffer(
+     libpff_io_handle_t *io_handle,
+     libcdata_tree_node_t *item_tree_node )
+{
+	uint8_t buffer[ 16 ];
+	uint8_t html_body[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	libpff_item_t *message   = NULL;
+	ssize_t read_count       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = pff_test_message_initialize(
+	          &message,
+	          io_handle,
+	          item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_message_append_record_entry(
+	          message,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_HTML,
+	          LIBPFF_VALUE_TYPE_STRING_ASCII,
+	          pff_test_message_html_body_data,
+	          10,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libpff_message_html_body_read_buffer(
+	              message,
+	              buffer,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_message_html_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_message_html_body_read_buffer(
+	              NULL,
+	              buffer,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libpff_message_html_body_read_buffer(
+	              message,
+	              NULL,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libpff_message_html_body_read_buffer(
+	              message,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an ASCII string body is returned as stored
+	 */
+	read_count = libpff_message_html_body_read_buffer(
+	              message,
+	              buffer,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 10 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          pff_test_message_html_body_data,
+	          10 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libpff_message_html_body_read_buffer(
+	              message,
+	              buffer,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the HTML body matches the body returned by libpff_message_get_html_body
+	 */
+	result = libpff_message_get_html_body(
+	          message,
+	          html_body,
+	          16,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          html_body,
+	          pff_test_message_html_body_data,
+	          10 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libpff_message_html_body_close(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_item_free(
+	          &message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a binary body is returned as stored
+	 */
+	result = pff_test_message_initialize(
+	          &message,
+	          io_handle,
+	          item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_message_append_record_entry(
+	          message,
+	          LIBPFF_ENTRY_TYPE_MESSAGE_BODY_HTML,
+	          LIBPFF_VALUE_TYPE_BINARY_DATA,
+	          pff_test_message_html_body_data,
+	          9,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_html_body_open(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_message_html_body_read_buffer(
+	              message,
+	              buffer,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 9 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          pff_test_message_html_body_data,
+	          9 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libpff_message_html_body_read_buffer(
+	              message,
+	              buffer,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_html_body_close(
+	          message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libpff_item_free(
+	          &message,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message",
+	 message );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message != NULL )
+	{
+		libpff_item_free(
+		 &message,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
 
 /* The main program
  */
@@ -47,6 +3106,17 @@ int main(
      char * const argv[] PFF_TEST_ATTRIBUTE_UNUSED )
 #endif
 {
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	libcdata_tree_node_t *item_tree_node      = NULL;
+	libcerror_error_t *error                  = NULL;
+	libpff_io_handle_t *io_handle             = NULL;
+	libpff_item_descriptor_t *item_descriptor = NULL;
+	int result                                = 0;
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
 	PFF_TEST_UNREFERENCED_PARAMETER( argc )
 	PFF_TEST_UNREFERENCED_PARAMETER( argv )
 
@@ -100,19 +3170,229 @@ int main(
 
 	/* TODO: add tests for libpff_message_get_plain_text_body */
 
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize test
+	 */
+	result = libpff_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_item_descriptor_initialize(
+	          &item_descriptor,
+	          0,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_descriptor",
+	 item_descriptor );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_node_initialize(
+	          &item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_tree_node",
+	 item_tree_node );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_node_set_value(
+	          item_tree_node,
+	          (intptr_t *) item_descriptor,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	item_descriptor = NULL;
+
+	PFF_TEST_RUN_WITH_ARGS(
+	 "libpff_message_get_body_stream_codepage",
+	 pff_test_message_get_body_stream_codepage,
+	 io_handle,
+	 item_tree_node );
+
+	PFF_TEST_RUN_WITH_ARGS(
+	 "libpff_message_plain_text_body_open",
+	 pff_test_message_plain_text_body_open,
+	 io_handle,
+	 item_tree_node );
+
+	PFF_TEST_RUN_WITH_ARGS(
+	 "libpff_message_plain_text_body_close",
+	 pff_test_message_plain_text_body_close,
+	 io_handle,
+	 item_tree_node );
+
+	PFF_TEST_RUN_WITH_ARGS(
+	 "libpff_message_plain_text_body_read_buffer",
+	 pff_test_message_plain_text_body_read_buffer,
+	 io_handle,
+	 item_tree_node );
+
 	/* TODO: add tests for libpff_message_get_rtf_body_size */
 
 	/* TODO: add tests for libpff_message_get_rtf_body */
 
+	PFF_TEST_RUN_WITH_ARGS(
+	 "libpff_message_rtf_body_open",
+	 pff_test_message_rtf_body_open,
+	 io_handle,
+	 item_tree_node );
+
+	PFF_TEST_RUN_WITH_ARGS(
+	 "libpff_message_rtf_body_close",
+	 pff_test_message_rtf_body_close,
+	 io_handle,
+	 item_tree_node );
+
+	PFF_TEST_RUN_WITH_ARGS(
+	 "libpff_message_rtf_body_read_buffer",
+	 pff_test_message_rtf_body_read_buffer,
+	 io_handle,
+	 item_tree_node );
+
+	PFF_TEST_RUN_WITH_ARGS(
+	 "libpff_message_rtf_body_seek_offset",
+	 pff_test_message_rtf_body_seek_offset,
+	 io_handle,
+	 item_tree_node );
+
 	/* TODO: add tests for libpff_message_get_html_body_size */
 
 	/* TODO: add tests for libpff_message_get_html_body */
 
+	PFF_TEST_RUN_WITH_ARGS(
+	 "libpff_message_html_body_open",
+	 pff_test_message_html_body_open,
+	 io_handle,
+	 item_tree_node );
+
+	PFF_TEST_RUN_WITH_ARGS(
+	 "libpff_message_html_body_close",
+	 pff_test_message_html_body_close,
+	 io_handle,
+	 item_tree_node );
+
+	PFF_TEST_RUN_WITH_ARGS(
+	 "libpff_message_html_body_read_buffer",
+	 pff_test_message_html_body_read_buffer,
+	 io_handle,
+	 item_tree_node );
+
+	/* Clean up
+	 */
+	result = libcdata_tree_node_free(
+	          &item_tree_node,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libpff_item_descriptor_free,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "item_tree_node",
+	 item_tree_node );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
 	return( EXIT_SUCCESS );
 
-/* TODO add tests
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_tree_node != NULL )
+	{
+		libcdata_tree_node_free(
+		 &item_tree_node,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libpff_item_descriptor_free,
+		 NULL );
+	}
+	if( item_descriptor != NULL )
+	{
+		libpff_item_descriptor_free(
+		 &item_descriptor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libpff_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
 	return( EXIT_FAILURE );
-*/
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
 }
 
@@ -0,0 +1,868 @@
+/*
+ * Library message_body_stream type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pff_test_libcerror.h"
+#include "pff_test_macros.h"
+#include "pff_test_memory.h"
+#include "pff_test_unused.h"
+
+#include "../libpff/libpff_codepage.h"
+#include "../libpff/libpff_mapi.h"
+#include "../libpff/libpff_message_body_stream.h"
+#include "../libpff/libpff_record_entry.h"
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+/* UTF-16 little-endian string: "Hé€" with end of string character
+ */
+uint8_t pff_test_message_body_stream_utf16_data[ 8 ] = {
+	0x48, 0x00, 0xe9, 0x00, 0xac, 0x20, 0x00, 0x00 };
+
+/* UTF-8 string: "Hé€" without end of string character
+ */
+uint8_t pff_test_message_body_stream_utf8_data[ 6 ] = {
+	0x48, 0xc3, 0xa9, 0xe2, 0x82, 0xac };
+
+/* Creates a record entry with value data for testing
+ * Returns 1 if successful or -1 on error
+ */
+int pff_test_message_body_stream_record_entry_initialize(
+     libpff_record_entry_t **record_entry,
+     uint32_t value_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	if( libpff_record_entry_initialize(
+	     record_entry,
+	     LIBPFF_CODEPAGE_WINDOWS_1252,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libpff_record_entry_set_value_data(
+	     *record_entry,
+	     value_data,
+	     value_data_size,
+	     error ) != 1 )
+	{
+		libpff_internal_record_entry_free(
+		 (libpff_internal_record_entry_t **) record_entry,
+		 NULL );
+
+		return( -1 );
+	}
+	( (libpff_internal_record_entry_t *) *record_entry )->identifier.format     = LIBPFF_RECORD_ENTRY_IDENTIFIER_FORMAT_MAPI_PROPERTY;
+	( (libpff_internal_record_entry_t *) *record_entry )->identifier.value_type = value_type;
+
+	return( 1 );
+}
+
+/* Tests the libpff_message_body_stream_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_message_body_stream_initialize(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libpff_message_body_stream_t *message_body_stream = NULL;
+	libpff_record_entry_t *record_entry               = NULL;
+	int result                                        = 0;
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+	int number_of_malloc_fail_tests                   = 1;
+	int number_of_memset_fail_tests                   = 1;
+	int test_number                                   = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = pff_test_message_body_stream_record_entry_initialize(
+	          &record_entry,
+	          LIBPFF_VALUE_TYPE_STRING_UNICODE,
+	          pff_test_message_body_stream_utf16_data,
+	          8,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_entry",
+	 record_entry );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_message_body_stream_initialize(
+	          NULL,
+	          record_entry,
+	          LIBPFF_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	message_body_stream = (libpff_message_body_stream_t *) 0x12345678UL;
+
+	result = libpff_message_body_stream_initialize(
+	          &message_body_stream,
+	          record_entry,
+	          LIBPFF_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	message_body_stream = NULL;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_message_body_stream_initialize(
+	          &message_body_stream,
+	          NULL,
+	          LIBPFF_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message_body_stream",
+	 message_body_stream );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_message_body_stream_initialize(
+	          &message_body_stream,
+	          record_entry,
+	          LIBPFF_CODEPAGE_WINDOWS_1252,
+	          0xff,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message_body_stream",
+	 message_body_stream );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libpff_message_body_stream_initialize with malloc failing
+		 */
+		pff_test_malloc_attempts_before_fail = test_number;
+
+		result = libpff_message_body_stream_initialize(
+		          &message_body_stream,
+		          record_entry,
+		          LIBPFF_CODEPAGE_WINDOWS_1252,
+		          0,
+		          &error );
+
+		if( pff_test_malloc_attempts_before_fail != -1 )
+		{
+			pff_test_malloc_attempts_before_fail = -1;
+
+			if( message_body_stream != NULL )
+			{
+				libpff_message_body_stream_free(
+				 &message_body_stream,
+				 NULL );
+			}
+		}
+		else
+		{
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "message_body_stream",
+			 message_body_stream );
+
+			PFF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libpff_message_body_stream_initialize with memset failing
+		 */
+		pff_test_memset_attempts_before_fail = test_number;
+
+		result = libpff_message_body_stream_initialize(
+		          &message_body_stream,
+		          record_entry,
+		          LIBPFF_CODEPAGE_WINDOWS_1252,
+		          0,
+		          &error );
+
+		if( pff_test_memset_attempts_before_fail != -1 )
+		{
+			pff_test_memset_attempts_before_fail = -1;
+
+			if( message_body_stream != NULL )
+			{
+				libpff_message_body_stream_free(
+				 &message_body_stream,
+				 NULL );
+			}
+		}
+		else
+		{
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "message_body_stream",
+			 message_body_stream );
+
+			PFF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_PFF_TEST_MEMORY ) */
+
+	/* Test regular cases
+	 */
+	result = libpff_message_body_stream_initialize(
+	          &message_body_stream,
+	          record_entry,
+	          LIBPFF_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "message_body_stream",
+	 message_body_stream );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "message_body_stream->conversion",
+	 (int) message_body_stream->conversion,
+	 LIBPFF_MESSAGE_BODY_STREAM_CONVERSION_UTF16 );
+
+	result = libpff_message_body_stream_free(
+	          &message_body_stream,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "message_body_stream",
+	 message_body_stream );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_internal_record_entry_free(
+	          (libpff_internal_record_entry_t **) &record_entry,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "record_entry",
+	 record_entry );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message_body_stream != NULL )
+	{
+		libpff_message_body_stream_free(
+		 &message_body_stream,
+		 NULL );
+	}
+	if( record_entry != NULL )
+	{
+		libpff_internal_record_entry_free(
+		 (libpff_internal_record_entry_t **) &record_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_message_body_stream_free function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_message_body_stream_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libpff_message_body_stream_free(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_message_body_stream_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_message_body_stream_read_buffer(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error                          = NULL;
+	libpff_message_body_stream_t *message_body_stream = NULL;
+	libpff_record_entry_t *record_entry               = NULL;
+	size_t buffer_offset                              = 0;
+	ssize_t read_count                                = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = pff_test_message_body_stream_record_entry_initialize(
+	          &record_entry,
+	          LIBPFF_VALUE_TYPE_STRING_UNICODE,
+	          pff_test_message_body_stream_utf16_data,
+	          8,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_body_stream_initialize(
+	          &message_body_stream,
+	          record_entry,
+	          LIBPFF_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Read one byte at a time so multi-byte UTF-8 characters are split
+	 */
+	buffer_offset = 0;
+
+	do
+	{
+		read_count = libpff_message_body_stream_read_buffer(
+		              message_body_stream,
+		              &( buffer[ buffer_offset ] ),
+		              1,
+		              &error );
+
+		PFF_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		PFF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		buffer_offset += (size_t) read_count;
+	}
+	while( ( read_count > 0 )
+	    && ( buffer_offset < 16 ) );
+
+	PFF_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_offset",
+	 buffer_offset,
+	 (size_t) 6 );
+
+	result = memory_compare(
+	          buffer,
+	          pff_test_message_body_stream_utf8_data,
+	          6 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	read_count = libpff_message_body_stream_read_buffer(
+	              NULL,
+	              buffer,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libpff_message_body_stream_read_buffer(
+	              message_body_stream,
+	              NULL,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libpff_message_body_stream_read_buffer(
+	              message_body_stream,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_message_body_stream_free(
+	          &message_body_stream,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_internal_record_entry_free(
+	          (libpff_internal_record_entry_t **) &record_entry,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "record_entry",
+	 record_entry );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test binary data is returned as stored
+	 */
+	result = pff_test_message_body_stream_record_entry_initialize(
+	          &record_entry,
+	          LIBPFF_VALUE_TYPE_BINARY_DATA,
+	          pff_test_message_body_stream_utf16_data,
+	          8,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_body_stream_initialize(
+	          &message_body_stream,
+	          record_entry,
+	          LIBPFF_CODEPAGE_WINDOWS_1252,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_message_body_stream_read_buffer(
+	              message_body_stream,
+	              buffer,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          pff_test_message_body_stream_utf16_data,
+	          8 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libpff_message_body_stream_read_buffer(
+	              message_body_stream,
+	              buffer,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_body_stream_free(
+	          &message_body_stream,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_internal_record_entry_free(
+	          (libpff_internal_record_entry_t **) &record_entry,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a string is returned as stored when requested
+	 */
+	result = pff_test_message_body_stream_record_entry_initialize(
+	          &record_entry,
+	          LIBPFF_VALUE_TYPE_STRING_UNICODE,
+	          pff_test_message_body_stream_utf16_data,
+	          8,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_message_body_stream_initialize(
+	          &message_body_stream,
+	          record_entry,
+	          LIBPFF_CODEPAGE_WINDOWS_1252,
+	          LIBPFF_MESSAGE_BODY_STREAM_FLAG_READ_AS_STORED,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libpff_message_body_stream_read_buffer(
+	              message_body_stream,
+	              buffer,
+	              16,
+	              &error );
+
+	PFF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          pff_test_message_body_stream_utf16_data,
+	          8 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libpff_message_body_stream_free(
+	          &message_body_stream,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_internal_record_entry_free(
+	          (libpff_internal_record_entry_t **) &record_entry,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "record_entry",
+	 record_entry );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message_body_stream != NULL )
+	{
+		libpff_message_body_stream_free(
+		 &message_body_stream,
+		 NULL );
+	}
+	if( record_entry != NULL )
+	{
+		libpff_internal_record_entry_free(
+		 (libpff_internal_record_entry_t **) &record_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc PFF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] PFF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc PFF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] PFF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	PFF_TEST_UNREFERENCED_PARAMETER( argc )
+	PFF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+	PFF_TEST_RUN(
+	 "libpff_message_body_stream_initialize",
+	 pff_test_message_body_stream_initialize );
+
+	PFF_TEST_RUN(
+	 "libpff_message_body_stream_free",
+	 pff_test_message_body_stream_free );
+
+	PFF_TEST_RUN(
+	 "libpff_message_body_stream_read_buffer",
+	 pff_test_message_body_stream_read_buffer );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+}
+
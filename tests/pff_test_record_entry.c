@@ -28,11 +28,14 @@
 #endif
 
 #include "pff_test_libcerror.h"
+#include "pff_test_libfdata.h"
 #include "pff_test_libpff.h"
 #include "pff_test_macros.h"
 #include "pff_test_memory.h"
 #include "pff_test_unused.h"
 
+#include "../libpff/libpff_definitions.h"
+#include "../libpff/libpff_io_handle.h"
 #include "../libpff/libpff_record_entry.h"
 
 #if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
@@ -839,6 +842,178 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libpff_record_entry_get_number_of_data_extents function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_record_entry_get_number_of_data_extents(
+     libpff_record_entry_t *record_entry )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_extents    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libpff_record_entry_get_number_of_data_extents(
+	          record_entry,
+	          &number_of_extents,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_record_entry_get_number_of_data_extents(
+	          NULL,
+	          &number_of_extents,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_record_entry_get_number_of_data_extents(
+	          record_entry,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_record_entry_get_data_extent_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_record_entry_get_data_extent_by_index(
+     libpff_record_entry_t *record_entry )
+{
+	libcerror_error_t *error = NULL;
+	size64_t extent_size     = 0;
+	off64_t extent_offset    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libpff_record_entry_get_data_extent_by_index(
+	          record_entry,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_record_entry_get_data_extent_by_index(
+	          NULL,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_record_entry_get_data_extent_by_index(
+	          record_entry,
+	          0,
+	          NULL,
+	          &extent_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_record_entry_get_data_extent_by_index(
+	          record_entry,
+	          0,
+	          &extent_offset,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libpff_record_entry_get_value_data function
  * Returns 1 if successful or 0 if not
  */
@@ -850,16 +1025,384 @@ int pff_test_record_entry_get_value_data(
 	size_t value_data_size   = 0;
 	int result               = 0;
 
-	/* Test regular cases
-	 */
-/* TODO implement */
+	/* Test regular cases
+	 */
+/* TODO implement */
+
+	/* Test error cases
+	 */
+	result = libpff_record_entry_get_value_data(
+	          NULL,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_record_entry_get_value_data(
+	          record_entry,
+	          NULL,
+	          &value_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_record_entry_get_value_data(
+	          record_entry,
+	          &value_data,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_record_entry_set_value_data function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_record_entry_set_value_data(
+     void )
+{
+	uint8_t value_data[ 32 ];
+
+	libcerror_error_t *error            = NULL;
+	libpff_record_entry_t *record_entry = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_record_entry_initialize(
+	          &record_entry,
+	          LIBPFF_CODEPAGE_WINDOWS_1251,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_entry",
+	 record_entry );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_record_entry_set_value_data(
+	          record_entry,
+	          (uint8_t *) "test value",
+	          11,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_record_entry_set_value_data(
+	          NULL,
+	          value_data,
+	          32,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_record_entry_set_value_data(
+	          record_entry,
+	          NULL,
+	          32,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_record_entry_set_value_data(
+	          record_entry,
+	          value_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_internal_record_entry_free(
+	          (libpff_internal_record_entry_t **) &record_entry,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "record_entry",
+	 record_entry );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_entry != NULL )
+	{
+		libpff_internal_record_entry_free(
+		 (libpff_internal_record_entry_t **) &record_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_record_entry_set_value_data_list function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_record_entry_set_value_data_list(
+     void )
+{
+	uint8_t value_data_list_data[ 32 ];
+
+	libcerror_error_t *error                              = NULL;
+	libfdata_list_t *value_data_list                      = (libfdata_list_t *) value_data_list_data;
+	libpff_internal_record_entry_t *internal_record_entry = NULL;
+	libpff_io_handle_t *io_handle                         = NULL;
+	libpff_record_entry_t *record_entry                   = NULL;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = libpff_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_record_entry_initialize(
+	          &record_entry,
+	          LIBPFF_CODEPAGE_WINDOWS_1251,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_entry",
+	 record_entry );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record_entry = (libpff_internal_record_entry_t *) record_entry;
+
+	/* Test regular cases
+	 */
+	io_handle->encryption_type = LIBPFF_ENCRYPTION_TYPE_NONE;
+
+	result = libpff_record_entry_set_value_data_list(
+	          record_entry,
+	          io_handle,
+	          value_data_list,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The value data list is not a real list and should not be freed
+	 */
+	internal_record_entry->value_data_list = NULL;
+	internal_record_entry->io_handle       = NULL;
+
+	/* Test with an encrypted file
+	 */
+	io_handle->encryption_type = LIBPFF_ENCRYPTION_TYPE_COMPRESSIBLE;
+
+	result = libpff_record_entry_set_value_data_list(
+	          record_entry,
+	          io_handle,
+	          value_data_list,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->encryption_type = LIBPFF_ENCRYPTION_TYPE_NONE;
+
+	/* Test with forced decryption
+	 */
+	io_handle->force_decryption = 1;
+
+	result = libpff_record_entry_set_value_data_list(
+	          record_entry,
+	          io_handle,
+	          value_data_list,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->force_decryption = 0;
+
+	/* Test with a data block for which decryption was forced
+	 */
+	internal_record_entry->value_data_block_flags = LIBPFF_DATA_BLOCK_FLAG_DECRYPTION_FORCED;
+
+	result = libpff_record_entry_set_value_data_list(
+	          record_entry,
+	          io_handle,
+	          value_data_list,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a compressed data block
+	 */
+	internal_record_entry->value_data_block_flags = LIBPFF_DATA_BLOCK_FLAG_COMPRESSED;
+
+	result = libpff_record_entry_set_value_data_list(
+	          record_entry,
+	          io_handle,
+	          value_data_list,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record_entry->value_data_block_flags = 0;
 
 	/* Test error cases
 	 */
-	result = libpff_record_entry_get_value_data(
+	result = libpff_record_entry_set_value_data_list(
 	          NULL,
-	          &value_data,
-	          &value_data_size,
+	          io_handle,
+	          value_data_list,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -874,10 +1417,10 @@ int pff_test_record_entry_get_value_data(
 	libcerror_error_free(
 	 &error );
 
-	result = libpff_record_entry_get_value_data(
+	result = libpff_record_entry_set_value_data_list(
 	          record_entry,
 	          NULL,
-	          &value_data_size,
+	          value_data_list,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -892,9 +1435,9 @@ int pff_test_record_entry_get_value_data(
 	libcerror_error_free(
 	 &error );
 
-	result = libpff_record_entry_get_value_data(
+	result = libpff_record_entry_set_value_data_list(
 	          record_entry,
-	          &value_data,
+	          io_handle,
 	          NULL,
 	          &error );
 
@@ -910,6 +1453,42 @@ int pff_test_record_entry_get_value_data(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libpff_internal_record_entry_free(
+	          (libpff_internal_record_entry_t **) &record_entry,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "record_entry",
+	 record_entry );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -918,23 +1497,62 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( internal_record_entry != NULL )
+	{
+		internal_record_entry->value_data_list = NULL;
+	}
+	if( record_entry != NULL )
+	{
+		libpff_internal_record_entry_free(
+		 (libpff_internal_record_entry_t **) &record_entry,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libpff_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libpff_record_entry_set_value_data function
+/* Tests the libpff_internal_record_entry_get_value_data_extents function
  * Returns 1 if successful or 0 if not
  */
-int pff_test_record_entry_set_value_data(
+int pff_test_internal_record_entry_get_value_data_extents(
      void )
 {
-	uint8_t value_data[ 32 ];
-
-	libcerror_error_t *error            = NULL;
-	libpff_record_entry_t *record_entry = NULL;
-	int result                          = 0;
+	libpff_descriptor_data_extent_t value_data_extents[ 1 ];
+
+	libcerror_error_t *error                              = NULL;
+	libpff_internal_record_entry_t *internal_record_entry = NULL;
+	libpff_io_handle_t *io_handle                         = NULL;
+	libfdata_list_t *value_data_list                      = NULL;
+	libpff_record_entry_t *record_entry                   = NULL;
+	size64_t extent_size                                  = 0;
+	off64_t extent_offset                                 = 0;
+	int number_of_extents                                 = 0;
+	int result                                            = 0;
 
 	/* Initialize test
 	 */
+	result = libpff_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libpff_record_entry_initialize(
 	          &record_entry,
 	          LIBPFF_CODEPAGE_WINDOWS_1251,
@@ -953,12 +1571,47 @@ int pff_test_record_entry_set_value_data(
 	 "error",
 	 error );
 
+	internal_record_entry = (libpff_internal_record_entry_t *) record_entry;
+
+	value_data_extents[ 0 ].file_offset = 0x4400;
+	value_data_extents[ 0 ].size        = 8192;
+
 	/* Test regular cases
 	 */
-	result = libpff_record_entry_set_value_data(
+	result = libpff_internal_record_entry_get_value_data_extents(
+	          internal_record_entry,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record_entry->io_handle                    = io_handle;
+	internal_record_entry->value_data_extents           = value_data_extents;
+	internal_record_entry->number_of_value_data_extents = 1;
+	internal_record_entry->value_data_extents_available = 1;
+
+	result = libpff_internal_record_entry_get_value_data_extents(
+	          internal_record_entry,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_record_entry_get_number_of_data_extents(
 	          record_entry,
-	          (uint8_t *) "test value",
-	          11,
+	          &number_of_extents,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -966,34 +1619,173 @@ int pff_test_record_entry_set_value_data(
 	 result,
 	 1 );
 
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 1 );
+
 	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	result = libpff_record_entry_get_data_extent_by_index(
+	          record_entry,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "extent_offset",
+	 (int64_t) extent_offset,
+	 (int64_t) 0x4400 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_size",
+	 (uint64_t) extent_size,
+	 (uint64_t) 8192 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with decryption forced after the value data was read
 	 */
-	result = libpff_record_entry_set_value_data(
+	io_handle->force_decryption = 1;
+
+	result = libpff_internal_record_entry_get_value_data_extents(
+	          internal_record_entry,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_record_entry_get_number_of_data_extents(
+	          record_entry,
+	          &number_of_extents,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_record_entry_get_data_extent_by_index(
+	          record_entry,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The value data extents are not allocated and should not be freed
+	 */
+	internal_record_entry->value_data_extents           = NULL;
+	internal_record_entry->number_of_value_data_extents = 0;
+	internal_record_entry->value_data_extents_available = 0;
+
+	/* Test an empty value has 0 extents on every call
+	 */
+	io_handle->force_decryption = 0;
+
+	result = libfdata_list_initialize(
+	          &value_data_list,
 	          NULL,
-	          value_data,
-	          32,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "value_data_list",
+	 value_data_list );
+
+	PFF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	internal_record_entry->value_data_list = value_data_list;
+	value_data_list                        = NULL;
 
-	result = libpff_record_entry_set_value_data(
+	result = libpff_record_entry_get_number_of_data_extents(
 	          record_entry,
-	          NULL,
-	          32,
+	          &number_of_extents,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "internal_record_entry->value_data_list",
+	 internal_record_entry->value_data_list );
+
+	number_of_extents = -1;
+
+	result = libpff_record_entry_get_number_of_data_extents(
+	          record_entry,
+	          &number_of_extents,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_record_entry_get_data_extent_by_index(
+	          record_entry,
+	          0,
+	          &extent_offset,
+	          &extent_size,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -1008,10 +1800,10 @@ int pff_test_record_entry_set_value_data(
 	libcerror_error_free(
 	 &error );
 
-	result = libpff_record_entry_set_value_data(
-	          record_entry,
-	          value_data,
-	          (size_t) SSIZE_MAX + 1,
+	/* Test error cases
+	 */
+	result = libpff_internal_record_entry_get_value_data_extents(
+	          NULL,
 	          &error );
 
 	PFF_TEST_ASSERT_EQUAL_INT(
@@ -1045,6 +1837,23 @@ int pff_test_record_entry_set_value_data(
 	 "error",
 	 error );
 
+	result = libpff_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -1053,12 +1862,28 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( internal_record_entry != NULL )
+	{
+		internal_record_entry->value_data_extents = NULL;
+	}
+	if( value_data_list != NULL )
+	{
+		libfdata_list_free(
+		 &value_data_list,
+		 NULL );
+	}
 	if( record_entry != NULL )
 	{
 		libpff_internal_record_entry_free(
 		 (libpff_internal_record_entry_t **) &record_entry,
 		 NULL );
 	}
+	if( io_handle != NULL )
+	{
+		libpff_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -2189,6 +3014,14 @@ int main(
 
 	/* TODO: add tests for libpff_record_entry_set_value_data_from_stream */
 
+	PFF_TEST_RUN(
+	 "libpff_record_entry_set_value_data_list",
+	 pff_test_record_entry_set_value_data_list );
+
+	PFF_TEST_RUN(
+	 "libpff_internal_record_entry_get_value_data_extents",
+	 pff_test_internal_record_entry_get_value_data_extents );
+
 	/* TODO: add tests for libpff_record_entry_read_buffer */
 
 	/* TODO: add tests for libpff_record_entry_seek_offset */
@@ -2250,6 +3083,16 @@ int main(
 	 pff_test_record_entry_get_data_size,
 	 record_entry );
 
+	PFF_TEST_RUN_WITH_ARGS(
+	 "libpff_record_entry_get_number_of_data_extents",
+	 pff_test_record_entry_get_number_of_data_extents,
+	 record_entry );
+
+	PFF_TEST_RUN_WITH_ARGS(
+	 "libpff_record_entry_get_data_extent_by_index",
+	 pff_test_record_entry_get_data_extent_by_index,
+	 record_entry );
+
 	PFF_TEST_RUN_WITH_ARGS(
 	 "libpff_record_entry_get_value_data",
 	 pff_test_record_entry_get_value_data,
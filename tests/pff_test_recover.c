@@ -0,0 +1,1468 @@
+/*
+ * Library recover functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pff_test_libcerror.h"
+#include "pff_test_macros.h"
+#include "pff_test_memory.h"
+#include "pff_test_unused.h"
+
+#include "../libpff/libpff_definitions.h"
+#include "../libpff/libpff_io_handle.h"
+#include "../libpff/libpff_recover.h"
+
+#define PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS	8
+#define PFF_TEST_RECOVER_CHUNK_SIZE		4096
+
+uint8_t pff_test_recover_data[ PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS * PFF_TEST_RECOVER_CHUNK_SIZE ];
+
+uint32_t pff_test_recover_random_seed = 0x12345678UL;
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+/* Retrieves a pseudo random byte
+ * Returns the byte value
+ */
+uint8_t pff_test_recover_get_random_byte(
+         void )
+{
+	pff_test_recover_random_seed = ( pff_test_recover_random_seed * 1103515245UL ) + 12345UL;
+
+	return( (uint8_t) ( pff_test_recover_random_seed >> 16 ) );
+}
+
+/* Fills the test data with random data that contains 64-bit data block footers
+ * Every fifth block of 64 bytes has a footer with a plausible data size and back pointer
+ */
+void pff_test_recover_initialize_data(
+      void )
+{
+	uint8_t *data_block_footer = NULL;
+	size_t block_index         = 0;
+	size_t data_offset         = 0;
+
+	for( data_offset = 0;
+	     data_offset < sizeof( pff_test_recover_data );
+	     data_offset++ )
+	{
+		pff_test_recover_data[ data_offset ] = pff_test_recover_get_random_byte();
+	}
+	for( block_index = 0;
+	     block_index < ( sizeof( pff_test_recover_data ) / 64 );
+	     block_index += 5 )
+	{
+		data_block_footer = &( pff_test_recover_data[ ( block_index * 64 ) + 48 ] );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( data_block_footer[ 0 ] ),
+		 (uint16_t) ( 40 + ( block_index % 200 ) ) );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data_block_footer[ 8 ] ),
+		 (uint64_t) ( block_index + 1 ) );
+	}
+}
+
+/* Initializes the recovery scan jobs of the test data
+ */
+void pff_test_recover_initialize_scan_jobs(
+      libpff_recover_scan_job_t *scan_jobs,
+      int number_of_scan_jobs )
+{
+	off64_t chunk_offset = 0;
+	int scan_job_index   = 0;
+
+	for( scan_job_index = 0;
+	     scan_job_index < number_of_scan_jobs;
+	     scan_job_index++ )
+	{
+		chunk_offset = (off64_t) scan_job_index * PFF_TEST_RECOVER_CHUNK_SIZE;
+
+		scan_jobs[ scan_job_index ].file_type        = LIBPFF_FILE_TYPE_64BIT;
+		scan_jobs[ scan_job_index ].recovery_flags   = LIBPFF_RECOVERY_FLAG_SCAN_FOR_FRAGMENTS;
+		scan_jobs[ scan_job_index ].range_offset     = 0;
+		scan_jobs[ scan_job_index ].range_end_offset = (off64_t) sizeof( pff_test_recover_data );
+		scan_jobs[ scan_job_index ].chunk_offset     = chunk_offset;
+		scan_jobs[ scan_job_index ].chunk_end_offset = chunk_offset + PFF_TEST_RECOVER_CHUNK_SIZE;
+
+		/* The buffer contains the data of the scan range that precedes the chunk
+		 */
+		scan_jobs[ scan_job_index ].buffer           = pff_test_recover_data;
+		scan_jobs[ scan_job_index ].buffer_offset    = 0;
+		scan_jobs[ scan_job_index ].buffer_data_size = (size_t) ( chunk_offset + PFF_TEST_RECOVER_CHUNK_SIZE );
+	}
+}
+
+/* Frees the candidates of the recovery scan jobs
+ */
+void pff_test_recover_free_scan_jobs(
+      libpff_recover_scan_job_t *scan_jobs,
+      int number_of_scan_jobs )
+{
+	int scan_job_index = 0;
+
+	for( scan_job_index = 0;
+	     scan_job_index < number_of_scan_jobs;
+	     scan_job_index++ )
+	{
+		if( scan_jobs[ scan_job_index ].candidates != NULL )
+		{
+			memory_free(
+			 scan_jobs[ scan_job_index ].candidates );
+
+			scan_jobs[ scan_job_index ].candidates = NULL;
+		}
+		scan_jobs[ scan_job_index ].number_of_candidates           = 0;
+		scan_jobs[ scan_job_index ].number_of_allocated_candidates = 0;
+	}
+}
+
+/* Writes a data block footer into the test data
+ */
+void pff_test_recover_set_data_block_footer(
+      size_t block_index,
+      uint8_t file_type,
+      uint16_t data_size,
+      uint64_t back_pointer )
+{
+	uint8_t *data_block_footer = NULL;
+
+	if( file_type == LIBPFF_FILE_TYPE_32BIT )
+	{
+		data_block_footer = &( pff_test_recover_data[ ( block_index * 64 ) + 64 - 12 ] );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( data_block_footer[ 0 ] ),
+		 data_size );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data_block_footer[ 4 ] ),
+		 (uint32_t) back_pointer );
+	}
+	else
+	{
+		if( file_type == LIBPFF_FILE_TYPE_64BIT )
+		{
+			data_block_footer = &( pff_test_recover_data[ ( block_index * 64 ) + 64 - 16 ] );
+		}
+		else
+		{
+			data_block_footer = &( pff_test_recover_data[ ( block_index * 512 ) + 512 - 24 ] );
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 &( data_block_footer[ 0 ] ),
+		 data_size );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data_block_footer[ 8 ] ),
+		 back_pointer );
+	}
+}
+
+/* Tests the libpff_recover_filter_data_block_footers function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_recover_filter_data_block_footers(
+     void )
+{
+	uint8_t file_types[ 3 ] = {
+		LIBPFF_FILE_TYPE_32BIT,
+		LIBPFF_FILE_TYPE_64BIT,
+		LIBPFF_FILE_TYPE_64BIT_4K_PAGE };
+
+	libcerror_error_t *error         = NULL;
+	size_t block_index               = 0;
+	size_t data_offset               = 0;
+	size_t footer_offset             = 0;
+	size_t format_data_block_size    = 0;
+	size_t number_of_blocks          = 0;
+	uint64_t expected_footer_mask    = 0;
+	uint64_t footer_mask             = 0;
+	uint32_t maximum_data_block_size = 0;
+	int file_type_index              = 0;
+	int iteration                    = 0;
+	int result                       = 0;
+
+#if defined( LIBPFF_RECOVER_HAVE_SIMD_FOOTER_FILTER )
+	size_t number_of_tested_blocks   = 0;
+#endif
+
+	/* Test if the footers of the 64-bit format are filtered as expected
+	 */
+	for( block_index = 0;
+	     block_index < 8;
+	     block_index++ )
+	{
+		pff_test_recover_set_data_block_footer(
+		 block_index,
+		 LIBPFF_FILE_TYPE_64BIT,
+		 0,
+		 0 );
+	}
+	/* Valid footers
+	 */
+	pff_test_recover_set_data_block_footer(
+	 1,
+	 LIBPFF_FILE_TYPE_64BIT,
+	 100,
+	 1 );
+
+	pff_test_recover_set_data_block_footer(
+	 3,
+	 LIBPFF_FILE_TYPE_64BIT,
+	 8191,
+	 0xffffffffUL );
+
+	pff_test_recover_set_data_block_footer(
+	 6,
+	 LIBPFF_FILE_TYPE_64BIT,
+	 0,
+	 0x80000000UL );
+
+	/* Invalid footers: upper 32-bit of back pointer set and data size too large
+	 */
+	pff_test_recover_set_data_block_footer(
+	 2,
+	 LIBPFF_FILE_TYPE_64BIT,
+	 100,
+	 0x100000000ULL );
+
+	pff_test_recover_set_data_block_footer(
+	 4,
+	 LIBPFF_FILE_TYPE_64BIT,
+	 8192,
+	 1 );
+
+	pff_test_recover_set_data_block_footer(
+	 5,
+	 LIBPFF_FILE_TYPE_64BIT,
+	 0xffff,
+	 0x100000001ULL );
+
+	pff_test_recover_set_data_block_footer(
+	 7,
+	 LIBPFF_FILE_TYPE_64BIT,
+	 0xffff,
+	 1 );
+
+	result = libpff_recover_filter_data_block_footers(
+	          pff_test_recover_data,
+	          8 * 64,
+	          LIBPFF_FILE_TYPE_64BIT,
+	          &footer_mask,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "footer_mask",
+	 footer_mask,
+	 (uint64_t) 0x4a );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the SIMD filter matches the scalar filter for all footer layouts
+	 * on crafted and random data
+	 */
+	for( file_type_index = 0;
+	     file_type_index < 3;
+	     file_type_index++ )
+	{
+		if( file_types[ file_type_index ] == LIBPFF_FILE_TYPE_32BIT )
+		{
+			format_data_block_size  = 64;
+			footer_offset           = 64 - 12;
+			maximum_data_block_size = 8192;
+		}
+		else if( file_types[ file_type_index ] == LIBPFF_FILE_TYPE_64BIT )
+		{
+			format_data_block_size  = 64;
+			footer_offset           = 64 - 16;
+			maximum_data_block_size = 8192;
+		}
+		else
+		{
+			format_data_block_size  = 512;
+			footer_offset           = 512 - 24;
+			maximum_data_block_size = 65536;
+		}
+		for( iteration = 0;
+		     iteration < 16;
+		     iteration++ )
+		{
+			for( data_offset = 0;
+			     data_offset < sizeof( pff_test_recover_data );
+			     data_offset++ )
+			{
+				pff_test_recover_data[ data_offset ] = pff_test_recover_get_random_byte();
+			}
+			/* The first iteration uses random data only, the other iterations
+			 * contain footers of which the upper 32-bit of the back pointer are 0
+			 */
+			for( block_index = 0;
+			     block_index < 64;
+			     block_index++ )
+			{
+				if( ( iteration == 0 )
+				 || ( ( pff_test_recover_get_random_byte() % 4 ) == 0 ) )
+				{
+					continue;
+				}
+				pff_test_recover_set_data_block_footer(
+				 block_index,
+				 file_types[ file_type_index ],
+				 (uint16_t) ( ( pff_test_recover_get_random_byte() << 8 ) | pff_test_recover_get_random_byte() ) >> ( iteration % 4 ),
+				 (uint64_t) ( pff_test_recover_get_random_byte() % 3 ) << ( 8 * ( iteration % 4 ) ) );
+			}
+			for( number_of_blocks = 1;
+			     number_of_blocks <= 64;
+			     number_of_blocks++ )
+			{
+				expected_footer_mask = libpff_recover_filter_data_block_footers_scalar(
+				                        pff_test_recover_data,
+				                        0,
+				                        number_of_blocks,
+				                        format_data_block_size,
+				                        footer_offset,
+				                        file_types[ file_type_index ],
+				                        maximum_data_block_size );
+
+				result = libpff_recover_filter_data_block_footers(
+				          pff_test_recover_data,
+				          number_of_blocks * format_data_block_size,
+				          file_types[ file_type_index ],
+				          &footer_mask,
+				          &error );
+
+				PFF_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				PFF_TEST_ASSERT_EQUAL_UINT64(
+				 "footer_mask",
+				 footer_mask,
+				 expected_footer_mask );
+
+				PFF_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+#if defined( LIBPFF_RECOVER_HAVE_SIMD_FOOTER_FILTER )
+				if( ( file_types[ file_type_index ] != LIBPFF_FILE_TYPE_32BIT )
+				 && ( libpff_recover_have_sse2() != 0 ) )
+				{
+					footer_mask = libpff_recover_filter_data_block_footers_sse2(
+					               pff_test_recover_data,
+					               number_of_blocks,
+					               format_data_block_size,
+					               footer_offset,
+					               (uint16_t) ~( maximum_data_block_size - 1 ),
+					               &number_of_tested_blocks );
+
+					/* The SIMD filter tests the blocks in pairs
+					 */
+					PFF_TEST_ASSERT_EQUAL_SIZE(
+					 "number_of_tested_blocks",
+					 number_of_tested_blocks,
+					 ( number_of_blocks / 2 ) * 2 );
+
+					/* The SIMD filter should only set the bits of the blocks it tested
+					 */
+					if( number_of_tested_blocks < 64 )
+					{
+						expected_footer_mask &= ( (uint64_t) 1 << number_of_tested_blocks ) - 1;
+					}
+					PFF_TEST_ASSERT_EQUAL_UINT64(
+					 "footer_mask",
+					 footer_mask,
+					 expected_footer_mask );
+				}
+#endif
+			}
+		}
+	}
+	/* Test error cases
+	 */
+	result = libpff_recover_filter_data_block_footers(
+	          NULL,
+	          64,
+	          LIBPFF_FILE_TYPE_64BIT,
+	          &footer_mask,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_recover_filter_data_block_footers(
+	          pff_test_recover_data,
+	          64,
+	          0xff,
+	          &footer_mask,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_recover_filter_data_block_footers(
+	          pff_test_recover_data,
+	          64,
+	          LIBPFF_FILE_TYPE_64BIT,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_recover_filter_data_block_footers(
+	          pff_test_recover_data,
+	          65 * 64,
+	          LIBPFF_FILE_TYPE_64BIT,
+	          &footer_mask,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_recover_scan_thread_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_recover_scan_thread_pool_initialize(
+     void )
+{
+	libcerror_error_t *error                            = NULL;
+	libpff_recover_scan_thread_pool_t *scan_thread_pool = NULL;
+	int result                                          = 0;
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+	int number_of_malloc_fail_tests                     = 1;
+	int number_of_memset_fail_tests                     = 1;
+	int test_number                                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libpff_recover_scan_thread_pool_initialize(
+	          &scan_thread_pool,
+	          4,
+	          8,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_thread_pool",
+	 scan_thread_pool );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_recover_scan_thread_pool_free(
+	          &scan_thread_pool,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "scan_thread_pool",
+	 scan_thread_pool );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_recover_scan_thread_pool_initialize(
+	          NULL,
+	          4,
+	          8,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	scan_thread_pool = (libpff_recover_scan_thread_pool_t *) 0x12345678UL;
+
+	result = libpff_recover_scan_thread_pool_initialize(
+	          &scan_thread_pool,
+	          4,
+	          8,
+	          &error );
+
+	scan_thread_pool = NULL;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_recover_scan_thread_pool_initialize(
+	          &scan_thread_pool,
+	          0,
+	          8,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_recover_scan_thread_pool_initialize(
+	          &scan_thread_pool,
+	          LIBPFF_MAXIMUM_NUMBER_OF_RECOVER_SCAN_JOBS + 1,
+	          8,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_recover_scan_thread_pool_initialize(
+	          &scan_thread_pool,
+	          4,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_recover_scan_thread_pool_free(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libpff_recover_scan_thread_pool_initialize with malloc failing
+		 */
+		pff_test_malloc_attempts_before_fail = test_number;
+
+		result = libpff_recover_scan_thread_pool_initialize(
+		          &scan_thread_pool,
+		          4,
+		          8,
+		          &error );
+
+		if( pff_test_malloc_attempts_before_fail != -1 )
+		{
+			pff_test_malloc_attempts_before_fail = -1;
+
+			if( scan_thread_pool != NULL )
+			{
+				libpff_recover_scan_thread_pool_free(
+				 &scan_thread_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "scan_thread_pool",
+			 scan_thread_pool );
+
+			PFF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libpff_recover_scan_thread_pool_initialize with memset failing
+		 */
+		pff_test_memset_attempts_before_fail = test_number;
+
+		result = libpff_recover_scan_thread_pool_initialize(
+		          &scan_thread_pool,
+		          4,
+		          8,
+		          &error );
+
+		if( pff_test_memset_attempts_before_fail != -1 )
+		{
+			pff_test_memset_attempts_before_fail = -1;
+
+			if( scan_thread_pool != NULL )
+			{
+				libpff_recover_scan_thread_pool_free(
+				 &scan_thread_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "scan_thread_pool",
+			 scan_thread_pool );
+
+			PFF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_PFF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_thread_pool != NULL )
+	{
+		libpff_recover_scan_thread_pool_free(
+		 &scan_thread_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_recover_scan_jobs_start and libpff_recover_scan_jobs_wait functions
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_recover_scan_jobs_start(
+     void )
+{
+	libpff_recover_scan_job_t scan_jobs[ PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS ];
+	libpff_recover_scan_job_t threaded_scan_jobs[ PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS ];
+
+	libpff_recover_scan_candidate_t *candidate          = NULL;
+	libpff_recover_scan_candidate_t *threaded_candidate = NULL;
+	libcerror_error_t *error                            = NULL;
+	libpff_recover_scan_thread_pool_t *scan_thread_pool = NULL;
+	int candidate_index                                 = 0;
+	int number_of_candidates                            = 0;
+	int result                                          = 0;
+	int scan_job_index                                  = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     scan_jobs,
+	     0,
+	     sizeof( libpff_recover_scan_job_t ) * PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS ) == NULL )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     threaded_scan_jobs,
+	     0,
+	     sizeof( libpff_recover_scan_job_t ) * PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS ) == NULL )
+	{
+		return( 0 );
+	}
+	result = libpff_recover_scan_thread_pool_initialize(
+	          &scan_thread_pool,
+	          4,
+	          PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_thread_pool",
+	 scan_thread_pool );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	pff_test_recover_initialize_data();
+
+	/* Test regular cases
+	 */
+	pff_test_recover_initialize_scan_jobs(
+	 scan_jobs,
+	 PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS );
+
+	result = libpff_recover_scan_jobs_start(
+	          NULL,
+	          scan_jobs,
+	          PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_recover_scan_jobs_wait(
+	          NULL,
+	          scan_jobs,
+	          PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if scanning the chunks with the thread pool results in the same candidates
+	 * in the same order as scanning them with the calling thread. The chunks are started
+	 * in 2 batches, where the second batch is started before the first batch is waited for
+	 */
+	pff_test_recover_initialize_scan_jobs(
+	 threaded_scan_jobs,
+	 PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS );
+
+	result = libpff_recover_scan_jobs_start(
+	          scan_thread_pool,
+	          threaded_scan_jobs,
+	          PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS / 2,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_recover_scan_jobs_start(
+	          scan_thread_pool,
+	          &( threaded_scan_jobs[ PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS / 2 ] ),
+	          PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS / 2,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_recover_scan_jobs_wait(
+	          scan_thread_pool,
+	          threaded_scan_jobs,
+	          PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS / 2,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_recover_scan_jobs_wait(
+	          scan_thread_pool,
+	          &( threaded_scan_jobs[ PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS / 2 ] ),
+	          PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS / 2,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( scan_job_index = 0;
+	     scan_job_index < PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS;
+	     scan_job_index++ )
+	{
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "threaded_scan_jobs[ scan_job_index ].is_pending",
+		 threaded_scan_jobs[ scan_job_index ].is_pending,
+		 0 );
+
+		PFF_TEST_ASSERT_EQUAL_INT(
+		 "threaded_scan_jobs[ scan_job_index ].number_of_candidates",
+		 threaded_scan_jobs[ scan_job_index ].number_of_candidates,
+		 scan_jobs[ scan_job_index ].number_of_candidates );
+
+		for( candidate_index = 0;
+		     candidate_index < scan_jobs[ scan_job_index ].number_of_candidates;
+		     candidate_index++ )
+		{
+			candidate          = &( scan_jobs[ scan_job_index ].candidates[ candidate_index ] );
+			threaded_candidate = &( threaded_scan_jobs[ scan_job_index ].candidates[ candidate_index ] );
+
+			PFF_TEST_ASSERT_EQUAL_UINT8(
+			 "threaded_candidate->type",
+			 threaded_candidate->type,
+			 candidate->type );
+
+			PFF_TEST_ASSERT_EQUAL_INT64(
+			 "threaded_candidate->offset",
+			 (int64_t) threaded_candidate->offset,
+			 (int64_t) candidate->offset );
+
+			PFF_TEST_ASSERT_EQUAL_UINT64(
+			 "threaded_candidate->data_block_back_pointer",
+			 threaded_candidate->data_block_back_pointer,
+			 candidate->data_block_back_pointer );
+
+			PFF_TEST_ASSERT_EQUAL_INT64(
+			 "threaded_candidate->data_block_data_offset",
+			 (int64_t) threaded_candidate->data_block_data_offset,
+			 (int64_t) candidate->data_block_data_offset );
+
+			PFF_TEST_ASSERT_EQUAL_UINT16(
+			 "threaded_candidate->data_block_data_size",
+			 threaded_candidate->data_block_data_size,
+			 candidate->data_block_data_size );
+
+			PFF_TEST_ASSERT_EQUAL_UINT32(
+			 "threaded_candidate->data_block_stored_checksum",
+			 threaded_candidate->data_block_stored_checksum,
+			 candidate->data_block_stored_checksum );
+
+			PFF_TEST_ASSERT_EQUAL_UINT32(
+			 "threaded_candidate->data_block_calculated_checksum",
+			 threaded_candidate->data_block_calculated_checksum,
+			 candidate->data_block_calculated_checksum );
+
+			/* The candidates of a chunk are ordered by offset
+			 */
+			if( candidate_index > 0 )
+			{
+				PFF_TEST_ASSERT_GREATER_THAN_INT(
+				 "candidate->offset",
+				 (int) candidate->offset,
+				 (int) scan_jobs[ scan_job_index ].candidates[ candidate_index - 1 ].offset );
+			}
+		}
+		number_of_candidates += scan_jobs[ scan_job_index ].number_of_candidates;
+	}
+	/* Every fifth block of the test data contains a data block footer
+	 */
+	PFF_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_candidates",
+	 number_of_candidates,
+	 0 );
+
+	pff_test_recover_free_scan_jobs(
+	 threaded_scan_jobs,
+	 PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS );
+
+	/* Test error cases
+	 */
+	result = libpff_recover_scan_jobs_start(
+	          scan_thread_pool,
+	          NULL,
+	          PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_recover_scan_jobs_start(
+	          scan_thread_pool,
+	          scan_jobs,
+	          -1,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_recover_scan_jobs_wait(
+	          scan_thread_pool,
+	          NULL,
+	          PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_recover_scan_jobs_wait(
+	          scan_thread_pool,
+	          scan_jobs,
+	          LIBPFF_MAXIMUM_NUMBER_OF_RECOVER_SCAN_JOBS + 1,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test if the error of a scan job is passed on
+	 */
+	scan_jobs[ 1 ].file_type = 0;
+
+	result = libpff_recover_scan_jobs_start(
+	          scan_thread_pool,
+	          scan_jobs,
+	          PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_recover_scan_jobs_wait(
+	          scan_thread_pool,
+	          scan_jobs,
+	          PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	          LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "scan_jobs[ 1 ].error",
+	 scan_jobs[ 1 ].error );
+
+	/* Clean up
+	 */
+	pff_test_recover_free_scan_jobs(
+	 scan_jobs,
+	 PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS );
+
+	result = libpff_recover_scan_thread_pool_free(
+	          &scan_thread_pool,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "scan_thread_pool",
+	 scan_thread_pool );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_thread_pool != NULL )
+	{
+		libpff_recover_scan_jobs_wait(
+		 scan_thread_pool,
+		 threaded_scan_jobs,
+		 PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS,
+		 NULL );
+
+		libpff_recover_scan_jobs_wait(
+		 scan_thread_pool,
+		 scan_jobs,
+		 PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS,
+		 NULL );
+
+		libpff_recover_scan_thread_pool_free(
+		 &scan_thread_pool,
+		 NULL );
+	}
+	pff_test_recover_free_scan_jobs(
+	 threaded_scan_jobs,
+	 PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS );
+
+	pff_test_recover_free_scan_jobs(
+	 scan_jobs,
+	 PFF_TEST_RECOVER_NUMBER_OF_SCAN_JOBS );
+
+	return( 0 );
+}
+
+/* Tests the libpff_recover_merge_scan_candidates function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_recover_merge_scan_candidates(
+     void )
+{
+	libpff_recover_scan_job_t scan_jobs[ 1 ];
+
+	libcerror_error_t *error      = NULL;
+	libpff_io_handle_t *io_handle = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     scan_jobs,
+	     0,
+	     sizeof( libpff_recover_scan_job_t ) ) == NULL )
+	{
+		return( 0 );
+	}
+	result = libpff_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_recover_merge_scan_candidates(
+	          io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          scan_jobs,
+	          0,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_recover_merge_scan_candidates(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          scan_jobs,
+	          1,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_recover_merge_scan_candidates(
+	          io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          1,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_recover_merge_scan_candidates(
+	          io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          scan_jobs,
+	          LIBPFF_MAXIMUM_NUMBER_OF_RECOVER_SCAN_JOBS + 1,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test if an abort is reported as such
+	 */
+	io_handle->abort = 1;
+
+	result = libpff_recover_merge_scan_candidates(
+	          io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          scan_jobs,
+	          1,
+	          0,
+	          &error );
+
+	io_handle->abort = 0;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	          LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libpff_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc PFF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] PFF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc PFF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] PFF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	PFF_TEST_UNREFERENCED_PARAMETER( argc )
+	PFF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+	/* TODO: add tests for libpff_recover_items */
+
+	/* TODO: add tests for libpff_recover_data_blocks */
+
+	PFF_TEST_RUN(
+	 "libpff_recover_filter_data_block_footers",
+	 pff_test_recover_filter_data_block_footers );
+
+	PFF_TEST_RUN(
+	 "libpff_recover_scan_thread_pool_initialize",
+	 pff_test_recover_scan_thread_pool_initialize );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	/* TODO: add tests for libpff_recover_scan_job_callback */
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	PFF_TEST_RUN(
+	 "libpff_recover_scan_jobs_start",
+	 pff_test_recover_scan_jobs_start );
+
+	PFF_TEST_RUN(
+	 "libpff_recover_merge_scan_candidates",
+	 pff_test_recover_merge_scan_candidates );
+
+	/* TODO: add tests for libpff_recover_complete_scan_jobs */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,2397 @@
+/*
+ * Library recover_checkpoint type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pff_test_libbfio.h"
+#include "pff_test_libcdata.h"
+#include "pff_test_libcerror.h"
+#include "pff_test_libpff.h"
+#include "pff_test_macros.h"
+#include "pff_test_memory.h"
+#include "pff_test_unused.h"
+
+#include "../libpff/libpff_definitions.h"
+#include "../libpff/libpff_descriptors_index.h"
+#include "../libpff/libpff_index.h"
+#include "../libpff/libpff_index_value.h"
+#include "../libpff/libpff_item_descriptor.h"
+#include "../libpff/libpff_item_tree.h"
+#include "../libpff/libpff_offsets_index.h"
+#include "../libpff/libpff_recover_checkpoint.h"
+
+#include "../libpff/pff_recover_checkpoint.h"
+
+#define PFF_TEST_RECOVER_CHECKPOINT_NUMBER_OF_INDEX_VALUES	3
+#define PFF_TEST_RECOVER_CHECKPOINT_NUMBER_OF_ITEMS		2
+#define PFF_TEST_RECOVER_CHECKPOINT_FILE_SIZE			0x00100000UL
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+/* Creates a descriptors and an offsets index that contain recovered index values
+ * Returns 1 if successful or -1 on error
+ */
+int pff_test_recover_checkpoint_initialize_indexes(
+     libpff_descriptors_index_t **descriptors_index,
+     libpff_offsets_index_t **offsets_index,
+     int number_of_index_values,
+     libcerror_error_t **error )
+{
+	libpff_index_value_t *index_value = NULL;
+	int value_index                   = 0;
+
+	if( libpff_descriptors_index_initialize(
+	     descriptors_index,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libpff_offsets_index_initialize(
+	     offsets_index,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < number_of_index_values;
+	     value_index++ )
+	{
+		if( libpff_index_value_initialize(
+		     &index_value,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		index_value->identifier                   = 0x00200021UL + ( (uint64_t) value_index * 0x20 );
+		index_value->data_identifier              = 0x00000040UL + ( (uint64_t) value_index * 4 );
+		index_value->local_descriptors_identifier = 0x00000062UL + ( (uint64_t) value_index * 4 );
+		index_value->parent_identifier            = 0x00008082UL;
+
+		if( libpff_descriptors_index_insert_recovered_index_value(
+		     *descriptors_index,
+		     index_value,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		index_value = NULL;
+
+		if( libpff_index_value_initialize(
+		     &index_value,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		index_value->identifier      = 0x00000040UL + ( (uint64_t) value_index * 4 );
+		index_value->file_offset     = 0x00004400UL + ( (off64_t) value_index * 512 );
+		index_value->data_size       = 128 + (size32_t) value_index;
+		index_value->reference_count = 2;
+
+		if( libpff_offsets_index_insert_recovered_index_value(
+		     *offsets_index,
+		     index_value,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		index_value = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( index_value != NULL )
+	{
+		libpff_index_value_free(
+		 &index_value,
+		 NULL );
+	}
+	if( *offsets_index != NULL )
+	{
+		libpff_offsets_index_free(
+		 offsets_index,
+		 NULL );
+	}
+	if( *descriptors_index != NULL )
+	{
+		libpff_descriptors_index_free(
+		 descriptors_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a recovered item array that contains recovered items
+ * Returns 1 if successful or -1 on error
+ */
+int pff_test_recover_checkpoint_initialize_recovered_items(
+     libcdata_array_t **recovered_item_array,
+     int number_of_items,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *item_tree_node      = NULL;
+	libpff_item_descriptor_t *item_descriptor = NULL;
+	int entry_index                           = 0;
+	int item_index                            = 0;
+
+	if( libcdata_array_initialize(
+	     recovered_item_array,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( libpff_item_descriptor_initialize(
+		     &item_descriptor,
+		     0x00200021UL + ( (uint32_t) item_index * 0x20 ),
+		     0x00000040UL + ( (uint64_t) item_index * 4 ),
+		     0x00000062UL + ( (uint64_t) item_index * 4 ),
+		     1,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		item_descriptor->recovered_data_identifier_value_index              = item_index;
+		item_descriptor->recovered_local_descriptors_identifier_value_index = 0;
+
+		if( libcdata_tree_node_initialize(
+		     &item_tree_node,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libcdata_tree_node_set_value(
+		     item_tree_node,
+		     (intptr_t *) item_descriptor,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		item_descriptor = NULL;
+
+		if( libcdata_array_append_entry(
+		     *recovered_item_array,
+		     &entry_index,
+		     (intptr_t *) item_tree_node,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		item_tree_node = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( item_tree_node != NULL )
+	{
+		libpff_item_tree_node_free_recovered(
+		 &item_tree_node,
+		 NULL );
+	}
+	if( item_descriptor != NULL )
+	{
+		libpff_item_descriptor_free(
+		 &item_descriptor,
+		 NULL );
+	}
+	if( *recovered_item_array != NULL )
+	{
+		libcdata_array_free(
+		 recovered_item_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libpff_item_tree_node_free_recovered,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates the data of a recovery checkpoint
+ * Returns 1 if successful or -1 on error
+ */
+int pff_test_recover_checkpoint_initialize_data(
+     uint8_t flags,
+     uint32_t sequence_number,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *recovered_item_array        = NULL;
+	libpff_descriptors_index_t *descriptors_index = NULL;
+	libpff_offsets_index_t *offsets_index         = NULL;
+	libpff_recover_checkpoint_t *checkpoint       = NULL;
+
+	if( pff_test_recover_checkpoint_initialize_indexes(
+	     &descriptors_index,
+	     &offsets_index,
+	     PFF_TEST_RECOVER_CHECKPOINT_NUMBER_OF_INDEX_VALUES,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ( flags & LIBPFF_RECOVER_CHECKPOINT_FLAG_ITEMS_ANALYZED ) != 0 )
+	{
+		if( pff_test_recover_checkpoint_initialize_recovered_items(
+		     &recovered_item_array,
+		     PFF_TEST_RECOVER_CHECKPOINT_NUMBER_OF_ITEMS,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libpff_recover_checkpoint_initialize(
+	     &checkpoint,
+	     (libbfio_handle_t *) 0x12345678UL,
+	     NULL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libpff_recover_checkpoint_set_scan_parameters(
+	     checkpoint,
+	     LIBPFF_FILE_TYPE_64BIT,
+	     LIBPFF_RECOVERY_FLAG_IGNORE_ALLOCATION_DATA,
+	     PFF_TEST_RECOVER_CHECKPOINT_FILE_SIZE,
+	     12,
+	     3,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	checkpoint->flags                    = flags;
+	checkpoint->number_of_scanned_chunks = 5 + (uint64_t) sequence_number;
+	checkpoint->scan_offset              = (off64_t) checkpoint->number_of_scanned_chunks * 0x00010000UL;
+	checkpoint->sequence_number          = sequence_number;
+
+	if( libpff_recover_checkpoint_get_data_size(
+	     checkpoint,
+	     descriptors_index,
+	     offsets_index,
+	     recovered_item_array,
+	     data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	*data = (uint8_t *) memory_allocate(
+	                     sizeof( uint8_t ) * *data_size );
+
+	if( *data == NULL )
+	{
+		goto on_error;
+	}
+	if( libpff_recover_checkpoint_write_data(
+	     checkpoint,
+	     descriptors_index,
+	     offsets_index,
+	     recovered_item_array,
+	     *data,
+	     *data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libpff_recover_checkpoint_free(
+	     &checkpoint,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( recovered_item_array != NULL )
+	{
+		if( libcdata_array_free(
+		     &recovered_item_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libpff_item_tree_node_free_recovered,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libpff_offsets_index_free(
+	     &offsets_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libpff_descriptors_index_free(
+	     &descriptors_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *data != NULL )
+	{
+		memory_free(
+		 *data );
+
+		*data = NULL;
+	}
+	if( checkpoint != NULL )
+	{
+		libpff_recover_checkpoint_free(
+		 &checkpoint,
+		 NULL );
+	}
+	if( recovered_item_array != NULL )
+	{
+		libcdata_array_free(
+		 &recovered_item_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libpff_item_tree_node_free_recovered,
+		 NULL );
+	}
+	if( offsets_index != NULL )
+	{
+		libpff_offsets_index_free(
+		 &offsets_index,
+		 NULL );
+	}
+	if( descriptors_index != NULL )
+	{
+		libpff_descriptors_index_free(
+		 &descriptors_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libpff_recover_checkpoint_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_recover_checkpoint_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libpff_recover_checkpoint_t *checkpoint = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 1;
+	int number_of_memset_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libpff_recover_checkpoint_initialize(
+	          &checkpoint,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          (libbfio_handle_t *) 0x87654321UL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "checkpoint",
+	 checkpoint );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "checkpoint->file_io_handle_index",
+	 checkpoint->file_io_handle_index,
+	 -1 );
+
+	result = libpff_recover_checkpoint_free(
+	          &checkpoint,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "checkpoint",
+	 checkpoint );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_recover_checkpoint_initialize(
+	          NULL,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	checkpoint = (libpff_recover_checkpoint_t *) 0x12345678UL;
+
+	result = libpff_recover_checkpoint_initialize(
+	          &checkpoint,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          NULL,
+	          &error );
+
+	checkpoint = NULL;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_recover_checkpoint_initialize(
+	          &checkpoint,
+	          NULL,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_PFF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libpff_recover_checkpoint_initialize with malloc failing
+		 */
+		pff_test_malloc_attempts_before_fail = test_number;
+
+		result = libpff_recover_checkpoint_initialize(
+		          &checkpoint,
+		          (libbfio_handle_t *) 0x12345678UL,
+		          NULL,
+		          &error );
+
+		if( pff_test_malloc_attempts_before_fail != -1 )
+		{
+			pff_test_malloc_attempts_before_fail = -1;
+
+			if( checkpoint != NULL )
+			{
+				libpff_recover_checkpoint_free(
+				 &checkpoint,
+				 NULL );
+			}
+		}
+		else
+		{
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "checkpoint",
+			 checkpoint );
+
+			PFF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libpff_recover_checkpoint_initialize with memset failing
+		 */
+		pff_test_memset_attempts_before_fail = test_number;
+
+		result = libpff_recover_checkpoint_initialize(
+		          &checkpoint,
+		          (libbfio_handle_t *) 0x12345678UL,
+		          NULL,
+		          &error );
+
+		if( pff_test_memset_attempts_before_fail != -1 )
+		{
+			pff_test_memset_attempts_before_fail = -1;
+
+			if( checkpoint != NULL )
+			{
+				libpff_recover_checkpoint_free(
+				 &checkpoint,
+				 NULL );
+			}
+		}
+		else
+		{
+			PFF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			PFF_TEST_ASSERT_IS_NULL(
+			 "checkpoint",
+			 checkpoint );
+
+			PFF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_PFF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( checkpoint != NULL )
+	{
+		libpff_recover_checkpoint_free(
+		 &checkpoint,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_recover_checkpoint_free function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_recover_checkpoint_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libpff_recover_checkpoint_free(
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_recover_checkpoint_check_data function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_recover_checkpoint_check_data(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	size_t data_size         = 0;
+	uint32_t sequence_number = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = pff_test_recover_checkpoint_initialize_data(
+	          LIBPFF_RECOVER_CHECKPOINT_FLAG_SCAN_COMPLETED | LIBPFF_RECOVER_CHECKPOINT_FLAG_ITEMS_ANALYZED,
+	          7,
+	          &data,
+	          &data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_recover_checkpoint_check_data(
+	          data,
+	          data_size,
+	          &sequence_number,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT32(
+	 "sequence_number",
+	 sequence_number,
+	 (uint32_t) 7 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_recover_checkpoint_check_data(
+	          NULL,
+	          data_size,
+	          &sequence_number,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_recover_checkpoint_check_data(
+	          data,
+	          data_size,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test check data with a truncated header
+	 */
+	result = libpff_recover_checkpoint_check_data(
+	          data,
+	          sizeof( pff_recover_checkpoint_header_t ) - 1,
+	          &sequence_number,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test check data with truncated index values
+	 */
+	result = libpff_recover_checkpoint_check_data(
+	          data,
+	          data_size - 1,
+	          &sequence_number,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	          LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test check data with an invalid signature
+	 */
+	data[ 0 ] = 'X';
+
+	result = libpff_recover_checkpoint_check_data(
+	          data,
+	          data_size,
+	          &sequence_number,
+	          &error );
+
+	data[ 0 ] = 'P';
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test check data with an unsupported format version
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->format_version,
+	 LIBPFF_RECOVER_CHECKPOINT_FORMAT_VERSION + 1 );
+
+	result = libpff_recover_checkpoint_check_data(
+	          data,
+	          data_size,
+	          &sequence_number,
+	          &error );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) data )->format_version,
+	 LIBPFF_RECOVER_CHECKPOINT_FORMAT_VERSION );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test check data with a corrupted index value
+	 */
+	data[ sizeof( pff_recover_checkpoint_header_t ) ] ^= 0xff;
+
+	result = libpff_recover_checkpoint_check_data(
+	          data,
+	          data_size,
+	          &sequence_number,
+	          &error );
+
+	data[ sizeof( pff_recover_checkpoint_header_t ) ] ^= 0xff;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_INPUT,
+	          LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libpff_recover_checkpoint_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_recover_checkpoint_read_data(
+     void )
+{
+	libcdata_array_t *recovered_item_array        = NULL;
+	libcdata_tree_node_t *item_tree_node          = NULL;
+	libcerror_error_t *error                      = NULL;
+	libpff_descriptors_index_t *descriptors_index = NULL;
+	libpff_item_descriptor_t *item_descriptor     = NULL;
+	libpff_offsets_index_t *offsets_index         = NULL;
+	libpff_recover_checkpoint_t *checkpoint       = NULL;
+	uint8_t *data                                 = NULL;
+	uint8_t *scan_data                            = NULL;
+	size_t data_size                              = 0;
+	size_t scan_data_size                         = 0;
+	uint32_t number_of_recovered_items            = 0;
+	int number_of_entries                         = 0;
+	int number_of_values                          = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = pff_test_recover_checkpoint_initialize_data(
+	          LIBPFF_RECOVER_CHECKPOINT_FLAG_SCAN_COMPLETED | LIBPFF_RECOVER_CHECKPOINT_FLAG_ITEMS_ANALYZED,
+	          7,
+	          &data,
+	          &data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_recover_checkpoint_initialize_data(
+	          LIBPFF_RECOVER_CHECKPOINT_FLAG_SCAN_COMPLETED,
+	          3,
+	          &scan_data,
+	          &scan_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_recover_checkpoint_initialize_indexes(
+	          &descriptors_index,
+	          &offsets_index,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &recovered_item_array,
+	          0,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_recover_checkpoint_initialize(
+	          &checkpoint,
+	          (libbfio_handle_t *) 0x12345678UL,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_recover_checkpoint_set_file_parameters(
+	          checkpoint,
+	          LIBPFF_FILE_TYPE_64BIT,
+	          PFF_TEST_RECOVER_CHECKPOINT_FILE_SIZE,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libpff_recover_checkpoint_read_data(
+	          checkpoint,
+	          descriptors_index,
+	          offsets_index,
+	          recovered_item_array,
+	          data,
+	          data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "checkpoint->is_restored",
+	 checkpoint->is_restored,
+	 (uint8_t) 1 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "checkpoint->file_type",
+	 checkpoint->file_type,
+	 (uint8_t) LIBPFF_FILE_TYPE_64BIT );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "checkpoint->recovery_flags",
+	 checkpoint->recovery_flags,
+	 (uint8_t) LIBPFF_RECOVERY_FLAG_IGNORE_ALLOCATION_DATA );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "checkpoint->flags",
+	 checkpoint->flags,
+	 (uint8_t) ( LIBPFF_RECOVER_CHECKPOINT_FLAG_SCAN_COMPLETED | LIBPFF_RECOVER_CHECKPOINT_FLAG_ITEMS_ANALYZED ) );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "checkpoint->file_size",
+	 (uint64_t) checkpoint->file_size,
+	 (uint64_t) PFF_TEST_RECOVER_CHECKPOINT_FILE_SIZE );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "checkpoint->number_of_unallocated_data_blocks",
+	 checkpoint->number_of_unallocated_data_blocks,
+	 12 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "checkpoint->number_of_unallocated_page_blocks",
+	 checkpoint->number_of_unallocated_page_blocks,
+	 3 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "checkpoint->number_of_scanned_chunks",
+	 checkpoint->number_of_scanned_chunks,
+	 (uint64_t) 12 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "checkpoint->number_of_written_chunks",
+	 checkpoint->number_of_written_chunks,
+	 (uint64_t) 12 );
+
+	PFF_TEST_ASSERT_EQUAL_INT64(
+	 "checkpoint->scan_offset",
+	 (int64_t) checkpoint->scan_offset,
+	 (int64_t) 0x000c0000L );
+
+	PFF_TEST_ASSERT_EQUAL_UINT32(
+	 "checkpoint->sequence_number",
+	 checkpoint->sequence_number,
+	 (uint32_t) 7 );
+
+	result = libcdata_btree_get_number_of_values(
+	          descriptors_index->recovered_index_values_tree,
+	          &number_of_values,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 PFF_TEST_RECOVER_CHECKPOINT_NUMBER_OF_INDEX_VALUES );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_btree_get_number_of_values(
+	          offsets_index->recovered_index_values_tree,
+	          &number_of_values,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 PFF_TEST_RECOVER_CHECKPOINT_NUMBER_OF_INDEX_VALUES );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          recovered_item_array,
+	          &number_of_entries,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 PFF_TEST_RECOVER_CHECKPOINT_NUMBER_OF_ITEMS );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_entry_by_index(
+	          recovered_item_array,
+	          1,
+	          (intptr_t **) &item_tree_node,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_tree_node_get_value(
+	          item_tree_node,
+	          (intptr_t **) &item_descriptor,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_descriptor",
+	 item_descriptor );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_UINT32(
+	 "item_descriptor->descriptor_identifier",
+	 item_descriptor->descriptor_identifier,
+	 (uint32_t) 0x00200041UL );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "item_descriptor->data_identifier",
+	 item_descriptor->data_identifier,
+	 (uint64_t) 0x00000044UL );
+
+	PFF_TEST_ASSERT_EQUAL_UINT64(
+	 "item_descriptor->local_descriptors_identifier",
+	 item_descriptor->local_descriptors_identifier,
+	 (uint64_t) 0x00000066UL );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "item_descriptor->recovered",
+	 item_descriptor->recovered,
+	 (uint8_t) 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "item_descriptor->recovered_data_identifier_value_index",
+	 item_descriptor->recovered_data_identifier_value_index,
+	 1 );
+
+	/* Test read data of a checkpoint of a file with different index root nodes
+	 */
+	offsets_index->index->root_node_back_pointer += 1;
+
+	result = libpff_recover_checkpoint_read_data(
+	          checkpoint,
+	          descriptors_index,
+	          offsets_index,
+	          NULL,
+	          data,
+	          data_size,
+	          &error );
+
+	offsets_index->index->root_node_back_pointer -= 1;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_INPUT,
+	          LIBCERROR_INPUT_ERROR_VALUE_MISMATCH );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read data with recovered index values already set
+	 */
+	result = libpff_recover_checkpoint_read_data(
+	          checkpoint,
+	          descriptors_index,
+	          offsets_index,
+	          NULL,
+	          data,
+	          data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	          LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read data after the recovered index values were emptied
+	 */
+	result = libpff_descriptors_index_empty_recovered_index_values(
+	          descriptors_index,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_offsets_index_empty_recovered_index_values(
+	          offsets_index,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_recover_checkpoint_read_data(
+	          checkpoint,
+	          descriptors_index,
+	          offsets_index,
+	          NULL,
+	          scan_data,
+	          scan_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	PFF_TEST_ASSERT_EQUAL_UINT8(
+	 "checkpoint->flags",
+	 checkpoint->flags,
+	 (uint8_t) LIBPFF_RECOVER_CHECKPOINT_FLAG_SCAN_COMPLETED );
+
+	PFF_TEST_ASSERT_EQUAL_UINT32(
+	 "checkpoint->sequence_number",
+	 checkpoint->sequence_number,
+	 (uint32_t) 3 );
+
+	/* Test the scan parameters of the restored checkpoint
+	 */
+	result = libpff_recover_checkpoint_set_scan_parameters(
+	          checkpoint,
+	          LIBPFF_FILE_TYPE_64BIT,
+	          LIBPFF_RECOVERY_FLAG_IGNORE_ALLOCATION_DATA,
+	          PFF_TEST_RECOVER_CHECKPOINT_FILE_SIZE,
+	          12,
+	          3,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_recover_checkpoint_set_scan_parameters(
+	          checkpoint,
+	          LIBPFF_FILE_TYPE_64BIT,
+	          LIBPFF_RECOVERY_FLAG_SCAN_FOR_FRAGMENTS,
+	          PFF_TEST_RECOVER_CHECKPOINT_FILE_SIZE,
+	          12,
+	          3,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_INPUT,
+	          LIBCERROR_INPUT_ERROR_VALUE_MISMATCH );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_descriptors_index_empty_recovered_index_values(
+	          descriptors_index,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_offsets_index_empty_recovered_index_values(
+	          offsets_index,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read data of a checkpoint without recovered items into a recovered item array
+	 */
+	result = libpff_recover_checkpoint_read_data(
+	          checkpoint,
+	          descriptors_index,
+	          offsets_index,
+	          recovered_item_array,
+	          scan_data,
+	          scan_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_INPUT,
+	          LIBCERROR_INPUT_ERROR_VALUE_MISMATCH );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read data of a checkpoint of a file with a different size
+	 */
+	checkpoint->file_size = PFF_TEST_RECOVER_CHECKPOINT_FILE_SIZE + 512;
+
+	result = libpff_recover_checkpoint_read_data(
+	          checkpoint,
+	          descriptors_index,
+	          offsets_index,
+	          NULL,
+	          scan_data,
+	          scan_data_size,
+	          &error );
+
+	checkpoint->file_size = PFF_TEST_RECOVER_CHECKPOINT_FILE_SIZE;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_INPUT,
+	          LIBCERROR_INPUT_ERROR_VALUE_MISMATCH );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read data with a number of recovered items that does not match the data size
+	 */
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) scan_data )->number_of_recovered_items,
+	 number_of_recovered_items );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) scan_data )->number_of_recovered_items,
+	 number_of_recovered_items + 1 );
+
+	result = libpff_recover_checkpoint_read_data(
+	          checkpoint,
+	          descriptors_index,
+	          offsets_index,
+	          NULL,
+	          scan_data,
+	          scan_data_size,
+	          &error );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (pff_recover_checkpoint_header_t *) scan_data )->number_of_recovered_items,
+	 number_of_recovered_items );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	          LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read data of a truncated checkpoint
+	 */
+	result = libpff_recover_checkpoint_read_data(
+	          checkpoint,
+	          descriptors_index,
+	          offsets_index,
+	          NULL,
+	          scan_data,
+	          scan_data_size - sizeof( pff_recover_checkpoint_offsets_index_value_t ),
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read data of a checkpoint with a corrupted checksum
+	 */
+	scan_data[ scan_data_size - 1 ] ^= 0x01;
+
+	result = libpff_recover_checkpoint_read_data(
+	          checkpoint,
+	          descriptors_index,
+	          offsets_index,
+	          NULL,
+	          scan_data,
+	          scan_data_size,
+	          &error );
+
+	scan_data[ scan_data_size - 1 ] ^= 0x01;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_INPUT,
+	          LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The failed reads must not have added recovered index values
+	 */
+	result = libcdata_btree_get_number_of_values(
+	          descriptors_index->recovered_index_values_tree,
+	          &number_of_values,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_recover_checkpoint_read_data(
+	          NULL,
+	          descriptors_index,
+	          offsets_index,
+	          NULL,
+	          scan_data,
+	          scan_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_recover_checkpoint_read_data(
+	          checkpoint,
+	          NULL,
+	          offsets_index,
+	          NULL,
+	          scan_data,
+	          scan_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_recover_checkpoint_read_data(
+	          checkpoint,
+	          descriptors_index,
+	          NULL,
+	          NULL,
+	          scan_data,
+	          scan_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libpff_recover_checkpoint_read_data(
+	          checkpoint,
+	          descriptors_index,
+	          offsets_index,
+	          NULL,
+	          NULL,
+	          scan_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libpff_recover_checkpoint_free(
+	          &checkpoint,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &recovered_item_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libpff_item_tree_node_free_recovered,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_offsets_index_free(
+	          &offsets_index,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libpff_descriptors_index_free(
+	          &descriptors_index,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 scan_data );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( checkpoint != NULL )
+	{
+		libpff_recover_checkpoint_free(
+		 &checkpoint,
+		 NULL );
+	}
+	if( recovered_item_array != NULL )
+	{
+		libcdata_array_free(
+		 &recovered_item_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libpff_item_tree_node_free_recovered,
+		 NULL );
+	}
+	if( offsets_index != NULL )
+	{
+		libpff_offsets_index_free(
+		 &offsets_index,
+		 NULL );
+	}
+	if( descriptors_index != NULL )
+	{
+		libpff_descriptors_index_free(
+		 &descriptors_index,
+		 NULL );
+	}
+	if( scan_data != NULL )
+	{
+		memory_free(
+		 scan_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Reads a checkpoint from checkpoint files that contain the test data
+ * Returns 1 if successful, 0 if no checkpoint was stored or -1 on error
+ */
+int pff_test_recover_checkpoint_read_from_memory(
+     uint8_t *data,
+     size_t data_size,
+     uint8_t *alternate_data,
+     size_t alternate_data_size,
+     int *file_io_handle_index,
+     uint32_t *sequence_number,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *alternate_file_io_handle    = NULL;
+	libbfio_handle_t *file_io_handle              = NULL;
+	libpff_descriptors_index_t *descriptors_index = NULL;
+	libpff_offsets_index_t *offsets_index         = NULL;
+	libpff_recover_checkpoint_t *checkpoint       = NULL;
+	int result                                    = 0;
+
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( alternate_data != NULL )
+	{
+		if( libbfio_memory_range_initialize(
+		     &alternate_file_io_handle,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libbfio_memory_range_set(
+		     alternate_file_io_handle,
+		     alternate_data,
+		     alternate_data_size,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( pff_test_recover_checkpoint_initialize_indexes(
+	     &descriptors_index,
+	     &offsets_index,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libpff_recover_checkpoint_initialize(
+	     &checkpoint,
+	     file_io_handle,
+	     alternate_file_io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	result = libpff_recover_checkpoint_read(
+	          checkpoint,
+	          descriptors_index,
+	          offsets_index,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	*file_io_handle_index = checkpoint->file_io_handle_index;
+	*sequence_number      = checkpoint->sequence_number;
+
+	if( libpff_recover_checkpoint_free(
+	     &checkpoint,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libpff_offsets_index_free(
+	     &offsets_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libpff_descriptors_index_free(
+	     &descriptors_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( alternate_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &alternate_file_io_handle,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( checkpoint != NULL )
+	{
+		libpff_recover_checkpoint_free(
+		 &checkpoint,
+		 NULL );
+	}
+	if( offsets_index != NULL )
+	{
+		libpff_offsets_index_free(
+		 &offsets_index,
+		 NULL );
+	}
+	if( descriptors_index != NULL )
+	{
+		libpff_descriptors_index_free(
+		 &descriptors_index,
+		 NULL );
+	}
+	if( alternate_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &alternate_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libpff_recover_checkpoint_read function
+ * Returns 1 if successful or 0 if not
+ */
+int pff_test_recover_checkpoint_read(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	uint8_t *alternate_data    = NULL;
+	uint8_t *data              = NULL;
+	uint8_t *wrapped_data      = NULL;
+	size_t alternate_data_size = 0;
+	size_t data_size           = 0;
+	size_t wrapped_data_size   = 0;
+	uint32_t sequence_number   = 0;
+	int file_io_handle_index   = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = pff_test_recover_checkpoint_initialize_data(
+	          0,
+	          1,
+	          &data,
+	          &data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_recover_checkpoint_initialize_data(
+	          0,
+	          2,
+	          &alternate_data,
+	          &alternate_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = pff_test_recover_checkpoint_read_from_memory(
+	          data,
+	          data_size,
+	          NULL,
+	          0,
+	          &file_io_handle_index,
+	          &sequence_number,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "file_io_handle_index",
+	 file_io_handle_index,
+	 0 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT32(
+	 "sequence_number",
+	 sequence_number,
+	 (uint32_t) 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read with the most recent checkpoint in the alternate file
+	 */
+	result = pff_test_recover_checkpoint_read_from_memory(
+	          data,
+	          data_size,
+	          alternate_data,
+	          alternate_data_size,
+	          &file_io_handle_index,
+	          &sequence_number,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "file_io_handle_index",
+	 file_io_handle_index,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT32(
+	 "sequence_number",
+	 sequence_number,
+	 (uint32_t) 2 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read with the most recent checkpoint in the checkpoint file
+	 */
+	result = pff_test_recover_checkpoint_read_from_memory(
+	          alternate_data,
+	          alternate_data_size,
+	          data,
+	          data_size,
+	          &file_io_handle_index,
+	          &sequence_number,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "file_io_handle_index",
+	 file_io_handle_index,
+	 0 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT32(
+	 "sequence_number",
+	 sequence_number,
+	 (uint32_t) 2 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read with a sequence number that wrapped around
+	 */
+	result = pff_test_recover_checkpoint_initialize_data(
+	          0,
+	          0xffffffffUL,
+	          &wrapped_data,
+	          &wrapped_data_size,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = pff_test_recover_checkpoint_read_from_memory(
+	          wrapped_data,
+	          wrapped_data_size,
+	          data,
+	          data_size,
+	          &file_io_handle_index,
+	          &sequence_number,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "file_io_handle_index",
+	 file_io_handle_index,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT32(
+	 "sequence_number",
+	 sequence_number,
+	 (uint32_t) 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 wrapped_data );
+
+	wrapped_data = NULL;
+
+	/* Test read with an interrupted write of the most recent checkpoint
+	 */
+	result = pff_test_recover_checkpoint_read_from_memory(
+	          data,
+	          data_size,
+	          alternate_data,
+	          alternate_data_size - 1,
+	          &file_io_handle_index,
+	          &sequence_number,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "file_io_handle_index",
+	 file_io_handle_index,
+	 0 );
+
+	PFF_TEST_ASSERT_EQUAL_UINT32(
+	 "sequence_number",
+	 sequence_number,
+	 (uint32_t) 1 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	alternate_data[ alternate_data_size - 1 ] ^= 0x01;
+
+	result = pff_test_recover_checkpoint_read_from_memory(
+	          data,
+	          data_size,
+	          alternate_data,
+	          alternate_data_size,
+	          &file_io_handle_index,
+	          &sequence_number,
+	          &error );
+
+	alternate_data[ alternate_data_size - 1 ] ^= 0x01;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "file_io_handle_index",
+	 file_io_handle_index,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read with an empty checkpoint file
+	 */
+	result = pff_test_recover_checkpoint_read_from_memory(
+	          data,
+	          0,
+	          NULL,
+	          0,
+	          &file_io_handle_index,
+	          &sequence_number,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	PFF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libpff_recover_checkpoint_read(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read with a corrupted checkpoint and without an alternate checkpoint
+	 */
+	data[ data_size - 1 ] ^= 0x01;
+
+	result = pff_test_recover_checkpoint_read_from_memory(
+	          data,
+	          data_size,
+	          NULL,
+	          0,
+	          &file_io_handle_index,
+	          &sequence_number,
+	          &error );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_INPUT,
+	          LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH );
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test read with a corrupted checkpoint and a truncated alternate checkpoint
+	 */
+	result = pff_test_recover_checkpoint_read_from_memory(
+	          data,
+	          data_size,
+	          alternate_data,
+	          sizeof( pff_recover_checkpoint_header_t ) - 1,
+	          &file_io_handle_index,
+	          &sequence_number,
+	          &error );
+
+	data[ data_size - 1 ] ^= 0x01;
+
+	PFF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	PFF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 alternate_data );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( wrapped_data != NULL )
+	{
+		memory_free(
+		 wrapped_data );
+	}
+	if( alternate_data != NULL )
+	{
+		memory_free(
+		 alternate_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc PFF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] PFF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc PFF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] PFF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	PFF_TEST_UNREFERENCED_PARAMETER( argc )
+	PFF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+	PFF_TEST_RUN(
+	 "libpff_recover_checkpoint_initialize",
+	 pff_test_recover_checkpoint_initialize );
+
+	PFF_TEST_RUN(
+	 "libpff_recover_checkpoint_free",
+	 pff_test_recover_checkpoint_free );
+
+	/* TODO: add tests for libpff_recover_checkpoint_set_file_parameters */
+
+	/* TODO: add tests for libpff_recover_checkpoint_set_scan_parameters */
+
+	/* TODO: add tests for libpff_recover_checkpoint_update */
+
+	/* TODO: add tests for libpff_recover_checkpoint_read_file */
+
+	PFF_TEST_RUN(
+	 "libpff_recover_checkpoint_read",
+	 pff_test_recover_checkpoint_read );
+
+	PFF_TEST_RUN(
+	 "libpff_recover_checkpoint_check_data",
+	 pff_test_recover_checkpoint_check_data );
+
+	PFF_TEST_RUN(
+	 "libpff_recover_checkpoint_read_data",
+	 pff_test_recover_checkpoint_read_data );
+
+	/* TODO: add tests for libpff_recover_checkpoint_write */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBPFF_DLL_IMPORT ) */
+}
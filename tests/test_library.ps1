@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "allocation_table attached_file_io_handle attachment bit_stream block_descriptor block_tree block_tree_node checksum column_definition compression data_array data_array_entry data_block deflate descriptors_index encryption error file_header folder free_map huffman_tree index index_node index_value io_handle item item_descriptor item_tree item_values local_descriptor_value local_descriptors local_descriptors_node local_descriptors_tree mapi_value message multi_value name_to_id_map_entry notify offsets_index record_entry record_set reference_descriptor table table_block_index table_header table_index_value value_type"
+$LibraryTests = "allocation_bitmap allocation_table attached_file_io_handle attachment bit_stream block_descriptor block_tree block_tree_node bloom_filter buffer_pool checksum column_definition compression data_array data_array_entry data_block deflate deflate_context descriptor_data_stream descriptors_index encryption error file_header folder free_map huffman_tree index index_node index_value index_value_set io_handle item item_descriptor item_tree item_values local_descriptor_value local_descriptors local_descriptors_node local_descriptors_tree lzfu mapi_value message message_body_stream multi_value name_to_id_map_entry notify offsets_index record_entry record_set recover recover_checkpoint reference_descriptor table table_block_index table_header table_index_value value_type"
 $LibraryTestsWithInput = "file read_items support"
 $OptionSets = "" -split " "
 